@@ -0,0 +1,163 @@
+#include "orteaf/internal/execution/allocator/lowlevel/hierarchical_slot_allocator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "benchmarks/internal/execution/allocator/testing/allocation_workload.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_heap_ops.h"
+#include "orteaf/internal/execution/execution.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+using ::orteaf::benchmarks::allocator::LatencySampler;
+using ::orteaf::benchmarks::allocator::tensorSizeDistribution;
+using CpuHeapOps = ::orteaf::internal::execution::cpu::resource::CpuHeapOps;
+using Allocator =
+    policies::HierarchicalSlotAllocator<CpuHeapOps,
+                                        ::orteaf::internal::execution::
+                                            Execution::Cpu>;
+using BufferView = Allocator::BufferView;
+
+constexpr std::size_t kKiB = 1024;
+constexpr std::size_t kMiB = 1024 * kKiB;
+
+// The top level covers the largest tensor size, so allocate() can serve every
+// request of the mix (at the cost of a whole top-level slot for large ones).
+Allocator &sharedAllocator() {
+  struct Holder {
+    Holder() {
+      Allocator::Config cfg{};
+      cfg.levels = {16 * kMiB, 1 * kMiB, 64 * kKiB, 4 * kKiB};
+      cfg.initial_bytes = 64 * kMiB;
+      cfg.expand_bytes = 64 * kMiB;
+      allocator.initialize(cfg, &heap_ops);
+    }
+    CpuHeapOps heap_ops;
+    Allocator allocator;
+  };
+  static Holder holder;
+  return holder.allocator;
+}
+
+// Single-slot path: one slot of the smallest fitting level.
+void BM_Allocate(benchmark::State &state) {
+  Allocator &allocator = sharedAllocator();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  LatencySampler alloc_latency;
+  LatencySampler free_latency;
+
+  for (auto _ : state) {
+    BufferView view{};
+    alloc_latency.run([&] { view = allocator.allocate(size); });
+    benchmark::DoNotOptimize(view.data());
+    free_latency.run([&] { allocator.deallocate(view); });
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  alloc_latency.report(state, "alloc");
+  free_latency.report(state, "free");
+}
+
+// Dense path: a contiguous run of slots across levels sized to the request.
+void BM_AllocateDense(benchmark::State &state) {
+  Allocator &allocator = sharedAllocator();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  LatencySampler alloc_latency;
+  LatencySampler free_latency;
+
+  for (auto _ : state) {
+    BufferView view{};
+    alloc_latency.run([&] { view = allocator.allocateDense(size); });
+    benchmark::DoNotOptimize(view.data());
+    free_latency.run([&] { allocator.deallocateDense(view, size); });
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  alloc_latency.report(state, "alloc");
+  free_latency.report(state, "free");
+}
+
+// Window of live tensor-sized buffers, oldest replaced each iteration.
+template <bool kDense> void BM_TensorMix(benchmark::State &state) {
+  Allocator &allocator = sharedAllocator();
+  const auto window = static_cast<std::size_t>(state.range(0));
+  const auto sizes = tensorSizeDistribution(
+      4096, 42 + static_cast<std::uint32_t>(state.thread_index()));
+  LatencySampler alloc_latency;
+  LatencySampler free_latency;
+
+  struct Live {
+    BufferView view{};
+    std::size_t size{0};
+  };
+  std::vector<Live> live(window);
+  const auto release = [&](Live &entry) {
+    if constexpr (kDense) {
+      allocator.deallocateDense(entry.view, entry.size);
+    } else {
+      allocator.deallocate(entry.view);
+    }
+  };
+  std::size_t next_size = 0;
+  std::size_t slot = 0;
+  std::int64_t bytes = 0;
+
+  for (auto _ : state) {
+    Live &entry = live[slot];
+    if (entry.size != 0) {
+      free_latency.run([&] { release(entry); });
+    }
+    entry.size = sizes[next_size];
+    alloc_latency.run([&] {
+      entry.view = kDense ? allocator.allocateDense(entry.size)
+                          : allocator.allocate(entry.size);
+    });
+    benchmark::DoNotOptimize(entry.view.data());
+    bytes += static_cast<std::int64_t>(entry.size);
+    next_size = (next_size + 1) % sizes.size();
+    slot = (slot + 1) % window;
+  }
+
+  for (auto &entry : live) {
+    if (entry.size != 0) {
+      release(entry);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(bytes);
+  alloc_latency.report(state, "alloc");
+  free_latency.report(state, "free");
+}
+
+BENCHMARK(BM_Allocate)
+    ->Name("HierarchicalSlotAllocator/Allocate")
+    ->Arg(4 * kKiB)
+    ->Arg(48 * kKiB)
+    ->Arg(768 * kKiB)
+    ->Arg(3 * kMiB)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
+BENCHMARK(BM_AllocateDense)
+    ->Name("HierarchicalSlotAllocator/AllocateDense")
+    ->Arg(4 * kKiB)
+    ->Arg(48 * kKiB)
+    ->Arg(768 * kKiB)
+    ->Arg(3 * kMiB)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_TensorMix, false)
+    ->Name("HierarchicalSlotAllocator/Allocate/TensorMix")
+    ->Arg(16)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_TensorMix, true)
+    ->Name("HierarchicalSlotAllocator/AllocateDense/TensorMix")
+    ->Arg(16)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
+
+} // namespace
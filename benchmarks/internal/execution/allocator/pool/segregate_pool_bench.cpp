@@ -0,0 +1,169 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "benchmarks/internal/execution/allocator/testing/allocation_workload.h"
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/thread_caching_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+using ::orteaf::benchmarks::allocator::LatencySampler;
+using ::orteaf::benchmarks::allocator::tensorSizeDistribution;
+using CpuResource = ::orteaf::internal::execution::cpu::CpuResource;
+
+template <typename ThreadingPolicy>
+using CpuPool = ::orteaf::internal::execution::allocator::pool::SegregatePool<
+    CpuResource, policies::FastFreePolicy, ThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<CpuResource>,
+    policies::DirectChunkLocatorPolicy<CpuResource>,
+    policies::DeferredReusePolicy<CpuResource>,
+    policies::HostStackFreelistPolicy<CpuResource>>;
+
+using NoLockPool = CpuPool<policies::NoLockThreadingPolicy>;
+using LockingPool = CpuPool<policies::LockingThreadingPolicy>;
+using CachingPool =
+    CpuPool<policies::ThreadCachingThreadingPolicy<CpuResource>>;
+
+constexpr std::size_t kMaxBlockSize = 1024 * 1024;
+
+// One pool per policy for the whole run, so multi-threaded runs share it and
+// every run after the first measures a warm pool.
+template <typename Pool> class SharedPool {
+public:
+  static Pool &get() {
+    static SharedPool holder;
+    return holder.pool_;
+  }
+
+private:
+  SharedPool() {
+    typename Pool::Config cfg{};
+    cfg.fast_free.resource = pool_.resource();
+    cfg.threading.resource = pool_.resource();
+    cfg.large_alloc.resource = pool_.resource();
+    cfg.chunk_locator.resource = pool_.resource();
+    cfg.reuse.resource = pool_.resource();
+    cfg.freelist.resource = pool_.resource();
+    cfg.chunk_size = 16 * 1024 * 1024;
+    cfg.min_block_size = 64;
+    cfg.max_block_size = kMaxBlockSize;
+    pool_.initialize(cfg);
+  }
+  ~SharedPool() {
+    typename Pool::LaunchParams params{};
+    pool_.releaseChunk(params);
+  }
+
+  Pool pool_;
+};
+
+// Allocate and immediately free one fixed-size block per iteration.
+template <typename Pool> void BM_AllocFree(benchmark::State &state) {
+  Pool &pool = SharedPool<Pool>::get();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  typename Pool::LaunchParams params{};
+  LatencySampler alloc_latency;
+  LatencySampler free_latency;
+
+  for (auto _ : state) {
+    typename Pool::BufferResource block{};
+    alloc_latency.run([&] { block = pool.allocate(size, 0, params); });
+    benchmark::DoNotOptimize(block.view.data());
+    free_latency.run([&] { pool.deallocate(block, size, 0, params); });
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  alloc_latency.report(state, "alloc");
+  free_latency.report(state, "free");
+}
+
+// Keep a window of live buffers with tensor-like sizes and replace the oldest
+// one per iteration, so blocks are freed in a different order than allocated.
+template <typename Pool> void BM_TensorMix(benchmark::State &state) {
+  Pool &pool = SharedPool<Pool>::get();
+  const auto window = static_cast<std::size_t>(state.range(0));
+  const auto sizes = tensorSizeDistribution(
+      4096, 42 + static_cast<std::uint32_t>(state.thread_index()));
+  typename Pool::LaunchParams params{};
+  LatencySampler alloc_latency;
+  LatencySampler free_latency;
+
+  struct Live {
+    typename Pool::BufferResource block{};
+    std::size_t size{0};
+  };
+  std::vector<Live> live(window);
+  std::size_t next_size = 0;
+  std::size_t slot = 0;
+  std::int64_t bytes = 0;
+
+  for (auto _ : state) {
+    Live &entry = live[slot];
+    if (entry.size != 0) {
+      free_latency.run(
+          [&] { pool.deallocate(entry.block, entry.size, 0, params); });
+    }
+    entry.size = sizes[next_size];
+    alloc_latency.run(
+        [&] { entry.block = pool.allocate(entry.size, 0, params); });
+    benchmark::DoNotOptimize(entry.block.view.data());
+    bytes += static_cast<std::int64_t>(entry.size);
+    next_size = (next_size + 1) % sizes.size();
+    slot = (slot + 1) % window;
+  }
+
+  for (auto &entry : live) {
+    if (entry.size != 0) {
+      pool.deallocate(entry.block, entry.size, 0, params);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(bytes);
+  alloc_latency.report(state, "alloc");
+  free_latency.report(state, "free");
+}
+
+// NoLockThreadingPolicy is single-threaded by contract.
+BENCHMARK_TEMPLATE(BM_AllocFree, NoLockPool)
+    ->Name("SegregatePool/NoLock/AllocFree")
+    ->RangeMultiplier(16)
+    ->Range(64, kMaxBlockSize);
+BENCHMARK_TEMPLATE(BM_AllocFree, LockingPool)
+    ->Name("SegregatePool/Locking/AllocFree")
+    ->RangeMultiplier(16)
+    ->Range(64, kMaxBlockSize)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_AllocFree, CachingPool)
+    ->Name("SegregatePool/ThreadCaching/AllocFree")
+    ->RangeMultiplier(16)
+    ->Range(64, kMaxBlockSize)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_TensorMix, NoLockPool)
+    ->Name("SegregatePool/NoLock/TensorMix")
+    ->Arg(64);
+BENCHMARK_TEMPLATE(BM_TensorMix, LockingPool)
+    ->Name("SegregatePool/Locking/TensorMix")
+    ->Arg(64)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_TensorMix, CachingPool)
+    ->Name("SegregatePool/ThreadCaching/TensorMix")
+    ->Arg(64)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+} // namespace
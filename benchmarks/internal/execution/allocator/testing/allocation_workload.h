@@ -0,0 +1,104 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace orteaf::benchmarks::allocator {
+
+/**
+ * @brief Records the latency of every Nth timed operation and reports
+ * percentiles as benchmark counters.
+ *
+ * Timing each call with steady_clock adds tens of nanoseconds, so only a
+ * sample is timed; the rest run untimed to keep the throughput figure honest.
+ */
+class LatencySampler {
+public:
+  explicit LatencySampler(std::uint32_t period = 16) : period_(period) {
+    samples_.reserve(1 << 16);
+  }
+
+  template <typename Fn> void run(Fn &&fn) {
+    if (++tick_ < period_) {
+      fn();
+      return;
+    }
+    tick_ = 0;
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const auto end = std::chrono::steady_clock::now();
+    samples_.push_back(
+        std::chrono::duration<double, std::nano>(end - start).count());
+  }
+
+  /// Adds <prefix>_p50_ns, _p99_ns and _p999_ns (averaged over threads).
+  void report(benchmark::State &state, const std::string &prefix) {
+    if (samples_.empty()) {
+      return;
+    }
+    std::sort(samples_.begin(), samples_.end());
+    const auto at = [&](double q) {
+      const auto index = static_cast<std::size_t>(
+          q * static_cast<double>(samples_.size() - 1));
+      return samples_[index];
+    };
+    const auto avg = benchmark::Counter::kAvgThreads;
+    state.counters[prefix + "_p50_ns"] = benchmark::Counter(at(0.50), avg);
+    state.counters[prefix + "_p99_ns"] = benchmark::Counter(at(0.99), avg);
+    state.counters[prefix + "_p999_ns"] = benchmark::Counter(at(0.999), avg);
+  }
+
+private:
+  std::uint32_t period_;
+  std::uint32_t tick_{0};
+  std::vector<double> samples_{};
+};
+
+/**
+ * @brief Buffer sizes drawn from a mix typical of tensor workloads.
+ *
+ * About half the requests are small (biases, norm parameters, scalars:
+ * 64 B - 4 KiB), a third are activations (16 KiB - 1 MiB) and the rest are
+ * weight-sized (2 - 16 MiB). Sizes are log-uniform within each band and
+ * rounded to whole fp32 elements. The sequence is fixed for a given seed.
+ */
+inline std::vector<std::size_t> tensorSizeDistribution(std::size_t count,
+                                                       std::uint32_t seed) {
+  struct Band {
+    double weight;
+    double min_bytes;
+    double max_bytes;
+  };
+  static constexpr Band kBands[] = {
+      {0.50, 64.0, 4.0 * 1024},
+      {0.35, 16.0 * 1024, 1024.0 * 1024},
+      {0.15, 2.0 * 1024 * 1024, 16.0 * 1024 * 1024},
+  };
+
+  std::mt19937 rng(seed);
+  std::discrete_distribution<int> pick_band(
+      {kBands[0].weight, kBands[1].weight, kBands[2].weight});
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+  std::vector<std::size_t> sizes;
+  sizes.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const Band &band = kBands[pick_band(rng)];
+    const double log_min = std::log(band.min_bytes);
+    const double log_max = std::log(band.max_bytes);
+    const double bytes = std::exp(log_min + unit(rng) * (log_max - log_min));
+    const auto elements = static_cast<std::size_t>(bytes / 4.0);
+    sizes.push_back(std::max<std::size_t>(1, elements) * 4);
+  }
+  return sizes;
+}
+
+} // namespace orteaf::benchmarks::allocator
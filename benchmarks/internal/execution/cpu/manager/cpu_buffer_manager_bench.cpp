@@ -0,0 +1,106 @@
+#include "orteaf/internal/execution/cpu/manager/cpu_buffer_manager.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "benchmarks/internal/execution/allocator/testing/allocation_workload.h"
+#include "orteaf/internal/execution/cpu/api/cpu_execution_api.h"
+#include "orteaf/internal/execution/cpu/cpu_handles.h"
+
+namespace {
+
+namespace cpu_exec = ::orteaf::internal::execution::cpu;
+using ::orteaf::benchmarks::allocator::LatencySampler;
+using ::orteaf::benchmarks::allocator::tensorSizeDistribution;
+using CpuExecutionApi = cpu_exec::api::CpuExecutionApi;
+using CpuBufferManager = cpu_exec::manager::CpuBufferManager;
+using AllocationMode = CpuBufferManager::AllocationMode;
+
+// state.range(0) selects the allocation mode for the whole run.
+AllocationMode modeOf(const benchmark::State &state) {
+  return state.range(0) == 0 ? AllocationMode::Direct : AllocationMode::Pooled;
+}
+
+void configureManager(const benchmark::State &state) {
+  CpuExecutionApi::ExecutionManager::Config config{};
+  config.device_config.buffer_config.allocation_mode = modeOf(state);
+  CpuExecutionApi::configure(config);
+}
+
+void shutdownManager(const benchmark::State &) {
+  CpuExecutionApi::shutdown();
+}
+
+// acquire() followed by dropping the lease, which returns the buffer.
+// CpuBufferManager itself is not thread-safe, so these run single-threaded;
+// the pool's multi-threaded behaviour is covered by the SegregatePool suite.
+void BM_AcquireRelease(benchmark::State &state) {
+  auto device = CpuExecutionApi::acquireDevice(cpu_exec::CpuDeviceHandle{0});
+  auto &buffers = device->buffer_manager;
+  const auto size = static_cast<std::size_t>(state.range(1));
+  LatencySampler acquire_latency;
+  LatencySampler release_latency;
+
+  for (auto _ : state) {
+    CpuBufferManager::BufferLease lease{};
+    acquire_latency.run([&] { lease = buffers.acquire(size); });
+    benchmark::DoNotOptimize(lease.operator->());
+    release_latency.run([&] { buffers.release(lease); });
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  acquire_latency.report(state, "acquire");
+  release_latency.report(state, "release");
+}
+
+// Window of live tensor-sized buffers, oldest released each iteration.
+void BM_TensorMix(benchmark::State &state) {
+  auto device = CpuExecutionApi::acquireDevice(cpu_exec::CpuDeviceHandle{0});
+  auto &buffers = device->buffer_manager;
+  const auto window = static_cast<std::size_t>(state.range(1));
+  const auto sizes = tensorSizeDistribution(4096, 42);
+  LatencySampler acquire_latency;
+  LatencySampler release_latency;
+
+  std::vector<CpuBufferManager::BufferLease> live(window);
+  std::size_t next_size = 0;
+  std::size_t slot = 0;
+  std::int64_t bytes = 0;
+
+  for (auto _ : state) {
+    auto &lease = live[slot];
+    if (lease) {
+      release_latency.run([&] { buffers.release(lease); });
+    }
+    const std::size_t size = sizes[next_size];
+    acquire_latency.run([&] { lease = buffers.acquire(size); });
+    benchmark::DoNotOptimize(lease.operator->());
+    bytes += static_cast<std::int64_t>(size);
+    next_size = (next_size + 1) % sizes.size();
+    slot = (slot + 1) % window;
+  }
+
+  live.clear();
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(bytes);
+  acquire_latency.report(state, "acquire");
+  release_latency.report(state, "release");
+}
+
+BENCHMARK(BM_AcquireRelease)
+    ->Name("CpuBufferManager/AcquireRelease")
+    ->ArgNames({"pooled", "bytes"})
+    ->ArgsProduct({{0, 1}, {64, 4096, 256 * 1024, 4 * 1024 * 1024}})
+    ->Setup(configureManager)
+    ->Teardown(shutdownManager);
+
+BENCHMARK(BM_TensorMix)
+    ->Name("CpuBufferManager/TensorMix")
+    ->ArgNames({"pooled", "window"})
+    ->ArgsProduct({{0, 1}, {64}})
+    ->Setup(configureManager)
+    ->Teardown(shutdownManager);
+
+} // namespace
@@ -0,0 +1,123 @@
+#include "orteaf/internal/kernel/registry/kernel_registry.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "orteaf/internal/base/lru_list.h"
+#include "orteaf/internal/kernel/registry/flat_kernel_table.h"
+
+namespace {
+
+namespace registry = ::orteaf::internal::kernel::registry;
+using Key = registry::KernelRegistry::Key;
+using Entry = registry::KernelRegistry::Entry;
+
+Key makeKey(std::size_t id) {
+  return static_cast<Key>(static_cast<std::uint64_t>(id) << 12);
+}
+
+// Keys to look up, drawn from the resident set in a fixed random order so
+// the access pattern is the same for every implementation.
+std::vector<Key> hitSequence(std::size_t resident) {
+  std::mt19937 rng(42);
+  std::vector<Key> keys(4096);
+  for (auto &key : keys) {
+    key = makeKey(rng() % resident);
+  }
+  return keys;
+}
+
+// The tier layout KernelRegistry used before FlatKernelTable: a key->entry
+// map plus a key->node map feeding an intrusive LRU list. Kept here as the
+// baseline the flat table is measured against.
+class NodeBasedTier {
+public:
+  Entry **findAndTouch(Key key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    auto node_it = nodes_.find(key);
+    if (node_it != nodes_.end()) {
+      lru_.touch(node_it->second.get());
+    }
+    return &it->second;
+  }
+
+  void insertFront(Key key, Entry *entry) {
+    entries_[key] = entry;
+    auto node_it = nodes_.emplace(key, std::make_unique<Node>(key)).first;
+    lru_.pushFront(node_it->second.get());
+  }
+
+private:
+  using Node = ::orteaf::internal::base::LruNode<Key>;
+  std::unordered_map<Key, Entry *> entries_;
+  std::unordered_map<Key, std::unique_ptr<Node>> nodes_;
+  ::orteaf::internal::base::LruList<Key> lru_;
+};
+
+template <typename Tier> void runTierHits(benchmark::State &state, Tier &tier) {
+  const auto resident = static_cast<std::size_t>(state.range(0));
+  Entry entry;
+  for (std::size_t i = 0; i < resident; ++i) {
+    tier.insertFront(makeKey(i), &entry);
+  }
+  const auto keys = hitSequence(resident);
+  std::size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tier.findAndTouch(keys[next]));
+    next = (next + 1) & (keys.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Cache-tier hit: the old node-based layout.
+void BM_NodeBasedTierHit(benchmark::State &state) {
+  NodeBasedTier tier;
+  runTierHits(state, tier);
+}
+
+// Cache-tier hit: FlatKernelTable, one probe sequence.
+void BM_FlatTableHit(benchmark::State &state) {
+  registry::FlatKernelTable<Entry *> tier(
+      static_cast<std::size_t>(state.range(0)));
+  runTierHits(state, tier);
+}
+
+// End-to-end KernelRegistry::lookup() hit. state.range(1) selects the
+// concurrent (lock-free) read path.
+void BM_RegistryLookupHit(benchmark::State &state) {
+  const auto resident = static_cast<std::size_t>(state.range(0));
+  registry::KernelRegistryConfig config;
+  config.cache_capacity = resident;
+  config.main_memory_capacity = resident;
+  config.concurrent = state.range(1) != 0;
+  registry::KernelRegistry reg(config);
+  for (std::size_t i = 0; i < resident; ++i) {
+    reg.registerKernel(makeKey(i), registry::KernelRegistry::Metadata{});
+    reg.lookup(makeKey(i));
+  }
+
+  const auto keys = hitSequence(resident);
+  std::size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(reg.lookup(keys[next]));
+    next = (next + 1) & (keys.size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_NodeBasedTierHit)->Arg(8)->Arg(64)->Arg(512);
+BENCHMARK(BM_FlatTableHit)->Arg(8)->Arg(64)->Arg(512);
+BENCHMARK(BM_RegistryLookupHit)
+    ->ArgsProduct({{8, 64, 512}, {0, 1}})
+    ->ArgNames({"resident", "concurrent"});
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+#include <orteaf/internal/kernel/core/kernel_entry.h>
+#include <orteaf/internal/kernel/core/variant.h>
+#include <orteaf/internal/kernel/registry/kernel_registry.h>
+#include <orteaf/internal/ops/ops.h>
+
+namespace orteaf::extension::kernel::cpu {
+
+/**
+ * @brief Variant of the built-in CPU kernels that runs on the calling thread
+ * only, ignoring the context's worker pool.
+ *
+ * Skips the fan-out cost that dominates small problems. key_resolver never
+ * picks it; KernelAutotuner times it against the default variant per shape
+ * bucket.
+ */
+inline constexpr ::orteaf::internal::kernel::Variant kSerialVariant{1};
+
+/**
+ * @brief Register the built-in CPU op kernels.
+ *
+ * Registers Add (F32, F16, I32), Relu and MatMul (F32, F16) under every CPU
+ * architecture with the default layout, in the default variant and in
+ * kSerialVariant. Each entry's kernel
+ * base records its architecture, which selects the SIMD path at run time:
+ * Zen4 / Skylake use AVX-512, IntelCometLake uses AVX2 and CpuGeneric uses
+ * NEON on AArch64 and scalar code elsewhere. key_resolver picks the most
+ * specific architecture for the device.
+ *
+ * Requires CpuExecutionApi to be configured.
+ */
+void registerCpuKernels(
+    ::orteaf::internal::kernel::registry::KernelRegistry &registry);
+
+/**
+ * @brief Register a fused elementwise kernel under every CPU architecture.
+ *
+ * Registers @p execute for F32, F16 and I32 (F32 and F16 when @p root_op
+ * is Relu) with the key (root_op, architecture, default layout, dtype,
+ * variant::fusedElementwise(index)). key_resolver only tries the default
+ * variant, so fused kernels are looked up by their exact key and never
+ * replace the unfused kernel of @p root_op. Usually called through
+ * ops::registerFusedElementwiseKernel().
+ *
+ * @throws OutOfRange if @p index >= variant::kFusedElementwiseCount.
+ */
+void registerFusedCpuKernel(
+    ::orteaf::internal::kernel::registry::KernelRegistry &registry,
+    ::orteaf::internal::ops::Op root_op, std::uint8_t index,
+    ::orteaf::internal::kernel::core::KernelEntry::ExecuteFunc execute);
+
+} // namespace orteaf::extension::kernel::cpu
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <orteaf/internal/kernel/core/kernel_args.h>
+#include <orteaf/internal/kernel/core/kernel_entry.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
+#include <orteaf/internal/kernel/param/param_id.h>
+#include <orteaf/internal/kernel/schema/kernel_param_schema.h>
+#include <orteaf/internal/kernel/schema/kernel_storage_schema.h>
+#include <orteaf/internal/kernel/storage/operand_id.h>
+
+namespace orteaf::extension::kernel::cpu::ops {
+
+namespace kernel = ::orteaf::internal::kernel;
+
+/**
+ * @brief Storage schema for the CPU add kernel.
+ *
+ * - Input0: lhs
+ * - Input1: rhs
+ * - Output: output = lhs + alpha * rhs
+ */
+struct AddStorages : kernel::StorageSchema<AddStorages> {
+  kernel::StorageField<kernel::OperandId::Input0> lhs;
+  kernel::StorageField<kernel::OperandId::Input1> rhs;
+  kernel::StorageField<kernel::OperandId::Output> output;
+
+  ORTEAF_EXTRACT_STORAGES(lhs, rhs, output)
+};
+
+/**
+ * @brief Parameter schema for the CPU add kernel.
+ *
+ * Operand layouts are the scoped Shape/Strides/Offset params bound by
+ * DenseTensorImpl::bindAllArgs(). lhs and rhs broadcast (numpy rules) to the
+ * output shape. Alpha defaults to 1.
+ */
+struct AddParams : kernel::ParamSchema<AddParams> {
+  kernel::cpu::CpuLayoutFields<kernel::OperandId::Input0> lhs;
+  kernel::cpu::CpuLayoutFields<kernel::OperandId::Input1> rhs;
+  kernel::cpu::CpuLayoutFields<kernel::OperandId::Output> output;
+  kernel::OptionalField<kernel::ParamId::Alpha, float> alpha{1.0f};
+
+  ORTEAF_EXTRACT_FIELDS(lhs, rhs, output, alpha)
+};
+
+/**
+ * @brief Execute function for the CPU add kernel (F32 / F16 / I32).
+ *
+ * Uses the vector ops of the ISA targeted by the kernel base architecture.
+ */
+void addExecute(kernel::core::KernelEntry::KernelBaseLease &lease,
+                kernel::KernelArgs &args);
+
+/**
+ * @brief Create a KernelEntry running the CPU add kernel.
+ */
+kernel::core::KernelEntry
+createAddKernel(kernel::core::KernelEntry::CpuKernelBaseLease lease);
+
+} // namespace orteaf::extension::kernel::cpu::ops
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include <orteaf/extension/kernel/cpu/cpu_kernel_registration.h>
+#include <orteaf/internal/kernel/core/kernel_args.h>
+#include <orteaf/internal/kernel/core/kernel_entry.h>
+#include <orteaf/internal/kernel/cpu/cpu_fused_elementwise.h>
+#include <orteaf/internal/kernel/registry/kernel_registry.h>
+
+namespace orteaf::extension::kernel::cpu::ops {
+
+namespace kernel = ::orteaf::internal::kernel;
+
+/**
+ * @brief Run @p nodes as one fused CPU elementwise kernel.
+ *
+ * Operands are Input0 .. Input{n-1} (n = fusedInputCount(nodes)) and Output,
+ * each with the scoped Shape/Strides/Offset params bound by
+ * DenseTensorImpl::bindAllArgs(). Inputs broadcast (numpy rules) to the
+ * output shape. See runFusedElementwise().
+ */
+void runFusedElementwiseKernel(
+    kernel::core::KernelEntry::KernelBaseLease &lease, kernel::KernelArgs &args,
+    std::span<const kernel::cpu::FusedNode> nodes);
+
+/**
+ * @brief Execute function generated for the fused expression @p Expression.
+ *
+ * @code
+ * constexpr auto kAddReluAdd = kernel::cpu::makeFusedExpression(
+ *     kernel::cpu::fusedAdd(fusedInput(0), fusedInput(1)),
+ *     kernel::cpu::fusedRelu(fusedResult(0)),
+ *     kernel::cpu::fusedAdd(fusedResult(1), fusedInput(2)));
+ * entry.setExecute(fusedElementwiseExecute<kAddReluAdd>);
+ * @endcode
+ */
+template <auto Expression>
+void fusedElementwiseExecute(kernel::core::KernelEntry::KernelBaseLease &lease,
+                             kernel::KernelArgs &args) {
+  static_assert(Expression.valid(), "Invalid fused elementwise expression");
+  runFusedElementwiseKernel(lease, args, Expression.view());
+}
+
+/**
+ * @brief Create a KernelEntry running the fused expression @p Expression.
+ */
+template <auto Expression>
+kernel::core::KernelEntry createFusedElementwiseKernel(
+    kernel::core::KernelEntry::CpuKernelBaseLease lease) {
+  kernel::core::KernelEntry entry;
+  entry.setBase(kernel::core::KernelEntry::KernelBaseLease{std::move(lease)});
+  entry.setExecute(fusedElementwiseExecute<Expression>);
+  return entry;
+}
+
+/**
+ * @brief Register @p Expression under every CPU architecture.
+ *
+ * Keys use the expression's root op and
+ * kernel::variant::fusedElementwise(@p index); see registerFusedCpuKernel().
+ */
+template <auto Expression>
+void registerFusedElementwiseKernel(kernel::registry::KernelRegistry &registry,
+                                    std::uint8_t index) {
+  static_assert(Expression.valid(), "Invalid fused elementwise expression");
+  registerFusedCpuKernel(registry, Expression.rootOp(), index,
+                         fusedElementwiseExecute<Expression>);
+}
+
+} // namespace orteaf::extension::kernel::cpu::ops
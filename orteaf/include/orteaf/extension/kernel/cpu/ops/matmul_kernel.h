@@ -0,0 +1,79 @@
+#pragma once
+
+#include <orteaf/internal/kernel/core/kernel_args.h>
+#include <orteaf/internal/kernel/core/kernel_entry.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
+#include <orteaf/internal/kernel/schema/kernel_param_schema.h>
+#include <orteaf/internal/kernel/schema/kernel_storage_schema.h>
+#include <orteaf/internal/kernel/storage/operand_id.h>
+
+namespace orteaf::extension::kernel::cpu::ops {
+
+namespace kernel = ::orteaf::internal::kernel;
+
+/**
+ * @brief Storage schema for the CPU matmul kernel.
+ *
+ * - Input0: lhs [..., M, K]
+ * - Input1: rhs [..., K, N]
+ * - Input2: optional bias, broadcast to [..., M, N]
+ * - Output: output [..., M, N]
+ */
+struct MatMulStorages : kernel::StorageSchema<MatMulStorages> {
+  kernel::StorageField<kernel::OperandId::Input0> lhs;
+  kernel::StorageField<kernel::OperandId::Input1> rhs;
+  kernel::OptionalStorageField<kernel::OperandId::Input2> bias;
+  kernel::StorageField<kernel::OperandId::Output> output;
+
+  ORTEAF_EXTRACT_STORAGES(lhs, rhs, bias, output)
+};
+
+/**
+ * @brief Parameter schema for the CPU matmul kernel.
+ *
+ * Batch dimensions broadcast. Transposed operands are expressed through
+ * their strides (e.g. a TensorApi::transpose view), so no separate flag is
+ * needed.
+ */
+struct MatMulParams : kernel::ParamSchema<MatMulParams> {
+  kernel::cpu::CpuLayoutFields<kernel::OperandId::Input0> lhs;
+  kernel::cpu::CpuLayoutFields<kernel::OperandId::Input1> rhs;
+  kernel::OptionalScopedField<kernel::ParamId::Shape,
+                              kernel::cpu::CpuLayoutFields<
+                                  kernel::OperandId::Input2>::View,
+                              kernel::OperandId::Input2>
+      bias_shape;
+  kernel::OptionalScopedField<kernel::ParamId::Strides,
+                              kernel::cpu::CpuLayoutFields<
+                                  kernel::OperandId::Input2>::View,
+                              kernel::OperandId::Input2>
+      bias_strides;
+  kernel::OptionalScopedField<kernel::ParamId::Offset, std::int64_t,
+                              kernel::OperandId::Input2>
+      bias_offset;
+  kernel::cpu::CpuLayoutFields<kernel::OperandId::Output> output;
+
+  ORTEAF_EXTRACT_FIELDS(lhs, rhs, bias_shape, bias_strides, bias_offset,
+                        output)
+};
+
+/**
+ * @brief Execute function for the CPU matmul kernel (F32 / F16).
+ *
+ * Collects one strided product per batch entry and hands them to
+ * cpu_kernel::gemm(), which packs cache-blocked panels of lhs and rhs
+ * (reading transposed or broadcast operands in place through their strides)
+ * and runs the register-blocked micro-kernel of the kernel base ISA,
+ * accumulating in F32. Blocks are spread over the context's thread pool when
+ * one is set.
+ */
+void matmulExecute(kernel::core::KernelEntry::KernelBaseLease &lease,
+                   kernel::KernelArgs &args);
+
+/**
+ * @brief Create a KernelEntry running the CPU matmul kernel.
+ */
+kernel::core::KernelEntry
+createMatMulKernel(kernel::core::KernelEntry::CpuKernelBaseLease lease);
+
+} // namespace orteaf::extension::kernel::cpu::ops
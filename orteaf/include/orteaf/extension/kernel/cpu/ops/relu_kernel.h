@@ -0,0 +1,51 @@
+#pragma once
+
+#include <orteaf/internal/kernel/core/kernel_args.h>
+#include <orteaf/internal/kernel/core/kernel_entry.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
+#include <orteaf/internal/kernel/schema/kernel_param_schema.h>
+#include <orteaf/internal/kernel/schema/kernel_storage_schema.h>
+#include <orteaf/internal/kernel/storage/operand_id.h>
+
+namespace orteaf::extension::kernel::cpu::ops {
+
+namespace kernel = ::orteaf::internal::kernel;
+
+/**
+ * @brief Storage schema for the CPU relu kernel.
+ *
+ * - Input0: input
+ * - Output: output = max(input, 0)
+ */
+struct ReluStorages : kernel::StorageSchema<ReluStorages> {
+  kernel::StorageField<kernel::OperandId::Input0> input;
+  kernel::StorageField<kernel::OperandId::Output> output;
+
+  ORTEAF_EXTRACT_STORAGES(input, output)
+};
+
+/**
+ * @brief Parameter schema for the CPU relu kernel.
+ *
+ * Input and output must have the same shape; strides may differ.
+ */
+struct ReluParams : kernel::ParamSchema<ReluParams> {
+  kernel::cpu::CpuLayoutFields<kernel::OperandId::Input0> input;
+  kernel::cpu::CpuLayoutFields<kernel::OperandId::Output> output;
+
+  ORTEAF_EXTRACT_FIELDS(input, output)
+};
+
+/**
+ * @brief Execute function for the CPU relu kernel (F32 / F16 / I32).
+ */
+void reluExecute(kernel::core::KernelEntry::KernelBaseLease &lease,
+                 kernel::KernelArgs &args);
+
+/**
+ * @brief Create a KernelEntry running the CPU relu kernel.
+ */
+kernel::core::KernelEntry
+createReluKernel(kernel::core::KernelEntry::CpuKernelBaseLease lease);
+
+} // namespace orteaf::extension::kernel::cpu::ops
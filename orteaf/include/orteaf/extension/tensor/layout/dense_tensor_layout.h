@@ -10,6 +10,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <span>
 #include <utility>
 
@@ -217,82 +218,42 @@ public:
                              new_offset);
   }
 
+  /**
+   * @brief Reshape as a view, or throw InvalidState if the strides cannot
+   * express it (see tryReshape()).
+   */
   DenseTensorLayout reshape(std::span<const Dim> new_shape) const {
-    if (!isContiguous()) {
+    auto reshaped = tryReshape(new_shape);
+    if (!reshaped) {
       ::orteaf::internal::diagnostics::error::throwError(
           ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
-          "DenseTensorLayout reshape requires contiguous layout");
-    }
-
-    bool has_inferred = false;
-    size_type inferred_index = 0;
-    Dim known_product = 1;
-    bool has_zero = false;
-
-    for (size_type i = 0; i < new_shape.size(); ++i) {
-      const Dim dim = new_shape[i];
-      if (dim == -1) {
-        if (has_inferred) {
-          ::orteaf::internal::diagnostics::error::throwError(
-              ::orteaf::internal::diagnostics::error::OrteafErrc::
-                  InvalidParameter,
-              "DenseTensorLayout reshape only allows one inferred dimension");
-        }
-        has_inferred = true;
-        inferred_index = i;
-        continue;
-      }
-      if (dim < 0) {
-        ::orteaf::internal::diagnostics::error::throwError(
-            ::orteaf::internal::diagnostics::error::OrteafErrc::
-                InvalidParameter,
-            "DenseTensorLayout reshape dimensions must be non-negative");
-      }
-      if (dim == 0) {
-        has_zero = true;
-      } else {
-        known_product *= dim;
-      }
-    }
-
-    const Dim current = numel();
-    if (!has_inferred) {
-      const Dim expected = has_zero ? Dim{0} : known_product;
-      if (current != expected) {
-        ::orteaf::internal::diagnostics::error::throwError(
-            ::orteaf::internal::diagnostics::error::OrteafErrc::
-                InvalidParameter,
-            "DenseTensorLayout reshape element count mismatch");
-      }
-    } else {
-      if (has_zero) {
-        ::orteaf::internal::diagnostics::error::throwError(
-            ::orteaf::internal::diagnostics::error::OrteafErrc::
-                InvalidParameter,
-            "DenseTensorLayout reshape cannot infer with zero dimensions");
-      }
-      if (current == 0) {
-        ::orteaf::internal::diagnostics::error::throwError(
-            ::orteaf::internal::diagnostics::error::OrteafErrc::
-                InvalidParameter,
-            "DenseTensorLayout reshape cannot infer with zero elements");
-      }
-      if (known_product == 0 || current % known_product != 0) {
-        ::orteaf::internal::diagnostics::error::throwError(
-            ::orteaf::internal::diagnostics::error::OrteafErrc::
-                InvalidParameter,
-            "DenseTensorLayout reshape cannot infer dimension");
-      }
+          "DenseTensorLayout reshape cannot be expressed as a view of this "
+          "layout");
     }
+    return std::move(*reshaped);
+  }
 
-    Dims resolved_shape;
-    resolved_shape.assign(new_shape.begin(), new_shape.end());
-    if (has_inferred) {
-      resolved_shape[inferred_index] = current / known_product;
+  /**
+   * @brief Reshape as a view over the same elements when possible.
+   *
+   * Contiguous layouts always succeed. Otherwise every group of old
+   * dimensions that is contiguous in memory must map onto whole new
+   * dimensions (e.g. merging two sliced dimensions whose strides do not
+   * chain fails). One entry of @p new_shape may be -1 to infer it.
+   *
+   * @return The reshaped layout, or std::nullopt when the result would need
+   *         a copy (see TensorApi::contiguous()).
+   * @throws InvalidParameter if @p new_shape is malformed or its element
+   *         count does not match.
+   */
+  std::optional<DenseTensorLayout>
+  tryReshape(std::span<const Dim> new_shape) const {
+    Dims resolved_shape = resolveReshape(new_shape);
+    auto strides = viewStrides(resolved_shape);
+    if (!strides) {
+      return std::nullopt;
     }
-
-    Dims strides = makeContiguousStrides(resolved_shape);
-    return DenseTensorLayout(std::move(resolved_shape), std::move(strides),
+    return DenseTensorLayout(std::move(resolved_shape), std::move(*strides),
                              offset_.value_);
   }
 
@@ -424,6 +385,126 @@ public:
   }
 
 private:
+  Dims resolveReshape(std::span<const Dim> new_shape) const {
+    bool has_inferred = false;
+    size_type inferred_index = 0;
+    Dim known_product = 1;
+    bool has_zero = false;
+
+    for (size_type i = 0; i < new_shape.size(); ++i) {
+      const Dim dim = new_shape[i];
+      if (dim == -1) {
+        if (has_inferred) {
+          ::orteaf::internal::diagnostics::error::throwError(
+              ::orteaf::internal::diagnostics::error::OrteafErrc::
+                  InvalidParameter,
+              "DenseTensorLayout reshape only allows one inferred dimension");
+        }
+        has_inferred = true;
+        inferred_index = i;
+        continue;
+      }
+      if (dim < 0) {
+        ::orteaf::internal::diagnostics::error::throwError(
+            ::orteaf::internal::diagnostics::error::OrteafErrc::
+                InvalidParameter,
+            "DenseTensorLayout reshape dimensions must be non-negative");
+      }
+      if (dim == 0) {
+        has_zero = true;
+      } else {
+        known_product *= dim;
+      }
+    }
+
+    const Dim current = numel();
+    if (!has_inferred) {
+      const Dim expected = has_zero ? Dim{0} : known_product;
+      if (current != expected) {
+        ::orteaf::internal::diagnostics::error::throwError(
+            ::orteaf::internal::diagnostics::error::OrteafErrc::
+                InvalidParameter,
+            "DenseTensorLayout reshape element count mismatch");
+      }
+    } else {
+      if (has_zero) {
+        ::orteaf::internal::diagnostics::error::throwError(
+            ::orteaf::internal::diagnostics::error::OrteafErrc::
+                InvalidParameter,
+            "DenseTensorLayout reshape cannot infer with zero dimensions");
+      }
+      if (current == 0) {
+        ::orteaf::internal::diagnostics::error::throwError(
+            ::orteaf::internal::diagnostics::error::OrteafErrc::
+                InvalidParameter,
+            "DenseTensorLayout reshape cannot infer with zero elements");
+      }
+      if (known_product == 0 || current % known_product != 0) {
+        ::orteaf::internal::diagnostics::error::throwError(
+            ::orteaf::internal::diagnostics::error::OrteafErrc::
+                InvalidParameter,
+            "DenseTensorLayout reshape cannot infer dimension");
+      }
+    }
+
+    Dims resolved_shape;
+    resolved_shape.assign(new_shape.begin(), new_shape.end());
+    if (has_inferred) {
+      resolved_shape[inferred_index] = current / known_product;
+    }
+
+    return resolved_shape;
+  }
+
+  /// Strides that view this layout with @p new_shape (same element order),
+  /// or std::nullopt if no such strides exist.
+  std::optional<Dims> viewStrides(const Dims &new_shape) const {
+    if (isContiguous() || numel() == 0) {
+      return makeContiguousStrides(new_shape);
+    }
+
+    Dims new_strides;
+    new_strides.resize(new_shape.size());
+    const Dims &old_shape = shape_.value_;
+    const Dims &old_strides = strides_.value_;
+
+    // Walk the old dimensions from the innermost, cutting them into chunks
+    // that are contiguous in memory, and lay the new dimensions over each
+    // chunk in turn.
+    std::size_t view_index = new_shape.size();
+    Dim chunk_base_stride = old_strides[rank() - 1];
+    Dim tensor_numel = 1;
+    Dim view_numel = 1;
+    for (size_type idx = rank(); idx > 0; --idx) {
+      const size_type dim = idx - 1;
+      tensor_numel *= old_shape[dim];
+      const bool chunk_ends =
+          dim == 0 || (old_shape[dim - 1] != 1 &&
+                       old_strides[dim - 1] != tensor_numel * chunk_base_stride);
+      if (!chunk_ends) {
+        continue;
+      }
+      while (view_index > 0 && (view_numel < tensor_numel ||
+                                new_shape[view_index - 1] == 1)) {
+        new_strides[view_index - 1] = view_numel * chunk_base_stride;
+        view_numel *= new_shape[view_index - 1];
+        --view_index;
+      }
+      if (view_numel != tensor_numel) {
+        return std::nullopt;
+      }
+      if (dim > 0) {
+        chunk_base_stride = old_strides[dim - 1];
+        tensor_numel = 1;
+        view_numel = 1;
+      }
+    }
+    if (view_index != 0) {
+      return std::nullopt;
+    }
+    return new_strides;
+  }
+
   static void validateRankMatch(const Dims &shape, const Dims &strides) {
     if (shape.size() != strides.size()) {
       ::orteaf::internal::diagnostics::error::throwError(
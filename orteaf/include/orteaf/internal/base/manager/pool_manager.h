@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include <orteaf/internal/base/lease/concepts.h>
 #include <orteaf/internal/base/lease/strong_lease.h>
@@ -409,6 +410,46 @@ public:
     return payload_pool_.tryAcquireCreated();
   }
 
+  /**
+   * @brief 作成済みスロットを取得し、request に合わなければ作り直す
+   *
+   * 解放済みスロットは以前の Payload を保持したまま再利用されるため、
+   * サイズ等が request ごとに異なる Payload ではこちらを使う。
+   *
+   * @param reusable bool(const Payload&, const Request&)。false
+   * を返した場合は destroy → create で作り直す
+   * @throws InvalidState 作り直しに失敗した場合（スロットは返却される）
+   */
+  template <typename Request, typename Context, typename ReusableFn>
+  PayloadHandle acquirePayloadOrGrowAndCreate(const Request &request,
+                                              const Context &context,
+                                              ReusableFn &&reusable)
+    requires requires(PayloadPool &pool, PayloadHandle h) {
+      { pool.tryAcquireCreated() } -> std::same_as<PayloadHandle>;
+      pool.destroy(h, request, context);
+      pool.emplace(h, request, context);
+    }
+  {
+    auto handle = acquirePayloadOrGrowAndCreate(request, context);
+    const auto *payload = payload_pool_.get(handle);
+    if (payload == nullptr ||
+        std::forward<ReusableFn>(reusable)(*payload, request)) {
+      return handle;
+    }
+    Request slot_request = request;
+    if constexpr (requires { slot_request.handle = handle; }) {
+      slot_request.handle = handle;
+    }
+    payload_pool_.destroy(handle, slot_request, context);
+    if (!payload_pool_.emplace(handle, slot_request, context)) {
+      payload_pool_.release(handle);
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
+          std::string(managerName()) + " failed to create payloads");
+    }
+    return handle;
+  }
+
   /**
    * @brief 未作成スロットを予約（必要なら拡張）
    *
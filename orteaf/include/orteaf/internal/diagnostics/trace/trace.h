@@ -0,0 +1,187 @@
+#pragma once
+
+/**
+ * @file trace.h
+ * @brief Timeline recorder exporting Chrome/Perfetto Trace Event Format.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace orteaf::internal::diagnostics::trace {
+
+/**
+ * @brief One completed span ("ph":"X" in Trace Event Format).
+ *
+ * Names, categories and arg names must be string literals (or otherwise
+ * outlive the recorder); only their pointers are stored.
+ */
+struct TraceEvent {
+  const char *name{nullptr};
+  const char *category{nullptr};
+  const char *arg_name{nullptr};
+  std::uint64_t arg_value{0};
+  std::uint64_t start_ns{0};
+  std::uint64_t duration_ns{0};
+  std::uint32_t thread_id{0};
+};
+
+/**
+ * @brief Process-wide span recorder.
+ *
+ * Each thread writes into its own fixed-size ring buffer without locks or
+ * allocation (after its first event); flush() drains every buffer. When a
+ * thread produces more events than its ring holds between flushes, the
+ * oldest are overwritten and counted in dropped(). A thread's buffer is
+ * released after the thread exits and its events have been flushed or
+ * cleared. Recording is off until start(); while off, a span costs one
+ * relaxed atomic load.
+ *
+ * Example:
+ * @code
+ * TraceRecorder::start();
+ * runRequest();
+ * TraceRecorder::stop();
+ * TraceRecorder::flushToFile("trace.json");  // open in ui.perfetto.dev
+ * @endcode
+ */
+class TraceRecorder {
+public:
+  struct Config {
+    /// Ring capacity of each thread buffer; rounded up to a power of two.
+    /// Applies to buffers created after start().
+    std::size_t events_per_thread{1u << 14};
+  };
+
+  /**
+   * @brief Start recording.
+   */
+  static void start() { start(Config{}); }
+  static void start(Config config);
+
+  /**
+   * @brief Stop recording; buffered events stay until flushed.
+   */
+  static void stop() noexcept {
+    enabled_.store(false, std::memory_order_relaxed);
+  }
+
+  static bool enabled() noexcept {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Monotonic timestamp in nanoseconds.
+   */
+  static std::uint64_t now() noexcept;
+
+  /**
+   * @brief Record a completed span on the calling thread's buffer.
+   *
+   * If the thread has no buffer yet and one cannot be allocated, the span
+   * is dropped and counted in dropped().
+   */
+  static void record(const char *name, const char *category,
+                     std::uint64_t start_ns, std::uint64_t duration_ns,
+                     const char *arg_name = nullptr,
+                     std::uint64_t arg_value = 0) noexcept;
+
+  /**
+   * @brief Move every buffered event into @p out, oldest first per thread.
+   *
+   * @return Number of events appended.
+   */
+  static std::size_t flush(std::vector<TraceEvent> &out);
+
+  /**
+   * @brief Drain the buffers into a Trace Event Format JSON document.
+   */
+  static std::string flushJson();
+
+  /**
+   * @brief Write flushJson() to @p path.
+   *
+   * @return false if the file could not be written.
+   */
+  static bool flushToFile(const std::string &path);
+
+  /**
+   * @brief Events overwritten before they were flushed, or lost because
+   * their thread's buffer could not be allocated.
+   */
+  static std::uint64_t dropped();
+
+  /**
+   * @brief Per-thread buffers currently held by the recorder.
+   */
+  static std::size_t threadBufferCount();
+
+  /**
+   * @brief Discard buffered events and reset dropped().
+   */
+  static void clear();
+
+private:
+  static inline std::atomic<bool> enabled_{false};
+};
+
+/**
+ * @brief RAII span; records [construction, destruction) when tracing is on.
+ */
+class TraceSpan {
+public:
+  TraceSpan(const char *name, const char *category,
+            const char *arg_name = nullptr,
+            std::uint64_t arg_value = 0) noexcept
+      : name_(name), category_(category), arg_name_(arg_name),
+        arg_value_(arg_value),
+        start_ns_(TraceRecorder::enabled() ? TraceRecorder::now() : 0) {}
+
+  ~TraceSpan() {
+    if (start_ns_ != 0) {
+      TraceRecorder::record(name_, category_, start_ns_,
+                            TraceRecorder::now() - start_ns_, arg_name_,
+                            arg_value_);
+    }
+  }
+
+  TraceSpan(const TraceSpan &) = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+
+private:
+  const char *name_;
+  const char *category_;
+  const char *arg_name_;
+  std::uint64_t arg_value_;
+  std::uint64_t start_ns_;
+};
+
+} // namespace orteaf::internal::diagnostics::trace
+
+#define ORTEAF_TRACE_CONCAT_INNER(a, b) a##b
+#define ORTEAF_TRACE_CONCAT(a, b) ORTEAF_TRACE_CONCAT_INNER(a, b)
+
+#if ORTEAF_ENABLE_TRACE
+/**
+ * @def ORTEAF_TRACE_SPAN(name, category)
+ * @brief Trace the rest of the enclosing scope as a span.
+ */
+#define ORTEAF_TRACE_SPAN(name, category)                                      \
+  ::orteaf::internal::diagnostics::trace::TraceSpan ORTEAF_TRACE_CONCAT(       \
+      orteaf_trace_span_, __LINE__)(name, category)
+
+/**
+ * @def ORTEAF_TRACE_SPAN_ARG(name, category, arg_name, arg_value)
+ * @brief ORTEAF_TRACE_SPAN with one integer argument shown in the viewer.
+ */
+#define ORTEAF_TRACE_SPAN_ARG(name, category, arg_name, arg_value)             \
+  ::orteaf::internal::diagnostics::trace::TraceSpan ORTEAF_TRACE_CONCAT(       \
+      orteaf_trace_span_, __LINE__)(name, category, arg_name,                  \
+                                    static_cast<std::uint64_t>(arg_value))
+#else
+#define ORTEAF_TRACE_SPAN(name, category) ((void)0)
+#define ORTEAF_TRACE_SPAN_ARG(name, category, arg_name, arg_value) ((void)0)
+#endif
@@ -54,7 +54,15 @@ public:
     std::size_t threshold{0};
   };
 
+  HierarchicalSlotStorage() = default;
+  HierarchicalSlotStorage(const HierarchicalSlotStorage &) = delete;
+  HierarchicalSlotStorage &operator=(const HierarchicalSlotStorage &) = delete;
+
+  /// Returns every reserved region to HeapOps, mapped slots included.
+  ~HierarchicalSlotStorage() { releaseRegions(); }
+
   void initialize(const Config &config, HeapOps *heap_ops) {
+    releaseRegions();
     config_ = config;
     heap_ops_ = heap_ops;
 
@@ -296,6 +304,7 @@ public:
     std::size_t remaining = (bytes == 0) ? root.slot_size : bytes;
 
     HeapRegion base_region = heap_ops_->reserve(remaining);
+    regions_.push_back(base_region);
     std::size_t offset = 0;
 
     while (remaining > 0) {
@@ -318,9 +327,23 @@ public:
   }
 
 private:
+  // Hand the reservations back so HeapOps can drop its bookkeeping for them
+  // too; runs from the destructor, so failures are ignored.
+  void releaseRegions() noexcept {
+    for (const auto &region : regions_) {
+      try {
+        heap_ops_->release(region);
+      } catch (...) {
+      }
+    }
+    regions_.clear();
+  }
+
   Config config_{};
   HeapOps *heap_ops_{nullptr};
   std::vector<Layer> layers_;
+  // Regions obtained from HeapOps::reserve(), root slots are carved from.
+  std::vector<HeapRegion> regions_;
   mutable std::mutex mutex_;
 };
 
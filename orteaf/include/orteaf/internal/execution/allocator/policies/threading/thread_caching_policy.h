@@ -0,0 +1,321 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <orteaf/internal/base/heap_vector.h>
+#include <orteaf/internal/diagnostics/error/error_macros.h>
+#include <orteaf/internal/execution/allocator/policies/policy_config.h>
+
+namespace orteaf::internal::execution::allocator::policies {
+
+/**
+ * @brief Threading policy with per-thread block magazines.
+ *
+ * lock()/unlock() guard the central pool state like LockingThreadingPolicy.
+ * On top of that every thread owns one magazine (a small LIFO stack of
+ * blocks) per size class. SegregatePool serves small allocations from the
+ * calling thread's magazine and returns freed blocks to it without taking
+ * the central lock; an empty magazine is refilled with up to batch_size
+ * blocks under one lock acquisition and a full one flushes batch_size blocks
+ * back to the central free lists. A magazine is full at magazine_capacity
+ * blocks or once its blocks reach high_water_bytes, so a thread never sits
+ * on more than that much memory of one size class.
+ *
+ * When a thread exits, its magazines are handed back to the policy and its
+ * cache is unregistered; the pool returns those blocks to the central free
+ * lists through drainExited() on its next locked allocation, so threads that
+ * come and go do not strand memory.
+ */
+template <typename Resource> class ThreadCachingThreadingPolicy {
+public:
+  using BufferBlock = typename Resource::BufferBlock;
+
+  template <typename R> struct Config : PolicyConfig<R> {
+    /// Blocks a thread may cache per size class.
+    std::size_t magazine_capacity{64};
+    /// Blocks moved between a magazine and the central lists at once.
+    std::size_t batch_size{32};
+    /// Bytes a thread may cache per size class; 0 disables the byte cap.
+    std::size_t high_water_bytes{std::size_t{1} << 20};
+  };
+
+  ThreadCachingThreadingPolicy() = default;
+  ThreadCachingThreadingPolicy(const ThreadCachingThreadingPolicy &) = delete;
+  ThreadCachingThreadingPolicy &
+  operator=(const ThreadCachingThreadingPolicy &) = delete;
+  // Threads hold pointers into the registry, so the policy cannot move.
+  ThreadCachingThreadingPolicy(ThreadCachingThreadingPolicy &&) = delete;
+  ThreadCachingThreadingPolicy &
+  operator=(ThreadCachingThreadingPolicy &&) = delete;
+  ~ThreadCachingThreadingPolicy() = default;
+
+  void initialize(const Config<Resource> &config) {
+    ORTEAF_THROW_IF(config.batch_size == 0 ||
+                        config.batch_size > config.magazine_capacity,
+                    InvalidParameter,
+                    "ThreadCachingThreadingPolicy requires 0 < batch_size <= "
+                    "magazine_capacity");
+    magazine_capacity_ = config.magazine_capacity;
+    batch_size_ = config.batch_size;
+    high_water_bytes_ = config.high_water_bytes;
+  }
+
+  void lock() { mutex_.lock(); }
+  void unlock() { mutex_.unlock(); }
+
+  std::size_t batchSize() const noexcept { return batch_size_; }
+  std::size_t magazineCapacity() const noexcept { return magazine_capacity_; }
+  std::size_t highWaterBytes() const noexcept { return high_water_bytes_; }
+
+  /**
+   * @brief Pop a block the calling thread cached for @p list_index.
+   */
+  bool popCached(std::size_t list_index, BufferBlock &block) {
+    ThreadCache &cache = localCache();
+    CacheGuard guard(cache);
+    if (list_index >= cache.magazines.size() ||
+        cache.magazines[list_index].empty()) {
+      return false;
+    }
+    auto &magazine = cache.magazines[list_index];
+    block = std::move(magazine.back());
+    magazine.popBack();
+    return true;
+  }
+
+  /**
+   * @brief Cache @p block for the calling thread.
+   *
+   * @param block_size Size of the blocks of @p list_index, for the
+   *        high-water cap; 0 counts blocks only.
+   * @return false if the magazine is full; the block is not taken.
+   */
+  bool pushCached(std::size_t list_index, const BufferBlock &block,
+                  std::size_t block_size = 0) {
+    ThreadCache &cache = localCache();
+    CacheGuard guard(cache);
+    auto &magazine = cache.magazineFor(list_index);
+    if (magazine.size() >= magazine_capacity_) {
+      return false;
+    }
+    if (high_water_bytes_ != 0 &&
+        (magazine.size() + 1) * block_size > high_water_bytes_) {
+      return false;
+    }
+    magazine.pushBack(block);
+    return true;
+  }
+
+  /**
+   * @brief Remove up to @p count of the calling thread's oldest cached
+   * blocks for @p list_index, passing each to fn(block).
+   */
+  template <typename Fn>
+  std::size_t takeCached(std::size_t list_index, std::size_t count,
+                         Fn &&fn) {
+    ThreadCache &cache = localCache();
+    CacheGuard guard(cache);
+    if (list_index >= cache.magazines.size()) {
+      return 0;
+    }
+    auto &magazine = cache.magazines[list_index];
+    const std::size_t taken = count < magazine.size() ? count : magazine.size();
+    for (std::size_t i = 0; i < taken; ++i) {
+      fn(magazine[i]);
+    }
+    // The most recently freed (cache-hot) blocks stay in the magazine.
+    for (std::size_t i = taken; i < magazine.size(); ++i) {
+      magazine[i - taken] = std::move(magazine[i]);
+    }
+    magazine.resize(magazine.size() - taken);
+    return taken;
+  }
+
+  /**
+   * @brief Empty every thread's magazines, passing each block to
+   * fn(list_index, block).
+   */
+  template <typename Fn> std::size_t drainCached(Fn &&fn) {
+    std::lock_guard<std::mutex> registry_lock(registry_->mutex);
+    std::size_t drained = drainMagazines(registry_->exited, fn);
+    registry_->has_exited.store(false, std::memory_order_relaxed);
+    for (auto &cache : registry_->caches) {
+      CacheGuard guard(*cache);
+      drained += drainMagazines(cache->magazines, fn);
+    }
+    return drained;
+  }
+
+  /**
+   * @brief Empty the magazines handed back by threads that have exited,
+   * passing each block to fn(list_index, block).
+   */
+  template <typename Fn> std::size_t drainExited(Fn &&fn) {
+    if (!registry_->has_exited.load(std::memory_order_acquire)) {
+      return 0;
+    }
+    std::lock_guard<std::mutex> registry_lock(registry_->mutex);
+    registry_->has_exited.store(false, std::memory_order_relaxed);
+    return drainMagazines(registry_->exited, fn);
+  }
+
+private:
+  using Magazines = ::orteaf::internal::base::HeapVector<
+      ::orteaf::internal::base::HeapVector<BufferBlock>>;
+
+  struct ThreadCache {
+    // Held by the owning thread for each magazine operation; only
+    // drainCached() from another thread ever contends for it.
+    std::atomic<bool> busy{false};
+    Magazines magazines{};
+
+    ::orteaf::internal::base::HeapVector<BufferBlock> &
+    magazineFor(std::size_t list_index) {
+      if (list_index >= magazines.size()) {
+        magazines.resize(list_index + 1);
+      }
+      return magazines[list_index];
+    }
+  };
+
+  class CacheGuard {
+  public:
+    explicit CacheGuard(ThreadCache &cache) : cache_(cache) {
+      while (cache_.busy.exchange(true, std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+    }
+    ~CacheGuard() { cache_.busy.store(false, std::memory_order_release); }
+    CacheGuard(const CacheGuard &) = delete;
+    CacheGuard &operator=(const CacheGuard &) = delete;
+
+  private:
+    ThreadCache &cache_;
+  };
+
+  /// Thread caches of one policy; shared with the threads so a thread that
+  /// outlives the policy can tell.
+  struct Registry {
+    std::mutex mutex;
+    ::orteaf::internal::base::HeapVector<std::unique_ptr<ThreadCache>>
+        caches{};
+    // Magazines of exited threads, waiting for drainExited().
+    Magazines exited{};
+    std::atomic<bool> has_exited{false};
+
+    /// Unregister @p cache and keep its blocks in exited.
+    void retire(ThreadCache *cache) {
+      std::lock_guard<std::mutex> registry_lock(mutex);
+      for (std::size_t i = 0; i < caches.size(); ++i) {
+        if (caches[i].get() != cache) {
+          continue;
+        }
+        auto &magazines = cache->magazines;
+        // Reserve first so a failed allocation leaves the cache intact.
+        if (exited.size() < magazines.size()) {
+          exited.resize(magazines.size());
+        }
+        for (std::size_t index = 0; index < magazines.size(); ++index) {
+          exited[index].reserve(exited[index].size() +
+                                magazines[index].size());
+        }
+        for (std::size_t index = 0; index < magazines.size(); ++index) {
+          for (auto &block : magazines[index]) {
+            exited[index].pushBack(block);
+          }
+        }
+        has_exited.store(true, std::memory_order_release);
+        caches[i] = std::move(caches.back());
+        caches.popBack();
+        return;
+      }
+    }
+  };
+
+  struct LocalEntry {
+    std::uint64_t owner{0};
+    ThreadCache *cache{nullptr};
+    std::weak_ptr<Registry> registry{};
+  };
+
+  /// The calling thread's caches, one per live policy it has used; their
+  /// blocks go back to the policy when the thread exits.
+  struct LocalCaches {
+    ::orteaf::internal::base::HeapVector<LocalEntry> entries{};
+
+    ~LocalCaches() {
+      for (auto &entry : entries) {
+        if (auto registry = entry.registry.lock()) {
+          try {
+            registry->retire(entry.cache);
+          } catch (...) {
+            // The cache stays registered; drainCached() still reclaims it.
+          }
+        }
+      }
+    }
+  };
+
+  template <typename Fn>
+  static std::size_t drainMagazines(Magazines &magazines, Fn &fn) {
+    std::size_t drained = 0;
+    for (std::size_t index = 0; index < magazines.size(); ++index) {
+      auto &magazine = magazines[index];
+      for (auto &block : magazine) {
+        fn(index, block);
+      }
+      drained += magazine.size();
+      magazine.clear();
+    }
+    return drained;
+  }
+
+  static std::uint64_t nextId() noexcept {
+    static std::atomic<std::uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  ThreadCache &localCache() {
+    // Keyed by a never-reused id, so entries left behind by destroyed
+    // policies are never matched again.
+    thread_local LocalCaches local;
+    auto &entries = local.entries;
+    for (const auto &entry : entries) {
+      if (entry.owner == id_) {
+        return *entry.cache;
+      }
+    }
+    // Forget caches of policies that have been destroyed.
+    for (std::size_t i = 0; i < entries.size();) {
+      if (entries[i].registry.expired()) {
+        entries[i] = std::move(entries.back());
+        entries.popBack();
+      } else {
+        ++i;
+      }
+    }
+    ThreadCache *cache = nullptr;
+    {
+      std::lock_guard<std::mutex> registry_lock(registry_->mutex);
+      registry_->caches.pushBack(std::make_unique<ThreadCache>());
+      cache = registry_->caches.back().get();
+    }
+    entries.pushBack(LocalEntry{id_, cache, registry_});
+    return *cache;
+  }
+
+  const std::uint64_t id_{nextId()};
+  std::size_t magazine_capacity_{64};
+  std::size_t batch_size_{32};
+  std::size_t high_water_bytes_{std::size_t{1} << 20};
+  std::mutex mutex_;
+  std::shared_ptr<Registry> registry_{std::make_shared<Registry>()};
+};
+
+} // namespace orteaf::internal::execution::allocator::policies
@@ -1,7 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <mutex>
 #include <limits>
+#include <orteaf/internal/diagnostics/trace/trace.h>
 #include <orteaf/internal/execution/allocator/pool/segregate_pool_stats.h>
 #include <orteaf/internal/execution/allocator/size_class_utils.h>
 #include <orteaf/internal/execution/execution.h>
@@ -20,6 +24,15 @@ public:
   using LaunchParams = typename ExecutionResource::LaunchParams;
   using Stats = SegregatePoolStats<ExecutionType>;
 
+  /// True when ThreadingPolicy keeps per-thread block magazines (see
+  /// ThreadCachingThreadingPolicy); small blocks then bypass the lock.
+  static constexpr bool kThreadCaching =
+      requires(ThreadingPolicy &policy, std::size_t index, BufferBlock &block) {
+        { policy.popCached(index, block) } -> std::convertible_to<bool>;
+        { policy.pushCached(index, block, index) } -> std::convertible_to<bool>;
+        { policy.batchSize() } -> std::convertible_to<std::size_t>;
+      };
+
   SegregatePool() = default;
   explicit SegregatePool(ExecutionResource resource)
       : resource_(std::move(resource)) {}
@@ -107,20 +120,37 @@ public:
                           LaunchParams &launch_params) {
     if (size == 0)
       return BufferResource{};
-
-    std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+    ORTEAF_TRACE_SPAN_ARG("SegregatePool::allocate", "allocator", "size",
+                          size);
 
     if (size > max_block_size_) {
+      std::lock_guard<ThreadingPolicy> lock(threading_policy_);
       stats_.updateAlloc(size, true);
       BufferBlock block = large_alloc_policy_.allocate(size, alignment);
       return BufferResource::fromBlock(block);
     }
 
-    processPendingReuses(launch_params);
-
     const std::size_t block_size = blockSizeFor(size);
     const std::size_t list_idx = sizeClassIndex(block_size, min_block_size_);
 
+    if constexpr (kThreadCaching) {
+      BufferBlock cached{};
+      if (threading_policy_.popCached(list_idx, cached)) {
+        stats_.updateAlloc(size, false);
+        return BufferResource::fromBlock(cached);
+      }
+    }
+
+    std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+    processPendingReuses(launch_params);
+    if constexpr (kThreadCaching) {
+      // Blocks cached by threads that have exited rejoin the free lists.
+      threading_policy_.drainExited(
+          [&](std::size_t exited_idx, const BufferBlock &exited) {
+            returnToFreeList(exited_idx, exited, launch_params);
+          });
+    }
+
     BufferBlock block = free_list_policy_.pop(list_idx, launch_params);
 
     if (!block.valid()) {
@@ -132,6 +162,9 @@ public:
     }
 
     chunk_locator_policy_.incrementUsed(block.handle);
+    if constexpr (kThreadCaching) {
+      refillCache(list_idx, block_size, launch_params);
+    }
 
     stats_.updateAlloc(size, false);
     return BufferResource::fromBlock(block);
@@ -141,10 +174,11 @@ public:
                   LaunchParams &launch_params) {
     if (!block.valid() || size == 0)
       return;
-
-    std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+    ORTEAF_TRACE_SPAN_ARG("SegregatePool::deallocate", "allocator", "size",
+                          size);
 
     if (size > max_block_size_) {
+      std::lock_guard<ThreadingPolicy> lock(threading_policy_);
       large_alloc_policy_.deallocate(block.handle, size, alignment);
       stats_.updateDealloc(size);
       return;
@@ -154,6 +188,25 @@ public:
         fast_free_policy_.get_block_size(min_block_size_, size);
     const std::size_t list_idx = sizeClassIndex(block_size, min_block_size_);
 
+    // Only blocks that are already safe to reuse may skip the deferred
+    // reuse queue and go straight to the thread's magazine.
+    if constexpr (kThreadCaching) {
+      if (resource_.isCompleted(block.reuse_token)) {
+        const BufferBlock cached{block.handle, block.view};
+        if (!threading_policy_.pushCached(list_idx, cached, block_size)) {
+          flushCache(list_idx, launch_params);
+          if (!threading_policy_.pushCached(list_idx, cached, block_size)) {
+            // Even an empty magazine is over the high-water mark.
+            std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+            returnToFreeList(list_idx, cached, launch_params);
+          }
+        }
+        stats_.updateDealloc(size);
+        return;
+      }
+    }
+
+    std::lock_guard<ThreadingPolicy> lock(threading_policy_);
     chunk_locator_policy_.incrementPending(block.handle);
     reuse_policy_.scheduleForReuse(std::move(block), list_idx);
     stats_.updateDealloc(size);
@@ -172,8 +225,16 @@ public:
   }
 
   void releaseChunk(LaunchParams &launch_params) {
+    ORTEAF_TRACE_SPAN("SegregatePool::releaseChunk", "allocator");
     std::lock_guard<ThreadingPolicy> lock(threading_policy_);
 
+    if constexpr (kThreadCaching) {
+      // Cached blocks count as used; hand them back so chunks can go.
+      threading_policy_.drainCached(
+          [&](std::size_t list_idx, const BufferBlock &block) {
+            returnToFreeList(list_idx, block, launch_params);
+          });
+    }
     processPendingReuses(launch_params);
 
     while (true) {
@@ -200,8 +261,49 @@ private:
         min_block_size_);
   }
 
+  /**
+   * @brief Move up to batchSize()-1 more blocks of @p list_idx into the
+   * calling thread's magazine, stopping at its high-water mark (central
+   * lock held).
+   */
+  void refillCache(std::size_t list_idx, std::size_t block_size,
+                   LaunchParams &launch_params) {
+    for (std::size_t i = 1; i < threading_policy_.batchSize(); ++i) {
+      BufferBlock block = free_list_policy_.pop(list_idx, launch_params);
+      if (!block.valid()) {
+        return;
+      }
+      if (!threading_policy_.pushCached(list_idx, block, block_size)) {
+        free_list_policy_.push(list_idx, block, launch_params);
+        return;
+      }
+      chunk_locator_policy_.incrementUsed(block.handle);
+    }
+  }
+
+  /**
+   * @brief Return a batch of the calling thread's cached @p list_idx blocks
+   * to the central free list.
+   */
+  void flushCache(std::size_t list_idx, LaunchParams &launch_params) {
+    std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+    threading_policy_.takeCached(list_idx, threading_policy_.batchSize(),
+                                 [&](const BufferBlock &block) {
+                                   returnToFreeList(list_idx, block,
+                                                    launch_params);
+                                 });
+  }
+
+  void returnToFreeList(std::size_t list_idx, const BufferBlock &block,
+                        LaunchParams &launch_params) {
+    chunk_locator_policy_.decrementUsed(block.handle);
+    free_list_policy_.push(list_idx, block, launch_params);
+  }
+
   void expandPool(std::size_t list_idx, std::size_t block_size,
                   LaunchParams &launch_params) {
+    ORTEAF_TRACE_SPAN_ARG("SegregatePool::expandPool", "allocator",
+                          "block_size", block_size);
     const std::size_t num_blocks = (chunk_size_ + block_size - 1) / block_size;
     const std::size_t actual_chunk_size = num_blocks * block_size;
 
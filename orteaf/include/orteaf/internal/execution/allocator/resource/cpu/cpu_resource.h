@@ -2,18 +2,39 @@
 
 #include <cstddef>
 
+#include "orteaf/internal/execution/cpu/resource/cpu_buffer.h"
 #include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
 #include "orteaf/internal/execution/cpu/resource/cpu_tokens.h"
+#include "orteaf/internal/execution/execution.h"
 
 namespace orteaf::internal::execution::cpu {
 
-// CPU execution resource for direct allocation.
-// For low-level heap operations (reserve/map/unmap), use CpuHeapOps.
+// CPU execution resource for direct allocation; also (via CpuNodeResource)
+// the backing resource of the CPU SegregatePool instantiation.
+// For low-level heap operations (reserve/map/unmap), use CpuHeapOps. When
+// CpuHeapOps is configured with a huge page kind, allocations of at least its
+// huge_page_threshold (e.g. pool chunks) are served by CpuHeapOps so they get
+// the configured page size and prefault behaviour.
 class CpuResource {
 public:
     using BufferView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
+    using BufferResource = ::orteaf::internal::execution::cpu::resource::CpuBuffer;
+    using BufferBlock = ::orteaf::internal::execution::cpu::resource::CpuBufferBlock;
     using FenceToken = ::orteaf::internal::execution::cpu::resource::FenceToken;
     using ReuseToken = ::orteaf::internal::execution::cpu::resource::ReuseToken;
+    struct LaunchParams {};
+
+    // Minimum alignment of every allocation (one cache line). Pool chunks get
+    // it too, so blocks carved at multiples of a >= 64 byte block size keep it.
+    static constexpr std::size_t kDefaultAlignment = 64;
+
+    static constexpr ::orteaf::internal::execution::Execution execution_type_static() noexcept {
+        return ::orteaf::internal::execution::Execution::Cpu;
+    }
+
+    constexpr ::orteaf::internal::execution::Execution execution_type() const noexcept {
+        return execution_type_static();
+    }
 
     struct Config {};
 
@@ -23,10 +44,27 @@ public:
 
     static void deallocate(BufferView view, std::size_t size, std::size_t alignment);
 
+    // Tokens stamped by CpuCommandQueue work; empty tokens are complete.
     static bool isCompleted(const FenceToken& token);
     static bool isCompleted(const ReuseToken& token);
 
     static BufferView makeView(BufferView base, std::size_t offset, std::size_t size);
 };
 
+// CpuResource that places its allocations on one NUMA node; the CPU
+// SegregatePool instantiation uses it so each device's chunks stay local.
+// Pools call allocate() through a resource pointer, which picks this member
+// over the static CpuResource::allocate().
+class CpuNodeResource : public CpuResource {
+public:
+    void setNumaNode(int node) noexcept { numa_node_ = node; }
+    // -1 = no placement (first touch decides).
+    int numaNode() const noexcept { return numa_node_; }
+
+    BufferView allocate(std::size_t size, std::size_t alignment) const;
+
+private:
+    int numa_node_{-1};
+};
+
 }  // namespace orteaf::internal::execution::cpu
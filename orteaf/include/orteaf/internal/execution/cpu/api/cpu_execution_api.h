@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "orteaf/internal/diagnostics/error/error.h"
 #include "orteaf/internal/execution/cpu/manager/cpu_execution_manager.h"
 #include "orteaf/internal/execution/cpu/platform/cpu_slow_ops.h"
@@ -15,6 +17,11 @@ public:
   using DeviceLease =
       ::orteaf::internal::execution::cpu::manager::CpuDeviceManager::DeviceLease;
   using SlowOps = ::orteaf::internal::execution::cpu::platform::CpuSlowOps;
+  using Architecture = ::orteaf::internal::architecture::Architecture;
+  using KernelBaseLease = ::orteaf::internal::execution::cpu::manager::
+      CpuKernelBaseManager::KernelBaseLease;
+  using KernelMetadataLease = ::orteaf::internal::execution::cpu::manager::
+      CpuKernelMetadataManager::CpuKernelMetadataLease;
 
   CpuExecutionApi() = delete;
 
@@ -35,6 +42,46 @@ public:
     return device_lease;
   }
 
+  static std::shared_ptr<ExecutionManager::ThreadPool> threadPool() {
+    auto pool = manager().threadPool();
+    if (!pool) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
+          "CPU execution manager is not configured");
+    }
+    return pool;
+  }
+
+  static std::shared_ptr<ExecutionManager::ThreadPool>
+  threadPool(DeviceHandle device) {
+    auto pool = manager().threadPool(device);
+    if (!pool) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
+          "CPU execution manager is not configured");
+    }
+    return pool;
+  }
+
+  static std::shared_ptr<ExecutionManager::CommandQueue>
+  commandQueue(DeviceHandle device) {
+    auto queue = manager().commandQueue(device);
+    if (!queue) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
+          "CPU command queue is not available for the device");
+    }
+    return queue;
+  }
+
+  static KernelBaseLease acquireKernelBase(Architecture architecture) {
+    return manager().kernelBaseManager().acquire(architecture);
+  }
+
+  static KernelMetadataLease acquireKernelMetadata(Architecture architecture) {
+    return manager().kernelMetadataManager().acquire(architecture);
+  }
+
 private:
   static ExecutionManager &manager() {
     static ExecutionManager instance{};
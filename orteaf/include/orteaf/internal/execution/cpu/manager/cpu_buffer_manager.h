@@ -1,13 +1,27 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <utility>
 
 #include "orteaf/internal/base/lease/control_block/strong.h"
 #include "orteaf/internal/base/manager/pool_manager.h"
 #include "orteaf/internal/base/pool/slot_pool.h"
 #include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/diagnostics/trace/trace.h"
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/thread_caching_policy.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_resource.h"
+#include "orteaf/internal/execution/allocator/size_class_utils.h"
 #include "orteaf/internal/execution/cpu/resource/cpu_buffer.h"
 #include "orteaf/internal/execution/cpu/cpu_handles.h"
 #include "orteaf/internal/execution/cpu/platform/cpu_slow_ops.h"
@@ -17,6 +31,28 @@ namespace orteaf::internal::execution::cpu::manager {
 struct DevicePayloadPoolTraits;
 class CpuExecutionManager;
 
+// =============================================================================
+// Pooled allocation
+// =============================================================================
+
+namespace allocator_policies =
+    ::orteaf::internal::execution::allocator::policies;
+
+/**
+ * @brief Size-class pool backing CpuBufferManager in pooled mode.
+ *
+ * Per-thread magazines keep concurrent acquire/release of small buffers off
+ * the pool mutex. Chunks are placed on the owning device's NUMA node.
+ */
+using CpuBufferPool =
+    ::orteaf::internal::execution::allocator::pool::SegregatePool<
+        CpuNodeResource, allocator_policies::FastFreePolicy,
+        allocator_policies::ThreadCachingThreadingPolicy<CpuNodeResource>,
+        allocator_policies::DirectResourceLargeAllocPolicy<CpuNodeResource>,
+        allocator_policies::DirectChunkLocatorPolicy<CpuNodeResource>,
+        allocator_policies::DeferredReusePolicy<CpuNodeResource>,
+        allocator_policies::HostStackFreelistPolicy<CpuNodeResource>>;
+
 // =============================================================================
 // Payload Pool Traits
 // =============================================================================
@@ -26,6 +62,8 @@ struct BufferPayloadPoolTraits {
       ::orteaf::internal::execution::cpu::resource::CpuBuffer;
   using Handle = ::orteaf::internal::execution::cpu::CpuBufferHandle;
   using SlowOps = ::orteaf::internal::execution::cpu::platform::CpuSlowOps;
+  using BufferView =
+      ::orteaf::internal::execution::cpu::resource::CpuBufferView;
 
   struct Request {
     std::size_t size{0};
@@ -35,16 +73,28 @@ struct BufferPayloadPoolTraits {
 
   struct Context {
     SlowOps *ops{nullptr};
+    /// Non-null in pooled mode; buffers then come from this pool, not ops.
+    CpuBufferPool *pool{nullptr};
+    /// NUMA node direct-mode buffers are placed on (-1 = first touch).
+    int numa_node{-1};
   };
 
   static bool create(Payload &payload, const Request &request,
                      const Context &context) {
-    if (context.ops == nullptr || request.size == 0 ||
-        !request.handle.isValid()) {
+    if (request.size == 0 || !request.handle.isValid()) {
+      return false;
+    }
+    if (context.pool != nullptr) {
+      return createPooled(payload, request, *context.pool);
+    }
+    if (context.ops == nullptr) {
       return false;
     }
 
-    void *ptr = context.ops->allocBuffer(request.size, request.alignment);
+    void *ptr = context.numa_node >= 0
+                    ? context.ops->allocBufferOnNode(
+                          request.size, request.alignment, context.numa_node)
+                    : context.ops->allocBuffer(request.size, request.alignment);
     if (ptr == nullptr) {
       return false;
     }
@@ -62,11 +112,96 @@ struct BufferPayloadPoolTraits {
 
   static void destroy(Payload &payload, const Request &,
                       const Context &context) {
-    if (context.ops != nullptr && payload.view) {
+    if (context.pool != nullptr) {
+      destroyPooled(payload, *context.pool);
+    } else if (context.ops != nullptr && payload.view) {
+      // Direct allocations have no deferred free list; wait out queued work.
+      payload.reuse_token.wait();
       context.ops->deallocBuffer(payload.view.raw(), payload.view.size());
     }
     payload = Payload{};
   }
+
+  /**
+   * @brief Whether a released payload can serve @p request as-is.
+   *
+   * Released slots keep their buffer; it is only handed out again when the
+   * size matches exactly, the address satisfies the requested alignment and
+   * no queued work still uses it (otherwise destroy() defers the free).
+   */
+  static bool reusable(const Payload &payload, const Request &request) {
+    if (!payload.view || payload.view.size() != request.size ||
+        !payload.reuse_token.isCompleted()) {
+      return false;
+    }
+    const auto address = reinterpret_cast<std::uintptr_t>(payload.view.data());
+    return request.alignment == 0 || address % request.alignment == 0;
+  }
+
+  /**
+   * @brief Alignment every small pool block is guaranteed to have.
+   *
+   * Blocks sit at multiples of their (power-of-two) block size from a chunk
+   * base aligned to CpuResource::kDefaultAlignment.
+   */
+  static std::size_t pooledAlignment(const CpuBufferPool &pool) noexcept {
+    return std::min(pool.min_block_size(), CpuResource::kDefaultAlignment);
+  }
+
+private:
+  static bool createPooled(Payload &payload, const Request &request,
+                           CpuBufferPool &pool) {
+    Payload buffer{};
+    if (request.alignment <= pooledAlignment(pool)) {
+      CpuResource::LaunchParams params{};
+      buffer = pool.allocate(request.size, request.alignment, params);
+    } else {
+      // Over-aligned requests bypass the size classes and take a dedicated
+      // allocation from the pool's large-allocation policy.
+      std::lock_guard lock(pool.threading_policy());
+      buffer = Payload::fromBlock(
+          pool.large_alloc_policy().allocate(request.size, request.alignment));
+    }
+    if (!buffer.valid()) {
+      return false;
+    }
+    // Callers see the requested size, not the rounded block size.
+    payload.handle = buffer.handle;
+    payload.view = BufferView{buffer.view.raw(), buffer.view.offset(),
+                              request.size};
+    return true;
+  }
+
+  static void destroyPooled(Payload &payload, CpuBufferPool &pool) {
+    if (!payload.valid()) {
+      return;
+    }
+    const std::size_t size = payload.view.size();
+    const bool large = pool.large_alloc_policy().isLargeAlloc(payload.handle);
+    if (large || size > pool.max_block_size()) {
+      // Dedicated allocations are freed immediately rather than deferred.
+      payload.reuse_token.wait();
+    }
+    if (size <= pool.max_block_size() && large) {
+      std::lock_guard lock(pool.threading_policy());
+      pool.large_alloc_policy().deallocate(payload.handle, size, 0);
+      return;
+    }
+    Payload block = payload;
+    if (size <= pool.max_block_size()) {
+      // Hand the whole block back so it is reused at its full size.
+      const std::size_t min_block = pool.min_block_size();
+      const std::size_t block_size =
+          ::orteaf::internal::execution::allocator::sizeClassToBlockSize(
+              ::orteaf::internal::execution::allocator::sizeClassIndex(
+                  std::max(min_block, size), min_block),
+              min_block);
+      block.view = BufferView{payload.view.raw(), payload.view.offset(),
+                              block_size};
+    }
+    CpuResource::LaunchParams params{};
+    pool.deallocate(std::move(block), size, 0, params);
+  }
 };
 
 // =============================================================================
@@ -109,6 +244,16 @@ struct CpuBufferManagerTraits {
  *
  * Manages CPU memory buffers with pooled allocation.
  * Provides BufferLease for safe resource access with automatic cleanup.
+ *
+ * In AllocationMode::Direct every buffer is a separate CpuSlowOps
+ * allocation. In AllocationMode::Pooled buffers are carved from a
+ * CpuBufferPool (power-of-two size classes over large chunks), so
+ * steady-state acquire/release churn does not reach the system allocator.
+ *
+ * A buffer whose reuse token still has pending CpuCommandQueue work is never
+ * handed out again early: Pooled mode parks its block until the work
+ * completes, while Direct mode and dedicated pool allocations wait for it
+ * before freeing.
  */
 class CpuBufferManager {
 public:
@@ -124,7 +269,20 @@ public:
 
   using BufferLease = Core::StrongLeaseType;
 
+  using Pool = CpuBufferPool;
+
+  enum class AllocationMode : std::uint8_t {
+    Direct, ///< One CpuSlowOps::allocBuffer call per buffer.
+    Pooled, ///< Size-class blocks from a CpuBufferPool.
+  };
+
   struct Config {
+    AllocationMode allocation_mode{AllocationMode::Direct};
+    // Pool settings (Pooled mode only); block sizes must be powers of two.
+    // Requests above max_block_size get a dedicated allocation.
+    std::size_t chunk_size{16 * 1024 * 1024};
+    std::size_t min_block_size{64};
+    std::size_t max_block_size{16 * 1024 * 1024};
     // PoolManager settings
     std::size_t control_block_capacity{0};
     std::size_t control_block_block_size{0};
@@ -149,12 +307,20 @@ private:
   struct InternalConfig {
     Config public_config{};
     SlowOps *ops{nullptr};
+    /// NUMA node of the owning device (-1 = no placement).
+    int numa_node{-1};
   };
 
   void configure(const InternalConfig &config) {
     ops_ = config.ops;
+    numa_node_ = config.numa_node;
     const auto &cfg = config.public_config;
 
+    pool_.reset();
+    if (cfg.allocation_mode == AllocationMode::Pooled) {
+      pool_ = makePool(cfg, numa_node_);
+    }
+
     std::size_t payload_capacity = cfg.payload_capacity;
     if (payload_capacity == 0) {
       payload_capacity = 64;
@@ -173,8 +339,7 @@ private:
     }
 
     BufferPayloadPoolTraits::Request request{};
-    BufferPayloadPoolTraits::Context context{};
-    context.ops = ops_;
+    const auto context = makePayloadContext();
 
     Core::Builder<BufferPayloadPoolTraits::Request,
                   BufferPayloadPoolTraits::Context>{}
@@ -195,10 +360,12 @@ private:
 
 public:
 #if ORTEAF_ENABLE_TEST
-  void configureForTest(const Config &config, SlowOps *ops) {
+  void configureForTest(const Config &config, SlowOps *ops,
+                        int numa_node = -1) {
     InternalConfig internal{};
     internal.public_config = config;
     internal.ops = ops;
+    internal.numa_node = numa_node;
     configure(internal);
   }
 #endif
@@ -208,10 +375,15 @@ public:
    */
   void shutdown() {
     BufferPayloadPoolTraits::Request request{};
-    BufferPayloadPoolTraits::Context context{};
-    context.ops = ops_;
+    const auto context = makePayloadContext();
 
     core_.shutdown(request, context);
+    if (pool_) {
+      // Every block is back in the pool; return the chunks to the system.
+      CpuResource::LaunchParams params{};
+      pool_->releaseChunk(params);
+      pool_.reset();
+    }
     ops_ = nullptr;
   }
 
@@ -227,6 +399,8 @@ public:
    * @return BufferLease for the allocated buffer
    */
   BufferLease acquire(std::size_t size, std::size_t alignment = 0) {
+    ORTEAF_TRACE_SPAN_ARG("CpuBufferManager::acquire", "allocator", "size",
+                          size);
     core_.ensureConfigured();
 
     if (size == 0) {
@@ -239,10 +413,10 @@ public:
     request.size = size;
     request.alignment = alignment;
 
-    BufferPayloadPoolTraits::Context context{};
-    context.ops = ops_;
+    const auto context = makePayloadContext();
 
-    auto payload_handle = core_.acquirePayloadOrGrowAndCreate(request, context);
+    auto payload_handle = core_.acquirePayloadOrGrowAndCreate(
+        request, context, &BufferPayloadPoolTraits::reusable);
     if (!payload_handle.isValid()) {
       ::orteaf::internal::diagnostics::error::throwError(
           ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
@@ -258,8 +432,14 @@ public:
    */
   void release(BufferLease &lease) noexcept { lease.release(); }
 
+  /**
+   * @brief NUMA node buffers are placed on, or -1 for first-touch placement.
+   */
+  int numaNode() const noexcept { return numa_node_; }
+
 #if ORTEAF_ENABLE_TEST
   bool isConfiguredForTest() const noexcept { return core_.isConfigured(); }
+  const Pool *poolForTest() const noexcept { return pool_.get(); }
   std::size_t payloadPoolSizeForTest() const noexcept {
     return core_.payloadPoolSizeForTest();
   }
@@ -284,7 +464,43 @@ public:
 #endif
 
 private:
+  static std::unique_ptr<Pool> makePool(const Config &cfg, int numa_node) {
+    if (cfg.chunk_size == 0 || !std::has_single_bit(cfg.min_block_size) ||
+        !std::has_single_bit(cfg.max_block_size) ||
+        cfg.min_block_size > cfg.max_block_size) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+          "CPU buffer pool needs a non-zero chunk size and power-of-two "
+          "min/max block sizes with min <= max");
+    }
+    auto pool = std::make_unique<Pool>();
+    pool->resource()->setNumaNode(numa_node);
+    Pool::Config pool_cfg{};
+    pool_cfg.fast_free.resource = pool->resource();
+    pool_cfg.threading.resource = pool->resource();
+    pool_cfg.large_alloc.resource = pool->resource();
+    pool_cfg.chunk_locator.resource = pool->resource();
+    pool_cfg.reuse.resource = pool->resource();
+    pool_cfg.freelist.resource = pool->resource();
+    pool_cfg.chunk_size = cfg.chunk_size;
+    pool_cfg.min_block_size = cfg.min_block_size;
+    pool_cfg.max_block_size = cfg.max_block_size;
+    pool->initialize(pool_cfg);
+    return pool;
+  }
+
+  BufferPayloadPoolTraits::Context makePayloadContext() const noexcept {
+    BufferPayloadPoolTraits::Context context{};
+    context.ops = ops_;
+    context.pool = pool_.get();
+    context.numa_node = numa_node_;
+    return context;
+  }
+
   SlowOps *ops_{nullptr};
+  int numa_node_{-1};
+  // Heap-allocated so the manager stays movable (the pool holds a mutex).
+  std::unique_ptr<Pool> pool_{};
   Core core_{};
 };
 
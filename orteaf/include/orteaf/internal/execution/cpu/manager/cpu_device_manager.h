@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 #include "orteaf/internal/architecture/architecture.h"
 #include "orteaf/internal/base/lease/control_block/strong.h"
@@ -24,7 +25,9 @@ class CpuExecutionManager;
  * @brief Resource structure holding CPU device state and sub-managers.
  *
  * Similar to MpsDevicePayload, this holds the architecture information
- * and any device-specific sub-managers (e.g., buffer manager).
+ * and any device-specific sub-managers (e.g., buffer manager). On NUMA
+ * hosts each node is a device; its buffer manager places memory on the
+ * node and @c cores lists the CPUs its worker threads run on.
  */
 struct CpuDeviceResource {
   using SlowOps = ::orteaf::internal::execution::cpu::platform::CpuSlowOps;
@@ -32,6 +35,10 @@ struct CpuDeviceResource {
   ::orteaf::internal::architecture::Architecture arch{
       ::orteaf::internal::architecture::Architecture::CpuGeneric};
   bool is_alive{false};
+  /// NUMA node backing this device (-1 = no explicit placement).
+  int numa_node{-1};
+  /// CPUs local to this device (empty = not restricted).
+  std::vector<std::size_t> cores{};
   CpuBufferManager buffer_manager{};
 
   CpuDeviceResource() = default;
@@ -63,6 +70,7 @@ struct DevicePayloadPoolTraits {
   struct Context {
     SlowOps *ops{nullptr};
     CpuBufferManager::Config buffer_config{};
+    std::size_t device_count{1};
   };
 
   static bool create(Payload &payload, const Request &request,
@@ -108,7 +116,9 @@ struct CpuDeviceManagerTraits {
 /**
  * @brief CPU device manager using PoolManager pattern.
  *
- * Manages the host CPU device with the same architecture as MpsDeviceManager.
+ * Manages the host CPU devices with the same architecture as
+ * MpsDeviceManager: one device per NUMA node reported by
+ * CpuSlowOps::getDeviceCount() (a single device on UMA hosts).
  * Provides DeviceLease for safe resource access with automatic cleanup.
  */
 class CpuDeviceManager {
@@ -172,11 +182,16 @@ public:
   /**
    * @brief Acquire a lease for the specified device.
    *
-   * @param handle Device handle (must be DeviceHandle{0} for CPU)
+   * @param handle Device handle below deviceCount()
    * @return DeviceLease for the device
    */
   DeviceLease acquire(DeviceHandle handle);
 
+  /**
+   * @brief Number of CPU devices (NUMA nodes); 0 before configuration.
+   */
+  std::size_t deviceCount() const noexcept { return device_count_; }
+
 #if ORTEAF_ENABLE_TEST
   void configureForTest(const Config &config, SlowOps *ops) {
     InternalConfig internal{};
@@ -195,6 +210,7 @@ public:
 
 private:
   SlowOps *ops_{nullptr};
+  std::size_t device_count_{0};
   Core core_{};
   LifetimeRegistry lifetime_{};
 };
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "orteaf/internal/execution/cpu/manager/cpu_device_manager.h"
+#include "orteaf/internal/execution/cpu/manager/cpu_kernel_base_manager.h"
+#include "orteaf/internal/execution/cpu/manager/cpu_kernel_metadata_manager.h"
 #include "orteaf/internal/execution/cpu/platform/cpu_slow_ops.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_command_queue.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_thread_pool.h"
 
 namespace orteaf::internal::execution::cpu::manager {
 
@@ -11,7 +17,7 @@ namespace orteaf::internal::execution::cpu::manager {
  * @brief CPU execution manager that provides unified access to CPU managers.
  *
  * Similar to MpsExecutionManager, this class owns the SlowOps instance and
- * manages the lifecycle of CPU managers (device manager, buffer manager, etc.).
+ * manages the lifecycle of CPU managers (device manager, kernel managers, etc.).
  */
 class CpuExecutionManager {
   using SlowOps = ::orteaf::internal::execution::cpu::platform::CpuSlowOps;
@@ -19,6 +25,11 @@ class CpuExecutionManager {
       ::orteaf::internal::execution::cpu::platform::CpuSlowOpsImpl;
 
 public:
+  using ThreadPool = ::orteaf::internal::execution::cpu::resource::CpuThreadPool;
+  using CommandQueue =
+      ::orteaf::internal::execution::cpu::resource::CpuCommandQueue;
+  using DeviceHandle = ::orteaf::internal::execution::cpu::CpuDeviceHandle;
+
   // =========================================================================
   // Config
   // =========================================================================
@@ -29,6 +40,14 @@ public:
     SlowOps *slow_ops = nullptr;
     /// Device manager configuration
     CpuDeviceManager::Config device_config = {};
+    /// Kernel base manager configuration
+    CpuKernelBaseManager::Config kernel_base_config = {};
+    /// Kernel metadata manager configuration
+    CpuKernelMetadataManager::Config kernel_metadata_config = {};
+    /// Worker pool configuration (thread count and core pinning). On NUMA
+    /// hosts each device also gets a pool pinned to its cores, with
+    /// thread_count threads (0 = one per core).
+    ThreadPool::Config thread_pool_config = {};
   };
 
   CpuExecutionManager() = default;
@@ -50,12 +69,74 @@ public:
     return device_manager_;
   }
 
+  /**
+   * @brief Get the kernel base manager.
+   */
+  CpuKernelBaseManager &kernelBaseManager() noexcept {
+    return kernel_base_manager_;
+  }
+  const CpuKernelBaseManager &kernelBaseManager() const noexcept {
+    return kernel_base_manager_;
+  }
+
+  /**
+   * @brief Get the kernel metadata manager.
+   */
+  CpuKernelMetadataManager &kernelMetadataManager() noexcept {
+    return kernel_metadata_manager_;
+  }
+  const CpuKernelMetadataManager &kernelMetadataManager() const noexcept {
+    return kernel_metadata_manager_;
+  }
+
   /**
    * @brief Get the SlowOps instance.
    */
   SlowOps *slowOps() noexcept { return slow_ops_.get(); }
   const SlowOps *slowOps() const noexcept { return slow_ops_.get(); }
 
+  /**
+   * @brief Get the worker pool shared by CPU kernels.
+   *
+   * When every device has its own pinned pool, this is device 0's pool
+   * rather than a further set of workers competing for the same cores.
+   * Contexts keep their own reference, so the pool outlives a shutdown()
+   * that races with in-flight kernels.
+   */
+  std::shared_ptr<ThreadPool> threadPool() const noexcept {
+    return thread_pool_;
+  }
+
+  /**
+   * @brief Get the worker pool for @p device.
+   *
+   * Devices with known local cores (NUMA nodes) get a pool pinned to them,
+   * so kernels first-touch and stream memory on the device's own node;
+   * otherwise this is the shared pool.
+   */
+  std::shared_ptr<ThreadPool> threadPool(DeviceHandle device) const noexcept {
+    if (device.isValid() && device.index < device_pools_.size() &&
+        device_pools_[device.index]) {
+      return device_pools_[device.index];
+    }
+    return thread_pool_;
+  }
+
+  /**
+   * @brief Get the command queue for @p device.
+   *
+   * Every device has one in-order queue; its worker thread starts with the
+   * first submission. Returns nullptr if @p device is out of range or the
+   * manager is not configured.
+   */
+  std::shared_ptr<CommandQueue> commandQueue(DeviceHandle device) const
+      noexcept {
+    if (!device.isValid() || device.index >= command_queues_.size()) {
+      return nullptr;
+    }
+    return command_queues_[device.index];
+  }
+
   // =========================================================================
   // Lifecycle
   // =========================================================================
@@ -77,12 +158,44 @@ public:
     device_config.public_config = config.device_config;
     device_config.ops = slow_ops_.get();
     device_manager_.configure(device_config);
+
+    // Configure kernel managers
+    CpuKernelBaseManager::InternalConfig kernel_base_config{};
+    kernel_base_config.public_config = config.kernel_base_config;
+    kernel_base_manager_.configure(kernel_base_config);
+
+    CpuKernelMetadataManager::InternalConfig kernel_metadata_config{};
+    kernel_metadata_config.public_config = config.kernel_metadata_config;
+    kernel_metadata_manager_.configure(kernel_metadata_config);
+
+    configureDevicePools(config.thread_pool_config);
+    const bool every_device_pinned =
+        !device_pools_.empty() &&
+        std::all_of(device_pools_.begin(), device_pools_.end(),
+                    [](const auto &pool) { return pool != nullptr; });
+    thread_pool_ =
+        every_device_pinned
+            ? device_pools_.front()
+            : std::make_shared<ThreadPool>(config.thread_pool_config);
+
+    command_queues_.clear();
+    command_queues_.resize(device_manager_.deviceCount());
+    for (auto &queue : command_queues_) {
+      queue = std::make_shared<CommandQueue>();
+    }
   }
 
   /**
    * @brief Shutdown the CPU execution manager and release all resources.
    */
   void shutdown() {
+    // Dropped first: an unreferenced queue drains its tasks, which may still
+    // use the pools.
+    command_queues_.clear();
+    device_pools_.clear();
+    thread_pool_.reset();
+    kernel_metadata_manager_.shutdown();
+    kernel_base_manager_.shutdown();
     device_manager_.shutdown();
     slow_ops_.reset();
   }
@@ -92,15 +205,47 @@ public:
    */
   bool isConfigured() const noexcept {
 #if ORTEAF_ENABLE_TEST
-    return slow_ops_ != nullptr && device_manager_.isConfiguredForTest();
+    return slow_ops_ != nullptr && device_manager_.isConfiguredForTest() &&
+           kernel_base_manager_.isConfiguredForTest() &&
+           kernel_metadata_manager_.isConfiguredForTest();
 #else
     return slow_ops_ != nullptr;
 #endif
   }
 
 private:
+  void configureDevicePools(const ThreadPool::Config &base) {
+    device_pools_.clear();
+    const std::size_t count = device_manager_.deviceCount();
+    if (count < 2) {
+      return;
+    }
+    device_pools_.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      auto device = device_manager_.acquire(
+          DeviceHandle{static_cast<DeviceHandle::underlying_type>(i)});
+      if (device->cores.empty()) {
+        continue;
+      }
+      ThreadPool::Config pool_config = base;
+      if (pool_config.thread_count == 0) {
+        pool_config.thread_count = device->cores.size();
+      }
+      pool_config.pin_threads = true;
+      pool_config.cores = device->cores;
+      device_pools_[i] = std::make_shared<ThreadPool>(pool_config);
+    }
+  }
+
   CpuDeviceManager device_manager_{};
+  CpuKernelBaseManager kernel_base_manager_{};
+  CpuKernelMetadataManager kernel_metadata_manager_{};
   std::unique_ptr<SlowOps> slow_ops_{};
+  std::shared_ptr<ThreadPool> thread_pool_{};
+  /// Per-device pools, indexed by device; empty on single-device hosts.
+  std::vector<std::shared_ptr<ThreadPool>> device_pools_{};
+  /// One command queue per device.
+  std::vector<std::shared_ptr<CommandQueue>> command_queues_{};
 };
 
 } // namespace orteaf::internal::execution::cpu::manager
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 #include "orteaf/internal/architecture/architecture.h"
 #include "orteaf/internal/architecture/cpu_detect.h"
 #include "orteaf/internal/execution/cpu/cpu_handles.h"
 #include "orteaf/internal/execution/cpu/platform/wrapper/cpu_alloc.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
 
 namespace orteaf::internal::execution::cpu::platform {
 
@@ -29,10 +31,34 @@ struct CpuSlowOps {
   /**
    * @brief Get the number of available CPU devices.
    *
-   * Currently always returns 1 (the host CPU).
+   * One device per NUMA node; a value below 1 is treated as 1 (the host).
    */
   virtual int getDeviceCount() = 0;
 
+  /**
+   * @brief NUMA node whose memory backs @p device_id.
+   *
+   * @return Node id, or -1 when buffers need no explicit placement (the
+   * default, and the case on single-node hosts).
+   */
+  virtual int numaNodeOf(
+      [[maybe_unused]] ::orteaf::internal::execution::cpu::CpuDeviceHandle
+          device_id) {
+    return -1;
+  }
+
+  /**
+   * @brief Logical CPUs local to @p device_id.
+   *
+   * @return Core ids worker threads for the device are pinned to; empty
+   * (the default) leaves the shared worker pool in charge.
+   */
+  virtual std::vector<std::size_t> coresOf(
+      [[maybe_unused]] ::orteaf::internal::execution::cpu::CpuDeviceHandle
+          device_id) {
+    return {};
+  }
+
   /**
    * @brief Detect the CPU architecture for a given device.
    *
@@ -56,6 +82,16 @@ struct CpuSlowOps {
    */
   virtual void *allocBuffer(std::size_t size, std::size_t alignment) = 0;
 
+  /**
+   * @brief Allocate a buffer whose pages live on NUMA node @p numa_node.
+   *
+   * The default ignores the node and calls allocBuffer().
+   */
+  virtual void *allocBufferOnNode(std::size_t size, std::size_t alignment,
+                                  [[maybe_unused]] int numa_node) {
+    return allocBuffer(size, alignment);
+  }
+
   /**
    * @brief Deallocate a previously allocated buffer.
    *
@@ -72,8 +108,33 @@ struct CpuSlowOps {
  */
 struct CpuSlowOpsImpl final : public CpuSlowOps {
   int getDeviceCount() override {
-    // CPU always has exactly one device (the host)
-    return 1;
+    // One device per online NUMA node (a single device on UMA hosts).
+    return static_cast<int>(
+        ::orteaf::internal::execution::cpu::platform::wrapper::numaNodes()
+            .size());
+  }
+
+  int numaNodeOf(::orteaf::internal::execution::cpu::CpuDeviceHandle device_id)
+      override {
+    const auto nodes =
+        ::orteaf::internal::execution::cpu::platform::wrapper::numaNodes();
+    // With one node every page is local already; skip placement.
+    if (nodes.size() < 2 || !device_id.isValid() ||
+        device_id.index >= nodes.size()) {
+      return -1;
+    }
+    return nodes[device_id.index];
+  }
+
+  std::vector<std::size_t>
+  coresOf(::orteaf::internal::execution::cpu::CpuDeviceHandle device_id)
+      override {
+    const int node = numaNodeOf(device_id);
+    if (node < 0) {
+      return {};
+    }
+    return ::orteaf::internal::execution::cpu::platform::wrapper::
+        numaNodeCores(node);
   }
 
   ::orteaf::internal::architecture::Architecture detectArchitecture(
@@ -98,6 +159,17 @@ struct CpuSlowOpsImpl final : public CpuSlowOps {
     }
   }
 
+  void *allocBufferOnNode(std::size_t size, std::size_t alignment,
+                          int numa_node) override {
+    void *ptr = allocBuffer(size, alignment);
+    if (ptr != nullptr && numa_node >= 0) {
+      // Best effort: an unplaced buffer is still usable.
+      (void)::orteaf::internal::execution::cpu::platform::wrapper::
+          bindToNumaNode(ptr, size, numa_node);
+    }
+    return ptr;
+  }
+
   void deallocBuffer(void *ptr, std::size_t size) override {
     ::orteaf::internal::execution::cpu::platform::wrapper::dealloc(ptr, size);
   }
@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @file cpu_numa.h
+ * @brief NUMA topology queries and memory placement for the host CPU.
+ *
+ * Topology is read from sysfs (/sys/devices/system/node) and placement uses
+ * the mbind system call directly, so no libnuma dependency is needed. On
+ * platforms without NUMA support the host reports a single node 0 and
+ * placement requests are no-ops.
+ */
+
+#include <cstddef>
+#include <vector>
+
+namespace orteaf::internal::execution::cpu::platform::wrapper {
+
+/**
+ * @brief Online NUMA node ids in ascending order.
+ *
+ * @return At least one entry; {0} when the topology cannot be read.
+ */
+std::vector<int> numaNodes();
+
+/**
+ * @brief Logical CPUs that belong to NUMA node @p node.
+ *
+ * @return CPU ids from the node's cpulist; empty if unknown.
+ */
+std::vector<std::size_t> numaNodeCores(int node);
+
+/**
+ * @brief Place the pages of [@p ptr, @p ptr + @p size) on NUMA node @p node.
+ *
+ * Uses a preferred policy, so allocation still succeeds when the node is
+ * full, and migrates pages that were already faulted elsewhere. Only pages
+ * lying entirely inside the range are affected.
+ *
+ * @return false if the kernel rejected the request or NUMA is unsupported.
+ */
+bool bindToNumaNode(void *ptr, std::size_t size, int node) noexcept;
+
+/**
+ * @brief NUMA node holding the page at @p ptr, or -1 if unknown.
+ *
+ * The page must already be faulted in.
+ */
+int numaNodeOfAddress(const void *ptr) noexcept;
+
+} // namespace orteaf::internal::execution::cpu::platform::wrapper
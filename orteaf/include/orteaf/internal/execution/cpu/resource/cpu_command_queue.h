@@ -0,0 +1,104 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "orteaf/internal/execution/cpu/resource/cpu_tokens.h"
+
+namespace orteaf::internal::execution::cpu::resource {
+
+/**
+ * @brief In-order asynchronous stream of CPU work.
+ *
+ * submit() hands a task to the queue's worker thread and returns at once
+ * with a FenceToken for it, so the caller can prepare the next launch while
+ * this one computes. Tasks run one at a time in submission order; a task may
+ * still fan out over a CpuThreadPool.
+ *
+ * Objects that must outlive a task (e.g. storage leases it reads) are passed
+ * as @p keep_alive and released on a submitting thread once the task has
+ * completed, never on the worker, so resource managers only ever see
+ * releases from the threads that use them.
+ *
+ * The first exception thrown by a task is captured and rethrown from the
+ * next synchronize(); later tasks still run. The worker thread is started by
+ * the first submit().
+ */
+class CpuCommandQueue {
+public:
+  using Task = std::function<void()>;
+
+  CpuCommandQueue();
+  CpuCommandQueue(const CpuCommandQueue &) = delete;
+  CpuCommandQueue &operator=(const CpuCommandQueue &) = delete;
+  CpuCommandQueue(CpuCommandQueue &&) = delete;
+  CpuCommandQueue &operator=(CpuCommandQueue &&) = delete;
+  /// Runs every queued task, then stops the worker. Pending errors are
+  /// dropped.
+  ~CpuCommandQueue();
+
+  /**
+   * @brief Queue @p task and return the token that completes after it.
+   *
+   * @throws InvalidParameter if @p task is empty.
+   */
+  FenceToken submit(Task task, std::shared_ptr<const void> keep_alive = {});
+
+  /**
+   * @brief Wait for every submitted task and release their keep-alives.
+   *
+   * @throws the first exception captured from a task since the last call.
+   */
+  void synchronize();
+
+  /**
+   * @brief Release keep-alives of completed tasks without waiting.
+   * @return Number of keep-alives released.
+   */
+  std::size_t releaseCompleted();
+
+  /// @brief Token for the most recent submission (complete if none).
+  FenceToken lastToken() const;
+
+  std::uint64_t submittedEpoch() const;
+  std::uint64_t completedEpoch() const noexcept {
+    return timeline_->completed();
+  }
+
+  /// @brief Keep-alives not yet released.
+  std::size_t retainedCount() const;
+
+private:
+  struct Pending {
+    Task task;
+    std::uint64_t epoch{0};
+  };
+
+  struct Retained {
+    std::uint64_t epoch{0};
+    std::shared_ptr<const void> object;
+  };
+
+  void workerLoop();
+  void stopWorker();
+
+  std::shared_ptr<CpuQueueTimeline> timeline_;
+  mutable std::mutex mutex_{};
+  std::condition_variable work_cv_{};
+  std::deque<Pending> pending_{};
+  std::deque<Retained> retained_{};
+  std::uint64_t submitted_{0};
+  std::exception_ptr error_{};
+  bool stop_{false};
+  std::thread worker_{};
+};
+
+} // namespace orteaf::internal::execution::cpu::resource
@@ -1,26 +1,108 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 #include <orteaf/internal/execution/cpu/resource/cpu_buffer_view.h>
 #include <orteaf/internal/execution/cpu/resource/cpu_heap_region.h>
 
 namespace orteaf::internal::execution::cpu::resource {
 
+class CpuThreadPool;
+
+// Page size backing a reserved region.
+enum class CpuPageKind : std::uint8_t {
+    Base,             // System base pages (4 KiB on most targets).
+    TransparentHuge,  // Base-page mapping advised with MADV_HUGEPAGE.
+    ExplicitHuge,     // hugetlbfs pages from MAP_HUGETLB.
+};
+
+inline constexpr std::size_t kCpuPageKindCount = 3;
+
+// Process-wide page policy of CpuHeapOps.
+struct CpuHeapConfig {
+    // Page kind requested for regions of at least huge_page_threshold bytes;
+    // smaller regions always use base pages. An unavailable kind falls back
+    // to the next smaller one (ExplicitHuge -> TransparentHuge -> Base).
+    CpuPageKind page_kind{CpuPageKind::Base};
+    std::size_t huge_page_threshold{2 * 1024 * 1024};
+    // Explicit huge page size; 0 uses the system default (Hugepagesize).
+    std::size_t huge_page_size{0};
+    // Populate pages when a region is mapped so first use does not fault.
+    // Explicit huge regions are populated at reserve (MAP_POPULATE).
+    bool prefault{false};
+    // Regions at least this large are populated on prefault_pool, typically
+    // the device's worker pool (CpuExecutionApi::threadPool()). The pool is
+    // not owned; without a live pool, or if it fails, map() populates the
+    // region on the calling thread.
+    std::size_t parallel_prefault_threshold{64 * 1024 * 1024};
+    std::weak_ptr<CpuThreadPool> prefault_pool{};
+};
+
+// Totals over all regions reserved since process start.
+struct CpuHeapStats {
+    std::size_t regions[kCpuPageKindCount]{};
+    std::size_t reserved_bytes[kCpuPageKindCount]{};
+    // Regions that asked for huge pages and got a smaller kind.
+    std::size_t huge_page_fallbacks{0};
+    std::size_t prefaulted_bytes{0};
+};
+
+// One live region, as reported by CpuHeapOps::regionStats().
+struct CpuHeapRegionStats {
+    void* base{nullptr};
+    std::size_t size{0};
+    CpuPageKind kind{CpuPageKind::Base};
+    std::size_t page_size{0};
+    // Bytes currently mapped RW through map().
+    std::size_t mapped_bytes{0};
+    // Bytes the kernel backs with huge pages (AnonHugePages / *_Hugetlb in
+    // /proc/self/smaps); 0 where smaps is unavailable. Approximate when the
+    // kernel merged the mapping with a neighbouring one.
+    std::size_t huge_resident_bytes{0};
+};
+
 // Low-level heap operations for CPU execution.
-// Used by HierarchicalSlotAllocator for VA reservation and mapping.
+// Used by HierarchicalSlotAllocator for VA reservation and mapping, and by
+// CpuResource for large chunks when a huge page policy is configured.
 struct CpuHeapOps {
     using BufferView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
     using HeapRegion = ::orteaf::internal::execution::cpu::resource::CpuHeapRegion;
 
-    // VA reservation. Allocates PROT_NONE region via mmap.
+    // Set the page policy for regions reserved from now on.
+    static void configure(const CpuHeapConfig& config);
+
+    // Current page policy. Lock-free, so allocators may consult it on every
+    // allocation.
+    static CpuHeapConfig config();
+
+    // VA reservation. Allocates PROT_NONE region via mmap. Explicit huge
+    // regions are committed RW here, since hugetlb mappings can only change
+    // protection in whole huge pages. A huge page request that cannot be
+    // met falls back to base pages; throws OutOfMemory only if that fails
+    // too.
     static HeapRegion reserve(std::size_t size);
 
-    // Map reserved region to RW.
+    // Map reserved region (or a slice of one) to RW, prefaulting if configured.
     static BufferView map(HeapRegion region);
 
-    // Unmap and release the region.
+    // Decommit the region back to PROT_NONE; the VA stays reserved. Slices of
+    // explicit huge regions stay RW and only whole huge pages are dropped.
     static void unmap(HeapRegion region, std::size_t size);
+
+    // Return a region obtained from reserve() to the system.
+    // Returns false if @p region does not start a reserved region.
+    static bool release(HeapRegion region);
+
+    // Page kind of the region containing @p ptr (Base if unknown).
+    static CpuPageKind pageKindOf(const void* ptr);
+
+    static CpuHeapStats stats();
+
+    // Live regions, with huge page residency read from /proc/self/smaps.
+    static std::vector<CpuHeapRegionStats> regionStats();
 };
 
-}  // namespace orteaf::internal::execution::cpu::resource
\ No newline at end of file
+}  // namespace orteaf::internal::execution::cpu::resource
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+
+#include "orteaf/internal/architecture/architecture.h"
+#include "orteaf/internal/execution/cpu/manager/cpu_device_manager.h"
+
+namespace orteaf::internal::execution::cpu::resource {
+
+struct CpuKernelMetadata;
+
+/**
+ * @brief Kernel base structure for CPU kernels.
+ *
+ * CPU kernels have no compiled pipeline objects to cache, so the base only
+ * records the architecture the kernel implementation targets (e.g. an
+ * AVX-512 kernel registered under Zen4) and checks that the device bound to
+ * the execution context can actually run it. This mirrors
+ * MpsKernelBase::ensurePipelines() and lets CPU kernels flow through the
+ * same KernelRegistry / KernelEntry pipeline as the other backends.
+ */
+struct CpuKernelBase {
+  using MetadataType = CpuKernelMetadata;
+  using Architecture = ::orteaf::internal::architecture::Architecture;
+  using DeviceLease =
+      ::orteaf::internal::execution::cpu::manager::CpuDeviceManager::DeviceLease;
+
+  CpuKernelBase() = default;
+
+  CpuKernelBase(const CpuKernelBase &) = delete;
+  CpuKernelBase &operator=(const CpuKernelBase &) = delete;
+  CpuKernelBase(CpuKernelBase &&other) noexcept
+      : architecture_(other.architecture_),
+        configured_device_(
+            other.configured_device_.load(std::memory_order_relaxed)) {}
+  CpuKernelBase &operator=(CpuKernelBase &&other) noexcept {
+    architecture_ = other.architecture_;
+    configured_device_.store(
+        other.configured_device_.load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+    return *this;
+  }
+  ~CpuKernelBase() = default;
+
+  /**
+   * @brief Set the architecture this kernel implementation targets.
+   *
+   * Must be a CPU architecture; returns false otherwise.
+   */
+  bool setArchitecture(Architecture architecture);
+
+  /**
+   * @brief Get the architecture this kernel implementation targets.
+   */
+  Architecture architecture() const noexcept { return architecture_; }
+
+  /**
+   * @brief Check if the base was validated against the given device.
+   */
+  bool configured(::orteaf::internal::execution::cpu::CpuDeviceHandle device)
+      const noexcept {
+    return device.isValid() &&
+           configured_device_.load(std::memory_order_relaxed) == device.index;
+  }
+
+  /**
+   * @brief Ensure the kernel can run on the device bound to the lease.
+   *
+   * Returns false if the device lease is invalid or the device architecture
+   * does not derive from the kernel's target architecture.
+   *
+   * Safe to call from several threads at once: a base is shared by every
+   * entry of its architecture, and a concurrent registry runs one entry on
+   * many threads. The validated device is only a cache of a pure check, so
+   * relaxed ordering suffices.
+   */
+  bool ensureConfigured(DeviceLease &device_lease);
+
+  /**
+   * @brief Check whether a device architecture can run a kernel targeting
+   * the given architecture.
+   *
+   * A device can run kernels registered for its own architecture or for any
+   * architecture in its fallback chain (down to CpuGeneric).
+   */
+  static bool supports(Architecture device_arch, Architecture kernel_arch);
+
+  /**
+   * @brief Clear the target architecture and cached validation state.
+   */
+  void reset() noexcept {
+    architecture_ = Architecture::CpuGeneric;
+    configured_device_.store(kNotConfigured, std::memory_order_relaxed);
+  }
+
+private:
+  using DeviceIndex =
+      ::orteaf::internal::execution::cpu::CpuDeviceHandle::index_type;
+  static constexpr DeviceIndex kNotConfigured =
+      ::orteaf::internal::execution::cpu::CpuDeviceHandle::invalid_index();
+
+  Architecture architecture_{Architecture::CpuGeneric};
+  /// Index of the device last validated, or kNotConfigured.
+  std::atomic<DeviceIndex> configured_device_{kNotConfigured};
+};
+
+} // namespace orteaf::internal::execution::cpu::resource
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "orteaf/internal/architecture/architecture.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_kernel_base.h"
+
+namespace orteaf::internal::kernel::core {
+class KernelEntry;
+class KernelMetadataLease;
+}
+
+namespace orteaf::internal::execution::cpu::resource {
+
+struct CpuKernelBase;
+
+/**
+ * @brief Kernel metadata resource for CPU.
+ *
+ * Stores the target architecture for kernel reconstruction.
+ */
+struct CpuKernelMetadata {
+  using Architecture = ::orteaf::internal::architecture::Architecture;
+
+  bool initialize(Architecture architecture) {
+    reset();
+    if (::orteaf::internal::architecture::executionOf(architecture) !=
+        ::orteaf::internal::execution::Execution::Cpu) {
+      return false;
+    }
+    architecture_ = architecture;
+    return true;
+  }
+
+  void reset() noexcept { architecture_ = Architecture::CpuGeneric; }
+
+  Architecture architecture() const noexcept { return architecture_; }
+
+  void rebuildKernelEntry(
+      ::orteaf::internal::kernel::core::KernelEntry &entry) const;
+
+  static ::orteaf::internal::kernel::core::KernelMetadataLease
+  buildMetadataLeaseFromBase(
+      const ::orteaf::internal::execution::cpu::resource::CpuKernelBase &base);
+
+private:
+  Architecture architecture_{Architecture::CpuGeneric};
+};
+
+} // namespace orteaf::internal::execution::cpu::resource
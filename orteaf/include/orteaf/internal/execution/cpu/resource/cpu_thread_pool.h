@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace orteaf::internal::execution::cpu::resource {
+
+/**
+ * @brief Fork-join worker pool with per-worker work-stealing deques.
+ *
+ * parallelFor() splits a range into chunks and spreads them over the worker
+ * deques; the calling thread helps run chunks until the whole range is done,
+ * so nested parallelFor() calls from inside a worker do not deadlock. Each
+ * worker pops its own deque LIFO and steals FIFO from the others when idle.
+ *
+ * Exceptions thrown by a chunk are captured and the first one is rethrown on
+ * the calling thread once every chunk of that call has finished.
+ */
+class CpuThreadPool {
+public:
+  using Index = std::int64_t;
+
+  struct Config {
+    /// Threads that run chunks, including the calling thread
+    /// (0 = std::thread::hardware_concurrency(), 1 = run inline).
+    std::size_t thread_count{0};
+    /// Pin worker i to core (first_core + i) where the platform supports it.
+    bool pin_threads{false};
+    std::size_t first_core{0};
+    /// When non-empty (and pin_threads is set), pin worker i to
+    /// cores[i % cores.size()] instead, e.g. the CPUs of one NUMA node.
+    std::vector<std::size_t> cores{};
+  };
+
+  CpuThreadPool() : CpuThreadPool(Config{}) {}
+  explicit CpuThreadPool(const Config &config);
+  CpuThreadPool(const CpuThreadPool &) = delete;
+  CpuThreadPool &operator=(const CpuThreadPool &) = delete;
+  CpuThreadPool(CpuThreadPool &&) = delete;
+  CpuThreadPool &operator=(CpuThreadPool &&) = delete;
+
+  /**
+   * @brief Stop and join the workers.
+   *
+   * May run on one of the pool's own workers, e.g. when a task drops the
+   * last shared_ptr to the pool; that worker is detached rather than joined.
+   * Callers of parallelFor() must still keep the pool alive for the call.
+   */
+  ~CpuThreadPool();
+
+  /**
+   * @brief Number of threads that run chunks, including the caller.
+   */
+  std::size_t concurrency() const noexcept { return queues_.size() + 1; }
+
+  /**
+   * @brief Run fn(chunk_begin, chunk_end) over [begin, end).
+   *
+   * Chunks hold at least @p grain indices (except possibly the last).
+   */
+  template <typename Fn>
+  void parallelFor(Index begin, Index end, Index grain, Fn &&fn) {
+    using FnT = std::remove_reference_t<Fn>;
+    run(begin, end, grain,
+        RangeFn{const_cast<void *>(static_cast<const void *>(&fn)),
+                [](void *ctx, Index chunk_begin, Index chunk_end) {
+                  (*static_cast<FnT *>(ctx))(chunk_begin, chunk_end);
+                }});
+  }
+
+  /**
+   * @brief Reduce map(chunk_begin, chunk_end) over [begin, end).
+   *
+   * Partial results are combined with @p reduce in chunk order, so the
+   * result is deterministic for a given range, grain and concurrency.
+   */
+  template <typename T, typename Map, typename Reduce>
+  T parallelReduce(Index begin, Index end, Index grain, T identity, Map &&map,
+                   Reduce &&reduce) {
+    if (end <= begin) {
+      return identity;
+    }
+    const Index chunk = chunkSize(end - begin, grain);
+    const Index chunks = (end - begin + chunk - 1) / chunk;
+    std::vector<T> partials(static_cast<std::size_t>(chunks), identity);
+    parallelFor(Index{0}, chunks, Index{1},
+                [&](Index first, Index last) {
+                  for (Index c = first; c < last; ++c) {
+                    const Index chunk_begin = begin + c * chunk;
+                    partials[static_cast<std::size_t>(c)] =
+                        map(chunk_begin, std::min(end, chunk_begin + chunk));
+                  }
+                });
+    T result = std::move(identity);
+    for (auto &partial : partials) {
+      result = reduce(std::move(result), std::move(partial));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Index of the calling worker in this pool, or -1 if the caller is
+   * not one of its workers.
+   */
+  int currentWorkerIndex() const noexcept;
+
+private:
+  struct RangeFn {
+    void *ctx{nullptr};
+    void (*call)(void *ctx, Index begin, Index end){nullptr};
+  };
+
+  /// State shared by all chunks of one parallelFor() call.
+  struct Job {
+    RangeFn fn{};
+    std::atomic<Index> remaining{0};
+    std::mutex error_mutex{};
+    std::exception_ptr error{};
+  };
+
+  struct Task {
+    Job *job{nullptr};
+    Index begin{0};
+    Index end{0};
+  };
+
+  struct WorkerQueue {
+    std::mutex mutex{};
+    std::deque<Task> tasks{};
+  };
+
+  Index chunkSize(Index count, Index grain) const noexcept;
+  void run(Index begin, Index end, Index grain, RangeFn fn);
+  void push(std::size_t queue, Task task);
+  bool popLocal(std::size_t queue, Task &task);
+  bool steal(std::size_t thief, Task &task);
+  bool tryRunOne(int self);
+  static void execute(const Task &task);
+  void wakeWorkers() noexcept;
+  void workerLoop(std::size_t index);
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_{};
+  std::vector<std::thread> workers_{};
+  /// Bumped whenever tasks are queued or the pool stops; idle workers
+  /// block on it with std::atomic::wait().
+  std::atomic<std::uint32_t> wake_epoch_{0};
+  std::atomic<Index> queued_{0};
+  std::atomic<std::size_t> next_queue_{0};
+  std::atomic<bool> stop_{false};
+};
+
+} // namespace orteaf::internal::execution::cpu::resource
@@ -1,9 +1,133 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "orteaf/internal/base/small_vector.h"
+
 namespace orteaf::internal::execution::cpu::resource {
 
-// CPU tokens are no-ops; they exist so the allocator interface can stay consistent.
-struct FenceToken {};
-struct ReuseToken {};
+/**
+ * @brief Completion counter of one CPU command queue.
+ *
+ * The queue numbers its submissions 1, 2, ... and advances the counter as
+ * they finish in order, so epoch e is complete once completed() >= e.
+ */
+class CpuQueueTimeline {
+public:
+  std::uint64_t completed() const noexcept {
+    return completed_.load(std::memory_order_acquire);
+  }
+
+  bool reached(std::uint64_t epoch) const noexcept {
+    return completed() >= epoch;
+  }
+
+  /// @brief Block until @p epoch is complete.
+  void wait(std::uint64_t epoch) const noexcept {
+    std::uint64_t current = completed();
+    while (current < epoch) {
+      completed_.wait(current, std::memory_order_acquire);
+      current = completed();
+    }
+  }
+
+  /// @brief Mark every epoch up to @p epoch complete (queue worker only).
+  void advance(std::uint64_t epoch) noexcept {
+    completed_.store(epoch, std::memory_order_release);
+    completed_.notify_all();
+  }
+
+private:
+  std::atomic<std::uint64_t> completed_{0};
+};
+
+/**
+ * @brief Completion of one CPU command queue submission.
+ *
+ * A default-constructed token refers to no queue and is always complete, so
+ * synchronous CPU work needs no tokens at all.
+ */
+struct FenceToken {
+  std::shared_ptr<const CpuQueueTimeline> timeline{};
+  std::uint64_t epoch{0};
+
+  bool empty() const noexcept { return timeline == nullptr; }
+
+  bool isCompleted() const noexcept {
+    return timeline == nullptr || timeline->reached(epoch);
+  }
+
+  void wait() const noexcept {
+    if (timeline != nullptr) {
+      timeline->wait(epoch);
+    }
+  }
+};
+
+/**
+ * @brief Outstanding accesses to a CPU buffer, one fence per queue.
+ *
+ * Stamped on a buffer that queued work still reads or writes; the allocator
+ * keeps the memory out of circulation until every fence has completed.
+ */
+class ReuseToken {
+public:
+  static constexpr std::size_t kInlineCapacity = 2;
+
+  ReuseToken() = default;
+  explicit ReuseToken(FenceToken fence) { addOrReplace(std::move(fence)); }
+
+  bool empty() const noexcept { return fences_.empty(); }
+  std::size_t size() const noexcept { return fences_.size(); }
+
+  /**
+   * @brief Track @p fence, replacing an earlier fence of the same queue.
+   *
+   * Queues complete in submission order, so only the latest epoch per queue
+   * matters.
+   */
+  void addOrReplace(FenceToken fence) {
+    if (fence.empty()) {
+      return;
+    }
+    for (auto &existing : fences_) {
+      if (existing.timeline == fence.timeline) {
+        if (existing.epoch < fence.epoch) {
+          existing.epoch = fence.epoch;
+        }
+        return;
+      }
+    }
+    fences_.pushBack(std::move(fence));
+  }
+
+  bool isCompleted() const noexcept {
+    for (const auto &fence : fences_) {
+      if (!fence.isCompleted()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// @brief Block until every tracked fence has completed.
+  void wait() const noexcept {
+    for (const auto &fence : fences_) {
+      fence.wait();
+    }
+  }
+
+  void clear() noexcept { fences_.clear(); }
+
+  const FenceToken *begin() const noexcept { return fences_.begin(); }
+  const FenceToken *end() const noexcept { return fences_.end(); }
+
+private:
+  ::orteaf::internal::base::SmallVector<FenceToken, kInlineCapacity> fences_{};
+};
 
-}  // namespace orteaf::internal::execution::cpu::resource
\ No newline at end of file
+}  // namespace orteaf::internal::execution::cpu::resource
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <memory>
+
 #include "orteaf/internal/execution/cpu/cpu_handles.h"
 #include "orteaf/internal/execution/cpu/manager/cpu_device_manager.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_thread_pool.h"
 
 namespace orteaf::internal::execution_context::cpu {
 
@@ -9,15 +12,19 @@ class Context {
 public:
   using DeviceLease =
       ::orteaf::internal::execution::cpu::manager::CpuDeviceManager::DeviceLease;
+  using ThreadPool = ::orteaf::internal::execution::cpu::resource::CpuThreadPool;
 
   /// @brief Create an empty context with no resources.
   Context() = default;
 
-  /// @brief Create a context for the specified CPU device.
+  /// @brief Create a context for the specified CPU device and its worker
+  /// pool (pinned to the device's NUMA node where there is more than one).
   /// @param device The device handle to create the context for.
   explicit Context(::orteaf::internal::execution::cpu::CpuDeviceHandle device);
 
   DeviceLease device{};
+  /// Worker pool for parallelFor / parallelReduce (nullptr = run serially).
+  std::shared_ptr<ThreadPool> thread_pool{};
 };
 
 } // namespace orteaf::internal::execution_context::cpu
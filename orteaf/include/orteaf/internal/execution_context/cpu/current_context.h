@@ -17,4 +17,8 @@ void reset();
 const Context &currentContext();
 Context::DeviceLease currentDevice();
 
+/// @brief Handle of the current context's device (device 0 when none is
+/// set). Unlike currentDevice(), this does not install the default context.
+::orteaf::internal::execution::cpu::CpuDeviceHandle currentDeviceHandle();
+
 } // namespace orteaf::internal::execution_context::cpu
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+#include <orteaf/internal/base/small_vector.h>
+#include <orteaf/internal/kernel/core/kernel_args.h>
+#include <orteaf/internal/kernel/core/key_components.h>
+#include <orteaf/internal/kernel/registry/kernel_registry.h>
+
+namespace orteaf::internal::kernel::autotune {
+
+/**
+ * @brief Bucket of a problem shape for tuning decisions.
+ *
+ * Each extent is rounded up to a power of two, so 60x64 and 64x64 share a
+ * bucket while 64x64 and 4096x4096 do not. Rank is part of the bucket.
+ */
+std::uint64_t shapeBucket(std::span<const std::int64_t> extents) noexcept;
+
+/**
+ * @brief Picks the fastest registered Layout/Variant of a kernel per shape
+ * bucket and remembers the choice across runs.
+ *
+ * key_resolver only tries the default layout and variant. select() instead
+ * collects every registered key of the request's (Op, DType) under the most
+ * specific architecture of its fallback chain that has any, skipping fused
+ * elementwise variants (they compute a different expression). On the first
+ * call for a (request, bucket) pair each candidate is timed and the fastest
+ * wins; later calls return the remembered key.
+ *
+ * Candidates are timed on a copy of the arguments whose written operands
+ * (by OperandId access) are replaced through Config::scratch, so the
+ * caller's outputs, including InOut operands, are left untouched. Without a
+ * scratch function, arguments with written operands are not timed: select()
+ * returns the first candidate and remembers nothing.
+ *
+ * Decisions are appended to Config::cache_path as they are made and loaded
+ * from it on construction. A loaded decision whose key is no longer
+ * registered is tuned again. With Config::store, decisions are also read
+ * from and written to that PersistentKernelStore. Safe to call from several
+ * threads. Timing runs without the lock; threads racing on one bucket may
+ * both time it, and the first decision recorded wins.
+ */
+class KernelAutotuner {
+public:
+  using Registry = ::orteaf::internal::kernel::registry::KernelRegistry;
+  using Entry = Registry::Entry;
+
+  /// Time one run of @p entry on @p args, in nanoseconds.
+  using MeasureFunc = double (*)(Entry &entry, KernelArgs &args);
+  /// Fresh storage of the same dtype and size holding a copy of @p source,
+  /// or an empty lease if it cannot be made.
+  using ScratchFunc = ::orteaf::internal::storage::StorageLease (*)(
+      const ::orteaf::internal::storage::StorageLease &source);
+
+  struct Config {
+    /// Decision file; empty keeps decisions in memory only.
+    std::string cache_path{};
+    /// Timed runs per candidate after one warm-up run; the median counts.
+    std::size_t repetitions{5};
+    /// Replaces the wall-clock timer (tests, external profilers).
+    MeasureFunc measure{nullptr};
+    /// Stands in for written operands while timing, e.g.
+    /// TensorApi::cloneStorage.
+    ScratchFunc scratch{nullptr};
+    /// Also keep decisions in an on-disk kernel store; not owned.
+    ::orteaf::internal::kernel::registry::PersistentKernelStore *store{
+        nullptr};
+  };
+
+  struct Stats {
+    std::size_t tuned{0};
+    std::size_t cached_hits{0};
+    std::size_t loaded{0};
+    std::size_t candidates_timed{0};
+    /// select() calls that could not time because a written operand had no
+    /// scratch replacement.
+    std::size_t untimed{0};
+  };
+
+  KernelAutotuner() : KernelAutotuner(Config{}) {}
+  explicit KernelAutotuner(Config config);
+
+  KernelAutotuner(const KernelAutotuner &) = delete;
+  KernelAutotuner &operator=(const KernelAutotuner &) = delete;
+
+  /**
+   * @brief Key of the kernel to run for @p request on @p args.
+   *
+   * @param bucket Shape bucket of @p args, usually from shapeBucket()
+   * @return The tuned key, or nullopt if no candidate is registered
+   */
+  std::optional<KernelKey> select(Registry &registry, const KeyRequest &request,
+                                  KernelArgs &args, std::uint64_t bucket);
+
+  /// Remembered decision, without tuning.
+  std::optional<KernelKey> decision(const KeyRequest &request,
+                                    std::uint64_t bucket) const;
+
+  /**
+   * @brief Rewrite Config::cache_path with every current decision.
+   *
+   * @return false if there is no path or the file could not be written
+   */
+  bool save();
+
+  /// Forget all decisions (the file is left alone).
+  void clear();
+
+  [[nodiscard]] Stats stats() const;
+  [[nodiscard]] const Config &config() const noexcept { return config_; }
+
+private:
+  struct DecisionKey {
+    std::uint64_t request;
+    std::uint64_t bucket;
+
+    bool operator==(const DecisionKey &) const noexcept = default;
+  };
+
+  struct DecisionKeyHash {
+    std::size_t operator()(const DecisionKey &key) const noexcept {
+      return static_cast<std::size_t>(key.request * 0x9E3779B97F4A7C15ull ^
+                                      key.bucket);
+    }
+  };
+
+  using Candidates = ::orteaf::internal::base::SmallVector<KernelKey, 8>;
+
+  static DecisionKey decisionKeyOf(const KeyRequest &request,
+                                   std::uint64_t bucket) noexcept;
+  static Candidates collectCandidates(const Registry &registry,
+                                      const KeyRequest &request);
+  std::optional<KernelArgs> scratchArgs(const KernelArgs &args) const;
+  double timeCandidate(Entry &entry, KernelArgs &args) const;
+  void load();
+  bool rewriteFile();
+  void append(const DecisionKey &key, KernelKey winner);
+
+  Config config_;
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<DecisionKey, KernelKey, DecisionKeyHash> decisions_;
+  // cached_hits lives in cached_hits_: it is counted under the shared lock.
+  Stats stats_{};
+  std::atomic<std::size_t> cached_hits_{0};
+  // The decision file exists with the current header, so appending is safe.
+  bool file_current_{false};
+};
+
+} // namespace orteaf::internal::kernel::autotune
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <orteaf/internal/diagnostics/error/error.h>
+#include <orteaf/internal/kernel/core/kernel_args.h>
+#include <orteaf/internal/kernel/core/kernel_entry.h>
+#include <orteaf/internal/kernel/core/key_resolver.h>
+#include <orteaf/internal/kernel/storage/operand_key.h>
+#include <orteaf/internal/storage/storage_lease.h>
+
+namespace orteaf::internal::kernel::core {
+
+/**
+ * @brief A kernel launch bound once and replayed many times.
+ *
+ * Captures the resolved kernel and a fully bound KernelArgs (context,
+ * storages, Shape/Strides/Offset params or a packed schema). Later launches
+ * on identically laid-out tensors only patch storage leases through
+ * setStorage() and call run(); key resolution, registry lookup and
+ * DenseTensorImpl::bindAllArgs() are skipped entirely.
+ *
+ * Queueing a launch on a backend stream lives with the backend; see
+ * kernel::cpu::enqueue() for the CPU command queue.
+ *
+ * The entry is copied out of the registry (sharing its kernel base lease),
+ * so registry eviction does not invalidate a bound launch. ArrayView params
+ * in the ParamList are copied into storage owned by the bound launch, so it
+ * does not depend on the tensors whose layouts produced them. packParams()
+ * then turns those params into the kernel's packed schema once, so replays
+ * read fields directly. Views inside a schema packed by the caller
+ * (KernelArgs::setPackedParams()) are not copied and must outlive the bound
+ * launch.
+ *
+ * Example:
+ * @code
+ * KernelArgs args(context);
+ * a->bindAllArgs(args, OperandId::Input0);
+ * out->bindAllArgs(args, OperandId::Output);
+ * auto launch = BoundLaunch::resolve(registry, request, std::move(args));
+ * launch.packParams<AddParams>();
+ * const auto in_slot = launch.storageSlot(OperandId::Input0);
+ * for (auto &batch : batches) {
+ *   launch.setStorage(in_slot, batch->storageLease());
+ *   launch.run();
+ * }
+ * @endcode
+ */
+class BoundLaunch {
+public:
+  using Args = ::orteaf::internal::kernel::KernelArgs;
+  using StorageLease = ::orteaf::internal::storage::StorageLease;
+
+  BoundLaunch() = default;
+
+  /**
+   * @brief Bind @p entry to @p args.
+   *
+   * @throws InvalidParameter if @p entry has no execute function.
+   */
+  BoundLaunch(const KernelEntry &entry, Args args);
+
+  BoundLaunch(const BoundLaunch &) = delete;
+  BoundLaunch &operator=(const BoundLaunch &) = delete;
+  BoundLaunch(BoundLaunch &&) noexcept = default;
+  BoundLaunch &operator=(BoundLaunch &&) noexcept = default;
+
+  /**
+   * @brief Look up @p key in @p registry and bind the entry to @p args.
+   *
+   * @throws InvalidParameter if the key is not registered.
+   */
+  template <typename Registry>
+  static BoundLaunch bind(Registry &registry, KernelKey key, Args args) {
+    auto *entry = registry.lookup(key);
+    if (entry == nullptr) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+          "BoundLaunch kernel key is not registered");
+    }
+    return BoundLaunch(*entry, std::move(args));
+  }
+
+  /**
+   * @brief Resolve @p request against @p args, then bind().
+   *
+   * @throws InvalidParameter if no registered kernel matches.
+   */
+  template <typename Registry>
+  static BoundLaunch resolve(Registry &registry,
+                             const KeyRequest &request,
+                             Args args) {
+    const std::optional<KernelKey> key =
+        key_resolver::resolve(registry, request, args);
+    if (!key.has_value()) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+          "BoundLaunch found no kernel for the request");
+    }
+    return bind(registry, *key, std::move(args));
+  }
+
+  /**
+   * @brief Check whether a kernel is bound.
+   */
+  bool valid() const noexcept { return entry_.execute() != nullptr; }
+
+  /**
+   * @brief Index of the storage bound under @p key, for setStorage().
+   *
+   * @throws InvalidParameter if no storage was bound under @p key.
+   */
+  std::size_t storageSlot(OperandKey key) const;
+
+  std::size_t storageSlot(OperandId id) const {
+    return storageSlot(makeOperandKey(id));
+  }
+
+  /**
+   * @brief Replace the storage lease in @p slot.
+   *
+   * The new storage must fit the captured binding: same execution and dtype
+   * as the storage it replaces, enough elements for the operand's captured
+   * Shape/Strides/Offset params (or for the replaced storage when none were
+   * bound), and writable if the operand is written.
+   *
+   * @throws OutOfRange if @p slot is not a valid storage slot.
+   * @throws InvalidParameter if @p lease is invalid or does not fit.
+   */
+  void setStorage(std::size_t slot, StorageLease lease);
+
+  /**
+   * @brief Pack the bound params into @p Schema for every later launch.
+   *
+   * Extracts @p Schema from the captured ParamList once and attaches it with
+   * KernelArgs::setPackedParams(), so the kernel's Schema::extract() reads
+   * fields at fixed offsets instead of searching the ParamList on each
+   * launch. The packed views point at arrays owned by this launch, and
+   * snapshotLaunch() copies repack against their own copies.
+   *
+   * @throws as Schema::extract() if a required param is missing.
+   */
+  template <typename Schema> void packParams() {
+    repack_ = [](Args &args) {
+      args.clearPackedParams();
+      args.setPackedParams(Schema::extract(args));
+    };
+    repack_(args_);
+  }
+
+  /**
+   * @brief Run the bound kernel.
+   *
+   * @throws InvalidState if no kernel is bound.
+   */
+  void run();
+
+  /**
+   * @brief Copy the current binding for a deferred launch.
+   *
+   * The snapshot owns its array params and packed schema, so setStorage()
+   * may rebind this launch for the next launch immediately. It counts as a
+   * launch issued by this one; the caller runs it once, e.g. from a queue.
+   *
+   * @throws InvalidState if no kernel is bound.
+   */
+  std::shared_ptr<BoundLaunch> snapshotLaunch();
+
+  /**
+   * @brief Number of launches issued through run() and snapshotLaunch().
+   */
+  std::size_t launchCount() const noexcept { return launch_count_; }
+
+  const Args &args() const noexcept { return args_; }
+  Args &args() noexcept { return args_; }
+  const KernelEntry &entry() const noexcept { return entry_; }
+
+private:
+  void ownArrayParams();
+
+  KernelEntry entry_{};
+  Args args_{};
+  // Backing store for the ArrayView params; sized once, never reallocated.
+  std::unique_ptr<std::byte[]> arrays_{};
+  // Rebuilds the packed schema after the args are copied; set by packParams().
+  void (*repack_)(Args &){nullptr};
+  std::size_t launch_count_{0};
+};
+
+} // namespace orteaf::internal::kernel::core
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace orteaf::internal::kernel {
+
+// Inline capacity of a packed parameter schema, in bytes.
+inline constexpr std::size_t kKernelArgPackCapacity = 512;
+
+/**
+ * @brief Flat, allocation-free storage for one packed parameter schema.
+ *
+ * Holds a copy of a ParamSchema-derived struct (Field / OptionalField /
+ * ScopedField members at fixed offsets) in inline storage, tagged with its
+ * type. A kernel asking for the same schema type reads the fields directly
+ * instead of searching a ParamList and visiting Param variants.
+ *
+ * Only trivially copyable schemas fit; ArrayView fields keep pointing at the
+ * producer's data, exactly like ArrayView params in a ParamList.
+ */
+class KernelArgPack {
+public:
+  KernelArgPack() = default;
+  KernelArgPack(const KernelArgPack &) = default;
+  KernelArgPack &operator=(const KernelArgPack &) = default;
+
+  /**
+   * @brief Store a copy of @p schema, replacing any previous pack.
+   */
+  template <typename Schema> void emplace(const Schema &schema) noexcept {
+    static_assert(std::is_trivially_copyable_v<Schema>,
+                  "Packed parameter schemas must be trivially copyable");
+    static_assert(sizeof(Schema) <= kKernelArgPackCapacity,
+                  "Parameter schema exceeds kKernelArgPackCapacity");
+    static_assert(alignof(Schema) <= alignof(std::max_align_t),
+                  "Parameter schema is over-aligned");
+    std::memcpy(storage_, &schema, sizeof(Schema));
+    tag_ = tagOf<Schema>();
+  }
+
+  /**
+   * @brief Get the packed schema if it has type @p Schema.
+   *
+   * @return Pointer into the inline storage, or nullptr if the pack is empty
+   *         or holds a different schema.
+   */
+  template <typename Schema> const Schema *get() const noexcept {
+    if (tag_ != tagOf<Schema>()) {
+      return nullptr;
+    }
+    return std::launder(reinterpret_cast<const Schema *>(storage_));
+  }
+
+  /**
+   * @brief Mutable access to the packed schema if it has type @p Schema.
+   */
+  template <typename Schema> Schema *get() noexcept {
+    if (tag_ != tagOf<Schema>()) {
+      return nullptr;
+    }
+    return std::launder(reinterpret_cast<Schema *>(storage_));
+  }
+
+  /**
+   * @brief Check whether the pack holds a schema of type @p Schema.
+   */
+  template <typename Schema> bool holds() const noexcept {
+    return tag_ == tagOf<Schema>();
+  }
+
+  bool empty() const noexcept { return tag_ == nullptr; }
+
+  void reset() noexcept { tag_ = nullptr; }
+
+private:
+  template <typename Schema> struct Tag {
+    static constexpr char kId = 0;
+  };
+
+  template <typename Schema> static const void *tagOf() noexcept {
+    return &Tag<Schema>::kId;
+  }
+
+  const void *tag_{nullptr};
+  alignas(std::max_align_t) unsigned char storage_[kKernelArgPackCapacity]{};
+};
+
+} // namespace orteaf::internal::kernel
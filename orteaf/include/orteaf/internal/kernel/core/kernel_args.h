@@ -4,6 +4,7 @@
 
 #include <orteaf/internal/execution/execution.h>
 #include <orteaf/internal/kernel/core/context_any.h>
+#include <orteaf/internal/kernel/core/kernel_arg_pack.h>
 #include <orteaf/internal/kernel/param/param_list.h>
 #include <orteaf/internal/kernel/storage/storage_binding.h>
 #include <orteaf/internal/kernel/storage/operand_key.h>
@@ -16,7 +17,9 @@ namespace orteaf::internal::kernel {
  * @brief Type-erased kernel arguments container.
  *
  * Holds execution context, storage bindings, and parameters without
- * backend-specific subclasses.
+ * backend-specific subclasses. Parameters travel either as a ParamList or as
+ * a packed schema (see setPackedParams()); ParamSchema::extract() prefers the
+ * latter.
  */
 class KernelArgs {
 public:
@@ -134,16 +137,50 @@ public:
    * @brief Get the list of all parameters.
    */
   const auto &paramList() const { return params_; }
+  auto &paramList() { return params_; }
 
   /**
-   * @brief Clear all parameters.
+   * @brief Clear all parameters, including a packed schema.
    */
-  void clearParams() { params_.clear(); }
+  void clearParams() {
+    params_.clear();
+    packed_params_.reset();
+  }
+
+  /**
+   * @brief Attach a fully populated parameter schema.
+   *
+   * Kernels extracting the same schema type read it by direct field access,
+   * skipping the ParamList search. Replaces any previously packed schema.
+   */
+  template <typename Schema> void setPackedParams(const Schema &schema) {
+    packed_params_.emplace(schema);
+  }
+
+  /**
+   * @brief Get the packed schema if it has type @p Schema, else nullptr.
+   */
+  template <typename Schema> const Schema *packedParams() const {
+    return packed_params_.template get<Schema>();
+  }
+
+  /**
+   * @brief Get the packed schema (mutable) if it has type @p Schema.
+   */
+  template <typename Schema> Schema *packedParams() {
+    return packed_params_.template get<Schema>();
+  }
+
+  /**
+   * @brief Drop the packed schema, keeping ParamList entries.
+   */
+  void clearPackedParams() { packed_params_.reset(); }
 
 private:
   Context context_{};
   StorageListType storages_{};
   ParamList params_{};
+  KernelArgPack packed_params_{};
 };
 
 } // namespace orteaf::internal::kernel
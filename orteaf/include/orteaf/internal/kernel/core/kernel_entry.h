@@ -1,11 +1,18 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 #include <variant>
 
 #include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/diagnostics/trace/trace.h"
+#include "orteaf/internal/execution/cpu/manager/cpu_kernel_base_manager.h"
+#include "orteaf/internal/execution_context/cpu/context.h"
 #include "orteaf/internal/kernel/core/kernel_args.h"
+#include "orteaf/internal/kernel/core/kernel_key.h"
+#include "orteaf/internal/kernel/profile/kernel_profiler.h"
 
 #if ORTEAF_ENABLE_MPS
 #include "orteaf/internal/execution/mps/manager/mps_kernel_base_manager.h"
@@ -23,6 +30,10 @@ class KernelEntry {
 public:
   using Args = ::orteaf::internal::kernel::KernelArgs;
 
+  using CpuKernelBaseLease =
+      ::orteaf::internal::execution::cpu::manager::CpuKernelBaseManager::
+          KernelBaseLease;
+
 #if ORTEAF_ENABLE_MPS
   using MpsKernelBaseLease =
       ::orteaf::internal::execution::mps::manager::MpsKernelBaseManager::
@@ -30,7 +41,7 @@ public:
 #endif
 
   using KernelBaseLease = std::variant<
-      std::monostate
+      std::monostate, CpuKernelBaseLease
 #if ORTEAF_ENABLE_MPS
       ,
       MpsKernelBaseLease
@@ -52,10 +63,40 @@ public:
   ExecuteFunc execute() const noexcept { return execute_; }
   void setExecute(ExecuteFunc execute) noexcept { execute_ = execute; }
 
+  /**
+   * @brief Key the entry was registered under, used to attribute profiles.
+   *
+   * Set by KernelRegistry when it builds the entry; zero otherwise.
+   */
+  KernelKey key() const noexcept { return key_; }
+  void setKey(KernelKey key) noexcept { key_ = key; }
+
   /**
    * @brief Run the kernel with automatic configuration.
+   *
+   * While a profile::KernelProfiler is installed, sampled launches are timed
+   * and recorded under key().
    */
   void run(Args &args) {
+    ORTEAF_TRACE_SPAN_ARG("KernelEntry::run", "kernel", "key",
+                          static_cast<std::uint64_t>(key_));
+    auto *profiler = ::orteaf::internal::kernel::profile::KernelProfiler::
+        active();
+    if (profiler != nullptr && profiler->shouldSample()) {
+      const auto start = std::chrono::steady_clock::now();
+      dispatch(args);
+      const auto nanoseconds = static_cast<std::uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count());
+      profiler->record(key_, args, nanoseconds);
+      return;
+    }
+    dispatch(args);
+  }
+
+private:
+  void dispatch(Args &args) {
     std::visit(
         [&](auto &lease_value) {
           using LeaseT = std::decay_t<decltype(lease_value)>;
@@ -64,6 +105,37 @@ public:
                 ::orteaf::internal::diagnostics::error::OrteafErrc::
                     InvalidState,
                 "Kernel base is not initialized");
+          } else if constexpr (std::is_same_v<LeaseT, CpuKernelBaseLease>) {
+            auto *base_ptr = lease_value.operator->();
+            if (!base_ptr) {
+              ::orteaf::internal::diagnostics::error::throwError(
+                  ::orteaf::internal::diagnostics::error::OrteafErrc::
+                      InvalidState,
+                  "CPU kernel base lease is invalid");
+            }
+            auto *context = args.context()
+                                .tryAs<
+                                    ::orteaf::internal::execution_context::cpu::
+                                        Context>();
+            if (!context) {
+              ::orteaf::internal::diagnostics::error::throwError(
+                  ::orteaf::internal::diagnostics::error::OrteafErrc::
+                      InvalidParameter,
+                  "CPU kernel requires CPU execution context");
+            }
+            if (!base_ptr->ensureConfigured(context->device)) {
+              ::orteaf::internal::diagnostics::error::throwError(
+                  ::orteaf::internal::diagnostics::error::OrteafErrc::
+                      InvalidState,
+                  "CPU kernel base does not support the context device");
+            }
+            if (!execute_) {
+              ::orteaf::internal::diagnostics::error::throwError(
+                  ::orteaf::internal::diagnostics::error::OrteafErrc::
+                      InvalidState,
+                  "Kernel execute function is invalid");
+            }
+            execute_(base_, args);
 #if ORTEAF_ENABLE_MPS
           } else if constexpr (std::is_same_v<LeaseT, MpsKernelBaseLease>) {
             auto *base_ptr = lease_value.operator->();
@@ -102,7 +174,6 @@ public:
         base_);
   }
 
-private:
   /**
    * @brief Kernel base instance.
    */
@@ -112,6 +183,11 @@ private:
    * @brief Execution function pointer.
    */
   ExecuteFunc execute_{nullptr};
+
+  /**
+   * @brief Registry key, for profiling.
+   */
+  KernelKey key_{};
 };
 
 } // namespace orteaf::internal::kernel::core
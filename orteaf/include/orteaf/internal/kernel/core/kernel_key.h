@@ -52,6 +52,23 @@ inline constexpr std::uint64_t kLayoutMask = 0xFF;         // 8 bits
 inline constexpr std::uint64_t kVariantMask = 0xFF;        // 8 bits
 inline constexpr std::uint64_t kVersionMask = 0xF;         // 4 bits
 
+/**
+ * @brief Raw value no real key takes; hash tables use it for empty slots.
+ *
+ * All-ones never occurs as a real key: it would need version 15.
+ */
+inline constexpr std::uint64_t kEmptyRaw = ~std::uint64_t{0};
+
+/**
+ * @brief Slot hash of a raw key for power-of-two hash tables.
+ *
+ * Fibonacci hashing spreads the packed fields across the high bits of the
+ * product; callers mask the result with (table size - 1).
+ */
+constexpr std::uint32_t slotHash(std::uint64_t raw) noexcept {
+  return static_cast<std::uint32_t>((raw * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
 /**
  * @brief Create a KernelKey from individual components.
  *
@@ -5,6 +5,8 @@
 #include <utility>
 #include <variant>
 
+#include "orteaf/internal/execution/cpu/manager/cpu_kernel_metadata_manager.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_kernel_metadata.h"
 #if ORTEAF_ENABLE_MPS
 #include "orteaf/internal/execution/mps/manager/mps_kernel_metadata_manager.h"
 #include "orteaf/internal/execution/mps/resource/mps_kernel_metadata.h"
@@ -46,6 +48,10 @@ concept KernelMetadataFromEntryBuildable =
  */
 class KernelMetadataLease {
 public:
+  using CpuKernelMetadataLease =
+      ::orteaf::internal::execution::cpu::manager::CpuKernelMetadataManager::
+          CpuKernelMetadataLease;
+
 #if ORTEAF_ENABLE_MPS
   using MpsKernelMetadataLease =
       ::orteaf::internal::execution::mps::manager::MpsKernelMetadataManager::
@@ -53,7 +59,7 @@ public:
 #endif
 
   using Variant = std::variant<
-      std::monostate
+      std::monostate, CpuKernelMetadataLease
 #if ORTEAF_ENABLE_MPS
       ,
       MpsKernelMetadataLease
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <concepts>
+#include <cstdint>
 #include <optional>
 
 #include <orteaf/internal/base/small_vector.h>
 #include <orteaf/internal/kernel/core/kernel_args.h>
 #include <orteaf/internal/kernel/core/key_components.h>
+#include <orteaf/internal/kernel/core/resolve_cache.h>
 
 namespace orteaf::internal::kernel::key_resolver {
 
@@ -91,4 +94,58 @@ std::optional<KernelKey> resolve(const Registry &registry,
   return std::nullopt;
 }
 
+/**
+ * @brief resolve() through a ResolveCache.
+ *
+ * The winning key, or the absence of one, is remembered per
+ * (Op, DType, Architecture, @p signature) until @p registry reports a new
+ * generation, so repeated dispatches skip buildContext() and the
+ * contains() probes.
+ *
+ * Rules built by buildContext() do not depend on @p args today. A caller
+ * whose verification does (custom predicates, layout-dependent variants)
+ * must encode what the predicates look at in @p signature, e.g. a layout
+ * or contiguity bitmask of the arguments.
+ *
+ * @tparam Registry Type that supports contains(KernelKey) and
+ * generation(), where generation() changes whenever contains() may start
+ * returning a different answer. When it also has persistentStore() (as
+ * KernelRegistry does) and a store is attached, results are persisted
+ * there and reused across runs that registered the same key set.
+ */
+template <typename Registry>
+  requires requires(const Registry &registry) {
+    { registry.generation() } -> std::convertible_to<std::uint64_t>;
+  }
+std::optional<KernelKey> resolve(const Registry &registry,
+                                 const KeyRequest &request,
+                                 const KernelArgs &args, ResolveCache &cache,
+                                 std::uint64_t signature = 0) {
+  const std::uint64_t generation = registry.generation();
+  std::optional<KernelKey> result;
+  if (cache.find(request, signature, generation, result)) {
+    return result;
+  }
+
+  if constexpr (requires { registry.persistentStore(); }) {
+    // A resolution persisted by a run that registered the same key set.
+    if (auto *store = registry.persistentStore()) {
+      const auto fingerprint = registry.keySetFingerprint();
+      result = store->findResolution(request, signature, fingerprint);
+      if (!result.has_value() || !registry.contains(*result)) {
+        result = resolve(registry, request, args);
+        if (result.has_value()) {
+          store->putResolution(request, signature, fingerprint, *result);
+        }
+      }
+      cache.store(request, signature, generation, result);
+      return result;
+    }
+  }
+
+  result = resolve(registry, request, args);
+  cache.store(request, signature, generation, result);
+  return result;
+}
+
 } // namespace orteaf::internal::kernel::key_resolver
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <orteaf/internal/kernel/core/key_components.h>
+
+namespace orteaf::internal::kernel::key_resolver {
+
+/**
+ * @brief Memo of key_resolver::resolve() results.
+ *
+ * Direct-mapped: each (request, signature) pair hashes to one slot, which
+ * remembers the winning KernelKey or that nothing matched. A slot is only
+ * trusted while the registry generation it was filled under is current,
+ * so registering a kernel invalidates every result at once without
+ * touching the cache.
+ *
+ * Not thread-safe; keep one per dispatching thread (see
+ * threadResolveCache()).
+ */
+class ResolveCache {
+public:
+  static constexpr std::size_t kSlots = 128;
+
+  /**
+   * @brief Look up a remembered result.
+   *
+   * @param result Set to the remembered key, or nullopt for a remembered
+   * miss
+   * @return true if a result for this generation was found
+   */
+  bool find(const KeyRequest &request, std::uint64_t signature,
+            std::uint64_t generation,
+            std::optional<KernelKey> &result) const noexcept {
+    const std::uint64_t packed = pack(request);
+    const Slot &slot = slots_[indexOf(packed, signature)];
+    if (slot.generation != generation || slot.request != packed ||
+        slot.signature != signature) {
+      return false;
+    }
+    result = slot.found ? std::optional<KernelKey>(slot.key) : std::nullopt;
+    return true;
+  }
+
+  /**
+   * @brief Remember @p result for (request, signature) under
+   * @p generation, replacing whatever shared the slot.
+   */
+  void store(const KeyRequest &request, std::uint64_t signature,
+             std::uint64_t generation,
+             std::optional<KernelKey> result) noexcept {
+    const std::uint64_t packed = pack(request);
+    Slot &slot = slots_[indexOf(packed, signature)];
+    slot.request = packed;
+    slot.signature = signature;
+    slot.generation = generation;
+    slot.key = result.value_or(KernelKey{});
+    slot.found = result.has_value();
+  }
+
+  void clear() noexcept { slots_ = {}; }
+
+private:
+  struct Slot {
+    std::uint64_t request{0};
+    std::uint64_t signature{0};
+    // 0 is never handed out as a registry generation.
+    std::uint64_t generation{0};
+    KernelKey key{};
+    bool found{false};
+  };
+
+  // The fixed fields of a KernelKey with the requested architecture; the
+  // layout and variant bits stay zero.
+  static std::uint64_t pack(const KeyRequest &request) noexcept {
+    return static_cast<std::uint64_t>(
+        makeKey({request.op, request.dtype},
+                {request.architecture, static_cast<Layout>(0),
+                 static_cast<Variant>(0)}));
+  }
+
+  static std::size_t indexOf(std::uint64_t packed,
+                             std::uint64_t signature) noexcept {
+    const std::uint64_t mixed =
+        (packed ^ (signature * 0xC2B2AE3D27D4EB4Full)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(mixed >> 32) & (kSlots - 1);
+  }
+
+  std::array<Slot, kSlots> slots_{};
+};
+
+/**
+ * @brief The calling thread's ResolveCache.
+ *
+ * Safe to share across registries: generations are unique per registry.
+ */
+ResolveCache &threadResolveCache() noexcept;
+
+} // namespace orteaf::internal::kernel::key_resolver
@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <functional>
 
+#include <orteaf/internal/diagnostics/error/error.h>
+
 namespace orteaf::internal::kernel {
 
 /**
@@ -14,6 +16,42 @@ namespace orteaf::internal::kernel {
  */
 enum class Variant : std::uint64_t {};
 
+namespace variant {
+
+/// Variant of the plain, unfused implementation of an op.
+inline constexpr Variant kDefault{0};
+
+/// First of the variants reserved for fused elementwise kernels. The key's Op
+/// is the root (last) op of the fused expression; the variant tells fused
+/// expressions sharing a root op apart.
+inline constexpr std::uint64_t kFusedElementwiseBase = 0x80;
+inline constexpr std::uint64_t kFusedElementwiseCount = 0x80;
+
+/**
+ * @brief Variant of the @p index-th fused elementwise expression.
+ *
+ * Only kFusedElementwiseCount indices fit the 8-bit variant field of
+ * KernelKey; larger ones would alias another expression's key.
+ *
+ * @throws OutOfRange if @p index >= kFusedElementwiseCount.
+ */
+constexpr Variant fusedElementwise(std::uint8_t index) {
+  if (index >= kFusedElementwiseCount) {
+    ::orteaf::internal::diagnostics::error::throwError(
+        ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+        "Fused elementwise variant index out of range");
+  }
+  return static_cast<Variant>(kFusedElementwiseBase + index);
+}
+
+constexpr bool isFusedElementwise(Variant value) noexcept {
+  const auto raw = static_cast<std::uint64_t>(value);
+  return raw >= kFusedElementwiseBase &&
+         raw < kFusedElementwiseBase + kFusedElementwiseCount;
+}
+
+} // namespace variant
+
 } // namespace orteaf::internal::kernel
 
 // Hash support for std::unordered_map and std::unordered_set
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <orteaf/internal/execution/cpu/resource/cpu_command_queue.h>
+#include <orteaf/internal/kernel/core/bound_launch.h>
+
+namespace orteaf::internal::kernel::cpu {
+
+/**
+ * @brief Queue @p launch on a CPU command queue and return at once.
+ *
+ * The launch runs from BoundLaunch::snapshotLaunch(), so setStorage() may
+ * rebind @p launch for the next launch immediately. The snapshot holds the
+ * storage leases until the returned token completes, which keeps the
+ * buffers out of the allocator meanwhile; wait on the token (or synchronize
+ * the queue) before reading the outputs on the host.
+ *
+ * @throws InvalidState if no kernel is bound.
+ * @throws InvalidParameter if the args do not carry a CPU context.
+ */
+::orteaf::internal::execution::cpu::resource::FenceToken
+enqueue(core::BoundLaunch &launch,
+        ::orteaf::internal::execution::cpu::resource::CpuCommandQueue &queue);
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <orteaf/internal/execution/cpu/resource/cpu_thread_pool.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
+
+namespace orteaf::internal::kernel::cpu {
+
+/**
+ * @brief Copy @p src into @p dst element by element, following both
+ * operands' strides.
+ *
+ * The iteration space is planned with CpuIterationPlan, so dimensions that
+ * are contiguous in both operands collapse into memcpy runs. When the two
+ * innermost planned dimensions are swapped between the operands (a 2-D
+ * permutation such as a transpose, possibly batched), the copy walks
+ * square tiles so both sides stay in cache. Work is split over @p pool when
+ * it is large enough.
+ *
+ * @throws InvalidParameter if shapes or dtypes differ.
+ */
+void copyStrided(const CpuOperand &src, const CpuOperand &dst,
+                 ::orteaf::internal::execution::cpu::resource::CpuThreadPool
+                     *pool = nullptr);
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include <orteaf/internal/execution/cpu/resource/cpu_thread_pool.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
+#include <orteaf/internal/kernel/cpu/cpu_vector_ops.h>
+#include <orteaf/internal/ops/ops.h>
+
+namespace orteaf::internal::kernel::cpu {
+
+/// External inputs a fused expression can read (Input0 .. Input3).
+inline constexpr std::size_t kMaxFusedInputs = 4;
+/// Nodes a fused expression can hold.
+inline constexpr std::size_t kMaxFusedNodes = 16;
+
+/**
+ * @brief Argument of a fused node: an external input or an earlier node.
+ */
+struct FusedValue {
+  enum class Source : std::uint8_t { Input, Node };
+
+  Source source{Source::Input};
+  std::uint8_t index{0};
+};
+
+/// Read external input @p index (bound as Input0 + index).
+constexpr FusedValue fusedInput(std::uint8_t index) noexcept {
+  return FusedValue{FusedValue::Source::Input, index};
+}
+
+/// Read the result of node @p index, which must come earlier.
+constexpr FusedValue fusedResult(std::uint8_t index) noexcept {
+  return FusedValue{FusedValue::Source::Node, index};
+}
+
+/**
+ * @brief One pointwise op of a fused expression.
+ *
+ * Uses the first ops::arityOf(op) entries of @c args. @c alpha is the Add
+ * attribute of the same name and is ignored by other ops.
+ */
+struct FusedNode {
+  ::orteaf::internal::ops::Op op{};
+  std::array<FusedValue, 2> args{};
+  float alpha{1.0f};
+};
+
+constexpr FusedNode fusedAdd(FusedValue lhs, FusedValue rhs,
+                             float alpha = 1.0f) noexcept {
+  return FusedNode{::orteaf::internal::ops::Op::Add, {lhs, rhs}, alpha};
+}
+
+constexpr FusedNode fusedRelu(FusedValue input) noexcept {
+  return FusedNode{::orteaf::internal::ops::Op::Relu, {input, FusedValue{}}};
+}
+
+/**
+ * @brief Whether @p op may appear in a fused elementwise expression.
+ *
+ * The op must be an arithmetic or activation op of the catalog with
+ * broadcast / elementwise / identity shape inference, and have a CPU vector
+ * loop (see CpuVectorOps).
+ */
+constexpr bool isFusableOp(::orteaf::internal::ops::Op op) noexcept {
+  namespace ops = ::orteaf::internal::ops;
+  const std::string_view category = ops::categoryOf(op);
+  if (category != "arithmetic" && category != "activation") {
+    return false;
+  }
+  const std::string_view shape = ops::shapeInferenceOf(op).kind;
+  if (shape != "broadcast" && shape != "elementwise" && shape != "identity") {
+    return false;
+  }
+  return op == ops::Op::Add || op == ops::Op::Relu;
+}
+
+/**
+ * @brief Check that @p nodes form a valid fused expression.
+ *
+ * Nodes are in evaluation order and the last one is the result. Every op
+ * must be fusable, have its catalog arity, and only read external inputs
+ * below kMaxFusedInputs or nodes that come before it.
+ */
+constexpr bool
+isValidFusedExpression(std::span<const FusedNode> nodes) noexcept {
+  if (nodes.empty() || nodes.size() > kMaxFusedNodes) {
+    return false;
+  }
+  for (std::size_t i = 0; i < nodes.size(); ++i) {
+    const FusedNode &node = nodes[i];
+    if (!isFusableOp(node.op)) {
+      return false;
+    }
+    const std::uint32_t arity = ::orteaf::internal::ops::arityOf(node.op);
+    if (arity == 0 || arity > node.args.size()) {
+      return false;
+    }
+    for (std::uint32_t a = 0; a < arity; ++a) {
+      const FusedValue arg = node.args[a];
+      const bool valid = arg.source == FusedValue::Source::Input
+                             ? arg.index < kMaxFusedInputs
+                             : arg.index < i;
+      if (!valid) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Number of external inputs read by @p nodes (highest index + 1).
+ */
+constexpr std::size_t
+fusedInputCount(std::span<const FusedNode> nodes) noexcept {
+  std::size_t count = 0;
+  for (const FusedNode &node : nodes) {
+    const std::uint32_t arity = ::orteaf::internal::ops::arityOf(node.op);
+    for (std::uint32_t a = 0; a < arity && a < node.args.size(); ++a) {
+      const FusedValue arg = node.args[a];
+      if (arg.source == FusedValue::Source::Input && arg.index + 1u > count) {
+        count = arg.index + 1u;
+      }
+    }
+  }
+  return count;
+}
+
+/**
+ * @brief Fixed-size fused expression usable as a template argument.
+ *
+ * Built with makeFusedExpression(); a kernel for it is generated by
+ * instantiating fusedElementwiseExecute<Expression> (see
+ * extension/kernel/cpu/ops/fused_elementwise_kernel.h).
+ */
+template <std::size_t N> struct FusedExpression {
+  std::array<FusedNode, N> nodes{};
+
+  constexpr std::span<const FusedNode> view() const noexcept {
+    return {nodes.data(), N};
+  }
+  constexpr ::orteaf::internal::ops::Op rootOp() const noexcept {
+    return nodes[N - 1].op;
+  }
+  constexpr std::size_t inputCount() const noexcept {
+    return fusedInputCount(view());
+  }
+  constexpr bool valid() const noexcept {
+    return isValidFusedExpression(view());
+  }
+};
+
+template <typename... Nodes>
+constexpr FusedExpression<sizeof...(Nodes)>
+makeFusedExpression(Nodes... nodes) noexcept {
+  return FusedExpression<sizeof...(Nodes)>{{FusedNode(nodes)...}};
+}
+
+/**
+ * @brief Evaluate a fused expression in one pass over memory.
+ *
+ * The output shape must equal the broadcast of all input shapes. The
+ * iteration space is walked with a CpuIterationPlan, split over @p pool
+ * when it is large enough. Each inner run is cut into tiles whose
+ * intermediate results stay in small scratch buffers, and every node runs
+ * the SIMD loop of @p vector_ops on the whole tile. Leaves
+ * are read in place with their broadcast strides and the root node writes
+ * straight to the output, so memory traffic is one read per input and one
+ * write of the output regardless of the number of nodes. Intermediates keep
+ * the operand dtype, so results match running the ops one by one.
+ *
+ * @throws InvalidParameter if the expression is invalid, an input is
+ *         missing, dtypes differ or shapes do not broadcast to the output.
+ * @throws Unsupported if the dtype has no vector loops.
+ */
+void runFusedElementwise(
+    std::span<const FusedNode> nodes, std::span<const CpuOperand> inputs,
+    const CpuOperand &output, const CpuVectorOps &vector_ops,
+    ::orteaf::internal::execution::cpu::resource::CpuThreadPool *pool =
+        nullptr);
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include <orteaf/internal/dtype/dtype.h>
+#include <orteaf/internal/execution/cpu/resource/cpu_thread_pool.h>
+#include <orteaf/internal/kernel/cpu/cpu_isa.h>
+
+namespace orteaf::internal::kernel::cpu {
+
+/**
+ * @brief Register-blocked GEMM micro-kernel for one ISA.
+ *
+ * Computes C[mr x nr] += A_panel * B_panel over @p kc, where A_panel is packed
+ * as kc columns of mr contiguous values and B_panel as kc rows of nr
+ * contiguous values. C is row-major with leading dimension @p ldc, always a
+ * full mr x nr tile (the driver pads edge tiles).
+ *
+ * mc / kc / nc are the cache blocking sizes the driver uses with this
+ * micro-kernel: an mc x kc block of A is sized for L2, a kc x nr sliver of B
+ * for L1 and a kc x nc panel of B for L3.
+ */
+struct CpuGemmMicroKernel {
+  using Index = std::int64_t;
+
+  CpuIsa isa{CpuIsa::Scalar};
+  Index mr{0};
+  Index nr{0};
+  Index mc{0};
+  Index kc{0};
+  Index nc{0};
+  void (*run)(Index kc, const float *a_panel, const float *b_panel, float *c,
+              Index ldc){nullptr};
+};
+
+/**
+ * @brief Get the GEMM micro-kernel for an ISA (see vectorOps() for fallback).
+ */
+const CpuGemmMicroKernel &gemmMicroKernel(CpuIsa isa) noexcept;
+
+/**
+ * @brief Strided 2-D matrix view, strides in elements.
+ */
+struct CpuGemmMatrix {
+  const void *data{nullptr};
+  std::int64_t row_stride{0};
+  std::int64_t col_stride{0};
+};
+
+struct CpuGemmMutableMatrix {
+  void *data{nullptr};
+  std::int64_t row_stride{0};
+  std::int64_t col_stride{0};
+};
+
+/**
+ * @brief One matrix product C = A * B (+ bias) of a batch.
+ *
+ * A is m x k, B is k x n, C and the optional bias are m x n. Strides may be
+ * arbitrary (including 0 for broadcast and swapped for transposed views); the
+ * operands are read in place while packing.
+ */
+struct CpuGemmBatch {
+  CpuGemmMatrix a{};
+  CpuGemmMatrix b{};
+  CpuGemmMatrix bias{};
+  CpuGemmMutableMatrix c{};
+};
+
+/**
+ * @brief Shape and element type shared by every product in a batch.
+ *
+ * F16 operands are widened while packing and accumulate in F32.
+ */
+struct CpuGemmShape {
+  std::int64_t m{0};
+  std::int64_t n{0};
+  std::int64_t k{0};
+  ::orteaf::internal::DType dtype{::orteaf::internal::DType::F32};
+  bool has_bias{false};
+};
+
+/**
+ * @brief Run a batch of matrix products with the packed-panel GEMM.
+ *
+ * B is packed once per call into (N block, K step) panels shared by every
+ * M block. Packing and the (batch, M block, N block) products run as tasks
+ * on @p pool when the problem is large enough, and inline when @p pool is
+ * null. Batches whose packed B would exceed 64 MiB are processed in groups.
+ * Supports F32 and F16.
+ *
+ * @throws Unsupported for other dtypes.
+ */
+void gemm(CpuIsa isa, const CpuGemmShape &shape,
+          std::span<const CpuGemmBatch> batches,
+          ::orteaf::internal::execution::cpu::resource::CpuThreadPool *pool =
+              nullptr);
+
+namespace detail {
+
+// Per-ISA micro-kernels. Return nullptr when the ISA is not compiled in.
+const CpuGemmMicroKernel &scalarGemmMicroKernel() noexcept;
+const CpuGemmMicroKernel *neonGemmMicroKernel() noexcept;
+const CpuGemmMicroKernel *avx2GemmMicroKernel() noexcept;
+const CpuGemmMicroKernel *avx512GemmMicroKernel() noexcept;
+
+} // namespace detail
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+#include "orteaf/internal/architecture/architecture.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+/**
+ * @brief SIMD instruction set used by CPU kernels.
+ *
+ * Each CPU architecture in architectures.yml maps to the widest ISA its
+ * kernels are allowed to use (see isaOf()).
+ */
+enum class CpuIsa : std::uint8_t {
+  Scalar,
+  Neon,
+  Avx2,
+  Avx512,
+};
+
+/**
+ * @brief Map a CPU architecture to the ISA its kernels target.
+ *
+ * Zen4 / Skylake -> AVX-512, IntelCometLake -> AVX2. CpuGeneric uses NEON on
+ * AArch64 builds (NEON is part of the base ISA there) and scalar code
+ * otherwise. Non-CPU architectures map to Scalar.
+ */
+CpuIsa isaOf(::orteaf::internal::architecture::Architecture arch) noexcept;
+
+/**
+ * @brief Check whether the ISA was compiled in and is supported by the host.
+ */
+bool isSupported(CpuIsa isa) noexcept;
+
+/**
+ * @brief Return the widest ISA not wider than @p isa that the host supports.
+ */
+CpuIsa effectiveIsa(CpuIsa isa) noexcept;
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <orteaf/internal/base/small_vector.h>
+#include <orteaf/internal/execution/cpu/resource/cpu_thread_pool.h>
+
+namespace orteaf::internal::kernel::cpu {
+
+/// Elements per parallel chunk for memory-bound elementwise kernels; below
+/// this the fork-join overhead outweighs the extra bandwidth.
+inline constexpr std::int64_t kElementwiseGrain = 32 * 1024;
+
+/**
+ * @brief Iteration plan for N strided operands sharing one shape.
+ *
+ * Built once from a dense layout (shape, per-operand element strides and
+ * offsets, with stride 0 for broadcast dimensions as produced by
+ * DenseTensorLayout::broadcastTo()):
+ *
+ * 1. Size-1 dimensions are dropped.
+ * 2. Dimensions are reordered so smaller strides end up innermost. A
+ *    dimension only moves when no operand disagrees, which makes e.g. a
+ *    transposed copy keep the destination order.
+ * 3. Adjacent dimensions that are contiguous with each other in every
+ *    operand are merged, so a dense tensor becomes one run of any rank.
+ *
+ * The remaining space is a set of inner runs (the innermost dimension,
+ * walked with a constant stride per operand, which is what the vector
+ * loops take) over an odometer of outer dimensions. The space is linear in
+ * element order, so forEachRun() can walk any sub-range and
+ * parallelForEachRun() splits it into chunks for a CpuThreadPool.
+ *
+ * Callbacks are invoked as `fn(offsets, count, inner_strides)`: per-operand
+ * element offsets of the first element, the number of elements in the run
+ * and the per-operand element stride between them.
+ */
+template <std::size_t N> class CpuIterationPlan {
+public:
+  using Dim = std::int64_t;
+  using Dims = ::orteaf::internal::base::SmallVector<Dim, 8>;
+  using Offsets = std::array<Dim, N>;
+
+  /**
+   * @param shape Iteration shape.
+   * @param strides Per-operand element strides, each of rank shape.size().
+   * @param base_offsets Per-operand element offset of index (0, ..., 0).
+   */
+  CpuIterationPlan(std::span<const Dim> shape,
+                   const std::array<std::span<const Dim>, N> &strides,
+                   const Offsets &base_offsets = {})
+      : base_offsets_(base_offsets) {
+    numel_ = 1;
+    for (const Dim dim : shape) {
+      numel_ *= dim;
+    }
+    if (numel_ == 0) {
+      return;
+    }
+
+    Dims order;
+    for (std::size_t d = 0; d < shape.size(); ++d) {
+      if (shape[d] != 1) {
+        insertByStride(order, strides, d);
+      }
+    }
+
+    for (const std::size_t d : order) {
+      bool mergeable = !dims_.empty();
+      for (std::size_t k = 0; mergeable && k < N; ++k) {
+        mergeable = strides_[k].back() == strides[k][d] * shape[d];
+      }
+      if (mergeable) {
+        dims_.back() *= shape[d];
+        for (std::size_t k = 0; k < N; ++k) {
+          strides_[k].back() = strides[k][d];
+        }
+        continue;
+      }
+      dims_.pushBack(shape[d]);
+      for (std::size_t k = 0; k < N; ++k) {
+        strides_[k].pushBack(strides[k][d]);
+      }
+    }
+
+    // Rank 0 (or all dims of size 1) is a single run of one element.
+    if (dims_.empty()) {
+      dims_.pushBack(1);
+      for (std::size_t k = 0; k < N; ++k) {
+        strides_[k].pushBack(0);
+      }
+    }
+    for (std::size_t k = 0; k < N; ++k) {
+      inner_strides_[k] = strides_[k].back();
+    }
+  }
+
+  /// Total number of elements.
+  Dim numel() const noexcept { return numel_; }
+  bool empty() const noexcept { return numel_ == 0; }
+  /// Rank after dropping, reordering and merging dimensions.
+  std::size_t rank() const noexcept { return dims_.size(); }
+  /// Dimensions after dropping, reordering and merging, outermost first.
+  std::span<const Dim> dims() const noexcept {
+    return {dims_.data(), dims_.size()};
+  }
+  /// Element strides of @p operand over dims().
+  std::span<const Dim> strides(std::size_t operand) const noexcept {
+    return {strides_[operand].data(), strides_[operand].size()};
+  }
+  /// Elements per inner run.
+  Dim innerCount() const noexcept { return empty() ? 0 : dims_.back(); }
+  /// Number of inner runs.
+  Dim outerCount() const noexcept {
+    return empty() ? 0 : numel_ / dims_.back();
+  }
+  const Offsets &innerStrides() const noexcept { return inner_strides_; }
+
+  /**
+   * @brief Per-operand element offsets of linear element @p index.
+   */
+  Offsets offsetsOf(Dim index) const noexcept {
+    Offsets offsets = base_offsets_;
+    for (std::size_t d = dims_.size(); d > 0 && index > 0; --d) {
+      const Dim coord = index % dims_[d - 1];
+      index /= dims_[d - 1];
+      for (std::size_t k = 0; k < N; ++k) {
+        offsets[k] += coord * strides_[k][d - 1];
+      }
+    }
+    return offsets;
+  }
+
+  /**
+   * @brief Walk the inner runs covering elements [begin, end).
+   *
+   * Runs are clipped to the range, so the first and last may be partial.
+   */
+  template <typename Fn> void forEachRun(Dim begin, Dim end, Fn &&fn) const {
+    end = std::min(end, numel_);
+    if (begin >= end) {
+      return;
+    }
+    const std::size_t outer_rank = dims_.size() - 1;
+    const Dim inner = dims_.back();
+
+    Dims index;
+    index.resize(outer_rank);
+    Dim outer = begin / inner;
+    for (std::size_t d = outer_rank; d > 0; --d) {
+      index[d - 1] = outer % dims_[d - 1];
+      outer /= dims_[d - 1];
+    }
+    Offsets offsets = offsetsOf(begin - begin % inner);
+    Dim position = begin % inner;
+
+    while (true) {
+      const Dim count = std::min(inner - position, end - begin);
+      Offsets run_offsets = offsets;
+      for (std::size_t k = 0; k < N; ++k) {
+        run_offsets[k] += position * inner_strides_[k];
+      }
+      fn(run_offsets, count, inner_strides_);
+      begin += count;
+      if (begin >= end) {
+        return;
+      }
+      position = 0;
+
+      // Odometer increment over the outer dimensions.
+      for (std::size_t d = outer_rank; d > 0; --d) {
+        ++index[d - 1];
+        for (std::size_t k = 0; k < N; ++k) {
+          offsets[k] += strides_[k][d - 1];
+        }
+        if (index[d - 1] < dims_[d - 1]) {
+          break;
+        }
+        for (std::size_t k = 0; k < N; ++k) {
+          offsets[k] -= strides_[k][d - 1] * dims_[d - 1];
+        }
+        index[d - 1] = 0;
+      }
+    }
+  }
+
+  template <typename Fn> void forEachRun(Fn &&fn) const {
+    forEachRun(0, numel_, fn);
+  }
+
+  /**
+   * @brief Walk all runs, split into chunks of at least @p grain elements
+   * spread over @p pool.
+   *
+   * Runs inline when @p pool is null or the plan holds no more than
+   * @p grain elements. @p fn must be safe to call concurrently for
+   * disjoint runs.
+   */
+  template <typename Fn>
+  void parallelForEachRun(
+      ::orteaf::internal::execution::cpu::resource::CpuThreadPool *pool,
+      Dim grain, Fn &&fn) const {
+    if (pool == nullptr || pool->concurrency() <= 1 || numel_ <= grain) {
+      forEachRun(0, numel_, fn);
+      return;
+    }
+    pool->parallelFor(0, numel_, grain, [&](Dim begin, Dim end) {
+      forEachRun(begin, end, fn);
+    });
+  }
+
+private:
+  /// Insert dimension @p d before the inner dimensions with larger
+  /// strides, stopping at the first one any operand orders differently.
+  static void insertByStride(Dims &order,
+                             const std::array<std::span<const Dim>, N> &strides,
+                             std::size_t d) {
+    std::size_t position = order.size();
+    while (position > 0 &&
+           shouldBeOuter(strides, d, static_cast<std::size_t>(
+                                         order[position - 1]))) {
+      --position;
+    }
+    order.pushBack(static_cast<Dim>(d));
+    for (std::size_t i = order.size() - 1; i > position; --i) {
+      order[i] = order[i - 1];
+    }
+    order[position] = static_cast<Dim>(d);
+  }
+
+  /// True when every operand with non-zero strides in both dimensions has
+  /// a strictly larger stride in @p a than in @p b.
+  static bool shouldBeOuter(const std::array<std::span<const Dim>, N> &strides,
+                            std::size_t a, std::size_t b) noexcept {
+    bool any = false;
+    for (std::size_t k = 0; k < N; ++k) {
+      const Dim sa = strides[k][a] < 0 ? -strides[k][a] : strides[k][a];
+      const Dim sb = strides[k][b] < 0 ? -strides[k][b] : strides[k][b];
+      if (sa == 0 || sb == 0) {
+        continue;
+      }
+      if (sa <= sb) {
+        return false;
+      }
+      any = true;
+    }
+    return any;
+  }
+
+  Dims dims_{};
+  std::array<Dims, N> strides_{};
+  Offsets inner_strides_{};
+  Offsets base_offsets_{};
+  Dim numel_{0};
+};
+
+} // namespace orteaf::internal::kernel::cpu
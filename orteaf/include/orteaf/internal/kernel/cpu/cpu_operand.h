@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <orteaf/internal/base/array_view.h>
+#include <orteaf/internal/base/small_vector.h>
+#include <orteaf/internal/dtype/dtype.h>
+#include <orteaf/internal/kernel/core/access.h>
+#include <orteaf/internal/kernel/core/kernel_entry.h>
+#include <orteaf/internal/kernel/param/param_id.h>
+#include <orteaf/internal/kernel/param/param_list.h>
+#include <orteaf/internal/kernel/schema/kernel_param_schema.h>
+#include <orteaf/internal/kernel/storage/operand_id.h>
+#include <orteaf/internal/kernel/storage/storage_binding.h>
+#include <orteaf/internal/storage/storage_lease.h>
+
+namespace orteaf::internal::kernel::cpu {
+
+/**
+ * @brief Host view of one kernel operand.
+ *
+ * Resolves a bound CPU storage plus its scoped Shape/Strides/Offset params
+ * into a raw pointer and element strides. @c data already points at the
+ * element selected by the layout offset.
+ */
+struct CpuOperand {
+  using Dim = std::int64_t;
+  using Dims = ::orteaf::internal::base::SmallVector<Dim, 4>;
+  using DType = ::orteaf::internal::DType;
+
+  std::byte *data{nullptr};
+  DType dtype{DType::F32};
+  Dims shape{};
+  Dims strides{};
+
+  std::size_t rank() const noexcept { return shape.size(); }
+
+  Dim numel() const noexcept {
+    Dim total = 1;
+    for (const auto dim : shape) {
+      total *= dim;
+    }
+    return total;
+  }
+
+  template <typename T> T *as() const noexcept {
+    return reinterpret_cast<T *>(data);
+  }
+};
+
+inline std::span<const CpuOperand::Dim>
+asSpan(const CpuOperand::Dims &dims) noexcept {
+  return {dims.data(), dims.size()};
+}
+
+inline bool sameShape(const CpuOperand::Dims &lhs,
+                      const CpuOperand::Dims &rhs) noexcept {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/**
+ * @brief Scoped layout params of one operand.
+ *
+ * Shape is required; Strides default to contiguous and Offset to zero, so
+ * callers binding only a shape still work. Usable as a field inside
+ * ORTEAF_EXTRACT_FIELDS.
+ */
+template <OperandId ID> struct CpuLayoutFields {
+  using View = ::orteaf::internal::base::ArrayView<const std::int64_t>;
+
+  ScopedField<ParamId::Shape, View, ID> shape;
+  OptionalScopedField<ParamId::Strides, View, ID> strides;
+  OptionalScopedField<ParamId::Offset, std::int64_t, ID> offset;
+
+  void extract(const ParamList &params) {
+    shape.extract(params);
+    strides.extract(params);
+    offset.extract(params);
+  }
+
+  /**
+   * @brief Fill the fields directly, for schemas packed into KernelArgs.
+   */
+  void assign(View shape_view, View strides_view, std::int64_t offset_value) {
+    shape.set(shape_view);
+    strides.set(strides_view);
+    offset.set(offset_value);
+  }
+};
+
+/**
+ * @brief Resolve a storage lease and layout into a CpuOperand.
+ *
+ * @param strides Element strides; an empty view means contiguous.
+ * @param access How the kernel uses the operand. File-mapped storage is
+ *        read-only and is only accepted for Access::Read.
+ * @throws InvalidParameter if the lease is not a CPU (heap or file-mapped)
+ *         storage, a file-mapped storage would be written, the strides rank
+ *         does not match the shape, or the buffer is invalid.
+ */
+CpuOperand
+makeCpuOperand(const ::orteaf::internal::storage::StorageLease &lease,
+               ::orteaf::internal::base::ArrayView<const std::int64_t> shape,
+               ::orteaf::internal::base::ArrayView<const std::int64_t> strides,
+               std::int64_t offset, Access access);
+
+/**
+ * @brief Resolve a schema storage field; its operand's access pattern
+ * decides whether read-only storage is accepted.
+ */
+template <typename StorageFieldT, OperandId ID>
+CpuOperand makeCpuOperand(const StorageFieldT &storage,
+                          const CpuLayoutFields<ID> &layout) {
+  return makeCpuOperand(
+      storage.template binding<StorageBinding>().lease, layout.shape.value,
+      layout.strides.valueOr({}), layout.offset.valueOr(0),
+      StorageFieldT::access());
+}
+
+/**
+ * @brief Compute the numpy-style broadcast of two shapes.
+ *
+ * @throws InvalidParameter if a dimension pair is neither equal nor 1.
+ */
+CpuOperand::Dims broadcastShape(std::span<const CpuOperand::Dim> lhs,
+                                std::span<const CpuOperand::Dim> rhs);
+
+/**
+ * @brief Strides that read @p operand as if it had shape @p target.
+ *
+ * Dimensions are right-aligned; missing and size-1 dimensions get stride 0.
+ *
+ * @throws InvalidParameter if @p operand cannot broadcast to @p target.
+ */
+CpuOperand::Dims broadcastStrides(const CpuOperand &operand,
+                                  std::span<const CpuOperand::Dim> target);
+
+/**
+ * @brief Architecture of the CPU kernel base held by a KernelEntry lease.
+ *
+ * @throws InvalidState if the lease does not hold a valid CPU kernel base.
+ */
+::orteaf::internal::architecture::Architecture
+kernelArchitecture(const core::KernelEntry::KernelBaseLease &lease);
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <orteaf/internal/kernel/cpu/cpu_iteration_plan.h>
+
+namespace orteaf::internal::kernel::cpu {
+
+/**
+ * @brief Walk N operands sharing one iteration shape, one inner run at a time.
+ *
+ * Shorthand for CpuIterationPlan<N>(shape, strides).forEachRun(fn): size-1
+ * dimensions are dropped, dimensions are ordered by stride and contiguous
+ * ones merged, so a fully contiguous tensor becomes a single run regardless
+ * of its rank. @p fn is called as `fn(offsets, count, inner_strides)` where
+ * offsets and strides are in elements per operand.
+ *
+ * @param shape Iteration shape.
+ * @param strides Per-operand element strides, each of rank shape.size().
+ */
+template <std::size_t N, typename Fn>
+void forEachInnerRun(
+    std::span<const std::int64_t> shape,
+    const std::array<std::span<const std::int64_t>, N> &strides, Fn &&fn) {
+  CpuIterationPlan<N>(shape, strides).forEachRun(fn);
+}
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+/**
+ * @brief Table of 1-D inner loops used by the CPU op kernels.
+ *
+ * Op kernels walk the outer dimensions of their operands and hand each
+ * innermost run to one of these functions. Every function accepts arbitrary
+ * element strides; SIMD implementations take the vector path when the output
+ * is unit-stride and each input is either unit-stride or broadcast
+ * (stride 0), and fall back to the scalar loop otherwise.
+ *
+ * F16 data is passed as raw IEEE binary16 bits and computed in F32.
+ */
+struct CpuVectorOps {
+  using Index = std::int64_t;
+
+  CpuIsa isa{CpuIsa::Scalar};
+
+  /// out[i] = a[i] + alpha * b[i]
+  void (*add_f32)(const float *a, Index a_stride, const float *b,
+                  Index b_stride, float *out, Index out_stride, Index count,
+                  float alpha){nullptr};
+  void (*add_f16)(const std::uint16_t *a, Index a_stride,
+                  const std::uint16_t *b, Index b_stride, std::uint16_t *out,
+                  Index out_stride, Index count, float alpha){nullptr};
+  void (*add_i32)(const std::int32_t *a, Index a_stride, const std::int32_t *b,
+                  Index b_stride, std::int32_t *out, Index out_stride,
+                  Index count, std::int32_t alpha){nullptr};
+
+  /// out[i] = max(in[i], 0)
+  void (*relu_f32)(const float *in, Index in_stride, float *out,
+                   Index out_stride, Index count){nullptr};
+  void (*relu_f16)(const std::uint16_t *in, Index in_stride,
+                   std::uint16_t *out, Index out_stride, Index count){nullptr};
+  void (*relu_i32)(const std::int32_t *in, Index in_stride, std::int32_t *out,
+                   Index out_stride, Index count){nullptr};
+
+  /// acc[i] += a * x[i] (acc is unit-stride F32 scratch)
+  void (*axpy_f32)(float a, const float *x, Index x_stride, float *acc,
+                   Index count){nullptr};
+  void (*axpy_f16)(float a, const std::uint16_t *x, Index x_stride, float *acc,
+                   Index count){nullptr};
+
+  /// out[i] = f16(in[i]) (in is unit-stride F32 scratch)
+  void (*store_f16)(const float *in, std::uint16_t *out, Index out_stride,
+                    Index count){nullptr};
+};
+
+/**
+ * @brief Get the vector op table for an ISA.
+ *
+ * Falls back to the widest narrower ISA supported by the host when @p isa is
+ * not available (see effectiveIsa()).
+ */
+const CpuVectorOps &vectorOps(CpuIsa isa) noexcept;
+
+/**
+ * @brief Convert an add's float alpha to the integer add_i32 takes.
+ *
+ * @throws InvalidParameter if @p alpha is not an integer in int32 range.
+ */
+std::int32_t i32AddAlpha(float alpha);
+
+namespace detail {
+
+/// a + alpha * b wrapping modulo 2^32 like the SIMD lanes (the signed
+/// expression is undefined on overflow).
+inline std::int32_t wrappingAddI32(std::int32_t a, std::int32_t b,
+                                   std::int32_t alpha) noexcept {
+  return static_cast<std::int32_t>(static_cast<std::uint32_t>(a) +
+                                   static_cast<std::uint32_t>(alpha) *
+                                       static_cast<std::uint32_t>(b));
+}
+
+// Per-ISA tables. Return nullptr when the ISA is not compiled in.
+const CpuVectorOps &scalarVectorOps() noexcept;
+const CpuVectorOps *neonVectorOps() noexcept;
+const CpuVectorOps *avx2VectorOps() noexcept;
+const CpuVectorOps *avx512VectorOps() noexcept;
+
+} // namespace detail
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <orteaf/internal/kernel/core/kernel_key.h>
+
+namespace orteaf::internal::kernel {
+class KernelArgs;
+} // namespace orteaf::internal::kernel
+
+namespace orteaf::internal::kernel::profile {
+
+/// Size buckets span x16 elements each: <16, <256, <4Ki, ... The last
+/// bucket collects launches without a Shape param.
+inline constexpr std::size_t kSizeBucketCount = 8;
+inline constexpr std::size_t kUnknownSizeBucket = kSizeBucketCount - 1;
+
+/// Latency buckets are powers of two in nanoseconds: [2^i, 2^(i+1)).
+inline constexpr std::size_t kLatencyBucketCount = 40;
+
+/**
+ * @brief Size bucket of a launch touching @p elements elements.
+ */
+std::size_t sizeBucketOf(std::int64_t elements) noexcept;
+
+/**
+ * @brief Size bucket of a launch, from the largest Shape param in @p args.
+ *
+ * Returns kUnknownSizeBucket when @p args carries no Shape param (e.g. only
+ * a packed schema).
+ */
+std::size_t sizeBucketOf(const KernelArgs &args) noexcept;
+
+/**
+ * @brief Latency histogram bucket of @p nanoseconds.
+ */
+std::size_t latencyBucketOf(std::uint64_t nanoseconds) noexcept;
+
+/**
+ * @brief Call count, total/min/max time and a log2 latency histogram.
+ */
+struct LatencySummary {
+  std::uint64_t calls{0};
+  std::uint64_t total_ns{0};
+  std::uint64_t min_ns{std::numeric_limits<std::uint64_t>::max()};
+  std::uint64_t max_ns{0};
+  std::array<std::uint64_t, kLatencyBucketCount> histogram{};
+
+  void add(std::uint64_t nanoseconds) noexcept;
+  void merge(const LatencySummary &other) noexcept;
+
+  double meanNs() const noexcept {
+    return calls == 0 ? 0.0
+                      : static_cast<double>(total_ns) /
+                            static_cast<double>(calls);
+  }
+};
+
+/**
+ * @brief Everything recorded for one KernelKey.
+ */
+struct KernelProfile {
+  KernelKey key{};
+  LatencySummary total{};
+  std::array<LatencySummary, kSizeBucketCount> by_size{};
+};
+
+/**
+ * @brief Opt-in per-KernelKey execution profiler.
+ *
+ * While installed, KernelEntry::run() times one launch out of every
+ * Config::sample_every on each thread and records it under the entry's
+ * KernelKey (set by KernelRegistry when it builds the entry) and the
+ * launch's size bucket. When no profiler is installed the hook costs one
+ * atomic load per launch; with one installed, unsampled launches cost a
+ * thread-local counter increment.
+ *
+ * Counts are of sampled launches; multiply by sample_every to estimate the
+ * real call count (the JSON export does so in "estimated_calls").
+ *
+ * Example:
+ * @code
+ * KernelProfiler profiler({.sample_every = 64});
+ * KernelProfiler::install(&profiler);
+ * runInference();
+ * KernelProfiler::install(nullptr);
+ * profiler.writeJson("kernel_profile.json");
+ * @endcode
+ */
+class KernelProfiler {
+public:
+  struct Config {
+    /// Time one launch out of this many per thread; 0 and 1 time all.
+    std::uint32_t sample_every{1};
+  };
+
+  KernelProfiler() : KernelProfiler(Config{}) {}
+  explicit KernelProfiler(Config config) : config_(config) {}
+
+  KernelProfiler(const KernelProfiler &) = delete;
+  KernelProfiler &operator=(const KernelProfiler &) = delete;
+
+  /**
+   * @brief Make @p profiler the one KernelEntry::run() reports to.
+   *
+   * Pass nullptr to stop profiling. The caller keeps ownership and must not
+   * destroy an installed profiler while kernels may still be running.
+   */
+  static void install(KernelProfiler *profiler) noexcept {
+    active_.store(profiler, std::memory_order_release);
+  }
+
+  /**
+   * @brief The installed profiler, or nullptr.
+   */
+  static KernelProfiler *active() noexcept {
+    return active_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Decide whether the calling thread's next launch is timed.
+   */
+  bool shouldSample() noexcept {
+    if (config_.sample_every <= 1) {
+      return true;
+    }
+    thread_local std::uint32_t countdown = 0;
+    if (countdown == 0) {
+      countdown = config_.sample_every - 1;
+      return true;
+    }
+    --countdown;
+    return false;
+  }
+
+  /**
+   * @brief Record one timed launch.
+   */
+  void record(KernelKey key, std::size_t size_bucket,
+              std::uint64_t nanoseconds);
+
+  /**
+   * @brief Record one timed launch, bucketing by the Shape params of @p args.
+   */
+  void record(KernelKey key, const KernelArgs &args,
+              std::uint64_t nanoseconds) {
+    record(key, sizeBucketOf(args), nanoseconds);
+  }
+
+  /**
+   * @brief Profile of @p key, if it was recorded.
+   */
+  std::optional<KernelProfile> find(KernelKey key) const;
+
+  /**
+   * @brief All profiles, most total time first.
+   */
+  std::vector<KernelProfile> snapshot() const;
+
+  /**
+   * @brief Drop everything recorded so far.
+   */
+  void reset();
+
+  /**
+   * @brief Export all profiles as a JSON document.
+   */
+  std::string toJson() const;
+
+  /**
+   * @brief Write toJson() to @p path.
+   *
+   * @return false if the file could not be written.
+   */
+  bool writeJson(const std::string &path) const;
+
+  const Config &config() const noexcept { return config_; }
+
+private:
+  static inline std::atomic<KernelProfiler *> active_{nullptr};
+
+  Config config_;
+  mutable std::mutex mutex_;
+  std::unordered_map<KernelKey, KernelProfile> profiles_;
+};
+
+} // namespace orteaf::internal::kernel::profile
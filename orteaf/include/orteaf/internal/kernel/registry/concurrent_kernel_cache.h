@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "orteaf/internal/kernel/core/kernel_entry.h"
+#include "orteaf/internal/kernel/core/kernel_key.h"
+
+namespace orteaf::internal::kernel::registry {
+
+/**
+ * @brief Lock-free read index over the KernelRegistry Cache tier.
+ *
+ * A set-associative table: each key hashes to one bucket of kWays slots
+ * laid out in a single cache line, so a lookup touches one line and never
+ * probes further. Readers only load atomics; the one store they may do is
+ * setting the slot's CLOCK reference bit, and only when it is clear, so
+ * steady-state hits leave shared memory untouched.
+ *
+ * Writers (insert/erase/clear and the reference-bit sweep) must be
+ * serialized by the caller. Entries are published by pointer; the caller
+ * must keep an entry alive until no reader can still hold it, which
+ * KernelRegistry does by retiring evicted entries instead of destroying
+ * them.
+ */
+class ConcurrentKernelCache {
+public:
+  using Entry = ::orteaf::internal::kernel::core::KernelEntry;
+  using Key = ::orteaf::internal::kernel::KernelKey;
+
+  static constexpr std::size_t kWays = 4;
+
+  /**
+   * @param capacity Expected number of resident keys. Buckets are sized
+   * for twice this so conflicts within a bucket stay rare.
+   */
+  explicit ConcurrentKernelCache(std::size_t capacity)
+      : bucket_count_(std::bit_ceil(
+            std::max<std::size_t>(1, (2 * capacity + kWays - 1) / kWays))),
+        buckets_(std::make_unique<Bucket[]>(bucket_count_)) {}
+
+  ConcurrentKernelCache(const ConcurrentKernelCache &) = delete;
+  ConcurrentKernelCache &operator=(const ConcurrentKernelCache &) = delete;
+
+  /**
+   * @brief Find @p key without locking. Safe against concurrent writers.
+   *
+   * @return The published entry, or nullptr if the key is not resident.
+   */
+  Entry *find(Key key) const noexcept {
+    const auto raw = static_cast<std::uint64_t>(key);
+    Bucket &bucket = bucketOf(raw);
+    for (std::size_t way = 0; way < kWays; ++way) {
+      if (bucket.keys[way].load(std::memory_order_acquire) != raw) {
+        continue;
+      }
+      Entry *entry = bucket.entries[way].load(std::memory_order_acquire);
+      // A writer may have replaced the slot between the two loads.
+      if (entry == nullptr ||
+          bucket.keys[way].load(std::memory_order_acquire) != raw) {
+        return nullptr;
+      }
+      const auto bit = static_cast<std::uint8_t>(1u << way);
+      if ((bucket.referenced.load(std::memory_order_relaxed) & bit) == 0) {
+        bucket.referenced.fetch_or(bit, std::memory_order_relaxed);
+      }
+      return entry;
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief True if @p key was read through find() since it was inserted or
+   * since the last call, which clears the bit (CLOCK second chance).
+   *
+   * Writer side.
+   */
+  bool testAndClearReferenced(Key key) noexcept {
+    const auto raw = static_cast<std::uint64_t>(key);
+    Bucket &bucket = bucketOf(raw);
+    const std::size_t way = wayOf(bucket, raw);
+    if (way == kWays) {
+      return false;
+    }
+    const auto bit = static_cast<std::uint8_t>(1u << way);
+    return (bucket.referenced.fetch_and(static_cast<std::uint8_t>(~bit),
+                                        std::memory_order_relaxed) &
+            bit) != 0;
+  }
+
+  /**
+   * @brief Publish @p entry under @p key. Writer side.
+   *
+   * When the bucket is full, a slot whose reference bit is clear is
+   * replaced (CLOCK within the bucket). The displaced key only disappears
+   * from this index; the registry tiers are unaffected.
+   */
+  void insert(Key key, Entry *entry) noexcept {
+    const auto raw = static_cast<std::uint64_t>(key);
+    Bucket &bucket = bucketOf(raw);
+    std::size_t way = wayOf(bucket, raw);
+    if (way == kWays) {
+      way = wayOf(bucket, kernel_key::kEmptyRaw);
+    }
+    if (way == kWays) {
+      way = clockVictim(bucket);
+    } else if (bucket.keys[way].load(std::memory_order_relaxed) ==
+               kernel_key::kEmptyRaw) {
+      ++size_;
+    }
+    writeSlot(bucket, way, raw, entry);
+  }
+
+  /**
+   * @brief Unpublish @p key. Writer side.
+   */
+  void erase(Key key) noexcept {
+    const auto raw = static_cast<std::uint64_t>(key);
+    Bucket &bucket = bucketOf(raw);
+    const std::size_t way = wayOf(bucket, raw);
+    if (way == kWays) {
+      return;
+    }
+    bucket.keys[way].store(kernel_key::kEmptyRaw, std::memory_order_release);
+    bucket.entries[way].store(nullptr, std::memory_order_release);
+    --size_;
+  }
+
+  /**
+   * @brief Unpublish every key. Writer side.
+   */
+  void clear() noexcept {
+    for (std::size_t b = 0; b < bucket_count_; ++b) {
+      for (std::size_t way = 0; way < kWays; ++way) {
+        buckets_[b].keys[way].store(kernel_key::kEmptyRaw,
+                                    std::memory_order_release);
+        buckets_[b].entries[way].store(nullptr, std::memory_order_release);
+      }
+      buckets_[b].referenced.store(0, std::memory_order_relaxed);
+    }
+    size_ = 0;
+  }
+
+  /// Number of published keys. Writer side.
+  std::size_t size() const noexcept { return size_; }
+
+  /// Total number of slots.
+  std::size_t slotCount() const noexcept { return bucket_count_ * kWays; }
+
+private:
+  struct alignas(64) Bucket {
+    std::array<std::atomic<std::uint64_t>, kWays> keys;
+    std::array<std::atomic<Entry *>, kWays> entries;
+    // Lives on its own line: readers set it, and keeping it apart from the
+    // keys avoids invalidating the line every other reader is loading.
+    alignas(64) std::atomic<std::uint8_t> referenced{0};
+
+    Bucket() noexcept {
+      for (std::size_t way = 0; way < kWays; ++way) {
+        keys[way].store(kernel_key::kEmptyRaw, std::memory_order_relaxed);
+        entries[way].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  Bucket &bucketOf(std::uint64_t raw) const noexcept {
+    return buckets_[kernel_key::slotHash(raw) & (bucket_count_ - 1)];
+  }
+
+  static std::size_t wayOf(const Bucket &bucket, std::uint64_t raw) noexcept {
+    for (std::size_t way = 0; way < kWays; ++way) {
+      if (bucket.keys[way].load(std::memory_order_relaxed) == raw) {
+        return way;
+      }
+    }
+    return kWays;
+  }
+
+  static std::size_t clockVictim(Bucket &bucket) noexcept {
+    const std::uint8_t referenced =
+        bucket.referenced.load(std::memory_order_relaxed);
+    for (std::size_t way = 0; way < kWays; ++way) {
+      if ((referenced & (1u << way)) == 0) {
+        return way;
+      }
+    }
+    // Everything was referenced: give every slot its second chance.
+    bucket.referenced.store(0, std::memory_order_relaxed);
+    return 0;
+  }
+
+  static void writeSlot(Bucket &bucket, std::size_t way, std::uint64_t raw,
+                        Entry *entry) noexcept {
+    // Hide the slot first so no reader pairs the new entry with an old key.
+    bucket.keys[way].store(kernel_key::kEmptyRaw, std::memory_order_release);
+    bucket.entries[way].store(entry, std::memory_order_release);
+    bucket.keys[way].store(raw, std::memory_order_release);
+    bucket.referenced.fetch_and(static_cast<std::uint8_t>(~(1u << way)),
+                                std::memory_order_relaxed);
+  }
+
+  std::size_t bucket_count_;
+  std::unique_ptr<Bucket[]> buckets_;
+  std::size_t size_{0};
+};
+
+} // namespace orteaf::internal::kernel::registry
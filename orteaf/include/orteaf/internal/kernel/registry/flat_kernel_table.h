@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "orteaf/internal/kernel/core/kernel_key.h"
+
+namespace orteaf::internal::kernel::registry {
+
+/**
+ * @brief Fixed-capacity KernelKey table with inline LRU order.
+ *
+ * One KernelRegistry tier. Slots live in a single array sized to a power
+ * of two at least twice the capacity and are found by linear probing, so a
+ * lookup is one probe sequence over adjacent slots. Each slot carries the
+ * key, the value and its LRU links as slot indices; touching, inserting
+ * and evicting only rewrite links and never allocate. Erasure uses
+ * backward-shift deletion, so there are no tombstones and probe sequences
+ * stay short under churn.
+ *
+ * Values move when neighbouring keys are erased; hold values that must
+ * stay put (such as entries) behind a pointer.
+ *
+ * @tparam Value Movable, default-constructible mapped type
+ */
+template <typename Value> class FlatKernelTable {
+public:
+  using Key = ::orteaf::internal::kernel::KernelKey;
+
+  /**
+   * @param capacity Maximum number of keys; at least one is always allowed.
+   */
+  explicit FlatKernelTable(std::size_t capacity)
+      : capacity_(std::max<std::size_t>(capacity, 1)),
+        mask_(std::bit_ceil(std::max<std::size_t>(2 * capacity_, 8)) - 1),
+        slots_(std::make_unique<Slot[]>(mask_ + 1)) {}
+
+  FlatKernelTable(const FlatKernelTable &) = delete;
+  FlatKernelTable &operator=(const FlatKernelTable &) = delete;
+
+  [[nodiscard]] std::size_t size() const noexcept { return size_; }
+  [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] bool full() const noexcept { return size_ >= capacity_; }
+  [[nodiscard]] std::size_t slotCount() const noexcept { return mask_ + 1; }
+
+  [[nodiscard]] bool contains(Key key) const noexcept {
+    return indexOf(raw(key)) != kNil;
+  }
+
+  /**
+   * @brief Find @p key without changing its recency.
+   */
+  Value *find(Key key) noexcept {
+    const std::uint32_t index = indexOf(raw(key));
+    return index == kNil ? nullptr : &slots_[index].value;
+  }
+
+  /**
+   * @brief Find @p key and make it the most recently used.
+   */
+  Value *findAndTouch(Key key) noexcept {
+    const std::uint32_t index = indexOf(raw(key));
+    if (index == kNil) {
+      return nullptr;
+    }
+    moveToFront(index);
+    return &slots_[index].value;
+  }
+
+  /**
+   * @brief Make @p key the most recently used. No-op if absent.
+   */
+  void touch(Key key) noexcept { findAndTouch(key); }
+
+  /**
+   * @brief Insert @p key as the most recently used.
+   *
+   * Preconditions: @p key is absent and the table is not full().
+   */
+  Value &insertFront(Key key, Value value) {
+    const std::uint64_t k = raw(key);
+    std::uint32_t index = home(k);
+    while (slots_[index].key != kernel_key::kEmptyRaw) {
+      index = (index + 1) & mask_;
+    }
+    Slot &slot = slots_[index];
+    slot.key = k;
+    slot.value = std::move(value);
+    linkFront(index);
+    ++size_;
+    return slot.value;
+  }
+
+  /**
+   * @brief Least recently used key, or std::nullopt when empty.
+   */
+  [[nodiscard]] std::optional<Key> backKey() const noexcept {
+    if (tail_ == kNil) {
+      return std::nullopt;
+    }
+    return static_cast<Key>(slots_[tail_].key);
+  }
+
+  /**
+   * @brief Remove @p key, moving its value into @p out when given.
+   *
+   * @return true if the key was present
+   */
+  bool erase(Key key, Value *out = nullptr) {
+    const std::uint32_t index = indexOf(raw(key));
+    if (index == kNil) {
+      return false;
+    }
+    if (out != nullptr) {
+      *out = std::move(slots_[index].value);
+    }
+    eraseAt(index);
+    return true;
+  }
+
+  /**
+   * @brief Remove the least recently used key, storing it in @p key and
+   * moving its value into @p out when given.
+   *
+   * @return false if the table was empty
+   */
+  bool popBack(Key *key, Value *out = nullptr) {
+    if (tail_ == kNil) {
+      return false;
+    }
+    *key = static_cast<Key>(slots_[tail_].key);
+    if (out != nullptr) {
+      *out = std::move(slots_[tail_].value);
+    }
+    eraseAt(tail_);
+    return true;
+  }
+
+  void clear() {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      slots_[i] = Slot{};
+    }
+    head_ = tail_ = kNil;
+    size_ = 0;
+  }
+
+  /**
+   * @brief Visit keys from most to least recently used.
+   */
+  template <typename Fn> void forEachByRecency(Fn &&fn) const {
+    for (std::uint32_t i = head_; i != kNil; i = slots_[i].next) {
+      fn(static_cast<Key>(slots_[i].key), slots_[i].value);
+    }
+  }
+
+private:
+  static constexpr std::uint32_t kNil = ~std::uint32_t{0};
+
+  struct Slot {
+    std::uint64_t key{kernel_key::kEmptyRaw};
+    std::uint32_t prev{kNil};
+    std::uint32_t next{kNil};
+    Value value{};
+  };
+
+  static std::uint64_t raw(Key key) noexcept {
+    return static_cast<std::uint64_t>(key);
+  }
+
+  std::uint32_t home(std::uint64_t k) const noexcept {
+    return kernel_key::slotHash(k) & static_cast<std::uint32_t>(mask_);
+  }
+
+  std::uint32_t indexOf(std::uint64_t k) const noexcept {
+    for (std::uint32_t index = home(k);; index = (index + 1) & mask_) {
+      if (slots_[index].key == k) {
+        return index;
+      }
+      if (slots_[index].key == kernel_key::kEmptyRaw) {
+        return kNil;
+      }
+    }
+  }
+
+  void linkFront(std::uint32_t index) noexcept {
+    slots_[index].prev = kNil;
+    slots_[index].next = head_;
+    if (head_ != kNil) {
+      slots_[head_].prev = index;
+    } else {
+      tail_ = index;
+    }
+    head_ = index;
+  }
+
+  void unlink(std::uint32_t index) noexcept {
+    const Slot &slot = slots_[index];
+    if (slot.prev != kNil) {
+      slots_[slot.prev].next = slot.next;
+    } else {
+      head_ = slot.next;
+    }
+    if (slot.next != kNil) {
+      slots_[slot.next].prev = slot.prev;
+    } else {
+      tail_ = slot.prev;
+    }
+  }
+
+  void moveToFront(std::uint32_t index) noexcept {
+    if (head_ == index) {
+      return;
+    }
+    unlink(index);
+    linkFront(index);
+  }
+
+  /// Move the slot at @p from into the empty slot @p to, keeping its
+  /// neighbours' links pointing at it.
+  void relocate(std::uint32_t from, std::uint32_t to) {
+    Slot &src = slots_[from];
+    if (src.prev != kNil) {
+      slots_[src.prev].next = to;
+    } else {
+      head_ = to;
+    }
+    if (src.next != kNil) {
+      slots_[src.next].prev = to;
+    } else {
+      tail_ = to;
+    }
+    slots_[to] = std::move(src);
+  }
+
+  void eraseAt(std::uint32_t hole) {
+    unlink(hole);
+    --size_;
+    // Backward-shift: pull later members of the probe run into the hole so
+    // no lookup has to step over an empty slot to reach them.
+    for (std::uint32_t index = (hole + 1) & mask_;
+         slots_[index].key != kernel_key::kEmptyRaw;
+         index = (index + 1) & mask_) {
+      const std::uint32_t desired = home(slots_[index].key);
+      // Distance from the home slot to the hole vs. to the current slot.
+      if (((hole - desired) & mask_) < ((index - desired) & mask_)) {
+        relocate(index, hole);
+        hole = index;
+      }
+    }
+    slots_[hole] = Slot{};
+  }
+
+  std::size_t capacity_;
+  std::size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  std::uint32_t head_{kNil};
+  std::uint32_t tail_{kNil};
+  std::size_t size_{0};
+};
+
+} // namespace orteaf::internal::kernel::registry
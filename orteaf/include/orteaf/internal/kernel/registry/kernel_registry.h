@@ -1,16 +1,25 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
-#include "orteaf/internal/base/lru_list.h"
 #include "orteaf/internal/kernel/core/kernel_key.h"
 #include "orteaf/internal/kernel/core/kernel_entry.h"
 #include "orteaf/internal/kernel/core/kernel_metadata.h"
+#include "orteaf/internal/kernel/registry/concurrent_kernel_cache.h"
+#include "orteaf/internal/kernel/registry/flat_kernel_table.h"
 #include "orteaf/internal/kernel/registry/kernel_registry_config.h"
+#include "orteaf/internal/kernel/registry/persistent_kernel_store.h"
 
 namespace orteaf::internal::kernel::registry {
 
+class KernelWarmup;
+
 /**
  * @brief 3-tier cache KernelRegistry with LRU eviction.
  *
@@ -20,8 +29,34 @@ namespace orteaf::internal::kernel::registry {
  * - Secondary Storage: Unbounded, holds lightweight Metadata for reconstruction
  *
  * Uses LRU (Least Recently Used) algorithm for eviction at each tier.
- * KernelKey serves as the virtual address for kernel lookup.
+ * KernelKey serves as the virtual address for kernel lookup. The bounded
+ * tiers are FlatKernelTables sized from the configuration up front, so a
+ * hit is a single probe sequence and promotion or eviction never
+ * allocates bookkeeping.
+ *
+ * With KernelRegistryConfig::concurrent set, the registry may be shared
+ * between threads. The Cache tier is then mirrored into a
+ * ConcurrentKernelCache, and lookup() hits it without taking a lock or
+ * writing to shared memory. Everything else (misses, promotion, eviction,
+ * registration) runs under one mutex. Cache hits no longer move entries in
+ * the Cache LRU; eviction approximates it with CLOCK reference bits
+ * instead. Entries evicted from Main Memory are retired rather than
+ * destroyed, because a concurrent reader may still be running them. A
+ * retired entry is revived, not rebuilt, when its key is promoted again, so
+ * at most one entry per registered key is ever retired and the retired set
+ * stays bounded however long the registry runs. clear() releases it, and
+ * reclaimRetired() does so at any other point where no kernel from this
+ * registry is in flight.
+ *
+ * A PersistentKernelStore can be attached as an on-disk tier below
+ * Secondary Storage: registrations are recorded in it, saveWorkingSet()
+ * remembers which kernels were in Main Memory, and warmFromStore() rebuilds
+ * that working set in a restarted process before its first dispatch.
  *
+ * KernelWarmup promotes a whole manifest of kernels on background threads.
+ * Rebuilds acquire leases from pools that are not thread-safe, so they
+ * run under the registry mutex; the warm-up overlaps with the caller's
+ * other initialization rather than with itself.
  */
 class KernelRegistry {
 public:
@@ -40,6 +75,13 @@ public:
     std::size_t main_memory_hits{0};
     std::size_t secondary_hits{0};
     std::size_t misses{0};
+    /// Manifest warm-up (KernelWarmup): keys requested so far, keys now
+    /// resident, keys not registered, and rebuild time summed over threads.
+    /// Warm-up promotions are not counted as hits or misses above.
+    std::size_t prefetch_requested{0};
+    std::size_t prefetched{0};
+    std::size_t prefetch_missing{0};
+    std::uint64_t prefetch_nanoseconds{0};
   };
 
 private:
@@ -47,6 +89,11 @@ private:
   void recordCacheHit() noexcept {
 #if defined(ORTEAF_STATS_LEVEL_CORE_VALUE) && ORTEAF_STATS_LEVEL_CORE_VALUE <= 4
     ++stats_.cache_hits;
+#endif
+  }
+  void recordPublishedHit() noexcept {
+#if defined(ORTEAF_STATS_LEVEL_CORE_VALUE) && ORTEAF_STATS_LEVEL_CORE_VALUE <= 4
+    published_hits_.fetch_add(1, std::memory_order_relaxed);
 #endif
   }
   void recordMainMemoryHit() noexcept {
@@ -62,6 +109,22 @@ private:
   void recordMiss() noexcept {
 #if defined(ORTEAF_STATS_LEVEL_CORE_VALUE) && ORTEAF_STATS_LEVEL_CORE_VALUE <= 4
     ++stats_.misses;
+#endif
+  }
+  void recordPrefetchRequested(std::size_t count) noexcept {
+#if defined(ORTEAF_STATS_LEVEL_CORE_VALUE) && ORTEAF_STATS_LEVEL_CORE_VALUE <= 4
+    stats_.prefetch_requested += count;
+#else
+    (void)count;
+#endif
+  }
+  void recordPrefetch(bool found, std::uint64_t nanoseconds) noexcept {
+#if defined(ORTEAF_STATS_LEVEL_CORE_VALUE) && ORTEAF_STATS_LEVEL_CORE_VALUE <= 4
+    ++(found ? stats_.prefetched : stats_.prefetch_missing);
+    stats_.prefetch_nanoseconds += nanoseconds;
+#else
+    (void)found;
+    (void)nanoseconds;
 #endif
   }
 
@@ -70,14 +133,21 @@ public:
   /**
    * @brief Construct registry with default configuration.
    */
-  KernelRegistry() = default;
+  KernelRegistry() : KernelRegistry(KernelRegistryConfig{}) {}
 
   /**
    * @brief Construct registry with custom configuration.
    */
-  explicit KernelRegistry(KernelRegistryConfig config) : config_(config) {}
+  explicit KernelRegistry(KernelRegistryConfig config)
+      : config_(config), cache_(config.cache_capacity),
+        main_memory_(config.main_memory_capacity) {
+    if (config_.concurrent) {
+      published_ =
+          std::make_unique<ConcurrentKernelCache>(config_.cache_capacity);
+    }
+  }
 
-  // Non-copyable and non-movable (LRU list is intrusive)
+  // Non-copyable and non-movable (entries are handed out by pointer)
   KernelRegistry(const KernelRegistry &) = delete;
   KernelRegistry &operator=(const KernelRegistry &) = delete;
   KernelRegistry(KernelRegistry &&) = delete;
@@ -90,32 +160,22 @@ public:
    * If found in a lower tier, promotes to higher tier.
    * Updates LRU position on access.
    *
+   * In concurrent mode a Cache hit is served lock-free; any other outcome
+   * takes the registry mutex.
+   *
    * @param key Kernel key to look up
    * @return Pointer to entry, or nullptr if not found
    */
   Entry *lookup(Key key) {
-    // Try Cache first
-    if (auto *entry = lookupCache(key)) {
-      recordCacheHit();
-      return entry;
+    if (published_ == nullptr) {
+      return lookupTiers(key);
     }
-
-    // Try Main Memory
-    if (auto *entry = lookupMainMemory(key)) {
-      recordMainMemoryHit();
-      promoteToCache(key, entry);
+    if (auto *entry = published_->find(key)) {
+      recordPublishedHit();
       return entry;
     }
-
-    // Try Secondary Storage (rebuilds entry)
-    if (auto *entry = lookupSecondaryStorage(key)) {
-      recordSecondaryHit();
-      promoteToCache(key, entry);
-      return entry;
-    }
-
-    recordMiss();
-    return nullptr;
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lookupTiers(key);
   }
 
   /**
@@ -128,12 +188,20 @@ public:
    * @param metadata Metadata for kernel reconstruction
    */
   void registerKernel(Key key, Metadata metadata) {
+    auto lock = lockIfConcurrent();
     // If already in any tier, skip
-    if (cache_.count(key) > 0 || main_memory_.count(key) > 0 ||
+    if (cache_.contains(key) || main_memory_.contains(key) ||
         secondary_storage_.count(key) > 0) {
       return;
     }
     secondary_storage_[key] = std::move(metadata);
+    generation_.store(nextGeneration(), std::memory_order_release);
+    fingerprint_.fetch_xor(fingerprintOf(key), std::memory_order_relaxed);
+    if (store_ != nullptr && !store_->findMetadata(key).has_value()) {
+      store_->putMetadata(
+          key, {::orteaf::internal::kernel::kernel_key::getArchitecture(key),
+                false});
+    }
   }
 
   /**
@@ -143,13 +211,43 @@ public:
    * @return true if kernel is registered
    */
   [[nodiscard]] bool contains(Key key) const {
-    return cache_.count(key) > 0 || main_memory_.count(key) > 0 ||
+    auto lock = lockIfConcurrent();
+    return cache_.contains(key) || main_memory_.contains(key) ||
            secondary_storage_.count(key) > 0;
   }
 
+  /**
+   * @brief Visit every registered key (all tiers), in no particular order.
+   *
+   * In concurrent mode @p fn runs under the registry mutex and must not
+   * call back into the registry.
+   */
+  template <typename Fn> void forEachKey(Fn &&fn) const {
+    auto lock = lockIfConcurrent();
+    main_memory_.forEachByRecency(
+        [&](Key key, const std::unique_ptr<Entry> &) { fn(key); });
+    for (const auto &[key, metadata] : secondary_storage_) {
+      fn(key);
+    }
+  }
+
+  /**
+   * @brief Visit the keys in Main Memory, most recently used first.
+   *
+   * In concurrent mode @p fn runs under the registry mutex and must not
+   * call back into the registry.
+   */
+  template <typename Fn> void forEachResidentKey(Fn &&fn) const {
+    auto lock = lockIfConcurrent();
+    main_memory_.forEachByRecency(
+        [&](Key key, const std::unique_ptr<Entry> &) { fn(key); });
+  }
+
   /**
    * @brief Prefetch a kernel into Cache from lower tiers.
    *
+   * Runs on the calling thread; see KernelWarmup for warming many kernels.
+   *
    * @param key Kernel key to prefetch
    * @return true if kernel was found and prefetched
    */
@@ -161,42 +259,172 @@ public:
    * Clears Cache but keeps entries in Main Memory.
    */
   void flush() {
+    auto lock = lockIfConcurrent();
     cache_.clear();
-    cache_lru_.clear();
-    cache_nodes_.clear();
+    if (published_ != nullptr) {
+      published_->clear();
+    }
   }
 
   /**
    * @brief Clear all tiers.
+   *
+   * In concurrent mode this destroys entries, so no kernel obtained from
+   * the registry may be in flight.
    */
   void clear() {
+    auto lock = lockIfConcurrent();
     cache_.clear();
-    cache_lru_.clear();
-    cache_nodes_.clear();
+    if (published_ != nullptr) {
+      published_->clear();
+    }
 
     main_memory_.clear();
-    main_memory_lru_.clear();
-    main_memory_nodes_.clear();
 
     secondary_storage_.clear();
+    retired_.clear();
 
     stats_ = {};
+    published_hits_.store(0, std::memory_order_relaxed);
+    generation_.store(nextGeneration(), std::memory_order_release);
+    fingerprint_.store(0, std::memory_order_relaxed);
+  }
+
+  // ----- Persistent tier -----
+
+  /**
+   * @brief Attach (or, with nullptr, detach) an on-disk tier.
+   *
+   * The store is not owned and must outlive the attachment. Keys already
+   * registered are recorded.
+   */
+  void attachPersistentStore(PersistentKernelStore *store) {
+    auto lock = lockIfConcurrent();
+    store_ = store;
+    if (store_ == nullptr) {
+      return;
+    }
+    auto record = [&](Key key) {
+      if (!store_->findMetadata(key).has_value()) {
+        store_->putMetadata(
+            key,
+            {::orteaf::internal::kernel::kernel_key::getArchitecture(key),
+             false});
+      }
+    };
+    main_memory_.forEachByRecency(
+        [&](Key key, const std::unique_ptr<Entry> &) { record(key); });
+    for (const auto &[key, metadata] : secondary_storage_) {
+      record(key);
+    }
+  }
+
+  [[nodiscard]] PersistentKernelStore *persistentStore() const noexcept {
+    return store_;
+  }
+
+  /**
+   * @brief Record the current Main Memory tier as the working set in the
+   * attached store and flush it to disk.
+   *
+   * @return Number of kernels marked, or 0 without a store
+   */
+  std::size_t saveWorkingSet() {
+    auto lock = lockIfConcurrent();
+    if (store_ == nullptr) {
+      return 0;
+    }
+    std::size_t marked = 0;
+    store_->markResident([&](Key key) {
+      const bool resident = main_memory_.contains(key);
+      marked += resident ? 1 : 0;
+      return resident;
+    });
+    store_->sync();
+    return marked;
+  }
+
+  /**
+   * @brief Rebuild the working set saved by a previous run.
+   *
+   * Kernels that were resident at the last saveWorkingSet() and are
+   * registered in this process are promoted into Main Memory and Cache.
+   *
+   * @return Number of kernels warmed
+   */
+  std::size_t warmFromStore() {
+    std::vector<Key> resident;
+    if (store_ == nullptr) {
+      return 0;
+    }
+    store_->forEachMetadata(
+        [&](Key key, const PersistentKernelStore::MetadataRecord &record) {
+          if (record.resident) {
+            resident.push_back(key);
+          }
+        });
+    std::size_t warmed = 0;
+    for (const Key key : resident) {
+      if (contains(key) && lookup(key) != nullptr) {
+        ++warmed;
+      }
+    }
+    return warmed;
+  }
+
+  /**
+   * @brief Order-independent hash of the registered key set.
+   *
+   * Equal in two processes that registered the same kernels, so results
+   * derived from the key set (persisted resolutions) can be reused across
+   * runs only while it matches.
+   */
+  [[nodiscard]] std::uint64_t keySetFingerprint() const noexcept {
+    return fingerprint_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Destroy entries retired by Main Memory eviction in concurrent
+   * mode.
+   *
+   * Optional: the retired set is bounded by the registered key count. Only
+   * safe when no kernel obtained from this registry is in flight.
+   *
+   * @return Number of entries destroyed
+   */
+  std::size_t reclaimRetired() {
+    auto lock = lockIfConcurrent();
+    const std::size_t count = retired_.size();
+    retired_.clear();
+    return count;
   }
 
   /**
    * @brief Get performance statistics.
+   *
+   * Returns a copy; in concurrent mode it is a snapshot taken under the
+   * registry mutex, with lock-free Cache hits counted in cache_hits.
    */
-  [[nodiscard]] const Stats &stats() const noexcept { return stats_; }
+  [[nodiscard]] Stats stats() const noexcept {
+    auto lock = lockIfConcurrent();
+    Stats snapshot = stats_;
+    snapshot.cache_hits += published_hits_.load(std::memory_order_relaxed);
+    return snapshot;
+  }
 
   /**
    * @brief Get current Cache tier size.
    */
-  [[nodiscard]] std::size_t cacheSize() const noexcept { return cache_.size(); }
+  [[nodiscard]] std::size_t cacheSize() const noexcept {
+    auto lock = lockIfConcurrent();
+    return cache_.size();
+  }
 
   /**
    * @brief Get current Main Memory tier size.
    */
   [[nodiscard]] std::size_t mainMemorySize() const noexcept {
+    auto lock = lockIfConcurrent();
     return main_memory_.size();
   }
 
@@ -204,9 +432,30 @@ public:
    * @brief Get current Secondary Storage tier size.
    */
   [[nodiscard]] std::size_t secondaryStorageSize() const noexcept {
+    auto lock = lockIfConcurrent();
     return secondary_storage_.size();
   }
 
+  /**
+   * @brief Get number of retired entries awaiting reclaimRetired().
+   */
+  [[nodiscard]] std::size_t retiredSize() const noexcept {
+    auto lock = lockIfConcurrent();
+    return retired_.size();
+  }
+
+  /**
+   * @brief Token that changes whenever the set of registered keys may have
+   * changed (registerKernel() adding a key, clear()).
+   *
+   * Moving entries between tiers does not change it. Values are never
+   * reused, even across registries, so memoized key resolutions
+   * (key_resolver::ResolveCache) can be checked against it.
+   */
+  [[nodiscard]] std::uint64_t generation() const noexcept {
+    return generation_.load(std::memory_order_acquire);
+  }
+
   /**
    * @brief Get configuration.
    */
@@ -214,104 +463,171 @@ public:
     return config_;
   }
 
-#if ORTEAF_ENABLE_TESTING
-  auto &cacheNodesForTest() noexcept { return cache_nodes_; }
-  auto &mainMemoryNodesForTest() noexcept { return main_memory_nodes_; }
-#endif
-
 private:
-  using LruNode = base::LruNode<Key>;
-  using LruList = base::LruList<Key>;
+  static std::uint64_t fingerprintOf(Key key) noexcept {
+    std::uint64_t x = static_cast<std::uint64_t>(key);
+    // splitmix64 finalizer: XOR of mixed keys does not cancel structure.
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+  }
+
+  static std::uint64_t nextGeneration() noexcept {
+    static std::atomic<std::uint64_t> counter{1};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::unique_lock<std::mutex> lockIfConcurrent() const {
+    if (published_ == nullptr) {
+      return {};
+    }
+    return std::unique_lock<std::mutex>(mutex_);
+  }
+
+  // Tiered lookup; in concurrent mode the caller holds mutex_.
+  Entry *lookupTiers(Key key) {
+    // Try Cache first
+    if (auto *entry = lookupCache(key)) {
+      recordCacheHit();
+      return entry;
+    }
+
+    // Try Main Memory
+    if (auto *entry = lookupMainMemory(key)) {
+      recordMainMemoryHit();
+      promoteToCache(key, entry);
+      return entry;
+    }
+
+    // Try Secondary Storage (rebuilds entry)
+    if (auto *entry = lookupSecondaryStorage(key)) {
+      recordSecondaryHit();
+      promoteToCache(key, entry);
+      return entry;
+    }
+
+    recordMiss();
+    return nullptr;
+  }
+
+  friend class KernelWarmup;
+
+  // Warm-up entry points for KernelWarmup. Both take mutex_ whatever the
+  // mode: in non-concurrent mode the warm-up workers are the only threads
+  // using the registry, and they only have each other to exclude.
+  void beginPrefetch(std::size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    recordPrefetchRequested(count);
+  }
+
+  // Promote @p key into Main Memory and Cache. Returns false if it is not
+  // registered. The rebuild acquires kernel-base and metadata leases, whose
+  // pools are not thread-safe, so it runs under the mutex like any other
+  // promotion.
+  bool prefetchForWarmup(Key key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cache_.findAndTouch(key) != nullptr) {
+      recordPrefetch(true, 0);
+      return true;
+    }
+    if (auto *entry = lookupMainMemory(key)) {
+      promoteToCache(key, entry);
+      recordPrefetch(true, 0);
+      return true;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    auto *entry = lookupSecondaryStorage(key);
+    const auto nanoseconds = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+    if (entry == nullptr) {
+      recordPrefetch(false, nanoseconds);
+      return false;
+    }
+    promoteToCache(key, entry);
+    recordPrefetch(true, nanoseconds);
+    return true;
+  }
 
   // ----- Cache Tier -----
 
   Entry *lookupCache(Key key) {
-    auto it = cache_.find(key);
-    if (it == cache_.end()) {
+    auto *slot = cache_.findAndTouch(key);
+    if (slot == nullptr) {
       return nullptr;
     }
-    // Touch in Cache LRU
-    auto node_it = cache_nodes_.find(key);
-    if (node_it != cache_nodes_.end()) {
-      cache_lru_.touch(node_it->second.get());
+    // Resident but displaced from the lock-free index by a bucket conflict.
+    if (published_ != nullptr) {
+      published_->insert(key, *slot);
     }
-    return it->second;
+    return *slot;
   }
 
   void promoteToCache(Key key, Entry *entry) {
     // Already in Cache?
-    auto it = cache_.find(key);
-    if (it != cache_.end()) {
-      auto node_it = cache_nodes_.find(key);
-      if (node_it != cache_nodes_.end()) {
-        cache_lru_.touch(node_it->second.get());
-      }
+    if (cache_.findAndTouch(key) != nullptr) {
       return;
     }
 
     // Evict from Cache if at capacity
-    if (cache_.size() >= config_.cache_capacity) {
+    if (cache_.full()) {
       evictFromCache();
     }
 
-    // Insert into Cache
-    cache_[key] = entry;
-    auto node_it = cache_nodes_.emplace(key, std::make_unique<LruNode>(key)).first;
-    cache_lru_.pushFront(node_it->second.get());
+    cache_.insertFront(key, entry);
+    if (published_ != nullptr) {
+      published_->insert(key, entry);
+    }
   }
 
   void evictFromCache() {
-    auto *node = cache_lru_.popBack();
-    if (node == nullptr) {
+    if (published_ != nullptr) {
+      // Lock-free hits do not touch the LRU order; give entries read since
+      // the last sweep a second chance (CLOCK), at most one pass.
+      for (std::size_t i = cache_.size(); i > 0; --i) {
+        const Key back = *cache_.backKey();
+        if (!published_->testAndClearReferenced(back)) {
+          break;
+        }
+        cache_.touch(back);
+      }
+    }
+    Key key{};
+    if (!cache_.popBack(&key)) {
       return;
     }
-    Key key = node->key;
-    cache_.erase(key);
-    cache_nodes_.erase(key);
+    if (published_ != nullptr) {
+      published_->erase(key);
+    }
     // Entry stays in Main Memory (not demoted further)
   }
 
   // ----- Main Memory Tier -----
 
   Entry *lookupMainMemory(Key key) {
-    auto it = main_memory_.find(key);
-    if (it == main_memory_.end()) {
-      return nullptr;
-    }
-    touchMainMemory(key);
-    return it->second.get();
-  }
-
-  void touchMainMemory(Key key) {
-    auto node_it = main_memory_nodes_.find(key);
-    if (node_it != main_memory_nodes_.end()) {
-      main_memory_lru_.touch(node_it->second.get());
-    }
+    auto *slot = main_memory_.findAndTouch(key);
+    return slot == nullptr ? nullptr : slot->get();
   }
 
   void evictFromMainMemory() {
-    auto *node = main_memory_lru_.popBack();
-    if (node == nullptr) {
+    Key key{};
+    std::unique_ptr<Entry> entry;
+    if (!main_memory_.popBack(&key, &entry)) {
       return;
     }
-    Key key = node->key;
 
     // Demote to Secondary Storage
-    auto it = main_memory_.find(key);
-    if (it != main_memory_.end()) {
-      secondary_storage_[key] =
-          ::orteaf::internal::kernel::core::KernelMetadataLease::fromEntry(
-              *it->second);
-      main_memory_.erase(it);
-    }
-    main_memory_nodes_.erase(key);
+    secondary_storage_[key] =
+        ::orteaf::internal::kernel::core::KernelMetadataLease::fromEntry(
+            *entry);
 
     // Also remove from Cache if present
     cache_.erase(key);
-    auto cache_node_it = cache_nodes_.find(key);
-    if (cache_node_it != cache_nodes_.end()) {
-      cache_lru_.remove(cache_node_it->second.get());
-      cache_nodes_.erase(cache_node_it);
+    if (published_ != nullptr) {
+      // A lock-free reader may still hold the entry; keep it for reuse.
+      published_->erase(key);
+      retired_.insert_or_assign(key, std::move(entry));
     }
   }
 
@@ -323,45 +639,61 @@ private:
       return nullptr;
     }
 
-    // Rebuild entry and promote to Main Memory
-    Entry rebuilt = it->second.rebuild();
+    // Revive the entry retired at eviction, or rebuild it, and promote to
+    // Main Memory
+    std::unique_ptr<Entry> rebuilt;
+    if (auto retired = retired_.find(key); retired != retired_.end()) {
+      rebuilt = std::move(retired->second);
+      retired_.erase(retired);
+    } else {
+      rebuilt = std::make_unique<Entry>(it->second.rebuild());
+      rebuilt->setKey(key);
+    }
     secondary_storage_.erase(it);
 
     // Evict if needed
-    if (main_memory_.size() >= config_.main_memory_capacity) {
+    if (main_memory_.full()) {
       evictFromMainMemory();
     }
 
-    // Insert into Main Memory
-    main_memory_[key] = std::make_unique<Entry>(std::move(rebuilt));
-    auto node_it =
-        main_memory_nodes_.emplace(key, std::make_unique<LruNode>(key)).first;
-    main_memory_lru_.pushFront(node_it->second.get());
-
-    return main_memory_[key].get();
+    return main_memory_.insertFront(key, std::move(rebuilt)).get();
   }
 
   // ----- Storage -----
 
+  KernelRegistryConfig config_;
+
   // Cache tier: pointers to Main Memory entries
-  std::unordered_map<Key, Entry *> cache_;
-  std::unordered_map<Key, std::unique_ptr<LruNode>> cache_nodes_;
-  LruList cache_lru_;
+  FlatKernelTable<Entry *> cache_;
 
-  // Main Memory tier: owned entries
-  std::unordered_map<Key, std::unique_ptr<Entry>> main_memory_;
-  std::unordered_map<Key, std::unique_ptr<LruNode>> main_memory_nodes_;
-  LruList main_memory_lru_;
+  // Main Memory tier: owned entries (boxed so pointers survive slot moves)
+  FlatKernelTable<std::unique_ptr<Entry>> main_memory_;
 
   // Secondary Storage tier: lightweight metadata
   std::unordered_map<Key, Metadata> secondary_storage_;
 
-  KernelRegistryConfig config_;
 #if defined(ORTEAF_STATS_LEVEL_CORE_VALUE) && ORTEAF_STATS_LEVEL_CORE_VALUE <= 4
   Stats stats_;
 #else
   Stats stats_{}; // Empty, never updated
 #endif
+
+  // ----- Concurrent mode -----
+
+  // Lock-free index of the Cache tier; null unless config_.concurrent.
+  std::unique_ptr<ConcurrentKernelCache> published_;
+  // Entries evicted from Main Memory while readers may still hold them,
+  // at most one per key
+  std::unordered_map<Key, std::unique_ptr<Entry>> retired_;
+  // Serializes every tier mutation in concurrent mode
+  mutable std::mutex mutex_;
+  std::atomic<std::size_t> published_hits_{0};
+
+  std::atomic<std::uint64_t> generation_{nextGeneration()};
+  std::atomic<std::uint64_t> fingerprint_{0};
+
+  // On-disk tier; not owned
+  PersistentKernelStore *store_{nullptr};
 };
 
 } // namespace orteaf::internal::kernel::registry
@@ -17,6 +17,9 @@ struct KernelRegistryConfig {
   std::size_t main_memory_capacity{64};
 
   /// Secondary Storage is unbounded (no capacity limit)
+
+  /// Allow concurrent use; Cache hits become lock-free (see KernelRegistry)
+  bool concurrent{false};
 };
 
 } // namespace orteaf::internal::kernel::registry
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "orteaf/internal/architecture/architecture.h"
+#include "orteaf/internal/dtype/dtype.h"
+#include "orteaf/internal/kernel/core/kernel_key.h"
+#include "orteaf/internal/kernel/core/key_components.h"
+#include "orteaf/internal/kernel/core/layout.h"
+#include "orteaf/internal/kernel/core/variant.h"
+#include "orteaf/internal/kernel/registry/kernel_registry.h"
+#include "orteaf/internal/ops/ops.h"
+
+namespace orteaf::internal::kernel::registry {
+
+/**
+ * @brief One kernel to warm up: the KernelKey fields as a tuple.
+ */
+struct KernelManifestEntry {
+  ::orteaf::internal::ops::Op op;
+  ::orteaf::internal::DType dtype;
+  ::orteaf::internal::architecture::Architecture architecture;
+  Variant variant{variant::kDefault};
+  Layout layout{};
+
+  [[nodiscard]] KernelKey key() const noexcept {
+    return makeKey({op, dtype}, {architecture, layout, variant});
+  }
+
+  static KernelManifestEntry fromKey(KernelKey key) noexcept {
+    return {kernel_key::getOp(key), kernel_key::getDType(key),
+            kernel_key::getArchitecture(key), kernel_key::getVariant(key),
+            kernel_key::getLayout(key)};
+  }
+
+  bool operator==(const KernelManifestEntry &) const noexcept = default;
+};
+
+using KernelManifest = std::vector<KernelManifestEntry>;
+
+/**
+ * @brief Manifest of the kernels in @p registry's Main Memory tier, most
+ * recently used first: the working set of the run so far.
+ */
+KernelManifest recordManifest(const KernelRegistry &registry);
+
+/**
+ * @brief Write @p manifest as text, one tuple per line.
+ *
+ * @return false if the file could not be written
+ */
+bool saveManifest(const std::string &path, const KernelManifest &manifest);
+
+/**
+ * @brief Read a manifest written by saveManifest().
+ *
+ * A missing or foreign file yields an empty manifest; malformed lines are
+ * skipped.
+ */
+KernelManifest loadManifest(const std::string &path);
+
+/**
+ * @brief Promotes a manifest of kernels into a registry's Main Memory and
+ * Cache tiers on a background thread.
+ *
+ * Meant for startup: construct it with a manifest recorded from an earlier
+ * run, do the rest of initialization, then wait() before the first
+ * dispatch so that it only hits warm kernels. Entries are rebuilt one at a
+ * time under the registry mutex (the lease pools they draw from are not
+ * thread-safe), so the gain is overlap with the caller's own startup work,
+ * not parallel rebuilds; one worker is the default for that reason.
+ * Manifest entries that are not registered are counted as missing and
+ * skipped.
+ *
+ * Progress is available from progress() while the workers run, and the
+ * registry's Stats accumulate the prefetch_* counters across warm-ups.
+ *
+ * A registry in concurrent mode may be used freely during the warm-up.
+ * Otherwise the registry is not thread-safe, so the constructor waits for
+ * the workers before returning.
+ *
+ * The destructor waits for the workers; the registry must outlive this
+ * object.
+ */
+class KernelWarmup {
+public:
+  struct Progress {
+    std::size_t total{0};
+    std::size_t completed{0};
+    std::size_t warmed{0};
+    std::size_t missing{0};
+    /// Wall time of the whole warm-up; 0 until finished().
+    std::uint64_t nanoseconds{0};
+  };
+
+  /**
+   * @param threads Worker threads (0 is treated as 1), never more than one
+   * per manifest entry. Extra workers only take turns on the registry
+   * mutex, so they do not make the warm-up faster.
+   */
+  KernelWarmup(KernelRegistry &registry,
+               std::span<const KernelManifestEntry> manifest,
+               std::size_t threads = 1);
+  ~KernelWarmup();
+
+  KernelWarmup(const KernelWarmup &) = delete;
+  KernelWarmup &operator=(const KernelWarmup &) = delete;
+
+  /// Block until every manifest entry has been processed.
+  void wait() const noexcept;
+
+  [[nodiscard]] bool finished() const noexcept {
+    return finished_.load(std::memory_order_acquire);
+  }
+
+  [[nodiscard]] Progress progress() const noexcept;
+
+private:
+  void work();
+  void finish() noexcept;
+
+  KernelRegistry &registry_;
+  std::vector<KernelKey> keys_;
+  std::chrono::steady_clock::time_point start_;
+  std::atomic<std::size_t> next_{0};
+  std::atomic<std::size_t> completed_{0};
+  std::atomic<std::size_t> warmed_{0};
+  std::atomic<std::size_t> missing_{0};
+  std::atomic<std::uint64_t> nanoseconds_{0};
+  std::atomic<std::size_t> running_{0};
+  std::atomic<bool> finished_{false};
+  std::vector<std::thread> workers_;
+};
+
+} // namespace orteaf::internal::kernel::registry
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "orteaf/internal/architecture/architecture.h"
+#include "orteaf/internal/kernel/core/kernel_key.h"
+#include "orteaf/internal/kernel/core/key_components.h"
+
+namespace orteaf::internal::kernel::registry {
+
+/**
+ * @brief Memory-mapped, on-disk secondary tier for KernelRegistry.
+ *
+ * Persists what a restarted process would otherwise have to rediscover:
+ * - kernel metadata per KernelKey, including whether the kernel was in the
+ *   working set (Main Memory) when the last run saved it
+ * - key_resolver resolution results
+ * - autotuning decisions
+ *
+ * The file is a 64-byte header followed by fixed-size records, mapped
+ * shared so updates land in the page cache immediately and survive a crash
+ * of the process. Records are updated in place or appended; the file grows
+ * by doubling. An in-memory index built on open finds records.
+ *
+ * Several processes may share one file. Creation, appends and growth run
+ * under an exclusive flock on it, and each write first remaps if another
+ * process grew the file and indexes the records it appended; those records
+ * become visible to lookups from then on.
+ *
+ * The header carries a format version and the kernel_key version. A file
+ * that is not a store, or was written with either version different from
+ * this build, is refused rather than overwritten, and keys whose version
+ * bits differ from kernel_key::kCurrentVersion are never stored.
+ *
+ * Execute functions are not persisted: addresses do not survive a restart.
+ * Kernels still have to be registered by code; the store tells the
+ * registry which of them to rebuild ahead of the first dispatch.
+ *
+ * Thread-safe.
+ */
+class PersistentKernelStore {
+public:
+  using Key = ::orteaf::internal::kernel::KernelKey;
+  using Architecture = ::orteaf::internal::architecture::Architecture;
+
+  /// On-disk format version; bump when the header or record layout changes.
+  static constexpr std::uint32_t kFormatVersion = 1;
+
+  struct MetadataRecord {
+    Architecture architecture{Architecture::CpuGeneric};
+    /// Was in Main Memory at the last KernelRegistry::saveWorkingSet().
+    bool resident{false};
+  };
+
+  /**
+   * @brief Open or create the store at @p path.
+   *
+   * @throws OperationFailed if the file cannot be opened, locked or mapped;
+   *         InvalidParameter if it is not a store of this format and
+   *         kernel_key version
+   */
+  explicit PersistentKernelStore(std::string path,
+                                 std::size_t initial_capacity = 256);
+  ~PersistentKernelStore();
+
+  PersistentKernelStore(const PersistentKernelStore &) = delete;
+  PersistentKernelStore &operator=(const PersistentKernelStore &) = delete;
+
+  // ----- Kernel metadata -----
+
+  /// @return false if @p key has a foreign version and was not stored
+  bool putMetadata(Key key, const MetadataRecord &record);
+  std::optional<MetadataRecord> findMetadata(Key key) const;
+
+  /// Visit every stored kernel key with its metadata.
+  template <typename Fn> void forEachMetadata(Fn &&fn) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < indexed_; ++i) {
+      const Record &record = records()[i];
+      if (record.kind == static_cast<std::uint32_t>(Kind::Metadata)) {
+        fn(static_cast<Key>(record.key), toMetadata(record));
+      }
+    }
+  }
+
+  /**
+   * @brief Mark exactly the keys for which @p is_resident returns true as
+   * the working set.
+   */
+  template <typename Predicate> void markResident(Predicate &&is_resident) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < indexed_; ++i) {
+      Record &record = records()[i];
+      if (record.kind == static_cast<std::uint32_t>(Kind::Metadata)) {
+        const bool resident = is_resident(static_cast<Key>(record.key));
+        record.flags = resident ? kResidentFlag : 0u;
+      }
+    }
+  }
+
+  // ----- Resolution results -----
+
+  /**
+   * @brief Remember that (request, signature) resolved to @p result while
+   * the registry's key set had @p fingerprint
+   * (KernelRegistry::keySetFingerprint()).
+   */
+  void putResolution(const KeyRequest &request, std::uint64_t signature,
+                     std::uint64_t fingerprint, Key result);
+  /// Resolution stored under the same key-set @p fingerprint, if any.
+  std::optional<Key> findResolution(const KeyRequest &request,
+                                    std::uint64_t signature,
+                                    std::uint64_t fingerprint) const;
+
+  // ----- Autotuning decisions -----
+
+  void putTuning(const KeyRequest &request, std::uint64_t bucket, Key winner);
+  std::optional<Key> findTuning(const KeyRequest &request,
+                                std::uint64_t bucket) const;
+
+  /// Flush dirty pages to the file.
+  void sync();
+
+  /// Number of records of any kind known to this process.
+  [[nodiscard]] std::size_t size() const;
+  [[nodiscard]] const std::string &path() const noexcept { return path_; }
+
+private:
+  enum class Kind : std::uint32_t { Metadata = 1, Resolution = 2, Tuning = 3 };
+
+  static constexpr std::uint32_t kResidentFlag = 1;
+
+  // Resolution records keep the low half of the key-set fingerprint in
+  // their flags.
+  static std::uint32_t foldFingerprint(std::uint64_t fingerprint) noexcept {
+    return static_cast<std::uint32_t>(fingerprint ^ (fingerprint >> 32));
+  }
+
+  struct Header {
+    char magic[8];
+    std::uint32_t format_version;
+    std::uint32_t key_version;
+    std::uint64_t count;
+    std::uint64_t capacity;
+    std::uint8_t reserved[32];
+  };
+  static_assert(sizeof(Header) == 64);
+
+  // key/a identify the record within its kind; b is the payload.
+  struct Record {
+    std::uint64_t key;
+    std::uint32_t kind;
+    std::uint32_t flags;
+    std::uint64_t a;
+    std::uint64_t b;
+  };
+  static_assert(sizeof(Record) == 32);
+
+  struct IndexKey {
+    std::uint32_t kind;
+    std::uint64_t key;
+    std::uint64_t a;
+
+    bool operator==(const IndexKey &) const noexcept = default;
+  };
+
+  struct IndexKeyHash {
+    std::size_t operator()(const IndexKey &key) const noexcept {
+      return static_cast<std::size_t>(
+          (key.key * 0x9E3779B97F4A7C15ull ^ key.a) +
+          key.kind * 0xC2B2AE3D27D4EB4Full);
+    }
+  };
+
+  static MetadataRecord toMetadata(const Record &record) noexcept {
+    return {static_cast<Architecture>(record.b),
+            (record.flags & kResidentFlag) != 0};
+  }
+  static std::uint64_t packRequest(const KeyRequest &request) noexcept;
+
+  // Owns the store's file descriptor.
+  class FileHandle {
+  public:
+    FileHandle() = default;
+    explicit FileHandle(int fd) noexcept : fd_(fd) {}
+    ~FileHandle();
+    FileHandle(const FileHandle &) = delete;
+    FileHandle &operator=(const FileHandle &) = delete;
+
+    int get() const noexcept { return fd_; }
+
+  private:
+    int fd_{-1};
+  };
+
+  // Owns the shared mapping of the header and `capacity` records.
+  class Mapping {
+  public:
+    Mapping() = default;
+    ~Mapping();
+    Mapping(const Mapping &) = delete;
+    Mapping &operator=(const Mapping &) = delete;
+
+    /// Replace the mapping with one covering @p capacity records.
+    void map(int fd, std::size_t capacity);
+    void *base() const noexcept { return base_; }
+    std::size_t bytes() const noexcept { return bytes_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+
+  private:
+    void *base_{nullptr};
+    std::size_t bytes_{0};
+    std::size_t capacity_{0};
+  };
+
+  Header *header() const noexcept {
+    return static_cast<Header *>(mapping_.base());
+  }
+  Record *records() const noexcept {
+    return reinterpret_cast<Record *>(static_cast<char *>(mapping_.base()) +
+                                      sizeof(Header));
+  }
+  std::size_t count() const noexcept { return header()->count; }
+
+  // The helpers below run with the file lock held.
+  void initialize(std::size_t capacity);
+  void refresh();
+  void grow();
+  void upsert(Kind kind, std::uint64_t key, std::uint64_t a, std::uint64_t b,
+              std::uint32_t flags);
+  const Record *find(Kind kind, std::uint64_t key, std::uint64_t a) const;
+
+  std::string path_;
+  FileHandle fd_;
+  Mapping mapping_;
+  /// Records [0, indexed_) are in index_ and inside mapping_.
+  std::size_t indexed_{0};
+  std::unordered_map<IndexKey, std::size_t, IndexKeyHash> index_;
+  mutable std::mutex mutex_;
+};
+
+} // namespace orteaf::internal::kernel::registry
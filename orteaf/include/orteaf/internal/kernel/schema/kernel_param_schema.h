@@ -65,6 +65,11 @@ template <ParamId ID, typename T> struct Field {
    */
   constexpr const T &get() const { return value; }
 
+  /**
+   * @brief Assign the value directly (for packed schemas).
+   */
+  constexpr void set(T v) { value = std::move(v); }
+
   /**
    * @brief Extract value from parameter list.
    *
@@ -143,6 +148,14 @@ template <ParamId ID, typename T> struct OptionalField {
     return present ? value : defaultValue;
   }
 
+  /**
+   * @brief Assign the value directly and mark it present.
+   */
+  constexpr void set(T v) {
+    value = std::move(v);
+    present = true;
+  }
+
   /**
    * @brief Extract value from parameter list (optional).
    *
@@ -219,6 +232,11 @@ struct ScopedField {
    */
   constexpr const T &get() const { return value; }
 
+  /**
+   * @brief Assign the value directly (for packed schemas).
+   */
+  constexpr void set(T v) { value = std::move(v); }
+
   /**
    * @brief Extract value from parameter list.
    *
@@ -274,6 +292,11 @@ struct OptionalScopedField {
     return present ? value : defaultValue;
   }
 
+  constexpr void set(T v) {
+    value = std::move(v);
+    present = true;
+  }
+
   void extract(const ParamList &params) {
     const auto *param = findParamInList(params, kKey);
     if (!param) {
@@ -316,13 +339,23 @@ struct OptionalScopedField {
  *
  * auto params = MyParams::extract(args);
  * @endcode
+ *
+ * Callers that know the schema can skip the ParamList entirely by filling
+ * the fields and packing the struct:
+ * @code
+ * MyParams params;
+ * params.alpha.set(1.0f);
+ * params.beta.set(0.5f);
+ * args.setPackedParams(params);
+ * @endcode
  */
 template <typename Derived> struct ParamSchema {
   /**
    * @brief Extract all fields from kernel arguments.
    *
-   * Creates a new schema instance and calls extractAllFields()
-   * on it to populate all field values.
+   * If @p args carries a packed schema of type Derived, it is copied out
+   * directly. Otherwise a new schema instance is populated by
+   * extractAllFields().
    *
    * @tparam KernelArgs The kernel arguments type
    * @param args Kernel arguments containing parameters
@@ -330,6 +363,11 @@ template <typename Derived> struct ParamSchema {
    */
   template <typename KernelArgs>
   static Derived extract(const KernelArgs &args) {
+    if constexpr (requires { args.template packedParams<Derived>(); }) {
+      if (const Derived *packed = args.template packedParams<Derived>()) {
+        return *packed;
+      }
+    }
     Derived schema;
     schema.extractAllFields(args);
     return schema;
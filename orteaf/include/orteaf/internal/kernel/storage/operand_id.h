@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 
+#include <orteaf/internal/kernel/core/access.h>
+
 namespace orteaf::internal::kernel {
 
 /**
@@ -23,6 +26,24 @@ enum class OperandId : std::uint64_t {
 
 } // namespace orteaf::internal::kernel
 
+// The generated tables specialise on the enumerators, so they follow the enum.
+#include <orteaf/kernel/operand_id_tables.h>
+
+namespace orteaf::internal::kernel {
+
+/**
+ * @brief Default access pattern of @p id, for code that only knows the
+ * operand at run time. Unknown ids count as read-write.
+ */
+constexpr Access accessOf(OperandId id) noexcept {
+  namespace tables = ::orteaf::generated::operand_id_tables;
+  const auto index = static_cast<std::size_t>(id);
+  return index < tables::kOperandIdCount ? tables::kOperandIdAccesses[index]
+                                         : Access::ReadWrite;
+}
+
+} // namespace orteaf::internal::kernel
+
 // Hash support for std::unordered_map and std::unordered_set
 namespace std {
 template <> struct hash<::orteaf::internal::kernel::OperandId> {
@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file cpu_mapped_file.h
+ * @brief Read-only memory mapping of a file on the host.
+ *
+ * The mapping is shared with the page cache, so opening the same file from
+ * several processes (or several times in one process) costs no extra memory
+ * and no copy. Pages are read from disk on first touch; the open itself only
+ * sets up the mapping, which is what makes loading a multi-GB weight file a
+ * matter of milliseconds.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace orteaf::internal::storage::cpu {
+
+/**
+ * @brief Read-only, shared mapping of an entire file.
+ *
+ * Instances are only handed out through shared_ptr so that every storage
+ * slicing the file keeps the mapping alive; the file is unmapped when the
+ * last reference goes away.
+ */
+class CpuMappedFile {
+public:
+  /// @brief Access hints passed to madvise() after mapping.
+  struct Options {
+    /// Start reading the whole file ahead (MADV_WILLNEED).
+    bool will_need{true};
+    /// Expect a front-to-back pass, enabling aggressive readahead
+    /// (MADV_SEQUENTIAL).
+    bool sequential{true};
+  };
+
+  /**
+   * @brief Map @p path read-only with the default access hints.
+   *
+   * @throws InvalidParameter if the file cannot be opened or is not a
+   *         regular file; OperationFailed if mmap fails.
+   */
+  static std::shared_ptr<const CpuMappedFile> open(const std::string &path) {
+    return open(path, Options{});
+  }
+
+  /// @brief Map @p path read-only with explicit access hints.
+  static std::shared_ptr<const CpuMappedFile> open(const std::string &path,
+                                                   Options options);
+
+  CpuMappedFile(const CpuMappedFile &) = delete;
+  CpuMappedFile &operator=(const CpuMappedFile &) = delete;
+  CpuMappedFile(CpuMappedFile &&) = delete;
+  CpuMappedFile &operator=(CpuMappedFile &&) = delete;
+  ~CpuMappedFile();
+
+  /// @brief First byte of the file; nullptr for an empty file.
+  const std::byte *data() const noexcept { return data_; }
+
+  /// @brief File size in bytes at the time it was mapped.
+  std::size_t size() const noexcept { return size_; }
+
+  const std::string &path() const noexcept { return path_; }
+
+private:
+  CpuMappedFile(std::string path, const std::byte *data, std::size_t size)
+      : path_(std::move(path)), data_(data), size_(size) {}
+
+  std::string path_;
+  const std::byte *data_{nullptr};
+  std::size_t size_{0};
+};
+
+} // namespace orteaf::internal::storage::cpu
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <orteaf/internal/diagnostics/error/error.h>
+#include <orteaf/internal/dtype/dtype.h>
+#include <orteaf/internal/execution/execution.h>
+#include <orteaf/internal/storage/cpu/cpu_mapped_file.h>
+#include <orteaf/internal/storage/cpu/cpu_storage_layout.h>
+
+namespace orteaf::internal::storage::cpu {
+
+/**
+ * @brief CPU storage backed by a read-only file mapping.
+ *
+ * Views a byte range of a CpuMappedFile in place: nothing is allocated or
+ * copied, and the pages are shared with every other process mapping the same
+ * file. The storage holds a reference to the mapping, so tensors built on
+ * it stay valid after the caller drops its own handle to the file.
+ *
+ * The memory is mapped PROT_READ, so only a const pointer is exposed. CPU
+ * kernels may read it; makeCpuOperand rejects it for written operands.
+ */
+class CpuMappedStorage {
+public:
+  using MappedFile = ::orteaf::internal::storage::cpu::CpuMappedFile;
+  /// The mapping is the buffer; sharing it is what keeps it alive.
+  using BufferLease = std::shared_ptr<const MappedFile>;
+  using Layout = ::orteaf::internal::storage::cpu::CpuStorageLayout;
+  using DType = ::orteaf::internal::DType;
+  using Execution = ::orteaf::internal::execution::Execution;
+
+  /// @brief The execution backend for this storage type.
+  static constexpr Execution kExecution = Execution::Cpu;
+
+  /**
+   * @brief Builder for constructing CpuMappedStorage instances.
+   *
+   * @par Example
+   * @code
+   * auto file = CpuMappedFile::open("model.bin");
+   * auto storage = CpuMappedStorage::builder()
+   *     .withMappedFile(file)
+   *     .withByteOffset(4096)
+   *     .withDType(DType::F32)
+   *     .withNumElements(1024)
+   *     .build();
+   * @endcode
+   */
+  class Builder {
+  public:
+    Builder() = default;
+
+    Builder &withMappedFile(BufferLease file) {
+      file_ = std::move(file);
+      return *this;
+    }
+
+    /// @brief Byte offset of the first element within the file.
+    Builder &withByteOffset(std::size_t byte_offset) {
+      byte_offset_ = byte_offset;
+      return *this;
+    }
+
+    Builder &withDType(DType dtype) {
+      dtype_ = dtype;
+      return *this;
+    }
+
+    Builder &withNumElements(std::size_t numel) {
+      numel_ = numel;
+      return *this;
+    }
+
+    Builder &withLayout(Layout layout) {
+      layout_ = std::move(layout);
+      return *this;
+    }
+
+    /**
+     * @brief Build the CpuMappedStorage instance.
+     *
+     * @throws InvalidState if no file was set; Misaligned if the offset is
+     *         not a multiple of the element size; OutOfRange if the byte
+     *         size overflows or the range extends past the end of the file.
+     */
+    CpuMappedStorage build() {
+      using ::orteaf::internal::diagnostics::error::OrteafErrc;
+      using ::orteaf::internal::diagnostics::error::throwError;
+      if (!file_) {
+        throwError(OrteafErrc::InvalidState,
+                   "CpuMappedStorage requires a mapped file");
+      }
+      const std::size_t element_size = ::orteaf::internal::sizeOf(dtype_);
+      if (byte_offset_ % element_size != 0) {
+        throwError(OrteafErrc::Misaligned,
+                   "CpuMappedStorage offset is not aligned to its dtype");
+      }
+      if (numel_ > std::numeric_limits<std::size_t>::max() / element_size) {
+        throwError(OrteafErrc::OutOfRange,
+                   "CpuMappedStorage byte size overflows");
+      }
+      const std::size_t size_in_bytes = numel_ * element_size;
+      if (byte_offset_ > file_->size() ||
+          size_in_bytes > file_->size() - byte_offset_) {
+        throwError(OrteafErrc::OutOfRange,
+                   "CpuMappedStorage range exceeds the mapped file");
+      }
+      return CpuMappedStorage(std::move(file_), byte_offset_,
+                              std::move(layout_), dtype_, numel_);
+    }
+
+  private:
+    BufferLease file_{};
+    std::size_t byte_offset_{0};
+    DType dtype_{DType::F32};
+    std::size_t numel_{0};
+    Layout layout_{};
+  };
+
+  /**
+   * @brief Create a new Builder instance.
+   * @return A new Builder for constructing CpuMappedStorage.
+   */
+  static Builder builder() { return Builder{}; }
+
+  CpuMappedStorage() = default;
+
+  CpuMappedStorage(const CpuMappedStorage &) = default;
+  CpuMappedStorage &operator=(const CpuMappedStorage &) = default;
+  CpuMappedStorage(CpuMappedStorage &&) = default;
+  CpuMappedStorage &operator=(CpuMappedStorage &&) = default;
+  ~CpuMappedStorage() = default;
+
+  /// @brief Return the execution backend for this storage.
+  constexpr Execution execution() const { return kExecution; }
+
+  /// @brief Return the data type of elements in this storage.
+  DType dtype() const { return dtype_; }
+
+  /// @brief Return the number of elements in this storage.
+  std::size_t numel() const { return numel_; }
+
+  /// @brief Return the size of the storage in bytes.
+  std::size_t sizeInBytes() const {
+    return numel_ * ::orteaf::internal::sizeOf(dtype_);
+  }
+
+  /// @brief Byte offset of the first element within the file.
+  std::size_t byteOffset() const { return byte_offset_; }
+
+  /// @brief Get the mapping backing this storage.
+  const BufferLease &bufferLease() const { return file_; }
+
+  /**
+   * @brief Get the host pointer to the first element of the storage.
+   * @return Read-only data pointer, or nullptr if unset or empty.
+   */
+  const void *data() const {
+    if (!file_ || file_->data() == nullptr) {
+      return nullptr;
+    }
+    return file_->data() + byte_offset_;
+  }
+
+private:
+  CpuMappedStorage(BufferLease file, std::size_t byte_offset, Layout layout,
+                   DType dtype, std::size_t numel)
+      : file_(std::move(file)), byte_offset_(byte_offset),
+        layout_(std::move(layout)), dtype_(dtype), numel_(numel) {}
+
+  BufferLease file_{};
+  std::size_t byte_offset_{0};
+  Layout layout_;
+  DType dtype_{DType::F32};
+  std::size_t numel_{0};
+};
+
+} // namespace orteaf::internal::storage::cpu
@@ -20,6 +20,8 @@ public:
   using DeviceHandle = DeviceManager::DeviceHandle;
   using DeviceLease = DeviceManager::DeviceLease;
   using BufferLease = BufferManager::BufferLease;
+  using BufferView =
+      ::orteaf::internal::execution::cpu::resource::CpuBufferView;
   using Layout = ::orteaf::internal::storage::cpu::CpuStorageLayout;
   using DType = ::orteaf::internal::DType;
   using Execution = ::orteaf::internal::execution::Execution;
@@ -98,7 +100,8 @@ public:
           numel_ * ::orteaf::internal::sizeOf(dtype_);
       BufferLease lease =
           device_lease_->buffer_manager.acquire(size_in_bytes, alignment_);
-      return CpuStorage(std::move(lease), std::move(layout_), dtype_, numel_);
+      return CpuStorage(std::move(lease), device_lease_.payloadHandle(),
+                        std::move(layout_), dtype_, numel_);
     }
 
   private:
@@ -126,6 +129,9 @@ public:
   /// @brief Return the execution backend for this storage.
   constexpr Execution execution() const { return kExecution; }
 
+  /// @brief Return the device whose buffer manager backs this storage.
+  DeviceHandle device() const { return device_; }
+
   /// @brief Return the data type of elements in this storage.
   DType dtype() const { return dtype_; }
 
@@ -137,13 +143,89 @@ public:
     return numel_ * ::orteaf::internal::sizeOf(dtype_);
   }
 
+  /// @brief Get the buffer lease.
+  const BufferLease &bufferLease() const { return buffer_lease_; }
+
+  /// @brief Get the buffer lease (mutable).
+  BufferLease &bufferLease() { return buffer_lease_; }
+
+  /**
+   * @brief Get the buffer view.
+   * @return CpuBufferView if valid, empty view otherwise.
+   */
+  BufferView bufferView() const {
+    if (!buffer_lease_) {
+      return BufferView{};
+    }
+    auto *buffer_payload = buffer_lease_.operator->();
+    if (buffer_payload == nullptr || !buffer_payload->valid()) {
+      return BufferView{};
+    }
+    return buffer_payload->view;
+  }
+
+  /**
+   * @brief Get the host pointer to the first element of the storage.
+   * @return Data pointer, or nullptr if the buffer is invalid.
+   */
+  void *data() const {
+    auto view = bufferView();
+    return view ? view.data() : nullptr;
+  }
+
+  /**
+   * @brief Get the reuse token of the buffer.
+   *
+   * Stamp it with the FenceToken of queued work that accesses the buffer
+   * without holding this storage, so the allocator does not hand the memory
+   * out again before that work completes.
+   *
+   * @return Reference to the reuse token
+   * @throws OrteafErrc::InvalidParameter if buffer lease is invalid
+   */
+  auto &reuseToken() {
+    if (!buffer_lease_) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+          "Storage has no buffer lease");
+    }
+    auto *payload = buffer_lease_.operator->();
+    if (!payload) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+          "Buffer lease has no payload");
+    }
+    return payload->reuse_token;
+  }
+
+  /**
+   * @brief Get the reuse token of the buffer (const).
+   * @return Const reference to the reuse token
+   * @throws OrteafErrc::InvalidParameter if buffer lease is invalid
+   */
+  const auto &reuseToken() const {
+    if (!buffer_lease_) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+          "Storage has no buffer lease");
+    }
+    auto *payload = buffer_lease_.operator->();
+    if (!payload) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+          "Buffer lease has no payload");
+    }
+    return payload->reuse_token;
+  }
+
 private:
-  CpuStorage(BufferLease buffer_lease, Layout layout, DType dtype,
-             std::size_t numel)
-      : buffer_lease_(std::move(buffer_lease)), layout_(std::move(layout)),
-        dtype_(dtype), numel_(numel) {}
+  CpuStorage(BufferLease buffer_lease, DeviceHandle device, Layout layout,
+             DType dtype, std::size_t numel)
+      : buffer_lease_(std::move(buffer_lease)), device_(device),
+        layout_(std::move(layout)), dtype_(dtype), numel_(numel) {}
 
   BufferLease buffer_lease_;
+  DeviceHandle device_{};
   Layout layout_;
   DType dtype_{DType::F32};
   std::size_t numel_{0};
@@ -21,6 +21,7 @@
 #include <orteaf/internal/dtype/dtype.h>
 #include <orteaf/internal/execution/execution.h>
 #include <orteaf/internal/storage/concepts/storage_concepts.h>
+#include <orteaf/internal/storage/cpu/cpu_mapped_storage.h>
 #if ORTEAF_ENABLE_MPS
 #include <orteaf/internal/storage/mps/mps_storage.h>
 #endif
@@ -56,6 +57,20 @@ template <typename Storage> struct TypedStorageRequest {
   Layout layout{};
 };
 
+template <>
+struct TypedStorageRequest<::orteaf::internal::storage::cpu::CpuMappedStorage> {
+  using MappedFile =
+      ::orteaf::internal::storage::cpu::CpuMappedStorage::BufferLease;
+  using Layout = ::orteaf::internal::storage::cpu::CpuMappedStorage::Layout;
+  using DType = ::orteaf::internal::storage::cpu::CpuMappedStorage::DType;
+
+  MappedFile mapped_file{};
+  std::size_t byte_offset{0};
+  DType dtype{DType::F32};
+  std::size_t numel{0};
+  Layout layout{};
+};
+
 #if ORTEAF_ENABLE_MPS
 template <>
 struct TypedStorageRequest<::orteaf::internal::storage::mps::MpsStorage> {
@@ -103,7 +118,12 @@ template <typename Storage> struct TypedStoragePoolTraits {
       }
     } else
   #endif
-    if constexpr (requires { request.device.isValid(); }) {
+    if constexpr (requires { request.mapped_file; }) {
+      if (!request.mapped_file) {
+        ORTEAF_THROW(InvalidArgument,
+                     "CpuMappedStorage request requires a mapped file");
+      }
+    } else if constexpr (requires { request.device.isValid(); }) {
       if (!request.device.isValid()) {
         ORTEAF_THROW(InvalidArgument,
                      "Storage request requires a valid device handle");
@@ -133,6 +153,12 @@ template <typename Storage> struct TypedStoragePoolTraits {
           builder.withDeviceHandle(request.device);
         }
       }
+      if constexpr (requires { builder.withMappedFile(request.mapped_file); }) {
+        builder.withMappedFile(request.mapped_file);
+      }
+      if constexpr (requires { builder.withByteOffset(request.byte_offset); }) {
+        builder.withByteOffset(request.byte_offset);
+      }
       if constexpr (requires { builder.withDType(request.dtype); }) {
         builder.withDType(request.dtype);
       }
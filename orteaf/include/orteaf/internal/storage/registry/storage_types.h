@@ -10,6 +10,7 @@
  * Adding to RegisteredStorages is all you need - everything else is automatic.
  */
 
+#include <orteaf/internal/storage/cpu/cpu_mapped_storage.h>
 #include <orteaf/internal/storage/cpu/cpu_storage.h>
 #include <orteaf/internal/storage/registry/storage_registry.h>
 
@@ -30,6 +31,14 @@ template <> struct StorageTraits<::orteaf::internal::storage::cpu::CpuStorage> {
   static constexpr const char *name = "cpu";
 };
 
+template <>
+struct StorageTraits<::orteaf::internal::storage::cpu::CpuMappedStorage> {
+  using Manager = manager::TypedStorageManager<
+      ::orteaf::internal::storage::cpu::CpuMappedStorage>;
+  using Lease = typename Manager::StorageLease;
+  static constexpr const char *name = "cpu_mapped";
+};
+
 #if ORTEAF_ENABLE_MPS
 template <> struct StorageTraits<::orteaf::internal::storage::mps::MpsStorage> {
   using Manager = manager::TypedStorageManager<
@@ -44,7 +53,8 @@ template <> struct StorageTraits<::orteaf::internal::storage::mps::MpsStorage> {
 // =============================================================================
 
 using RegisteredStorages =
-    StorageRegistry<::orteaf::internal::storage::cpu::CpuStorage
+    StorageRegistry<::orteaf::internal::storage::cpu::CpuStorage,
+                    ::orteaf::internal::storage::cpu::CpuMappedStorage
 #if ORTEAF_ENABLE_MPS
                     ,
                     ::orteaf::internal::storage::mps::MpsStorage
@@ -59,6 +69,10 @@ using CpuStorageManager =
     StorageTraits<::orteaf::internal::storage::cpu::CpuStorage>::Manager;
 using CpuStorageLease =
     StorageTraits<::orteaf::internal::storage::cpu::CpuStorage>::Lease;
+using CpuMappedStorageManager =
+    StorageTraits<::orteaf::internal::storage::cpu::CpuMappedStorage>::Manager;
+using CpuMappedStorageLease =
+    StorageTraits<::orteaf::internal::storage::cpu::CpuMappedStorage>::Lease;
 
 #if ORTEAF_ENABLE_MPS
 using MpsStorageManager =
@@ -74,6 +88,8 @@ namespace orteaf::internal::storage {
 using RegisteredStorages = registry::RegisteredStorages;
 using CpuStorageManager = registry::CpuStorageManager;
 using CpuStorageLease = registry::CpuStorageLease;
+using CpuMappedStorageManager = registry::CpuMappedStorageManager;
+using CpuMappedStorageLease = registry::CpuMappedStorageLease;
 #if ORTEAF_ENABLE_MPS
 using MpsStorageManager = registry::MpsStorageManager;
 using MpsStorageLease = registry::MpsStorageLease;
@@ -30,12 +30,13 @@ public:
   using DType = ::orteaf::internal::DType;
   using Execution = ::orteaf::internal::execution::Execution;
   using CpuLease = registry::CpuStorageLease;
+  using CpuMappedLease = registry::CpuMappedStorageLease;
 #if ORTEAF_ENABLE_MPS
   using MpsLease = registry::MpsStorageLease;
 #endif
 
   // Variant type holding all backend lease implementations
-  using Variant = std::variant<std::monostate, CpuLease
+  using Variant = std::variant<std::monostate, CpuLease, CpuMappedLease
 #if ORTEAF_ENABLE_MPS
                                ,
                                MpsLease
@@ -8,11 +8,15 @@
  * manager based on the tensor impl type. Managers are not exposed.
  */
 
+#include <cstddef>
+#include <memory>
 #include <span>
 #include <string_view>
 
 #include <orteaf/extension/tensor/registry/tensor_impl_types.h>
+#include <orteaf/internal/storage/cpu/cpu_mapped_file.h>
 #include <orteaf/internal/storage/registry/storage_types.h>
+#include <orteaf/internal/storage/storage_lease.h>
 
 namespace orteaf::internal::tensor::api {
 
@@ -31,6 +35,8 @@ public:
   using DType = ::orteaf::internal::DType;
   using Execution = ::orteaf::internal::execution::Execution;
   using Dim = ::orteaf::extension::tensor::DenseTensorLayout::Dim;
+  using StorageLease = ::orteaf::internal::storage::StorageLease;
+  using MappedFile = ::orteaf::internal::storage::cpu::CpuMappedFile;
 
   struct Config {
     StorageRegistry::Config storage_config{};
@@ -67,6 +73,45 @@ public:
   /// @brief Check if an impl type name is registered.
   static bool hasImplName(std::string_view impl_name);
 
+  // ===== Existing Storage =====
+
+  /**
+   * @brief Acquire a storage viewing @p numel elements of a mapped file.
+   *
+   * No memory is allocated and nothing is read; pages fault in from the
+   * page cache when a kernel first touches them.
+   *
+   * @param byte_offset Offset of the first element within the file; must
+   *        be a multiple of the dtype size.
+   * @throws OutOfRange if the range extends past the end of the file.
+   */
+  static StorageLease mapStorage(std::shared_ptr<const MappedFile> file,
+                                 std::size_t byte_offset, DType dtype,
+                                 std::size_t numel);
+
+  /**
+   * @brief Wrap @p storage as a contiguous dense tensor of @p shape whose
+   * first element is element @p offset of the storage.
+   *
+   * Several tensors may share one storage at different offsets, e.g. all
+   * weights packed in a single mapped file.
+   *
+   * @throws OutOfRange if the tensor does not fit in the storage.
+   */
+  static LeaseVariant fromStorage(StorageLease storage,
+                                  std::span<const Dim> shape, Dim offset = 0);
+
+  /**
+   * @brief Copy @p source into new heap storage of the same dtype and size,
+   * on the current CPU context's device.
+   *
+   * Matches KernelAutotuner::ScratchFunc, so tuning can run kernels on
+   * scratch outputs.
+   *
+   * @return The copy, or an empty lease if @p source is not CPU storage.
+   */
+  static StorageLease cloneStorage(const StorageLease &source);
+
   // ===== Auto-dispatch Operations =====
 
   static LeaseVariant transpose(const LeaseVariant &src,
@@ -82,6 +127,12 @@ public:
   static LeaseVariant squeeze(const LeaseVariant &src);
 
   static LeaseVariant unsqueeze(const LeaseVariant &src, std::size_t dim);
+
+  // ===== Materialization =====
+
+  /// @brief Return @p src itself when contiguous, otherwise a contiguous
+  /// copy in new storage.
+  static LeaseVariant contiguous(const LeaseVariant &src);
 };
 
 } // namespace orteaf::internal::tensor::api
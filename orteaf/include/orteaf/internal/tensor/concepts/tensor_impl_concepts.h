@@ -10,6 +10,7 @@
 
 #include <concepts>
 #include <cstddef>
+#include <optional>
 #include <span>
 #include <type_traits>
 
@@ -87,4 +88,17 @@ concept HasUnsqueeze =
       { layout.unsqueeze(dim) } -> std::same_as<typename Impl::Layout>;
     };
 
+/// @brief Concept for TensorImpl that can be materialized densely
+/// (contiguous() and the copying reshape fallback)
+template <typename Impl>
+concept HasContiguous =
+    TensorImplConcept<Impl> &&
+    requires(const typename Impl::Layout &layout,
+             std::span<const typename Impl::Layout::Dim> new_shape) {
+      { layout.isContiguous() } -> std::convertible_to<bool>;
+      {
+        layout.tryReshape(new_shape)
+      } -> std::same_as<std::optional<typename Impl::Layout>>;
+    };
+
 } // namespace orteaf::internal::tensor
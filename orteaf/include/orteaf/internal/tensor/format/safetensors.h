@@ -0,0 +1,44 @@
+#pragma once
+
+/**
+ * @file safetensors.h
+ * @brief Import of safetensors files.
+ *
+ * A safetensors file is a u64 little-endian header length, a JSON header
+ * mapping each tensor name to {"dtype", "shape", "data_offsets"}, and the raw
+ * payloads. Payloads are stored unpadded, so whether they can be viewed in
+ * place depends on the writer; converting yields a native weight file with
+ * 64-byte aligned payloads.
+ *
+ * Supported dtypes: BOOL, U8, I8, U16, I16, U32, I32, U64, I64, F8_E4M3,
+ * F8_E5M2, F16, F32, F64. Anything else (e.g. BF16) is rejected.
+ */
+
+#include <string>
+
+#include <orteaf/internal/tensor/format/weight_file.h>
+
+namespace orteaf::internal::tensor::format {
+
+/**
+ * @brief Map a safetensors file and index it for zero-copy loading.
+ *
+ * @throws InvalidParameter if the header is malformed; Unsupported for an
+ *         unknown dtype; Misaligned if a payload is not aligned to its
+ *         element size (use convertSafetensors instead).
+ */
+WeightFile openSafetensors(const std::string &path);
+
+/**
+ * @brief Stream the safetensors file @p source into a weight file at
+ * @p destination.
+ *
+ * Payloads are copied straight from the mapping without staging the model
+ * in memory; the tensor order of the source is kept.
+ *
+ * @throws as openSafetensors and WeightFileWriter.
+ */
+void convertSafetensors(const std::string &source,
+                        const std::string &destination);
+
+} // namespace orteaf::internal::tensor::format
@@ -0,0 +1,193 @@
+#pragma once
+
+/**
+ * @file weight_file.h
+ * @brief Memory-mappable container for model weights.
+ *
+ * A weight file is a 64-byte header, an index describing every tensor, and
+ * the tensor payloads:
+ *
+ * @code
+ * offset 0   header   magic "ORTEAFWT", u32 format version, u32 tensor
+ *                     count, u64 index bytes, u64 file size, zero padding
+ * offset 64  index    per tensor: u32 name length, name, u8 dtype id length,
+ *                     dtype id (the `id` from dtypes.yml, e.g. "F32"),
+ *                     u32 rank, i64 dims[rank], u64 byte offset,
+ *                     u64 byte size, u32 alignment
+ *            payloads each at its byte offset (absolute, a multiple of its
+ *                     alignment, which is at least 64), zero padded
+ * @endcode
+ *
+ * Integers are little-endian. Dtypes are stored by name so files stay
+ * readable when dtypes.yml gains entries.
+ *
+ * Reading maps the file once (CpuMappedFile) and views each payload in
+ * place through a CpuMappedStorage, so opening is independent of model size
+ * and processes loading the same file share its pages.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <orteaf/internal/dtype/dtype.h>
+#include <orteaf/internal/storage/cpu/cpu_mapped_file.h>
+#include <orteaf/internal/tensor/api/tensor_api.h>
+
+namespace orteaf::internal::tensor::format {
+
+/// @brief One tensor recorded in a weight file.
+struct WeightFileEntry {
+  std::string name;
+  ::orteaf::internal::DType dtype{::orteaf::internal::DType::F32};
+  std::vector<std::int64_t> shape;
+  /// Absolute offset of the payload within the file.
+  std::uint64_t byte_offset{0};
+  std::uint64_t byte_size{0};
+  std::uint32_t alignment{0};
+
+  std::int64_t numel() const noexcept;
+};
+
+/**
+ * @brief Read-only view of a mapped weight file.
+ *
+ * Cheap to copy; copies share the mapping.
+ */
+class WeightFile {
+public:
+  using MappedFile = ::orteaf::internal::storage::cpu::CpuMappedFile;
+  using LeaseVariant = ::orteaf::internal::tensor::api::TensorApi::LeaseVariant;
+
+  /// Payload alignment used by WeightFileWriter unless asked for more.
+  static constexpr std::uint32_t kPayloadAlignment = 64;
+  /// On-disk format version; bump when the header or index layout changes.
+  static constexpr std::uint32_t kFormatVersion = 1;
+
+  /**
+   * @brief Map and index the weight file at @p path.
+   *
+   * @throws InvalidParameter if the file is not a well-formed weight file.
+   */
+  static WeightFile open(const std::string &path);
+
+  /**
+   * @brief Wrap an already mapped file described by @p entries.
+   *
+   * Used by importers of foreign formats that are mappable as-is.
+   *
+   * @throws InvalidParameter if an entry lies outside the file, or its
+   *         size does not match its shape and dtype.
+   */
+  WeightFile(std::shared_ptr<const MappedFile> file,
+             std::vector<WeightFileEntry> entries);
+
+  WeightFile() = default;
+
+  const std::vector<WeightFileEntry> &entries() const noexcept {
+    return entries_;
+  }
+
+  /// @brief Entry named @p name, or nullptr.
+  const WeightFileEntry *find(std::string_view name) const noexcept;
+
+  /**
+   * @brief Dense CPU tensor viewing the payload of @p name without copying.
+   *
+   * The tensor keeps the mapping alive and is read-only. TensorApi must be
+   * configured.
+   *
+   * @throws InvalidArgument if no tensor is named @p name or it has no
+   *         elements.
+   */
+  LeaseVariant load(std::string_view name) const;
+
+  const std::shared_ptr<const MappedFile> &mappedFile() const noexcept {
+    return file_;
+  }
+
+private:
+  std::shared_ptr<const MappedFile> file_{};
+  std::vector<WeightFileEntry> entries_{};
+};
+
+/**
+ * @brief Streams tensors into a weight file.
+ *
+ * Tensors are declared first, which fixes the index and every payload
+ * offset, and their bytes are then appended in declaration order, in as many
+ * chunks as convenient. Only the index is held in memory.
+ *
+ * @par Example
+ * @code
+ * WeightFileWriter writer("model.owf");
+ * writer.declare("w", DType::F32, w_shape);
+ * writer.declare("b", DType::F32, b_shape);
+ * writer.append(w_data, w_bytes);
+ * writer.append(b_data, b_bytes);
+ * writer.finish();
+ * @endcode
+ */
+class WeightFileWriter {
+public:
+  using DType = ::orteaf::internal::DType;
+
+  /// @throws OperationFailed if @p path cannot be created.
+  explicit WeightFileWriter(std::string path);
+
+  WeightFileWriter(const WeightFileWriter &) = delete;
+  WeightFileWriter &operator=(const WeightFileWriter &) = delete;
+
+  /// An unfinished file is left truncated and fails to open.
+  ~WeightFileWriter() = default;
+
+  /**
+   * @brief Add a tensor to the index.
+   *
+   * @param alignment Payload alignment; a power of two, at least 64.
+   * @throws InvalidState once data has been appended; InvalidArgument for
+   *         duplicate names, negative dims, a byte size that overflows or a
+   *         bad alignment.
+   */
+  void declare(std::string name, DType dtype,
+               std::span<const std::int64_t> shape,
+               std::uint32_t alignment = WeightFile::kPayloadAlignment);
+
+  /**
+   * @brief Append @p size payload bytes.
+   *
+   * Bytes fill the declared tensors in order; a chunk may span tensors.
+   *
+   * @throws OutOfRange if more bytes are appended than declared.
+   */
+  void append(const void *data, std::size_t size);
+
+  /**
+   * @brief Flush and close the file.
+   *
+   * @throws InvalidState if declared payload bytes are still missing;
+   *         OperationFailed on a write error.
+   */
+  void finish();
+
+private:
+  void writeIndex();
+  void padTo(std::uint64_t offset);
+
+  std::string path_;
+  std::ofstream out_;
+  std::vector<WeightFileEntry> entries_;
+  std::uint64_t index_bytes_{0};
+  std::uint64_t file_size_{0};
+  bool index_written_{false};
+  bool finished_{false};
+  std::size_t current_{0};
+  std::uint64_t position_{0};
+};
+
+} // namespace orteaf::internal::tensor::format
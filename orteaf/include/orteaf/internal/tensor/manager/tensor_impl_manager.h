@@ -160,6 +160,10 @@ public:
   TensorImplLease create(std::span<const Dim> shape, DType dtype,
                          Execution execution, std::size_t alignment = 0);
 
+  /// Wraps existing @p storage as an impl with @p layout, without copying.
+  /// The caller guarantees that @p layout stays inside the storage.
+  TensorImplLease fromStorage(Layout layout, StorageLease storage);
+
   // ===== View Operations (conditionally enabled) =====
 
   TensorImplLease transpose(const TensorImplLease &src,
@@ -170,6 +174,8 @@ public:
                         std::span<const Dim> sizes)
     requires HasSlice<Impl>;
 
+  /// Views @p src when its strides allow it; otherwise (for impls with
+  /// HasContiguous) reshapes a contiguous() copy.
   TensorImplLease reshape(const TensorImplLease &src,
                           std::span<const Dim> new_shape)
     requires HasReshape<Impl>;
@@ -180,6 +186,13 @@ public:
   TensorImplLease unsqueeze(const TensorImplLease &src, std::size_t dim)
     requires HasUnsqueeze<Impl>;
 
+  // ===== Materialization =====
+
+  /// Returns @p src itself when it is contiguous, otherwise a new impl with
+  /// contiguous layout and freshly copied storage.
+  TensorImplLease contiguous(const TensorImplLease &src)
+    requires HasContiguous<Impl>;
+
 private:
   TensorImplLease createView(Layout layout, StorageLease storage);
 
@@ -8,7 +8,12 @@
  * after tensor_impl_manager.h.
  */
 
+#include <orteaf/internal/diagnostics/error/error.h>
 #include <orteaf/internal/dtype/dtype.h>
+#include <orteaf/internal/execution/cpu/api/cpu_execution_api.h>
+#include <orteaf/internal/execution_context/cpu/current_context.h>
+#include <orteaf/internal/kernel/cpu/cpu_copy.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
 #include <orteaf/internal/storage/registry/storage_types.h>
 #include <orteaf/internal/tensor/manager/tensor_impl_manager.h>
 
@@ -22,6 +27,13 @@ namespace detail {
 // Storage Lease Factory - Strategy Pattern
 // =============================================================================
 
+/// @brief Device that new CPU tensor storage is allocated on: the device of
+/// the current CPU context, so tensors made under a CpuContextGuard for a
+/// NUMA node live in that node's memory.
+inline ::orteaf::internal::execution::cpu::CpuDeviceHandle cpuStorageDevice() {
+  return ::orteaf::internal::execution_context::cpu::currentDeviceHandle();
+}
+
 /// @brief Creates StorageLease for a specific execution backend.
 /// Each backend specializes this template to provide custom logic.
 template <::orteaf::internal::execution::Execution E>
@@ -39,8 +51,7 @@ struct StorageLeaseFactory<::orteaf::internal::execution::Execution::Cpu> {
     using CpuStorageManager = ::orteaf::internal::storage::CpuStorageManager;
 
     typename CpuStorageManager::Request storage_request{};
-    storage_request.device =
-        ::orteaf::internal::execution::cpu::CpuDeviceHandle{0};
+    storage_request.device = cpuStorageDevice();
     storage_request.dtype = req.dtype;
     storage_request.numel = static_cast<std::size_t>(numel);
     storage_request.alignment = req.alignment;
@@ -105,6 +116,59 @@ template <typename Impl>
   }
 }
 
+// =============================================================================
+// Strided Copy - Strategy Pattern
+// =============================================================================
+
+/// @brief Copies the elements of one impl into another of the same shape
+/// and dtype for a specific execution backend.
+template <::orteaf::internal::execution::Execution E> struct StridedCopier;
+
+/// @brief CPU copier: runs the blocked strided copy kernel on the worker
+/// pool of the device the storage lives on, so the copy stays on that
+/// device's NUMA node when it has a pinned pool.
+template <>
+struct StridedCopier<::orteaf::internal::execution::Execution::Cpu> {
+  template <typename Impl> static void copy(const Impl &src, const Impl &dst) {
+    namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+    using CpuExecutionApi =
+        ::orteaf::internal::execution::cpu::api::CpuExecutionApi;
+
+    const auto &src_layout = src.layout();
+    const auto &dst_layout = dst.layout();
+    const auto src_operand = cpu_kernel::makeCpuOperand(
+        src.storageLease(), src_layout.shapeView(), src_layout.stridesView(),
+        src_layout.offset(), ::orteaf::internal::kernel::Access::Read);
+    const auto dst_operand = cpu_kernel::makeCpuOperand(
+        dst.storageLease(), dst_layout.shapeView(), dst_layout.stridesView(),
+        dst_layout.offset(), ::orteaf::internal::kernel::Access::Write);
+    const auto *dst_storage =
+        dst.storageLease()
+            .template tryAs<::orteaf::internal::storage::CpuStorageLease>();
+    const auto device = dst_storage != nullptr && *dst_storage
+                            ? (*dst_storage)->device()
+                            : cpuStorageDevice();
+    const auto pool = CpuExecutionApi::threadPool(device);
+    cpu_kernel::copyStrided(src_operand, dst_operand, pool.get());
+  }
+};
+
+/// @brief Runtime dispatcher for strided copies
+template <typename Impl>
+void copyStridedForExecution(const Impl &src, const Impl &dst) {
+  using Execution = ::orteaf::internal::execution::Execution;
+
+  switch (src.execution()) {
+  case Execution::Cpu:
+    StridedCopier<Execution::Cpu>::copy(src, dst);
+    return;
+  default:
+    ::orteaf::internal::diagnostics::error::throwError(
+        ::orteaf::internal::diagnostics::error::OrteafErrc::Unsupported,
+        "Strided copy is not supported for this execution");
+  }
+}
+
 // =============================================================================
 // Pool Traits Implementation
 // =============================================================================
@@ -296,6 +360,13 @@ TensorImplManager<Impl>::createView(Layout layout, StorageLease storage) {
   return core_.acquireStrongLease(payload_handle);
 }
 
+template <typename Impl>
+  requires TensorImplConcept<Impl>
+typename TensorImplManager<Impl>::TensorImplLease
+TensorImplManager<Impl>::fromStorage(Layout layout, StorageLease storage) {
+  return createView(std::move(layout), std::move(storage));
+}
+
 // ===== View Operations =====
 
 template <typename Impl>
@@ -328,8 +399,18 @@ TensorImplManager<Impl>::reshape(const TensorImplLease &src,
                                  std::span<const Dim> new_shape)
   requires HasReshape<Impl>
 {
-  auto new_layout = src->layout().reshape(new_shape);
-  return createView(std::move(new_layout), src->storageLease());
+  if constexpr (HasContiguous<Impl>) {
+    auto view_layout = src->layout().tryReshape(new_shape);
+    if (view_layout) {
+      return createView(std::move(*view_layout), src->storageLease());
+    }
+    auto dense = contiguous(src);
+    auto new_layout = dense->layout().reshape(new_shape);
+    return createView(std::move(new_layout), dense->storageLease());
+  } else {
+    auto new_layout = src->layout().reshape(new_shape);
+    return createView(std::move(new_layout), src->storageLease());
+  }
 }
 
 template <typename Impl>
@@ -352,4 +433,22 @@ TensorImplManager<Impl>::unsqueeze(const TensorImplLease &src, std::size_t dim)
   return createView(std::move(new_layout), src->storageLease());
 }
 
+// ===== Materialization =====
+
+template <typename Impl>
+  requires TensorImplConcept<Impl>
+typename TensorImplManager<Impl>::TensorImplLease
+TensorImplManager<Impl>::contiguous(const TensorImplLease &src)
+  requires HasContiguous<Impl>
+{
+  if (src->layout().isContiguous()) {
+    return src;
+  }
+  const auto &shape = src->layout().shape();
+  auto dense = create(std::span<const Dim>(shape.data(), shape.size()),
+                      src->dtype(), src->execution());
+  detail::copyStridedForExecution(*src.operator->(), *dense.operator->());
+  return dense;
+}
+
 } // namespace orteaf::internal::tensor
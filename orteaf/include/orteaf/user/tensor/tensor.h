@@ -87,10 +87,18 @@ public:
 
   Tensor transpose(std::span<const std::size_t> perm) const;
   Tensor slice(std::span<const Dim> starts, std::span<const Dim> sizes) const;
+  /// @brief Reshape as a view when the strides allow it, otherwise reshape
+  /// a contiguous() copy.
   Tensor reshape(std::span<const Dim> new_shape) const;
   Tensor squeeze() const;
   Tensor unsqueeze(std::size_t dim) const;
 
+  // ===== Materialization =====
+
+  /// @brief Return this tensor when contiguous, otherwise a contiguous copy
+  /// in new storage.
+  Tensor contiguous() const;
+
   // ===== Access to underlying impl =====
 
   const TensorImplVariant &implVariant() const noexcept { return impl_; }
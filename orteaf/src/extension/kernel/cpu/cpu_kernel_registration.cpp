@@ -0,0 +1,106 @@
+#include "orteaf/extension/kernel/cpu/cpu_kernel_registration.h"
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include "orteaf/extension/kernel/cpu/ops/add_kernel.h"
+#include "orteaf/extension/kernel/cpu/ops/matmul_kernel.h"
+#include "orteaf/extension/kernel/cpu/ops/relu_kernel.h"
+#include "orteaf/internal/architecture/architecture.h"
+#include "orteaf/internal/dtype/dtype.h"
+#include "orteaf/internal/execution/cpu/api/cpu_execution_api.h"
+#include "orteaf/internal/execution_context/cpu/context.h"
+#include "orteaf/internal/kernel/core/kernel_key.h"
+#include "orteaf/internal/kernel/core/variant.h"
+#include "orteaf/internal/ops/ops.h"
+
+namespace orteaf::extension::kernel::cpu {
+
+namespace {
+
+namespace internal_kernel = ::orteaf::internal::kernel;
+using ::orteaf::internal::DType;
+using ::orteaf::internal::architecture::Architecture;
+using ::orteaf::internal::ops::Op;
+using ExecuteFunc = internal_kernel::core::KernelEntry::ExecuteFunc;
+
+constexpr std::array<Architecture, 4> kCpuArchitectures{
+    Architecture::CpuGeneric, Architecture::CpuIntelCometLake,
+    Architecture::CpuSkylake, Architecture::CpuZen4};
+
+template <std::size_t N>
+void registerOp(internal_kernel::registry::KernelRegistry &registry, Op op,
+                const std::array<DType, N> &dtypes, ExecuteFunc execute,
+                internal_kernel::Variant variant =
+                    internal_kernel::variant::kDefault) {
+  using CpuExecutionApi =
+      ::orteaf::internal::execution::cpu::api::CpuExecutionApi;
+  for (const auto arch : kCpuArchitectures) {
+    for (const auto dtype : dtypes) {
+      internal_kernel::core::KernelMetadataLease metadata(
+          internal_kernel::core::KernelMetadataLease::Variant{
+              CpuExecutionApi::acquireKernelMetadata(arch)});
+      metadata.setExecute(execute);
+      const auto key = internal_kernel::kernel_key::make(
+          op, arch, internal_kernel::Layout{0}, dtype, variant);
+      registry.registerKernel(key, std::move(metadata));
+    }
+  }
+}
+
+constexpr std::array<DType, 3> kElementwiseDTypes{DType::F32, DType::F16,
+                                                  DType::I32};
+// ops.yml restricts Relu to floating-point inputs.
+constexpr std::array<DType, 2> kReluDTypes{DType::F32, DType::F16};
+
+// Runs Execute with the context's worker pool detached, so every
+// parallelFor in it runs inline.
+template <ExecuteFunc Execute>
+void serialExecute(internal_kernel::core::KernelEntry::KernelBaseLease &lease,
+                   internal_kernel::KernelArgs &args) {
+  using CpuContext = ::orteaf::internal::execution_context::cpu::Context;
+  auto *context = args.context().tryAs<CpuContext>();
+  if (context == nullptr || context->thread_pool == nullptr) {
+    Execute(lease, args);
+    return;
+  }
+  struct RestorePool {
+    CpuContext &context;
+    std::shared_ptr<CpuContext::ThreadPool> pool;
+    ~RestorePool() { context.thread_pool = std::move(pool); }
+  } restore{*context, std::move(context->thread_pool)};
+  Execute(lease, args);
+}
+
+template <std::size_t N, ExecuteFunc Execute>
+void registerWithSerial(internal_kernel::registry::KernelRegistry &registry,
+                        Op op, const std::array<DType, N> &dtypes) {
+  registerOp(registry, op, dtypes, Execute);
+  registerOp(registry, op, dtypes, &serialExecute<Execute>, kSerialVariant);
+}
+
+} // namespace
+
+void registerCpuKernels(
+    ::orteaf::internal::kernel::registry::KernelRegistry &registry) {
+  constexpr std::array<DType, 2> kMatMulDTypes{DType::F32, DType::F16};
+  registerWithSerial<3, ops::addExecute>(registry, Op::Add,
+                                         kElementwiseDTypes);
+  registerWithSerial<2, ops::reluExecute>(registry, Op::Relu, kReluDTypes);
+  registerWithSerial<2, ops::matmulExecute>(registry, Op::MatMul,
+                                            kMatMulDTypes);
+}
+
+void registerFusedCpuKernel(
+    ::orteaf::internal::kernel::registry::KernelRegistry &registry,
+    Op root_op, std::uint8_t index, ExecuteFunc execute) {
+  const auto variant = internal_kernel::variant::fusedElementwise(index);
+  if (root_op == Op::Relu) {
+    registerOp(registry, root_op, kReluDTypes, execute, variant);
+    return;
+  }
+  registerOp(registry, root_op, kElementwiseDTypes, execute, variant);
+}
+
+} // namespace orteaf::extension::kernel::cpu
@@ -0,0 +1,100 @@
+#include "orteaf/extension/kernel/cpu/ops/add_kernel.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/execution_context/cpu/context.h"
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+#include "orteaf/internal/kernel/cpu/cpu_iteration_plan.h"
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+namespace orteaf::extension::kernel::cpu::ops {
+
+namespace {
+
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+using ::orteaf::internal::DType;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+using cpu_kernel::asSpan;
+using CpuContext = ::orteaf::internal::execution_context::cpu::Context;
+
+} // namespace
+
+void addExecute(kernel::core::KernelEntry::KernelBaseLease &lease,
+                kernel::KernelArgs &args) {
+  const auto &vector_ops = cpu_kernel::vectorOps(
+      cpu_kernel::isaOf(cpu_kernel::kernelArchitecture(lease)));
+  auto storages = AddStorages::extract(args);
+  auto params = AddParams::extract(args);
+
+  const auto lhs = cpu_kernel::makeCpuOperand(storages.lhs, params.lhs);
+  const auto rhs = cpu_kernel::makeCpuOperand(storages.rhs, params.rhs);
+  const auto out = cpu_kernel::makeCpuOperand(storages.output, params.output);
+  if (lhs.dtype != out.dtype || rhs.dtype != out.dtype) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU add kernel requires matching operand dtypes");
+  }
+  const auto shape =
+      cpu_kernel::broadcastShape(asSpan(lhs.shape), asSpan(rhs.shape));
+  if (!cpu_kernel::sameShape(shape, out.shape)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU add kernel output shape does not match broadcast shape");
+  }
+
+  const auto lhs_strides =
+      cpu_kernel::broadcastStrides(lhs, asSpan(out.shape));
+  const auto rhs_strides =
+      cpu_kernel::broadcastStrides(rhs, asSpan(out.shape));
+  const float alpha = params.alpha.valueOr(1.0f);
+  const std::array<std::span<const std::int64_t>, 3> strides{
+      asSpan(lhs_strides), asSpan(rhs_strides), asSpan(out.strides)};
+
+  const cpu_kernel::CpuIterationPlan<3> plan(asSpan(out.shape), strides);
+  const auto *context = args.context().tryAs<CpuContext>();
+  auto *pool = context != nullptr ? context->thread_pool.get() : nullptr;
+
+  auto run = [&](auto add, auto *tag, auto scalar) {
+    using T = std::remove_pointer_t<decltype(tag)>;
+    const T *lhs_data = lhs.as<T>();
+    const T *rhs_data = rhs.as<T>();
+    T *out_data = out.as<T>();
+    plan.parallelForEachRun(
+        pool, cpu_kernel::kElementwiseGrain,
+        [&](const std::array<std::int64_t, 3> &offsets, std::int64_t count,
+            const std::array<std::int64_t, 3> &inner) {
+          add(lhs_data + offsets[0], inner[0], rhs_data + offsets[1], inner[1],
+              out_data + offsets[2], inner[2], count, scalar);
+        });
+  };
+
+  switch (out.dtype) {
+  case DType::F32:
+    run(vector_ops.add_f32, static_cast<float *>(nullptr), alpha);
+    break;
+  case DType::F16:
+    run(vector_ops.add_f16, static_cast<std::uint16_t *>(nullptr), alpha);
+    break;
+  case DType::I32:
+    run(vector_ops.add_i32, static_cast<std::int32_t *>(nullptr),
+        cpu_kernel::i32AddAlpha(alpha));
+    break;
+  default:
+    throwError(OrteafErrc::Unsupported,
+               "CPU add kernel does not support dtype");
+  }
+}
+
+kernel::core::KernelEntry
+createAddKernel(kernel::core::KernelEntry::CpuKernelBaseLease lease) {
+  kernel::core::KernelEntry entry;
+  entry.setBase(kernel::core::KernelEntry::KernelBaseLease{std::move(lease)});
+  entry.setExecute(addExecute);
+  return entry;
+}
+
+} // namespace orteaf::extension::kernel::cpu::ops
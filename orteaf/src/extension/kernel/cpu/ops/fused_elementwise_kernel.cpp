@@ -0,0 +1,75 @@
+#include "orteaf/extension/kernel/cpu/ops/fused_elementwise_kernel.h"
+
+#include <array>
+#include <cstddef>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/execution_context/cpu/context.h"
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+#include "orteaf/internal/kernel/cpu/cpu_operand.h"
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+#include "orteaf/internal/kernel/schema/kernel_storage_schema.h"
+#include "orteaf/internal/kernel/storage/operand_id.h"
+
+namespace orteaf::extension::kernel::cpu::ops {
+
+namespace {
+
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+using CpuContext = ::orteaf::internal::execution_context::cpu::Context;
+
+template <kernel::OperandId ID>
+cpu_kernel::CpuOperand extractOperand(const kernel::KernelArgs &args) {
+  kernel::StorageField<ID> storage;
+  storage.extract(args);
+  cpu_kernel::CpuLayoutFields<ID> layout;
+  layout.extract(args.paramList());
+  return cpu_kernel::makeCpuOperand(storage, layout);
+}
+
+cpu_kernel::CpuOperand extractInput(const kernel::KernelArgs &args,
+                                    std::size_t index) {
+  switch (index) {
+  case 0:
+    return extractOperand<kernel::OperandId::Input0>(args);
+  case 1:
+    return extractOperand<kernel::OperandId::Input1>(args);
+  case 2:
+    return extractOperand<kernel::OperandId::Input2>(args);
+  case 3:
+    return extractOperand<kernel::OperandId::Input3>(args);
+  default:
+    throwError(OrteafErrc::InvalidParameter,
+               "Fused elementwise kernel input index out of range");
+  }
+}
+
+} // namespace
+
+void runFusedElementwiseKernel(
+    kernel::core::KernelEntry::KernelBaseLease &lease, kernel::KernelArgs &args,
+    std::span<const kernel::cpu::FusedNode> nodes) {
+  const auto &vector_ops = cpu_kernel::vectorOps(
+      cpu_kernel::isaOf(cpu_kernel::kernelArchitecture(lease)));
+  if (!cpu_kernel::isValidFusedExpression(nodes)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "Invalid fused elementwise expression");
+  }
+
+  const std::size_t input_count = cpu_kernel::fusedInputCount(nodes);
+  std::array<cpu_kernel::CpuOperand, cpu_kernel::kMaxFusedInputs> inputs{};
+  for (std::size_t i = 0; i < input_count; ++i) {
+    inputs[i] = extractInput(args, i);
+  }
+  const auto output = extractOperand<kernel::OperandId::Output>(args);
+  const auto *context = args.context().tryAs<CpuContext>();
+
+  cpu_kernel::runFusedElementwise(
+      nodes, std::span<const cpu_kernel::CpuOperand>(inputs.data(), input_count),
+      output, vector_ops,
+      context != nullptr ? context->thread_pool.get() : nullptr);
+}
+
+} // namespace orteaf::extension::kernel::cpu::ops
@@ -0,0 +1,166 @@
+#include "orteaf/extension/kernel/cpu/ops/matmul_kernel.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/execution_context/cpu/context.h"
+#include "orteaf/internal/kernel/cpu/cpu_gemm.h"
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+#include "orteaf/internal/kernel/cpu/cpu_strided_loop.h"
+#include "orteaf/internal/kernel/storage/storage_binding.h"
+
+namespace orteaf::extension::kernel::cpu::ops {
+
+namespace {
+
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+using ::orteaf::internal::DType;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+using cpu_kernel::asSpan;
+using Dim = cpu_kernel::CpuOperand::Dim;
+using Dims = cpu_kernel::CpuOperand::Dims;
+using CpuContext = ::orteaf::internal::execution_context::cpu::Context;
+
+/// Leading (batch) dimensions of an operand, dropping the trailing @p drop.
+cpu_kernel::CpuOperand leadingDims(const cpu_kernel::CpuOperand &operand,
+                                   std::size_t drop) {
+  cpu_kernel::CpuOperand result{};
+  result.data = operand.data;
+  result.dtype = operand.dtype;
+  const std::size_t rank = operand.rank() - std::min(drop, operand.rank());
+  result.shape.assign(operand.shape.begin(), operand.shape.begin() + rank);
+  result.strides.assign(operand.strides.begin(),
+                        operand.strides.begin() + rank);
+  return result;
+}
+
+} // namespace
+
+void matmulExecute(kernel::core::KernelEntry::KernelBaseLease &lease,
+                   kernel::KernelArgs &args) {
+  const auto isa = cpu_kernel::isaOf(cpu_kernel::kernelArchitecture(lease));
+  auto storages = MatMulStorages::extract(args);
+  auto params = MatMulParams::extract(args);
+
+  const auto lhs = cpu_kernel::makeCpuOperand(storages.lhs, params.lhs);
+  const auto rhs = cpu_kernel::makeCpuOperand(storages.rhs, params.rhs);
+  const auto out = cpu_kernel::makeCpuOperand(storages.output, params.output);
+  if (lhs.dtype != out.dtype || rhs.dtype != out.dtype) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU matmul kernel requires matching operand dtypes");
+  }
+  if (lhs.rank() < 2 || rhs.rank() < 2 || out.rank() < 2) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU matmul kernel requires operands of rank >= 2");
+  }
+
+  const std::size_t out_rank = out.rank();
+  const Dim m_size = lhs.shape[lhs.rank() - 2];
+  const Dim k_size = lhs.shape[lhs.rank() - 1];
+  const Dim n_size = rhs.shape[rhs.rank() - 1];
+  if (rhs.shape[rhs.rank() - 2] != k_size ||
+      out.shape[out_rank - 2] != m_size || out.shape[out_rank - 1] != n_size) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU matmul kernel operand shapes do not match");
+  }
+
+  const auto lhs_batch = leadingDims(lhs, 2);
+  const auto rhs_batch = leadingDims(rhs, 2);
+  const auto out_batch = leadingDims(out, 2);
+  const auto batch_shape = cpu_kernel::broadcastShape(
+      asSpan(lhs_batch.shape), asSpan(rhs_batch.shape));
+  if (!cpu_kernel::sameShape(batch_shape, out_batch.shape)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU matmul kernel output batch shape does not match");
+  }
+  const auto lhs_batch_strides =
+      cpu_kernel::broadcastStrides(lhs_batch, asSpan(out_batch.shape));
+  const auto rhs_batch_strides =
+      cpu_kernel::broadcastStrides(rhs_batch, asSpan(out_batch.shape));
+
+  // Bias broadcasts against the full output shape, e.g. [N] or [M, N].
+  cpu_kernel::CpuOperand bias{};
+  Dims bias_strides;
+  bias_strides.resize(out_rank);
+  std::fill(bias_strides.begin(), bias_strides.end(), Dim{0});
+  const bool has_bias = storages.bias.present();
+  if (has_bias) {
+    if (!params.bias_shape) {
+      throwError(OrteafErrc::InvalidParameter,
+                 "CPU matmul kernel bias requires a shape param");
+    }
+    bias = cpu_kernel::makeCpuOperand(
+        storages.bias.bindingOr<kernel::StorageBinding>()->lease,
+        params.bias_shape.value, params.bias_strides.valueOr({}),
+        params.bias_offset.valueOr(0),
+        ::orteaf::internal::kernel::Access::Read);
+    if (bias.dtype != out.dtype) {
+      throwError(OrteafErrc::InvalidParameter,
+                 "CPU matmul kernel requires matching bias dtype");
+    }
+    bias_strides = cpu_kernel::broadcastStrides(bias, asSpan(out.shape));
+  }
+  Dims bias_batch_strides;
+  bias_batch_strides.assign(bias_strides.begin(),
+                            bias_strides.begin() + (out_rank - 2));
+
+  const std::array<std::span<const Dim>, 4> strides{
+      asSpan(lhs_batch_strides), asSpan(rhs_batch_strides),
+      asSpan(bias_batch_strides), asSpan(out_batch.strides)};
+
+  if (out.dtype != DType::F32 && out.dtype != DType::F16) {
+    throwError(OrteafErrc::Unsupported,
+               "CPU matmul kernel does not support dtype");
+  }
+
+  // Collect one strided product per batch entry; transposed or broadcast
+  // operands are read in place through their strides while packing.
+  const std::size_t elem_size = ::orteaf::internal::sizeOf(out.dtype);
+  std::vector<cpu_kernel::CpuGemmBatch> batches;
+  cpu_kernel::forEachInnerRun<4>(
+      asSpan(out_batch.shape), strides,
+      [&](const std::array<Dim, 4> &offsets, Dim count,
+          const std::array<Dim, 4> &inner) {
+        for (Dim i = 0; i < count; ++i) {
+          auto at = [&](std::byte *base, std::size_t operand) {
+            return base + (offsets[operand] + i * inner[operand]) *
+                              static_cast<Dim>(elem_size);
+          };
+          cpu_kernel::CpuGemmBatch batch{};
+          batch.a = {at(lhs.data, 0), lhs.strides[lhs.rank() - 2],
+                     lhs.strides[lhs.rank() - 1]};
+          batch.b = {at(rhs.data, 1), rhs.strides[rhs.rank() - 2],
+                     rhs.strides[rhs.rank() - 1]};
+          if (has_bias) {
+            batch.bias = {at(bias.data, 2), bias_strides[out_rank - 2],
+                          bias_strides[out_rank - 1]};
+          }
+          batch.c = {at(out.data, 3), out.strides[out_rank - 2],
+                     out.strides[out_rank - 1]};
+          batches.push_back(batch);
+        }
+      });
+
+  const cpu_kernel::CpuGemmShape shape{m_size, n_size, k_size, out.dtype,
+                                       has_bias};
+  const auto *context = args.context().tryAs<CpuContext>();
+  cpu_kernel::gemm(isa, shape, batches,
+                   context != nullptr ? context->thread_pool.get() : nullptr);
+}
+
+kernel::core::KernelEntry
+createMatMulKernel(kernel::core::KernelEntry::CpuKernelBaseLease lease) {
+  kernel::core::KernelEntry entry;
+  entry.setBase(kernel::core::KernelEntry::KernelBaseLease{std::move(lease)});
+  entry.setExecute(matmulExecute);
+  return entry;
+}
+
+} // namespace orteaf::extension::kernel::cpu::ops
@@ -0,0 +1,90 @@
+#include "orteaf/extension/kernel/cpu/ops/relu_kernel.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/execution_context/cpu/context.h"
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+#include "orteaf/internal/kernel/cpu/cpu_iteration_plan.h"
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+namespace orteaf::extension::kernel::cpu::ops {
+
+namespace {
+
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+using ::orteaf::internal::DType;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+using cpu_kernel::asSpan;
+using CpuContext = ::orteaf::internal::execution_context::cpu::Context;
+
+} // namespace
+
+void reluExecute(kernel::core::KernelEntry::KernelBaseLease &lease,
+                 kernel::KernelArgs &args) {
+  const auto &vector_ops = cpu_kernel::vectorOps(
+      cpu_kernel::isaOf(cpu_kernel::kernelArchitecture(lease)));
+  auto storages = ReluStorages::extract(args);
+  auto params = ReluParams::extract(args);
+
+  const auto in = cpu_kernel::makeCpuOperand(storages.input, params.input);
+  const auto out = cpu_kernel::makeCpuOperand(storages.output, params.output);
+  if (in.dtype != out.dtype) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU relu kernel requires matching operand dtypes");
+  }
+  if (!cpu_kernel::sameShape(in.shape, out.shape)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU relu kernel requires matching operand shapes");
+  }
+
+  const std::array<std::span<const std::int64_t>, 2> strides{
+      asSpan(in.strides), asSpan(out.strides)};
+
+  const cpu_kernel::CpuIterationPlan<2> plan(asSpan(out.shape), strides);
+  const auto *context = args.context().tryAs<CpuContext>();
+  auto *pool = context != nullptr ? context->thread_pool.get() : nullptr;
+
+  auto run = [&](auto relu, auto *tag) {
+    using T = std::remove_pointer_t<decltype(tag)>;
+    const T *in_data = in.as<T>();
+    T *out_data = out.as<T>();
+    plan.parallelForEachRun(
+        pool, cpu_kernel::kElementwiseGrain,
+        [&](const std::array<std::int64_t, 2> &offsets, std::int64_t count,
+            const std::array<std::int64_t, 2> &inner) {
+          relu(in_data + offsets[0], inner[0], out_data + offsets[1], inner[1],
+               count);
+        });
+  };
+
+  switch (out.dtype) {
+  case DType::F32:
+    run(vector_ops.relu_f32, static_cast<float *>(nullptr));
+    break;
+  case DType::F16:
+    run(vector_ops.relu_f16, static_cast<std::uint16_t *>(nullptr));
+    break;
+  case DType::I32:
+    run(vector_ops.relu_i32, static_cast<std::int32_t *>(nullptr));
+    break;
+  default:
+    throwError(OrteafErrc::Unsupported,
+               "CPU relu kernel does not support dtype");
+  }
+}
+
+kernel::core::KernelEntry
+createReluKernel(kernel::core::KernelEntry::CpuKernelBaseLease lease) {
+  kernel::core::KernelEntry entry;
+  entry.setBase(kernel::core::KernelEntry::KernelBaseLease{std::move(lease)});
+  entry.setExecute(reluExecute);
+  return entry;
+}
+
+} // namespace orteaf::extension::kernel::cpu::ops
@@ -0,0 +1,289 @@
+#include "orteaf/internal/diagnostics/trace/trace.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#include <unistd.h>
+
+namespace orteaf::internal::diagnostics::trace {
+
+namespace {
+
+/**
+ * @brief Single-producer ring of trace events.
+ *
+ * The owning thread writes slots without locks; flush() reads them under
+ * the registry mutex. Each slot carries a sequence number (odd while being
+ * written), so a reader that races with a lapping writer discards the slot
+ * instead of returning a torn event.
+ *
+ * When the owning thread exits it marks the ring retired; the registry
+ * releases a retired ring once everything in it has been drained.
+ */
+class ThreadBuffer {
+public:
+  ThreadBuffer(std::size_t capacity, std::uint32_t thread_id)
+      : slots_(std::make_unique<Slot[]>(capacity)), mask_(capacity - 1),
+        thread_id_(thread_id) {}
+
+  void push(const char *name, const char *category, const char *arg_name,
+            std::uint64_t arg_value, std::uint64_t start_ns,
+            std::uint64_t duration_ns) noexcept {
+    const std::uint64_t index = head_.load(std::memory_order_relaxed);
+    Slot &slot = slots_[index & mask_];
+    slot.seq.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.category.store(category, std::memory_order_relaxed);
+    slot.arg_name.store(arg_name, std::memory_order_relaxed);
+    slot.arg_value.store(arg_value, std::memory_order_relaxed);
+    slot.start_ns.store(start_ns, std::memory_order_relaxed);
+    slot.duration_ns.store(duration_ns, std::memory_order_relaxed);
+    slot.seq.store(2 * index + 2, std::memory_order_release);
+    head_.store(index + 1, std::memory_order_release);
+  }
+
+  /// Append unread events to @p out; caller serializes drains.
+  std::size_t drain(std::vector<TraceEvent> &out, std::uint64_t &dropped) {
+    const std::uint64_t head = head_.load(std::memory_order_acquire);
+    const std::uint64_t capacity = mask_ + 1;
+    std::uint64_t begin = tail_;
+    if (head - begin > capacity) {
+      dropped += head - capacity - begin;
+      begin = head - capacity;
+    }
+    std::size_t appended = 0;
+    for (std::uint64_t index = begin; index < head; ++index) {
+      const Slot &slot = slots_[index & mask_];
+      const std::uint64_t expected = 2 * index + 2;
+      if (slot.seq.load(std::memory_order_acquire) != expected) {
+        ++dropped;
+        continue;
+      }
+      TraceEvent event;
+      event.name = slot.name.load(std::memory_order_relaxed);
+      event.category = slot.category.load(std::memory_order_relaxed);
+      event.arg_name = slot.arg_name.load(std::memory_order_relaxed);
+      event.arg_value = slot.arg_value.load(std::memory_order_relaxed);
+      event.start_ns = slot.start_ns.load(std::memory_order_relaxed);
+      event.duration_ns = slot.duration_ns.load(std::memory_order_relaxed);
+      event.thread_id = thread_id_;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) != expected) {
+        ++dropped;
+        continue;
+      }
+      out.push_back(event);
+      ++appended;
+    }
+    tail_ = head;
+    return appended;
+  }
+
+  void discard() noexcept { tail_ = head_.load(std::memory_order_acquire); }
+
+  /// Called by the owning thread after its last push.
+  void retire() noexcept { retired_.store(true, std::memory_order_release); }
+
+  /// True once the owner has exited and every event has been drained.
+  bool releasable() const noexcept {
+    return retired_.load(std::memory_order_acquire) &&
+           tail_ == head_.load(std::memory_order_acquire);
+  }
+
+private:
+  struct Slot {
+    std::atomic<std::uint64_t> seq{0};
+    std::atomic<const char *> name{nullptr};
+    std::atomic<const char *> category{nullptr};
+    std::atomic<const char *> arg_name{nullptr};
+    std::atomic<std::uint64_t> arg_value{0};
+    std::atomic<std::uint64_t> start_ns{0};
+    std::atomic<std::uint64_t> duration_ns{0};
+  };
+
+  std::unique_ptr<Slot[]> slots_;
+  std::uint64_t mask_;
+  std::uint32_t thread_id_;
+  std::atomic<std::uint64_t> head_{0};
+  std::atomic<bool> retired_{false};
+  // Guarded by Registry::mutex.
+  std::uint64_t tail_{0};
+};
+
+struct Registry {
+  std::mutex mutex;
+  // Buffers outlive their threads so late flushes still see their events;
+  // pruneReleasable() drops them once they are retired and drained.
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  std::size_t capacity{1u << 14};
+  std::uint32_t next_thread_id{1};
+  std::uint64_t dropped{0};
+  // Events lost because their thread's ring could not be allocated.
+  std::atomic<std::uint64_t> unrecorded{0};
+};
+
+Registry &registry() {
+  static Registry instance;
+  return instance;
+}
+
+/// Caller holds Registry::mutex.
+void pruneReleasable(Registry &reg) {
+  std::erase_if(reg.buffers,
+                [](const auto &buffer) { return buffer->releasable(); });
+}
+
+/// Retires the calling thread's ring when the thread exits.
+struct ThreadBufferHolder {
+  std::shared_ptr<ThreadBuffer> buffer;
+
+  ~ThreadBufferHolder() {
+    if (buffer) {
+      buffer->retire();
+    }
+  }
+};
+
+/// The calling thread's ring, created on first use; nullptr if it could not
+/// be allocated (the next event retries).
+ThreadBuffer *threadBuffer() noexcept {
+  thread_local ThreadBufferHolder holder;
+  if (!holder.buffer) {
+    try {
+      auto &reg = registry();
+      std::lock_guard<std::mutex> lock(reg.mutex);
+      pruneReleasable(reg);
+      auto created =
+          std::make_shared<ThreadBuffer>(reg.capacity, reg.next_thread_id);
+      reg.buffers.push_back(created);
+      ++reg.next_thread_id;
+      holder.buffer = std::move(created);
+    } catch (...) {
+      return nullptr;
+    }
+  }
+  return holder.buffer.get();
+}
+
+void writeEscaped(std::ostringstream &out, const char *text) {
+  for (const char *c = text; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out << '\\';
+    }
+    out << *c;
+  }
+}
+
+} // namespace
+
+void TraceRecorder::start(Config config) {
+  {
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.capacity = std::bit_ceil(std::max<std::size_t>(
+        config.events_per_thread, std::size_t{2}));
+  }
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+std::uint64_t TraceRecorder::now() noexcept {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+void TraceRecorder::record(const char *name, const char *category,
+                           std::uint64_t start_ns, std::uint64_t duration_ns,
+                           const char *arg_name,
+                           std::uint64_t arg_value) noexcept {
+  ThreadBuffer *buffer = threadBuffer();
+  if (buffer == nullptr) {
+    registry().unrecorded.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  buffer->push(name, category, arg_name, arg_value, start_ns, duration_ns);
+}
+
+std::size_t TraceRecorder::flush(std::vector<TraceEvent> &out) {
+  auto &reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  std::size_t appended = 0;
+  for (auto &buffer : reg.buffers) {
+    appended += buffer->drain(out, reg.dropped);
+  }
+  pruneReleasable(reg);
+  return appended;
+}
+
+std::string TraceRecorder::flushJson() {
+  std::vector<TraceEvent> events;
+  flush(events);
+
+  const auto pid = static_cast<long>(::getpid());
+  std::ostringstream out;
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  char number[64];
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    const auto &event = events[i];
+    out << (i == 0 ? "" : ",") << "{\"name\":\"";
+    writeEscaped(out, event.name != nullptr ? event.name : "");
+    out << "\",\"cat\":\"";
+    writeEscaped(out, event.category != nullptr ? event.category : "");
+    // Trace Event Format timestamps are microseconds.
+    std::snprintf(number, sizeof(number), "%.3f,\"dur\":%.3f",
+                  static_cast<double>(event.start_ns) / 1000.0,
+                  static_cast<double>(event.duration_ns) / 1000.0);
+    out << "\",\"ph\":\"X\",\"ts\":" << number << ",\"pid\":" << pid
+        << ",\"tid\":" << event.thread_id;
+    if (event.arg_name != nullptr) {
+      out << ",\"args\":{\"";
+      writeEscaped(out, event.arg_name);
+      out << "\":" << event.arg_value << "}";
+    }
+    out << "}";
+  }
+  out << "]}";
+  return out.str();
+}
+
+bool TraceRecorder::flushToFile(const std::string &path) {
+  std::ofstream file(path, std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+  file << flushJson() << '\n';
+  return static_cast<bool>(file);
+}
+
+std::uint64_t TraceRecorder::dropped() {
+  auto &reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  return reg.dropped + reg.unrecorded.load(std::memory_order_relaxed);
+}
+
+std::size_t TraceRecorder::threadBufferCount() {
+  auto &reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  return reg.buffers.size();
+}
+
+void TraceRecorder::clear() {
+  auto &reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (auto &buffer : reg.buffers) {
+    buffer->discard();
+  }
+  pruneReleasable(reg);
+  reg.dropped = 0;
+  reg.unrecorded.store(0, std::memory_order_relaxed);
+}
+
+} // namespace orteaf::internal::diagnostics::trace
@@ -1,18 +1,47 @@
 #include "orteaf/internal/execution/allocator/resource/cpu/cpu_resource.h"
 
+#include <atomic>
+
 #include "orteaf/internal/execution/cpu/platform/wrapper/cpu_alloc.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_heap_ops.h"
 #include "orteaf/internal/diagnostics/error/error_macros.h"
 
 namespace orteaf::internal::execution::cpu {
 namespace cpu = ::orteaf::internal::execution::cpu::platform::wrapper;
 
+namespace {
+
+using ::orteaf::internal::execution::cpu::resource::CpuHeapOps;
+using ::orteaf::internal::execution::cpu::resource::CpuPageKind;
+
+// Live allocations served by CpuHeapOps; deallocate() only looks them up
+// while this is non-zero.
+std::atomic<std::size_t> heap_backed_live{0};
+
+bool useHeapOps(std::size_t size, std::size_t alignment) {
+    const auto config = CpuHeapOps::config();
+    // CpuHeapOps regions are page aligned; larger alignments stay on the
+    // aligned allocator.
+    return config.page_kind != CpuPageKind::Base && size >= config.huge_page_threshold && alignment <= 4096;
+}
+
+}  // namespace
+
 void CpuResource::initialize(const Config& /*config*/) noexcept {
     // Stateless; nothing to do.
 }
 
 CpuResource::BufferView CpuResource::allocate(std::size_t size, std::size_t alignment) {
     ORTEAF_THROW_IF(size == 0, InvalidParameter, "CpuResource::allocate requires size > 0");
-    void* base = cpu::allocAligned(size, alignment);
+    if (useHeapOps(size, alignment)) {
+        auto region = CpuHeapOps::reserve(size);
+        BufferView view = CpuHeapOps::map(region);
+        heap_backed_live.fetch_add(1, std::memory_order_relaxed);
+        cpu::updateAlloc(size);
+        return view;
+    }
+    void* base = cpu::allocAligned(size, alignment < kDefaultAlignment ? kDefaultAlignment : alignment);
     return BufferView{base, 0, size};
 }
 
@@ -21,21 +50,34 @@ void CpuResource::deallocate(BufferView view, std::size_t size, std::size_t /*al
         return;
     }
     void* base = static_cast<void*>(static_cast<char*>(view.data()) - view.offset());
+    if (heap_backed_live.load(std::memory_order_relaxed) != 0 &&
+        CpuHeapOps::release(CpuHeapOps::HeapRegion{base, size})) {
+        heap_backed_live.fetch_sub(1, std::memory_order_relaxed);
+        cpu::updateDealloc(size);
+        return;
+    }
     cpu::dealloc(base, size);
 }
 
 bool CpuResource::isCompleted(const FenceToken& token) {
-    (void)token;
-    return true;
+    return token.isCompleted();
 }
 
 bool CpuResource::isCompleted(const ReuseToken& token) {
-    (void)token;
-    return true;
+    return token.isCompleted();
 }
 
 CpuResource::BufferView CpuResource::makeView(BufferView base, std::size_t offset, std::size_t size) {
     return BufferView{base.raw(), offset, size};
 }
 
+CpuResource::BufferView CpuNodeResource::allocate(std::size_t size, std::size_t alignment) const {
+    BufferView view = CpuResource::allocate(size, alignment);
+    if (numa_node_ >= 0) {
+        // Best effort: an unplaced chunk is still usable.
+        (void)cpu::bindToNumaNode(view.data(), size, numa_node_);
+    }
+    return view;
+}
+
 }  // namespace orteaf::internal::execution::cpu
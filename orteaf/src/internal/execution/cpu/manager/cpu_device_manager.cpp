@@ -27,14 +27,20 @@ void CpuDeviceResource::reset([[maybe_unused]] SlowOps *slow_ops) noexcept {
   buffer_manager.shutdown();
   arch = ::orteaf::internal::architecture::Architecture::CpuGeneric;
   is_alive = false;
+  numa_node = -1;
+  cores.clear();
 }
 
 void CpuDeviceResource::moveFrom(CpuDeviceResource &&other) noexcept {
   arch = other.arch;
   is_alive = other.is_alive;
+  numa_node = other.numa_node;
+  cores = std::move(other.cores);
   buffer_manager = std::move(other.buffer_manager);
   other.arch = ::orteaf::internal::architecture::Architecture::CpuGeneric;
   other.is_alive = false;
+  other.numa_node = -1;
+  other.cores.clear();
 }
 
 // =============================================================================
@@ -47,17 +53,19 @@ bool DevicePayloadPoolTraits::create(Payload &payload, const Request &request,
     return false;
   }
 
-  // CPU has only one device with index 0
-  if (request.handle.index != 0) {
+  if (request.handle.index >= context.device_count) {
     return false;
   }
 
   payload.arch = context.ops->detectArchitecture(request.handle);
   payload.is_alive = true;
+  payload.numa_node = context.ops->numaNodeOf(request.handle);
+  payload.cores = context.ops->coresOf(request.handle);
 
   CpuBufferManager::InternalConfig buffer_config{};
   buffer_config.public_config = context.buffer_config;
   buffer_config.ops = context.ops;
+  buffer_config.numa_node = payload.numa_node;
   payload.buffer_manager.configure(buffer_config);
 
   return true;
@@ -84,9 +92,11 @@ void CpuDeviceManager::configure(const InternalConfig &config) {
   ops_ = config.ops;
   const auto &cfg = config.public_config;
 
-  // Setup pool configuration
-  const std::size_t payload_capacity = 1;
-  const std::size_t payload_block_size = 1;
+  // One payload per device; a host always has at least one.
+  const int reported = ops_->getDeviceCount();
+  device_count_ = reported < 1 ? 1u : static_cast<std::size_t>(reported);
+  const std::size_t payload_capacity = device_count_;
+  const std::size_t payload_block_size = device_count_;
   std::size_t control_block_capacity = cfg.control_block_capacity;
   if (control_block_capacity == 0) {
     control_block_capacity = 4;
@@ -102,6 +112,7 @@ void CpuDeviceManager::configure(const InternalConfig &config) {
   DevicePayloadPoolTraits::Context context{};
   context.ops = ops_;
   context.buffer_config = cfg.buffer_config;
+  context.device_count = device_count_;
 
   Core::Builder<DevicePayloadPoolTraits::Request,
                 DevicePayloadPoolTraits::Context>{}
@@ -127,12 +138,13 @@ void CpuDeviceManager::shutdown() {
 
   core_.shutdown(request, context);
   ops_ = nullptr;
+  device_count_ = 0;
 }
 
 CpuDeviceManager::DeviceLease CpuDeviceManager::acquire(DeviceHandle handle) {
   core_.ensureConfigured();
 
-  if (!handle.isValid() || handle.index != 0) {
+  if (!handle.isValid() || handle.index >= device_count_) {
     ::orteaf::internal::diagnostics::error::throwError(
         ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
         "invalid CPU device handle");
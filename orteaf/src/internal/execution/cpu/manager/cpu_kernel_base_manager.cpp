@@ -0,0 +1,75 @@
+#include "orteaf/internal/execution/cpu/manager/cpu_kernel_base_manager.h"
+
+#include "orteaf/internal/diagnostics/error/error.h"
+
+namespace orteaf::internal::execution::cpu::manager {
+
+// =============================================================================
+// PayloadPoolTraits implementation
+// =============================================================================
+
+bool CpuKernelBasePayloadPoolTraits::create(Payload &payload,
+                                            const Request &request,
+                                            const Context &) {
+  return payload.setArchitecture(request.architecture);
+}
+
+void CpuKernelBasePayloadPoolTraits::destroy(Payload &payload,
+                                             const Request &,
+                                             const Context &) {
+  payload.reset();
+}
+
+// =============================================================================
+// CpuKernelBaseManager implementation
+// =============================================================================
+
+void CpuKernelBaseManager::configure(const InternalConfig &config) {
+  shutdown();
+
+  const auto &cfg = config.public_config;
+  const CpuKernelBasePayloadPoolTraits::Request payload_request{};
+  const CpuKernelBasePayloadPoolTraits::Context payload_context{};
+
+  Core::Builder<CpuKernelBasePayloadPoolTraits::Request,
+                CpuKernelBasePayloadPoolTraits::Context>{}
+      .withControlBlockCapacity(cfg.control_block_capacity)
+      .withControlBlockBlockSize(cfg.control_block_block_size)
+      .withControlBlockGrowthChunkSize(cfg.control_block_growth_chunk_size)
+      .withPayloadCapacity(cfg.payload_capacity)
+      .withPayloadBlockSize(cfg.payload_block_size)
+      .withPayloadGrowthChunkSize(cfg.payload_growth_chunk_size)
+      .withRequest(payload_request)
+      .withContext(payload_context)
+      .configure(core_);
+}
+
+void CpuKernelBaseManager::shutdown() {
+  if (!core_.isConfigured()) {
+    return;
+  }
+
+  const CpuKernelBasePayloadPoolTraits::Request payload_request{};
+  const CpuKernelBasePayloadPoolTraits::Context payload_context{};
+  core_.shutdown(payload_request, payload_context);
+}
+
+CpuKernelBaseManager::KernelBaseLease
+CpuKernelBaseManager::acquire(Architecture architecture) {
+  core_.ensureConfigured();
+
+  CpuKernelBasePayloadPoolTraits::Request request{};
+  request.architecture = architecture;
+  const CpuKernelBasePayloadPoolTraits::Context context{};
+
+  auto handle = core_.acquirePayloadOrGrowAndCreate(request, context);
+  if (!handle.isValid()) {
+    ::orteaf::internal::diagnostics::error::throwError(
+        ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+        "CPU kernel base manager has no available slots");
+  }
+
+  return core_.acquireStrongLease(handle);
+}
+
+} // namespace orteaf::internal::execution::cpu::manager
@@ -0,0 +1,75 @@
+#include "orteaf/internal/execution/cpu/manager/cpu_kernel_metadata_manager.h"
+
+#include "orteaf/internal/diagnostics/error/error.h"
+
+namespace orteaf::internal::execution::cpu::manager {
+
+// =============================================================================
+// PayloadPoolTraits implementation
+// =============================================================================
+
+bool CpuKernelMetadataPayloadPoolTraits::create(Payload &payload,
+                                            const Request &request,
+                                            const Context &) {
+  return payload.initialize(request.architecture);
+}
+
+void CpuKernelMetadataPayloadPoolTraits::destroy(Payload &payload,
+                                             const Request &,
+                                             const Context &) {
+  payload.reset();
+}
+
+// =============================================================================
+// CpuKernelMetadataManager implementation
+// =============================================================================
+
+void CpuKernelMetadataManager::configure(const InternalConfig &config) {
+  shutdown();
+
+  const auto &cfg = config.public_config;
+  const CpuKernelMetadataPayloadPoolTraits::Request payload_request{};
+  const CpuKernelMetadataPayloadPoolTraits::Context payload_context{};
+
+  Core::Builder<CpuKernelMetadataPayloadPoolTraits::Request,
+                CpuKernelMetadataPayloadPoolTraits::Context>{}
+      .withControlBlockCapacity(cfg.control_block_capacity)
+      .withControlBlockBlockSize(cfg.control_block_block_size)
+      .withControlBlockGrowthChunkSize(cfg.control_block_growth_chunk_size)
+      .withPayloadCapacity(cfg.payload_capacity)
+      .withPayloadBlockSize(cfg.payload_block_size)
+      .withPayloadGrowthChunkSize(cfg.payload_growth_chunk_size)
+      .withRequest(payload_request)
+      .withContext(payload_context)
+      .configure(core_);
+}
+
+void CpuKernelMetadataManager::shutdown() {
+  if (!core_.isConfigured()) {
+    return;
+  }
+
+  const CpuKernelMetadataPayloadPoolTraits::Request payload_request{};
+  const CpuKernelMetadataPayloadPoolTraits::Context payload_context{};
+  core_.shutdown(payload_request, payload_context);
+}
+
+CpuKernelMetadataManager::CpuKernelMetadataLease
+CpuKernelMetadataManager::acquire(Architecture architecture) {
+  core_.ensureConfigured();
+
+  CpuKernelMetadataPayloadPoolTraits::Request request{};
+  request.architecture = architecture;
+  const CpuKernelMetadataPayloadPoolTraits::Context context{};
+
+  auto handle = core_.acquirePayloadOrGrowAndCreate(request, context);
+  if (!handle.isValid()) {
+    ::orteaf::internal::diagnostics::error::throwError(
+        ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+        "CPU kernel metadata manager has no available slots");
+  }
+
+  return core_.acquireStrongLease(handle);
+}
+
+} // namespace orteaf::internal::execution::cpu::manager
@@ -1,18 +1,251 @@
 #include "orteaf/internal/execution/cpu/resource/cpu_heap_ops.h"
 
 #include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
 
 #include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_thread_pool.h"
 
 namespace orteaf::internal::execution::cpu::resource {
 
+namespace {
+
+struct RegionInfo {
+    std::size_t size{0};  // Bytes actually mmapped (rounded to page_size).
+    std::size_t page_size{0};
+    CpuPageKind kind{CpuPageKind::Base};
+    std::size_t mapped_bytes{0};
+};
+
+struct HeapState {
+    std::mutex mutex;
+    // Every config ever set, immutable once published; config() reads the
+    // newest through `current` without taking the mutex. One entry per
+    // configure() call, which only happens at setup.
+    std::deque<CpuHeapConfig> configs{CpuHeapConfig{}};
+    std::atomic<const CpuHeapConfig*> current{&configs.front()};
+    std::map<std::uintptr_t, RegionInfo> regions;
+    CpuHeapStats stats{};
+};
+
+HeapState& state() {
+    static HeapState instance;
+    return instance;
+}
+
+std::size_t kindIndex(CpuPageKind kind) { return static_cast<std::size_t>(kind); }
+
+std::size_t basePageSize() {
+    static const std::size_t size = [] {
+        const long page = ::sysconf(_SC_PAGESIZE);
+        return page > 0 ? static_cast<std::size_t>(page) : std::size_t{4096};
+    }();
+    return size;
+}
+
+// Default huge page size from /proc/meminfo ("Hugepagesize: 2048 kB").
+std::size_t defaultHugePageSize() {
+    static const std::size_t size = [] {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string key;
+        std::size_t kib = 0;
+        while (meminfo >> key) {
+            if (key == "Hugepagesize:" && meminfo >> kib) {
+                return kib * 1024;
+            }
+            meminfo.ignore(256, '\n');
+        }
+        return std::size_t{2 * 1024 * 1024};
+    }();
+    return size;
+}
+
+bool transparentHugePagesEnabled() {
+    static const bool enabled = [] {
+        std::ifstream sysfs("/sys/kernel/mm/transparent_hugepage/enabled");
+        std::string modes;
+        if (!std::getline(sysfs, modes)) {
+            return false;
+        }
+        return modes.find("[never]") == std::string::npos;
+    }();
+    return enabled;
+}
+
+std::size_t roundUp(std::size_t value, std::size_t unit) { return (value + unit - 1) / unit * unit; }
+
+void throwReserveFailed() {
+    diagnostics::error::throwError(diagnostics::error::OrteafErrc::OutOfMemory, "cpu reserve mmap failed");
+}
+
+#if defined(MAP_HUGETLB)
+void* reserveExplicitHuge(std::size_t length, std::size_t page_size, bool populate) {
+    int flags = MAP_PRIVATE | MAP_ANON | MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+    if (page_size != defaultHugePageSize()) {
+        flags |= static_cast<int>(std::countr_zero(page_size)) << MAP_HUGE_SHIFT;
+    }
+#endif
+#if defined(MAP_POPULATE)
+    if (populate) {
+        flags |= MAP_POPULATE;
+    }
+#else
+    (void)populate;
+#endif
+    void* base = mmap(nullptr, length, PROT_READ | PROT_WRITE, flags, -1, 0);
+    return base == MAP_FAILED ? nullptr : base;
+}
+#endif
+
+// PROT_NONE reservation of @p size bytes aligned to @p alignment.
+void* reserveAligned(std::size_t size, std::size_t alignment) {
+    const std::size_t padded = size + alignment;
+    void* raw = mmap(nullptr, padded, PROT_NONE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+    const auto begin = reinterpret_cast<std::uintptr_t>(raw);
+    const auto aligned = (begin + alignment - 1) & ~(std::uintptr_t{alignment} - 1);
+    if (aligned > begin) {
+        munmap(raw, aligned - begin);
+    }
+    const std::uintptr_t end = begin + padded;
+    if (end > aligned + size) {
+        munmap(reinterpret_cast<void*>(aligned + size), end - (aligned + size));
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+void touchPages(char* begin, std::size_t length) {
+    const std::size_t page = basePageSize();
+    for (std::size_t offset = 0; offset < length; offset += page) {
+        volatile char* byte = begin + offset;
+        *byte = *byte;
+    }
+}
+
+void populateRange(char* begin, std::size_t length) {
+#if defined(MADV_POPULATE_WRITE)
+    if (madvise(begin, length, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+    touchPages(begin, length);
+}
+
+void prefault(void* base, std::size_t length, const CpuHeapConfig& config) {
+    auto* begin = static_cast<char*>(base);
+    const auto pool = config.prefault_pool.lock();
+    if (pool == nullptr || pool->concurrency() == 1 || length < config.parallel_prefault_threshold) {
+        populateRange(begin, length);
+        return;
+    }
+    // One share per pool thread, split on page boundaries. Populating is
+    // idempotent, so if the pool cannot run the shares the caller simply
+    // populates the whole range itself.
+    using Index = CpuThreadPool::Index;
+    const std::size_t page = basePageSize();
+    const auto pages = static_cast<Index>((length + page - 1) / page);
+    const auto threads = static_cast<Index>(pool->concurrency());
+    try {
+        pool->parallelFor(Index{0}, pages, (pages + threads - 1) / threads, [&](Index first, Index last) {
+            const std::size_t offset = static_cast<std::size_t>(first) * page;
+            populateRange(begin + offset, std::min(static_cast<std::size_t>(last) * page, length) - offset);
+        });
+    } catch (const std::exception&) {
+        populateRange(begin, length);
+    }
+}
+
+// Region containing @p ptr; caller holds the state mutex.
+std::map<std::uintptr_t, RegionInfo>::iterator findRegion(HeapState& heap, const void* ptr) {
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    auto it = heap.regions.upper_bound(address);
+    if (it == heap.regions.begin()) {
+        return heap.regions.end();
+    }
+    --it;
+    return address < it->first + it->second.size ? it : heap.regions.end();
+}
+
+}  // namespace
+
+void CpuHeapOps::configure(const CpuHeapConfig& config) {
+    auto& heap = state();
+    std::lock_guard<std::mutex> lock(heap.mutex);
+    heap.configs.push_back(config);
+    heap.current.store(&heap.configs.back(), std::memory_order_release);
+}
+
+CpuHeapConfig CpuHeapOps::config() {
+    return *state().current.load(std::memory_order_acquire);
+}
+
 CpuHeapOps::HeapRegion CpuHeapOps::reserve(std::size_t size) {
     if (size == 0) {
         return {};
     }
-    void* base = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANON, -1, 0);
-    if (base == MAP_FAILED) {
-        diagnostics::error::throwError(diagnostics::error::OrteafErrc::OutOfMemory, "cpu reserve mmap failed");
+    const CpuHeapConfig cfg = config();
+    const CpuPageKind requested = size >= cfg.huge_page_threshold ? cfg.page_kind : CpuPageKind::Base;
+
+    RegionInfo info{};
+    void* base = nullptr;
+#if defined(MAP_HUGETLB)
+    if (requested == CpuPageKind::ExplicitHuge) {
+        const std::size_t page = cfg.huge_page_size != 0 ? cfg.huge_page_size : defaultHugePageSize();
+        const std::size_t length = roundUp(size, page);
+        base = reserveExplicitHuge(length, page, cfg.prefault);
+        if (base != nullptr) {
+            info = RegionInfo{length, page, CpuPageKind::ExplicitHuge, length};
+        }
+    }
+#endif
+    if (base == nullptr && requested != CpuPageKind::Base && transparentHugePagesEnabled()) {
+#if defined(MADV_HUGEPAGE)
+        const std::size_t page = defaultHugePageSize();
+        // The aligned reservation needs a huge page of extra VA; if that
+        // fails, the plain base-page reservation below may still succeed.
+        base = reserveAligned(size, page);
+        if (base != nullptr) {
+            if (madvise(base, size, MADV_HUGEPAGE) == 0) {
+                info = RegionInfo{size, page, CpuPageKind::TransparentHuge, 0};
+            } else {
+                info = RegionInfo{size, basePageSize(), CpuPageKind::Base, 0};
+            }
+        }
+#endif
+    }
+    if (base == nullptr) {
+        base = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if (base == MAP_FAILED) {
+            throwReserveFailed();
+        }
+        info = RegionInfo{size, basePageSize(), CpuPageKind::Base, 0};
+    }
+
+    auto& heap = state();
+    std::lock_guard<std::mutex> lock(heap.mutex);
+    heap.regions[reinterpret_cast<std::uintptr_t>(base)] = info;
+    ++heap.stats.regions[kindIndex(info.kind)];
+    heap.stats.reserved_bytes[kindIndex(info.kind)] += info.size;
+    if (info.kind != requested) {
+        ++heap.stats.huge_page_fallbacks;
+    }
+    if (info.kind == CpuPageKind::ExplicitHuge && cfg.prefault) {
+        heap.stats.prefaulted_bytes += info.size;
     }
     return HeapRegion{base, size};
 }
@@ -20,18 +253,156 @@ CpuHeapOps::HeapRegion CpuHeapOps::reserve(std::size_t size) {
 CpuHeapOps::BufferView CpuHeapOps::map(HeapRegion region) {
     if (!region) return {};
     void* base = region.data();
+    auto& heap = state();
+    CpuPageKind kind = CpuPageKind::Base;
+    const CpuHeapConfig cfg = config();
+    {
+        std::lock_guard<std::mutex> lock(heap.mutex);
+        auto it = findRegion(heap, base);
+        if (it != heap.regions.end()) {
+            kind = it->second.kind;
+            if (kind != CpuPageKind::ExplicitHuge) {
+                it->second.mapped_bytes += region.size();
+            }
+        }
+    }
+    if (kind == CpuPageKind::ExplicitHuge) {
+        // Committed RW at reserve.
+        return BufferView{base, 0, region.size()};
+    }
     if (mprotect(base, region.size(), PROT_READ | PROT_WRITE) != 0) {
         diagnostics::error::throwError(diagnostics::error::OrteafErrc::OperationFailed, "cpu map mprotect failed");
     }
+    if (cfg.prefault) {
+        prefault(base, region.size(), cfg);
+        std::lock_guard<std::mutex> lock(heap.mutex);
+        heap.stats.prefaulted_bytes += region.size();
+    }
     return BufferView{base, 0, region.size()};
 }
 
 void CpuHeapOps::unmap(HeapRegion region, std::size_t size) {
     if (!region) return;
     void* base = region.data();
-    if (munmap(base, size) != 0) {
-        diagnostics::error::throwError(diagnostics::error::OrteafErrc::OperationFailed, "cpu unmap munmap failed");
+    auto& heap = state();
+    CpuPageKind kind = CpuPageKind::Base;
+    std::size_t page_size = 0;
+    {
+        std::lock_guard<std::mutex> lock(heap.mutex);
+        auto it = findRegion(heap, base);
+        if (it != heap.regions.end()) {
+            kind = it->second.kind;
+            page_size = it->second.page_size;
+            if (kind != CpuPageKind::ExplicitHuge) {
+                it->second.mapped_bytes -= std::min(it->second.mapped_bytes, size);
+            }
+        }
+    }
+    if (kind == CpuPageKind::ExplicitHuge) {
+        // Best effort: hugetlb can only drop whole huge pages (and older
+        // kernels not even that), and the range stays RW either way.
+        const auto begin = reinterpret_cast<std::uintptr_t>(base);
+        const std::uintptr_t first = roundUp(begin, page_size);
+        const std::uintptr_t last = (begin + size) / page_size * page_size;
+        if (last > first) {
+            madvise(reinterpret_cast<void*>(first), last - first, MADV_DONTNEED);
+        }
+        return;
+    }
+    // Drop the pages but keep the reservation: slot allocators map the same
+    // region again when the slot is reused.
+    if (madvise(base, size, MADV_DONTNEED) != 0 ||
+        mprotect(base, size, PROT_NONE) != 0) {
+        diagnostics::error::throwError(diagnostics::error::OrteafErrc::OperationFailed, "cpu unmap decommit failed");
+    }
+}
+
+bool CpuHeapOps::release(HeapRegion region) {
+    if (!region) return false;
+    RegionInfo info{};
+    {
+        auto& heap = state();
+        std::lock_guard<std::mutex> lock(heap.mutex);
+        auto it = heap.regions.find(reinterpret_cast<std::uintptr_t>(region.data()));
+        if (it == heap.regions.end()) {
+            return false;
+        }
+        info = it->second;
+        heap.regions.erase(it);
+    }
+    if (munmap(region.data(), info.size) != 0) {
+        diagnostics::error::throwError(diagnostics::error::OrteafErrc::OperationFailed, "cpu release munmap failed");
+    }
+    return true;
+}
+
+CpuPageKind CpuHeapOps::pageKindOf(const void* ptr) {
+    auto& heap = state();
+    std::lock_guard<std::mutex> lock(heap.mutex);
+    auto it = findRegion(heap, ptr);
+    return it != heap.regions.end() ? it->second.kind : CpuPageKind::Base;
+}
+
+CpuHeapStats CpuHeapOps::stats() {
+    auto& heap = state();
+    std::lock_guard<std::mutex> lock(heap.mutex);
+    return heap.stats;
+}
+
+std::vector<CpuHeapRegionStats> CpuHeapOps::regionStats() {
+    std::vector<CpuHeapRegionStats> result;
+    {
+        auto& heap = state();
+        std::lock_guard<std::mutex> lock(heap.mutex);
+        result.reserve(heap.regions.size());
+        for (const auto& [base, info] : heap.regions) {
+            CpuHeapRegionStats entry{};
+            entry.base = reinterpret_cast<void*>(base);
+            entry.size = info.size;
+            entry.kind = info.kind;
+            entry.page_size = info.page_size;
+            entry.mapped_bytes = info.kind == CpuPageKind::ExplicitHuge ? info.size : info.mapped_bytes;
+            result.push_back(entry);
+        }
+    }
+
+    // smaps lists each VMA as "start-end perms ..." followed by "Key: N kB"
+    // lines; attribute huge page counters to regions by address overlap.
+    std::ifstream smaps("/proc/self/smaps");
+    std::string line;
+    std::uintptr_t vma_begin = 0;
+    std::uintptr_t vma_end = 0;
+    while (std::getline(smaps, line)) {
+        if (line.empty()) continue;
+        const auto dash = line.find('-');
+        const auto space = line.find(' ');
+        if (dash != std::string::npos && space != std::string::npos && dash < space &&
+            line.find(':') > space) {
+            vma_begin = std::stoull(line.substr(0, dash), nullptr, 16);
+            vma_end = std::stoull(line.substr(dash + 1, space - dash - 1), nullptr, 16);
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string key;
+        std::size_t kib = 0;
+        if (!(fields >> key >> kib) ||
+            (key != "AnonHugePages:" && key != "Private_Hugetlb:" && key != "Shared_Hugetlb:") || kib == 0 ||
+            vma_end <= vma_begin) {
+            continue;
+        }
+        const double bytes = static_cast<double>(kib) * 1024.0;
+        for (auto& entry : result) {
+            const auto begin = reinterpret_cast<std::uintptr_t>(entry.base);
+            const std::uintptr_t end = begin + entry.size;
+            const std::uintptr_t overlap_begin = std::max(begin, vma_begin);
+            const std::uintptr_t overlap_end = std::min(end, vma_end);
+            if (overlap_end <= overlap_begin) continue;
+            const double share =
+                static_cast<double>(overlap_end - overlap_begin) / static_cast<double>(vma_end - vma_begin);
+            entry.huge_resident_bytes += static_cast<std::size_t>(bytes * share);
+        }
     }
+    return result;
 }
 
 }  // namespace orteaf::internal::execution::cpu::resource
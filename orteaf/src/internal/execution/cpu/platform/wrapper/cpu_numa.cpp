@@ -0,0 +1,136 @@
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace orteaf::internal::execution::cpu::platform::wrapper {
+
+namespace {
+
+// Parse a sysfs list such as "0-3,8,10-11".
+std::vector<std::size_t> parseIdList(const std::string &text) {
+  std::vector<std::size_t> ids;
+  std::size_t pos = 0;
+  while (pos < text.size()) {
+    std::size_t next = text.find(',', pos);
+    if (next == std::string::npos) {
+      next = text.size();
+    }
+    const std::string item = text.substr(pos, next - pos);
+    pos = next + 1;
+    if (item.empty() || item.find_first_not_of("0123456789-\n") !=
+                            std::string::npos) {
+      continue;
+    }
+    const std::size_t dash = item.find('-');
+    const std::size_t first = std::stoul(item.substr(0, dash));
+    const std::size_t last =
+        dash == std::string::npos ? first : std::stoul(item.substr(dash + 1));
+    for (std::size_t id = first; id <= last; ++id) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+
+std::vector<std::size_t> readIdList(const std::string &path) {
+  std::ifstream file(path);
+  std::string line;
+  if (!std::getline(file, line)) {
+    return {};
+  }
+  return parseIdList(line);
+}
+
+#if defined(__linux__) && defined(SYS_mbind)
+// From <linux/mempolicy.h>; spelled out to avoid a libnuma dependency.
+constexpr int kMpolPreferred = 1;
+constexpr unsigned kMpolMfMove = 1u << 1;
+#endif
+
+} // namespace
+
+std::vector<int> numaNodes() {
+  static const std::vector<int> nodes = [] {
+    std::vector<int> result;
+    for (std::size_t id : readIdList("/sys/devices/system/node/online")) {
+      result.push_back(static_cast<int>(id));
+    }
+    if (result.empty()) {
+      result.push_back(0);
+    }
+    return result;
+  }();
+  return nodes;
+}
+
+std::vector<std::size_t> numaNodeCores(int node) {
+  if (node < 0) {
+    return {};
+  }
+  return readIdList("/sys/devices/system/node/node" + std::to_string(node) +
+                    "/cpulist");
+}
+
+bool bindToNumaNode(void *ptr, std::size_t size, int node) noexcept {
+#if defined(__linux__) && defined(SYS_mbind)
+  if (ptr == nullptr || node < 0) {
+    return false;
+  }
+  const long page = ::sysconf(_SC_PAGESIZE);
+  const auto page_size = static_cast<std::uintptr_t>(page > 0 ? page : 4096);
+  const auto begin = reinterpret_cast<std::uintptr_t>(ptr);
+  const std::uintptr_t first = (begin + page_size - 1) & ~(page_size - 1);
+  const std::uintptr_t last = (begin + size) & ~(page_size - 1);
+  if (last <= first) {
+    // No whole page to place; first touch decides.
+    return true;
+  }
+
+  constexpr std::size_t kBitsPerWord = sizeof(unsigned long) * 8;
+  std::vector<unsigned long> mask(static_cast<std::size_t>(node) /
+                                      kBitsPerWord +
+                                  1);
+  mask[static_cast<std::size_t>(node) / kBitsPerWord] |=
+      1ul << (static_cast<std::size_t>(node) % kBitsPerWord);
+  // The kernel reads maxnode - 1 bits.
+  const unsigned long max_node = mask.size() * kBitsPerWord + 1;
+  return ::syscall(SYS_mbind, reinterpret_cast<void *>(first), last - first,
+                   kMpolPreferred, mask.data(), max_node, kMpolMfMove) == 0;
+#else
+  (void)ptr;
+  (void)size;
+  (void)node;
+  return false;
+#endif
+}
+
+int numaNodeOfAddress(const void *ptr) noexcept {
+#if defined(__linux__) && defined(SYS_move_pages)
+  if (ptr == nullptr) {
+    return -1;
+  }
+  const long page = ::sysconf(_SC_PAGESIZE);
+  const auto page_size = static_cast<std::uintptr_t>(page > 0 ? page : 4096);
+  void *aligned = reinterpret_cast<void *>(
+      reinterpret_cast<std::uintptr_t>(ptr) & ~(page_size - 1));
+  int status = -1;
+  // With a null node list move_pages only reports where each page lives.
+  if (::syscall(SYS_move_pages, 0, 1ul, &aligned, nullptr, &status, 0) != 0) {
+    return -1;
+  }
+  return status >= 0 ? status : -1;
+#else
+  (void)ptr;
+  return -1;
+#endif
+}
+
+} // namespace orteaf::internal::execution::cpu::platform::wrapper
@@ -0,0 +1,122 @@
+#include "orteaf/internal/execution/cpu/resource/cpu_command_queue.h"
+
+#include <vector>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/diagnostics/trace/trace.h"
+
+namespace orteaf::internal::execution::cpu::resource {
+
+CpuCommandQueue::CpuCommandQueue()
+    : timeline_(std::make_shared<CpuQueueTimeline>()) {}
+
+CpuCommandQueue::~CpuCommandQueue() { stopWorker(); }
+
+FenceToken CpuCommandQueue::submit(Task task,
+                                   std::shared_ptr<const void> keep_alive) {
+  if (!task) {
+    ::orteaf::internal::diagnostics::error::throwError(
+        ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+        "CpuCommandQueue::submit requires a task");
+  }
+  releaseCompleted();
+
+  std::uint64_t epoch = 0;
+  {
+    std::lock_guard lock(mutex_);
+    epoch = ++submitted_;
+    pending_.push_back(Pending{std::move(task), epoch});
+    if (keep_alive) {
+      retained_.push_back(Retained{epoch, std::move(keep_alive)});
+    }
+    if (!worker_.joinable()) {
+      worker_ = std::thread([this] { workerLoop(); });
+    }
+  }
+  work_cv_.notify_one();
+  return FenceToken{timeline_, epoch};
+}
+
+void CpuCommandQueue::synchronize() {
+  ORTEAF_TRACE_SPAN("CpuCommandQueue::synchronize", "execution");
+  timeline_->wait(submittedEpoch());
+  releaseCompleted();
+
+  std::exception_ptr error;
+  {
+    std::lock_guard lock(mutex_);
+    error = std::exchange(error_, nullptr);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+std::size_t CpuCommandQueue::releaseCompleted() {
+  std::vector<std::shared_ptr<const void>> released;
+  {
+    std::lock_guard lock(mutex_);
+    const std::uint64_t completed = timeline_->completed();
+    while (!retained_.empty() && retained_.front().epoch <= completed) {
+      released.push_back(std::move(retained_.front().object));
+      retained_.pop_front();
+    }
+  }
+  // Destructors run here, outside the lock and off the worker thread.
+  return released.size();
+}
+
+FenceToken CpuCommandQueue::lastToken() const {
+  return FenceToken{timeline_, submittedEpoch()};
+}
+
+std::uint64_t CpuCommandQueue::submittedEpoch() const {
+  std::lock_guard lock(mutex_);
+  return submitted_;
+}
+
+std::size_t CpuCommandQueue::retainedCount() const {
+  std::lock_guard lock(mutex_);
+  return retained_.size();
+}
+
+void CpuCommandQueue::workerLoop() {
+  for (;;) {
+    Pending item;
+    {
+      std::unique_lock lock(mutex_);
+      work_cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+      if (pending_.empty()) {
+        return;
+      }
+      item = std::move(pending_.front());
+      pending_.pop_front();
+    }
+    try {
+      ORTEAF_TRACE_SPAN_ARG("CpuCommandQueue::task", "execution", "epoch",
+                            item.epoch);
+      item.task();
+    } catch (...) {
+      std::lock_guard lock(mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+    item.task = nullptr;
+    timeline_->advance(item.epoch);
+  }
+}
+
+void CpuCommandQueue::stopWorker() {
+  {
+    std::lock_guard lock(mutex_);
+    stop_ = true;
+  }
+  work_cv_.notify_one();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+  retained_.clear();
+}
+
+} // namespace orteaf::internal::execution::cpu::resource
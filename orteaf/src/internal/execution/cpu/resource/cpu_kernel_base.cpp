@@ -0,0 +1,42 @@
+#include "orteaf/internal/execution/cpu/resource/cpu_kernel_base.h"
+
+namespace orteaf::internal::execution::cpu::resource {
+
+bool CpuKernelBase::setArchitecture(Architecture architecture) {
+  reset();
+  if (::orteaf::internal::architecture::executionOf(architecture) !=
+      ::orteaf::internal::execution::Execution::Cpu) {
+    return false;
+  }
+  architecture_ = architecture;
+  return true;
+}
+
+bool CpuKernelBase::ensureConfigured(DeviceLease &device_lease) {
+  if (!device_lease) {
+    return false;
+  }
+  const auto device = device_lease.payloadHandle();
+  if (configured(device)) {
+    return true;
+  }
+  const auto *resource = device_lease.operator->();
+  if (resource == nullptr || !supports(resource->arch, architecture_)) {
+    return false;
+  }
+  configured_device_.store(device.index, std::memory_order_relaxed);
+  return true;
+}
+
+bool CpuKernelBase::supports(Architecture device_arch,
+                             Architecture kernel_arch) {
+  bool found = false;
+  ::orteaf::internal::architecture::forEachFallback(
+      device_arch, [&](Architecture candidate) {
+        found = candidate == kernel_arch;
+        return !found;
+      });
+  return found;
+}
+
+} // namespace orteaf::internal::execution::cpu::resource
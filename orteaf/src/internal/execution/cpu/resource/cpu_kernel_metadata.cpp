@@ -0,0 +1,27 @@
+#include "orteaf/internal/execution/cpu/resource/cpu_kernel_metadata.h"
+
+#include "orteaf/internal/execution/cpu/api/cpu_execution_api.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_kernel_base.h"
+#include "orteaf/internal/kernel/core/kernel_entry.h"
+#include "orteaf/internal/kernel/core/kernel_metadata.h"
+
+namespace orteaf::internal::execution::cpu::resource {
+
+void CpuKernelMetadata::rebuildKernelEntry(
+    ::orteaf::internal::kernel::core::KernelEntry &entry) const {
+  entry.setBase(
+      ::orteaf::internal::execution::cpu::api::CpuExecutionApi::acquireKernelBase(
+          architecture()));
+}
+
+::orteaf::internal::kernel::core::KernelMetadataLease
+CpuKernelMetadata::buildMetadataLeaseFromBase(
+    const ::orteaf::internal::execution::cpu::resource::CpuKernelBase &base) {
+  ::orteaf::internal::kernel::core::KernelMetadataLease metadata;
+  metadata.setLease(
+      ::orteaf::internal::execution::cpu::api::CpuExecutionApi::
+          acquireKernelMetadata(base.architecture()));
+  return metadata;
+}
+
+} // namespace orteaf::internal::execution::cpu::resource
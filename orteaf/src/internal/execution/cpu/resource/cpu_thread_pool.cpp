@@ -0,0 +1,228 @@
+#include "orteaf/internal/execution/cpu/resource/cpu_thread_pool.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace orteaf::internal::execution::cpu::resource {
+
+namespace {
+
+// Worker identity of the current thread; lets nested parallelFor() calls
+// push onto their own deque and help instead of blocking.
+thread_local const CpuThreadPool *tls_pool = nullptr;
+thread_local int tls_worker_index = -1;
+
+// Chunks per participating thread; more chunks give stealing room to balance
+// uneven work at the cost of more queue traffic.
+constexpr CpuThreadPool::Index kChunksPerThread = 4;
+
+// Pins @p thread to the OS CPU id @p core.
+void pinToCore(std::thread &thread, std::size_t core) {
+#if defined(__linux__)
+  if (core >= CPU_SETSIZE) {
+    return;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core, &set);
+  // Best effort: pinning can be refused (e.g. restricted cpusets).
+  (void)pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+  (void)thread;
+  (void)core;
+#endif
+}
+
+} // namespace
+
+CpuThreadPool::CpuThreadPool(const Config &config) {
+  std::size_t threads = config.thread_count;
+  if (threads == 0) {
+    threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  }
+  const std::size_t worker_count = threads - 1;
+  queues_.reserve(worker_count);
+  for (std::size_t i = 0; i < worker_count; ++i) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+  // Explicit cores are OS CPU ids (possibly sparse, e.g. one NUMA node's)
+  // and are used as given; only the first_core + i numbering wraps.
+  const std::size_t hardware_cores =
+      std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  workers_.reserve(worker_count);
+  for (std::size_t i = 0; i < worker_count; ++i) {
+    workers_.emplace_back([this, i] { workerLoop(i); });
+    if (config.pin_threads) {
+      pinToCore(workers_.back(),
+                config.cores.empty() ? (config.first_core + i) % hardware_cores
+                                     : config.cores[i % config.cores.size()]);
+    }
+  }
+}
+
+CpuThreadPool::~CpuThreadPool() {
+  stop_.store(true, std::memory_order_release);
+  wakeWorkers();
+  // A task on one of our own workers may drop the last reference to the
+  // pool. That thread cannot join itself: it is detached instead and leaves
+  // workerLoop() once the task returns.
+  const int self = currentWorkerIndex();
+  for (std::size_t i = 0; i < workers_.size(); ++i) {
+    if (static_cast<int>(i) == self) {
+      workers_[i].detach();
+    } else {
+      workers_[i].join();
+    }
+  }
+  if (self >= 0) {
+    tls_pool = nullptr;
+    tls_worker_index = -1;
+  }
+}
+
+int CpuThreadPool::currentWorkerIndex() const noexcept {
+  return tls_pool == this ? tls_worker_index : -1;
+}
+
+CpuThreadPool::Index CpuThreadPool::chunkSize(Index count,
+                                              Index grain) const noexcept {
+  const Index target =
+      static_cast<Index>(concurrency()) * kChunksPerThread;
+  return std::max(std::max<Index>(grain, 1), (count + target - 1) / target);
+}
+
+void CpuThreadPool::run(Index begin, Index end, Index grain, RangeFn fn) {
+  if (end <= begin) {
+    return;
+  }
+  const Index count = end - begin;
+  const Index chunk = chunkSize(count, grain);
+  if (queues_.empty() || chunk >= count) {
+    fn.call(fn.ctx, begin, end);
+    return;
+  }
+
+  Job job;
+  job.fn = fn;
+  const Index chunks = (count + chunk - 1) / chunk;
+  job.remaining.store(chunks, std::memory_order_relaxed);
+
+  // The caller keeps the first chunk; the rest go to its own deque when it
+  // is a worker (others steal them) or round-robin over all deques.
+  const int self = currentWorkerIndex();
+  for (Index c = 1; c < chunks; ++c) {
+    const Index chunk_begin = begin + c * chunk;
+    const std::size_t queue =
+        self >= 0 ? static_cast<std::size_t>(self)
+                  : next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                        queues_.size();
+    push(queue, Task{&job, chunk_begin, std::min(end, chunk_begin + chunk)});
+  }
+  wakeWorkers();
+
+  execute(Task{&job, begin, begin + chunk});
+  while (job.remaining.load(std::memory_order_acquire) > 0) {
+    if (!tryRunOne(self)) {
+      std::this_thread::yield();
+    }
+  }
+  if (job.error) {
+    std::rethrow_exception(job.error);
+  }
+}
+
+void CpuThreadPool::push(std::size_t queue, Task task) {
+  auto &worker_queue = *queues_[queue];
+  {
+    std::lock_guard<std::mutex> lock(worker_queue.mutex);
+    worker_queue.tasks.push_back(task);
+  }
+  queued_.fetch_add(1, std::memory_order_release);
+}
+
+bool CpuThreadPool::popLocal(std::size_t queue, Task &task) {
+  auto &worker_queue = *queues_[queue];
+  std::lock_guard<std::mutex> lock(worker_queue.mutex);
+  if (worker_queue.tasks.empty()) {
+    return false;
+  }
+  task = worker_queue.tasks.back();
+  worker_queue.tasks.pop_back();
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool CpuThreadPool::steal(std::size_t thief, Task &task) {
+  const std::size_t count = queues_.size();
+  for (std::size_t i = 1; i <= count; ++i) {
+    auto &victim = *queues_[(thief + i) % count];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (victim.tasks.empty()) {
+      continue;
+    }
+    task = victim.tasks.front();
+    victim.tasks.pop_front();
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+bool CpuThreadPool::tryRunOne(int self) {
+  if (queued_.load(std::memory_order_acquire) <= 0) {
+    return false;
+  }
+  Task task;
+  const bool found =
+      (self >= 0 && popLocal(static_cast<std::size_t>(self), task)) ||
+      steal(self >= 0 ? static_cast<std::size_t>(self) : 0, task);
+  if (!found) {
+    return false;
+  }
+  execute(task);
+  return true;
+}
+
+void CpuThreadPool::execute(const Task &task) {
+  Job &job = *task.job;
+  try {
+    job.fn.call(job.fn.ctx, task.begin, task.end);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(job.error_mutex);
+    if (!job.error) {
+      job.error = std::current_exception();
+    }
+  }
+  // The owner may destroy the job as soon as this reaches zero.
+  job.remaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void CpuThreadPool::wakeWorkers() noexcept {
+  wake_epoch_.fetch_add(1, std::memory_order_release);
+  wake_epoch_.notify_all();
+}
+
+void CpuThreadPool::workerLoop(std::size_t index) {
+  tls_pool = this;
+  tls_worker_index = static_cast<int>(index);
+  for (;;) {
+    // Read the epoch before looking for work: a push that lands after the
+    // check bumps it, so wait() returns instead of missing the wake-up.
+    const std::uint32_t epoch = wake_epoch_.load(std::memory_order_acquire);
+    if (tryRunOne(static_cast<int>(index))) {
+      // The task destroyed the pool; touch no member after it.
+      if (tls_pool != this) {
+        return;
+      }
+      continue;
+    }
+    if (stop_.load(std::memory_order_acquire)) {
+      return;
+    }
+    wake_epoch_.wait(epoch, std::memory_order_acquire);
+  }
+}
+
+} // namespace orteaf::internal::execution::cpu::resource
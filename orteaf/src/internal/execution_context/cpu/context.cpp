@@ -8,6 +8,7 @@ Context::Context(::orteaf::internal::execution::cpu::CpuDeviceHandle device) {
   namespace cpu_api = ::orteaf::internal::execution::cpu::api;
 
   this->device = cpu_api::CpuExecutionApi::acquireDevice(device);
+  this->thread_pool = cpu_api::CpuExecutionApi::threadPool(device);
 }
 
 } // namespace orteaf::internal::execution_context::cpu
@@ -14,9 +14,8 @@ void ensureDefaultContext(CurrentContext &state) {
   if (state.current.device) {
     return;
   }
-  state.current.device =
-      ::orteaf::internal::execution::cpu::api::CpuExecutionApi::acquireDevice(
-          ::orteaf::internal::execution::cpu::CpuDeviceHandle{0});
+  state.current =
+      Context{::orteaf::internal::execution::cpu::CpuDeviceHandle{0}};
 }
 
 } // namespace
@@ -49,4 +48,12 @@ Context::DeviceLease currentDevice() {
   return state.current.device;
 }
 
+::orteaf::internal::execution::cpu::CpuDeviceHandle currentDeviceHandle() {
+  const auto &device = currentStateStorage().current.device;
+  if (!device) {
+    return ::orteaf::internal::execution::cpu::CpuDeviceHandle{0};
+  }
+  return device.payloadHandle();
+}
+
 } // namespace orteaf::internal::execution_context::cpu
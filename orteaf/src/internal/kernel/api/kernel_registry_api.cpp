@@ -3,7 +3,10 @@
 namespace orteaf::internal::kernel::api {
 
 ::orteaf::internal::kernel::registry::KernelRegistry &kernelRegistry() noexcept {
-  static ::orteaf::internal::kernel::registry::KernelRegistry instance;
+  // Shared by every dispatching thread.
+  static ::orteaf::internal::kernel::registry::KernelRegistry instance{
+      ::orteaf::internal::kernel::registry::KernelRegistryConfig{
+          .concurrent = true}};
   return instance;
 }
 
@@ -0,0 +1,295 @@
+#include "orteaf/internal/kernel/autotune/kernel_autotuner.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include <orteaf/internal/architecture/architecture.h>
+#include <orteaf/internal/kernel/core/kernel_key.h>
+#include <orteaf/internal/kernel/core/variant.h>
+
+namespace orteaf::internal::kernel::autotune {
+
+namespace {
+
+namespace arch = ::orteaf::internal::architecture;
+
+// First line of the decision file. Bump when the line format changes;
+// files with another header are ignored and rewritten by save().
+constexpr const char *kFileHeader = "orteaf-autotune 1";
+
+double wallClockMeasure(KernelAutotuner::Entry &entry, KernelArgs &args) {
+  const auto start = std::chrono::steady_clock::now();
+  entry.run(args);
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+} // namespace
+
+std::uint64_t shapeBucket(std::span<const std::int64_t> extents) noexcept {
+  std::uint64_t bucket = 0xCBF29CE484222325ull ^ extents.size();
+  for (const std::int64_t extent : extents) {
+    // log2 of the extent rounded up to a power of two; 0 and 1 share 0.
+    const auto log2 = extent <= 1 ? 0
+                                  : std::bit_width(static_cast<std::uint64_t>(
+                                        extent - 1));
+    bucket = (bucket ^ static_cast<std::uint64_t>(log2)) * 0x100000001B3ull;
+  }
+  return bucket;
+}
+
+KernelAutotuner::KernelAutotuner(Config config) : config_(std::move(config)) {
+  if (config_.measure == nullptr) {
+    config_.measure = &wallClockMeasure;
+  }
+  config_.repetitions = std::max<std::size_t>(config_.repetitions, 1);
+  load();
+}
+
+std::optional<KernelKey> KernelAutotuner::select(Registry &registry,
+                                                 const KeyRequest &request,
+                                                 KernelArgs &args,
+                                                 std::uint64_t bucket) {
+  const DecisionKey key = decisionKeyOf(request, bucket);
+  {
+    std::shared_lock lock(mutex_);
+    auto it = decisions_.find(key);
+    if (it != decisions_.end() && registry.contains(it->second)) {
+      cached_hits_.fetch_add(1, std::memory_order_relaxed);
+      return it->second;
+    }
+  }
+
+  std::unique_lock lock(mutex_);
+  // Another thread may have tuned this bucket meanwhile.
+  auto it = decisions_.find(key);
+  if (it != decisions_.end() && registry.contains(it->second)) {
+    cached_hits_.fetch_add(1, std::memory_order_relaxed);
+    return it->second;
+  }
+
+  if (config_.store != nullptr) {
+    const auto stored = config_.store->findTuning(request, bucket);
+    if (stored.has_value() && registry.contains(*stored)) {
+      decisions_[key] = *stored;
+      ++stats_.loaded;
+      return stored;
+    }
+  }
+
+  const auto candidates = collectCandidates(registry, request);
+  if (candidates.empty()) {
+    return std::nullopt;
+  }
+
+  KernelKey winner = candidates[0];
+  if (candidates.size() > 1) {
+    // Timing can take long; other buckets keep being served meanwhile.
+    lock.unlock();
+    auto trial = scratchArgs(args);
+    std::size_t timed = 0;
+    if (trial.has_value()) {
+      double best = 0.0;
+      bool have_best = false;
+      for (const KernelKey candidate : candidates) {
+        auto *entry = registry.lookup(candidate);
+        if (entry == nullptr) {
+          continue;
+        }
+        const double time = timeCandidate(*entry, *trial);
+        ++timed;
+        if (!have_best || time < best) {
+          best = time;
+          winner = candidate;
+          have_best = true;
+        }
+      }
+    }
+    lock.lock();
+    if (!trial.has_value()) {
+      ++stats_.untimed;
+      return winner;
+    }
+    stats_.candidates_timed += timed;
+    auto raced = decisions_.find(key);
+    if (raced != decisions_.end() && registry.contains(raced->second)) {
+      return raced->second;
+    }
+  }
+
+  decisions_[key] = winner;
+  ++stats_.tuned;
+  append(key, winner);
+  if (config_.store != nullptr) {
+    config_.store->putTuning(request, bucket, winner);
+  }
+  return winner;
+}
+
+std::optional<KernelKey>
+KernelAutotuner::decision(const KeyRequest &request,
+                          std::uint64_t bucket) const {
+  std::shared_lock lock(mutex_);
+  auto it = decisions_.find(decisionKeyOf(request, bucket));
+  if (it == decisions_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+bool KernelAutotuner::save() {
+  if (config_.cache_path.empty()) {
+    return false;
+  }
+  std::unique_lock lock(mutex_);
+  return rewriteFile();
+}
+
+void KernelAutotuner::clear() {
+  std::unique_lock lock(mutex_);
+  decisions_.clear();
+}
+
+KernelAutotuner::Stats KernelAutotuner::stats() const {
+  std::shared_lock lock(mutex_);
+  Stats stats = stats_;
+  stats.cached_hits = cached_hits_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+KernelAutotuner::DecisionKey
+KernelAutotuner::decisionKeyOf(const KeyRequest &request,
+                               std::uint64_t bucket) noexcept {
+  // The request packed as a key with default layout and variant.
+  const auto packed = makeKey({request.op, request.dtype},
+                              {request.architecture, static_cast<Layout>(0),
+                               variant::kDefault});
+  return {static_cast<std::uint64_t>(packed), bucket};
+}
+
+KernelAutotuner::Candidates
+KernelAutotuner::collectCandidates(const Registry &registry,
+                                   const KeyRequest &request) {
+  std::vector<KernelKey> matching;
+  registry.forEachKey([&](KernelKey key) {
+    if (kernel_key::getOp(key) == request.op &&
+        kernel_key::getDType(key) == request.dtype &&
+        kernel_key::getVersion(key) == kernel_key::kCurrentVersion &&
+        !variant::isFusedElementwise(kernel_key::getVariant(key))) {
+      matching.push_back(key);
+    }
+  });
+
+  // Only the most specific architecture with any candidate competes, as in
+  // key_resolver.
+  Candidates candidates;
+  arch::forEachFallback(request.architecture, [&](arch::Architecture level) {
+    for (const KernelKey key : matching) {
+      if (kernel_key::getArchitecture(key) == level) {
+        candidates.pushBack(key);
+      }
+    }
+    return candidates.empty();
+  });
+  // Registry iteration order is arbitrary; keep ties deterministic.
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+std::optional<KernelArgs>
+KernelAutotuner::scratchArgs(const KernelArgs &args) const {
+  KernelArgs trial = args;
+  for (auto &binding : trial.storageList()) {
+    const Access access = accessOf(binding.key.id);
+    if (access == Access::None || access == Access::Read) {
+      continue;
+    }
+    if (config_.scratch == nullptr) {
+      return std::nullopt;
+    }
+    auto scratch = config_.scratch(binding.lease);
+    if (!scratch) {
+      return std::nullopt;
+    }
+    binding.lease = std::move(scratch);
+  }
+  return trial;
+}
+
+double KernelAutotuner::timeCandidate(Entry &entry, KernelArgs &args) const {
+  config_.measure(entry, args); // warm-up: configures the kernel base
+  std::vector<double> samples(config_.repetitions);
+  for (auto &sample : samples) {
+    sample = config_.measure(entry, args);
+  }
+  const auto middle = samples.begin() + samples.size() / 2;
+  std::nth_element(samples.begin(), middle, samples.end());
+  return *middle;
+}
+
+void KernelAutotuner::load() {
+  if (config_.cache_path.empty()) {
+    return;
+  }
+  std::ifstream in(config_.cache_path);
+  std::string line;
+  if (!in || !std::getline(in, line) || line != kFileHeader) {
+    return;
+  }
+  file_current_ = true;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::uint64_t request = 0;
+    std::uint64_t bucket = 0;
+    std::uint64_t winner = 0;
+    if (!(fields >> std::hex >> request >> bucket >> winner)) {
+      continue; // torn or foreign line
+    }
+    const auto winner_key = static_cast<KernelKey>(winner);
+    if (kernel_key::getVersion(winner_key) != kernel_key::kCurrentVersion) {
+      continue;
+    }
+    // Later lines win: a bucket re-tuned after its key disappeared is
+    // appended again.
+    decisions_[{request, bucket}] = winner_key;
+  }
+  stats_.loaded = decisions_.size();
+}
+
+bool KernelAutotuner::rewriteFile() {
+  std::ofstream out(config_.cache_path, std::ios::trunc);
+  if (!out) {
+    return false;
+  }
+  out << kFileHeader << '\n' << std::hex;
+  for (const auto &[key, winner] : decisions_) {
+    out << key.request << ' ' << key.bucket << ' '
+        << static_cast<std::uint64_t>(winner) << '\n';
+  }
+  file_current_ = static_cast<bool>(out);
+  return file_current_;
+}
+
+void KernelAutotuner::append(const DecisionKey &key, KernelKey winner) {
+  if (config_.cache_path.empty()) {
+    return;
+  }
+  // Best effort: a read-only cache location only costs re-tuning later.
+  if (!file_current_) {
+    // Missing or foreign file: start it over with everything we know.
+    rewriteFile();
+    return;
+  }
+  std::ofstream out(config_.cache_path, std::ios::app);
+  if (out) {
+    out << std::hex << key.request << ' ' << key.bucket << ' '
+        << static_cast<std::uint64_t>(winner) << '\n';
+  }
+}
+
+} // namespace orteaf::internal::kernel::autotune
@@ -0,0 +1,204 @@
+#include "orteaf/internal/kernel/core/bound_launch.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <variant>
+
+#include <orteaf/internal/base/array_view.h>
+#include <orteaf/internal/kernel/core/access.h>
+#include <orteaf/internal/kernel/param/param_key.h>
+
+namespace orteaf::internal::kernel::core {
+
+namespace {
+
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+
+template <typename T> struct IsArrayView : std::false_type {};
+template <typename T>
+struct IsArrayView<::orteaf::internal::base::ArrayView<T>> : std::true_type {};
+
+constexpr std::size_t kArrayAlignment = alignof(std::max_align_t);
+
+constexpr std::size_t alignUp(std::size_t bytes) noexcept {
+  return (bytes + kArrayAlignment - 1) & ~(kArrayAlignment - 1);
+}
+
+using DimsView = ::orteaf::internal::base::ArrayView<const std::int64_t>;
+
+const DimsView *scopedDims(const KernelArgs &args, ParamId id,
+                           OperandKey key) {
+  const auto *param = args.findParam(ParamKey::scoped(id, key));
+  return param != nullptr ? param->tryGet<DimsView>() : nullptr;
+}
+
+// Elements a storage needs for the layout params bound under @p key, or
+// nullopt when no Shape was bound.
+std::optional<std::size_t> requiredElements(const KernelArgs &args,
+                                            OperandKey key) {
+  const DimsView *shape = scopedDims(args, ParamId::Shape, key);
+  if (shape == nullptr) {
+    return std::nullopt;
+  }
+  const DimsView *strides = scopedDims(args, ParamId::Strides, key);
+  if (strides != nullptr && !strides->empty() &&
+      strides->size() != shape->size()) {
+    throwError(OrteafErrc::InvalidParameter,
+               "BoundLaunch operand strides rank does not match shape");
+  }
+  std::int64_t offset = 0;
+  if (const auto *param =
+          args.findParam(ParamKey::scoped(ParamId::Offset, key));
+      param != nullptr) {
+    if (const auto *value = param->tryGet<std::int64_t>()) {
+      offset = *value;
+    }
+  }
+
+  // Contiguous strides when none were bound, as makeCpuOperand assumes.
+  std::int64_t last = offset;
+  std::int64_t contiguous = 1;
+  for (std::size_t i = shape->size(); i > 0; --i) {
+    const std::int64_t dim = (*shape)[i - 1];
+    if (dim == 0) {
+      return 0;
+    }
+    const std::int64_t stride = strides != nullptr && !strides->empty()
+                                    ? (*strides)[i - 1]
+                                    : contiguous;
+    last += (dim - 1) * (stride < 0 ? 0 : stride);
+    contiguous *= dim;
+  }
+  return static_cast<std::size_t>(last) + 1;
+}
+
+bool isReadOnly(const ::orteaf::internal::storage::StorageLease &lease) {
+  return lease.tryAs<::orteaf::internal::storage::CpuMappedStorageLease>() !=
+         nullptr;
+}
+
+} // namespace
+
+BoundLaunch::BoundLaunch(const KernelEntry &entry, Args args)
+    : entry_(entry), args_(std::move(args)) {
+  if (entry_.execute() == nullptr) {
+    throwError(OrteafErrc::InvalidParameter,
+               "BoundLaunch requires a kernel entry with an execute function");
+  }
+  ownArrayParams();
+}
+
+std::size_t BoundLaunch::storageSlot(OperandKey key) const {
+  const auto &storages = args_.storageList().storage();
+  for (std::size_t slot = 0; slot < storages.size(); ++slot) {
+    if (storages[slot].key == key) {
+      return slot;
+    }
+  }
+  throwError(OrteafErrc::InvalidParameter,
+             "BoundLaunch has no storage bound under the operand key");
+}
+
+void BoundLaunch::setStorage(std::size_t slot, StorageLease lease) {
+  auto &storages = args_.storageList().storage();
+  if (slot >= storages.size()) {
+    throwError(OrteafErrc::OutOfRange, "BoundLaunch storage slot out of range");
+  }
+  auto &binding = storages[slot];
+  if (!lease) {
+    throwError(OrteafErrc::InvalidParameter,
+               "BoundLaunch storage must be a valid lease");
+  }
+  if (binding.lease) {
+    if (lease.execution() != binding.lease.execution()) {
+      throwError(OrteafErrc::InvalidParameter,
+                 "BoundLaunch storage execution does not match the binding");
+    }
+    if (lease.dtype() != binding.lease.dtype()) {
+      throwError(OrteafErrc::InvalidParameter,
+                 "BoundLaunch storage dtype does not match the binding");
+    }
+  }
+  const std::optional<std::size_t> required =
+      requiredElements(args_, binding.key);
+  const std::size_t needed =
+      required.has_value() ? *required
+                           : (binding.lease ? binding.lease.numel() : 0);
+  if (lease.numel() < needed) {
+    throwError(OrteafErrc::InvalidParameter,
+               "BoundLaunch storage is too small for the bound layout");
+  }
+  if (accessOf(binding.key.id) != Access::Read && isReadOnly(lease)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "BoundLaunch cannot bind read-only storage to a written "
+               "operand");
+  }
+  binding.lease = std::move(lease);
+}
+
+void BoundLaunch::run() {
+  if (!valid()) {
+    throwError(OrteafErrc::InvalidState, "BoundLaunch is not bound");
+  }
+  entry_.run(args_);
+  ++launch_count_;
+}
+
+std::shared_ptr<BoundLaunch> BoundLaunch::snapshotLaunch() {
+  if (!valid()) {
+    throwError(OrteafErrc::InvalidState, "BoundLaunch is not bound");
+  }
+  // The snapshot re-owns its array params, so it is independent of this
+  // launch.
+  auto snapshot = std::make_shared<BoundLaunch>(entry_, args_);
+  if (repack_ != nullptr) {
+    // The copied pack still points at this launch's arrays.
+    snapshot->repack_ = repack_;
+    repack_(snapshot->args_);
+  }
+  ++launch_count_;
+  return snapshot;
+}
+
+void BoundLaunch::ownArrayParams() {
+  auto &params = args_.paramList();
+  std::size_t total = 0;
+  for (const auto &param : params) {
+    std::visit(
+        [&](const auto &value) {
+          using V = std::decay_t<decltype(value)>;
+          if constexpr (IsArrayView<V>::value) {
+            total += alignUp(value.count * sizeof(*value.data));
+          }
+        },
+        param.value());
+  }
+  if (total == 0) {
+    return;
+  }
+
+  arrays_ = std::make_unique<std::byte[]>(total);
+  std::byte *cursor = arrays_.get();
+  for (auto &param : params) {
+    std::visit(
+        [&](auto &value) {
+          using V = std::decay_t<decltype(value)>;
+          if constexpr (IsArrayView<V>::value) {
+            using Element = std::remove_const_t<
+                std::remove_pointer_t<decltype(value.data)>>;
+            const std::size_t bytes = value.count * sizeof(Element);
+            if (bytes != 0) {
+              std::memcpy(cursor, value.data, bytes);
+            }
+            value = V(reinterpret_cast<const Element *>(cursor), value.count);
+            cursor += alignUp(bytes);
+          }
+        },
+        param.value());
+  }
+}
+
+} // namespace orteaf::internal::kernel::core
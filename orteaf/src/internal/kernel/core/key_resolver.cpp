@@ -33,4 +33,9 @@ bool defaultVerify(const VariableKeyComponents & /*components*/,
   return true;
 }
 
+ResolveCache &threadResolveCache() noexcept {
+  thread_local ResolveCache cache;
+  return cache;
+}
+
 } // namespace orteaf::internal::kernel::key_resolver
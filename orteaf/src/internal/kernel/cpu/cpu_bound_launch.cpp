@@ -0,0 +1,37 @@
+#include "orteaf/internal/kernel/cpu/cpu_bound_launch.h"
+
+#include <memory>
+#include <utility>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/execution_context/cpu/context.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+namespace {
+
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+
+} // namespace
+
+::orteaf::internal::execution::cpu::resource::FenceToken
+enqueue(core::BoundLaunch &launch,
+        ::orteaf::internal::execution::cpu::resource::CpuCommandQueue &queue) {
+  if (!launch.valid()) {
+    throwError(OrteafErrc::InvalidState, "BoundLaunch is not bound");
+  }
+  if (launch.args()
+          .context()
+          .tryAs<::orteaf::internal::execution_context::cpu::Context>() ==
+      nullptr) {
+    throwError(OrteafErrc::InvalidParameter,
+               "enqueue requires a CPU execution context");
+  }
+  // The queue releases the snapshot on a submitting thread after it has run.
+  auto snapshot = launch.snapshotLaunch();
+  core::BoundLaunch *deferred = snapshot.get();
+  return queue.submit([deferred] { deferred->run(); }, std::move(snapshot));
+}
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,147 @@
+#include "orteaf/internal/kernel/cpu/cpu_copy.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/kernel/cpu/cpu_iteration_plan.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+namespace {
+
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+using ::orteaf::internal::execution::cpu::resource::CpuThreadPool;
+using Dim = CpuOperand::Dim;
+using Plan = CpuIterationPlan<2>;
+
+// Tile edge for permuted copies: a 32 x 32 tile of 8-byte elements is
+// 8 KiB per side, so source and destination tiles share L1.
+constexpr Dim kTile = 32;
+
+/// Copy where the two innermost planned dims are swapped between operands:
+/// the destination is contiguous along the last dim, the source along the
+/// one before it.
+template <typename T>
+void copyTiled(const T *src, T *dst, const Plan &plan, CpuThreadPool *pool) {
+  const std::size_t rank = plan.rank();
+  const auto dims = plan.dims();
+  const auto src_strides = plan.strides(0);
+  const auto dst_strides = plan.strides(1);
+  const Dim rows = dims[rank - 2];
+  const Dim cols = dims[rank - 1];
+  const Dim src_col_stride = src_strides[rank - 1];
+  const Dim dst_row_stride = dst_strides[rank - 2];
+
+  const Plan outer(dims.first(rank - 2),
+                   {src_strides.first(rank - 2), dst_strides.first(rank - 2)});
+  const Dim row_tiles = (rows + kTile - 1) / kTile;
+  const Dim tasks = outer.numel() * row_tiles;
+
+  auto run = [&](Dim first, Dim last) {
+    for (Dim task = first; task < last; ++task) {
+      const auto offsets = outer.offsetsOf(task / row_tiles);
+      const Dim row_begin = (task % row_tiles) * kTile;
+      const Dim row_end = std::min(rows, row_begin + kTile);
+      for (Dim col_begin = 0; col_begin < cols; col_begin += kTile) {
+        const Dim col_end = std::min(cols, col_begin + kTile);
+        for (Dim r = row_begin; r < row_end; ++r) {
+          const T *src_row = src + offsets[0] + r;
+          T *dst_row = dst + offsets[1] + r * dst_row_stride;
+          for (Dim c = col_begin; c < col_end; ++c) {
+            dst_row[c] = src_row[c * src_col_stride];
+          }
+        }
+      }
+    }
+  };
+
+  const Dim grain =
+      std::max<Dim>(1, kElementwiseGrain / (kTile * std::max<Dim>(cols, 1)));
+  if (pool == nullptr || pool->concurrency() <= 1 || tasks <= grain) {
+    run(0, tasks);
+    return;
+  }
+  pool->parallelFor(0, tasks, grain, run);
+}
+
+template <typename T>
+void copyTyped(const CpuOperand &src, const CpuOperand &dst, const Plan &plan,
+               CpuThreadPool *pool) {
+  const T *src_data = src.as<T>();
+  T *dst_data = dst.as<T>();
+
+  const std::size_t rank = plan.rank();
+  if (rank >= 2) {
+    const auto src_strides = plan.strides(0);
+    const auto dst_strides = plan.strides(1);
+    const bool permuted = dst_strides[rank - 1] == 1 &&
+                          src_strides[rank - 2] == 1 &&
+                          src_strides[rank - 1] != 1;
+    if (permuted && plan.dims()[rank - 2] >= kTile &&
+        plan.dims()[rank - 1] >= kTile) {
+      copyTiled(src_data, dst_data, plan, pool);
+      return;
+    }
+  }
+
+  plan.parallelForEachRun(
+      pool, kElementwiseGrain,
+      [&](const std::array<Dim, 2> &offsets, Dim count,
+          const std::array<Dim, 2> &inner) {
+        const T *from = src_data + offsets[0];
+        T *to = dst_data + offsets[1];
+        if (inner[0] == 1 && inner[1] == 1) {
+          std::memcpy(to, from, static_cast<std::size_t>(count) * sizeof(T));
+          return;
+        }
+        for (Dim i = 0; i < count; ++i) {
+          to[i * inner[1]] = from[i * inner[0]];
+        }
+      });
+}
+
+} // namespace
+
+void copyStrided(const CpuOperand &src, const CpuOperand &dst,
+                 CpuThreadPool *pool) {
+  if (src.dtype != dst.dtype) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU strided copy requires matching dtypes");
+  }
+  if (!sameShape(src.shape, dst.shape)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU strided copy requires matching shapes");
+  }
+
+  const Plan plan(asSpan(dst.shape),
+                  {asSpan(src.strides), asSpan(dst.strides)});
+  if (plan.empty()) {
+    return;
+  }
+
+  // Elements are moved as opaque words of the dtype's size.
+  switch (::orteaf::internal::sizeOf(dst.dtype)) {
+  case 1:
+    copyTyped<std::uint8_t>(src, dst, plan, pool);
+    break;
+  case 2:
+    copyTyped<std::uint16_t>(src, dst, plan, pool);
+    break;
+  case 4:
+    copyTyped<std::uint32_t>(src, dst, plan, pool);
+    break;
+  case 8:
+    copyTyped<std::uint64_t>(src, dst, plan, pool);
+    break;
+  default:
+    throwError(OrteafErrc::Unsupported,
+               "CPU strided copy does not support dtype size");
+  }
+}
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,159 @@
+#include "orteaf/internal/kernel/cpu/cpu_fused_elementwise.h"
+
+#include <algorithm>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/kernel/cpu/cpu_iteration_plan.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+namespace {
+
+using ::orteaf::internal::DType;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+using ::orteaf::internal::ops::Op;
+using Dim = CpuOperand::Dim;
+using ::orteaf::internal::execution::cpu::resource::CpuThreadPool;
+
+// Elements per tile: one scratch tile per node stays in L1 even for the
+// largest expression (16 nodes * 256 * 4 bytes = 16 KiB, on the stack).
+constexpr Dim kTileElements = 256;
+
+// Operand slots passed to forEachInnerRun: the inputs, then the output.
+constexpr std::size_t kSlots = kMaxFusedInputs + 1;
+constexpr std::size_t kOutputSlot = kMaxFusedInputs;
+
+template <typename T, typename AddFn, typename ReluFn, typename Alpha>
+void runTyped(std::span<const FusedNode> nodes,
+              std::span<const CpuOperand> inputs, const CpuOperand &output,
+              const std::array<CpuOperand::Dims, kSlots> &strides,
+              CpuThreadPool *pool, AddFn add, ReluFn relu,
+              Alpha (*to_alpha)(float)) {
+  std::array<std::span<const Dim>, kSlots> stride_spans{};
+  for (std::size_t k = 0; k < kSlots; ++k) {
+    stride_spans[k] = asSpan(strides[k]);
+  }
+  std::array<const T *, kMaxFusedInputs> input_data{};
+  for (std::size_t k = 0; k < inputs.size(); ++k) {
+    input_data[k] = inputs[k].as<T>();
+  }
+  T *out_data = output.as<T>();
+
+  const CpuIterationPlan<kSlots> plan(asSpan(output.shape), stride_spans);
+  plan.parallelForEachRun(
+      pool, kElementwiseGrain,
+      [&](const std::array<Dim, kSlots> &offsets, Dim count,
+          const std::array<Dim, kSlots> &inner) {
+        std::array<T, kMaxFusedNodes * kTileElements> scratch;
+        for (Dim begin = 0; begin < count; begin += kTileElements) {
+          const Dim len = std::min(kTileElements, count - begin);
+          const auto resolve = [&](FusedValue value, const T *&data,
+                                   Dim &stride) {
+            if (value.source == FusedValue::Source::Input) {
+              data = input_data[value.index] + offsets[value.index] +
+                     begin * inner[value.index];
+              stride = inner[value.index];
+            } else {
+              data = scratch.data() + value.index * kTileElements;
+              stride = 1;
+            }
+          };
+          for (std::size_t i = 0; i < nodes.size(); ++i) {
+            const FusedNode &node = nodes[i];
+            const bool root = i + 1 == nodes.size();
+            T *dst = root ? out_data + offsets[kOutputSlot] +
+                                begin * inner[kOutputSlot]
+                          : scratch.data() + static_cast<Dim>(i) *
+                                                 kTileElements;
+            const Dim dst_stride = root ? inner[kOutputSlot] : 1;
+            const T *a = nullptr;
+            Dim a_stride = 0;
+            resolve(node.args[0], a, a_stride);
+            if (node.op == Op::Add) {
+              const T *b = nullptr;
+              Dim b_stride = 0;
+              resolve(node.args[1], b, b_stride);
+              add(a, a_stride, b, b_stride, dst, dst_stride, len,
+                  to_alpha(node.alpha));
+            } else {
+              relu(a, a_stride, dst, dst_stride, len);
+            }
+          }
+        }
+      });
+}
+
+float f32Alpha(float alpha) { return alpha; }
+} // namespace
+
+void runFusedElementwise(std::span<const FusedNode> nodes,
+                         std::span<const CpuOperand> inputs,
+                         const CpuOperand &output,
+                         const CpuVectorOps &vector_ops,
+                         CpuThreadPool *pool) {
+  if (!isValidFusedExpression(nodes)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "Invalid fused elementwise expression");
+  }
+  if (inputs.size() < fusedInputCount(nodes) ||
+      inputs.size() > kMaxFusedInputs) {
+    throwError(OrteafErrc::InvalidParameter,
+               "Fused elementwise kernel input count does not match "
+               "expression");
+  }
+
+  CpuOperand::Dims shape{};
+  for (const auto &input : inputs) {
+    if (input.dtype != output.dtype) {
+      throwError(OrteafErrc::InvalidParameter,
+                 "Fused elementwise kernel requires matching operand dtypes");
+    }
+    shape = broadcastShape(asSpan(shape), asSpan(input.shape));
+  }
+  if (!sameShape(shape, output.shape)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "Fused elementwise output shape does not match broadcast "
+               "shape");
+  }
+
+  // Unused input slots walk the iteration space with stride 0.
+  std::array<CpuOperand::Dims, kSlots> strides{};
+  for (std::size_t k = 0; k < kMaxFusedInputs; ++k) {
+    if (k < inputs.size()) {
+      strides[k] = broadcastStrides(inputs[k], asSpan(output.shape));
+    } else {
+      strides[k].resize(output.rank());
+      std::fill(strides[k].begin(), strides[k].end(), Dim{0});
+    }
+  }
+  strides[kOutputSlot] = output.strides;
+
+  switch (output.dtype) {
+  case DType::F32:
+    runTyped<float>(nodes, inputs, output, strides, pool, vector_ops.add_f32,
+                    vector_ops.relu_f32, f32Alpha);
+    break;
+  case DType::F16:
+    runTyped<std::uint16_t>(nodes, inputs, output, strides, pool,
+                            vector_ops.add_f16, vector_ops.relu_f16,
+                            f32Alpha);
+    break;
+  case DType::I32:
+    // Reject a non-integral alpha before any output is written.
+    for (const auto &node : nodes) {
+      if (node.op == Op::Add) {
+        (void)i32AddAlpha(node.alpha);
+      }
+    }
+    runTyped<std::int32_t>(nodes, inputs, output, strides, pool,
+                           vector_ops.add_i32, vector_ops.relu_i32,
+                           i32AddAlpha);
+    break;
+  default:
+    throwError(OrteafErrc::Unsupported,
+               "Fused elementwise kernel does not support dtype");
+  }
+}
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,369 @@
+#include "orteaf/internal/kernel/cpu/cpu_gemm.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/dtype/float16.h"
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+namespace {
+
+using Index = CpuGemmMicroKernel::Index;
+using ::orteaf::internal::DType;
+using ::orteaf::internal::execution::cpu::resource::CpuThreadPool;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+
+constexpr Index kScalarMr = 4;
+constexpr Index kScalarNr = 4;
+
+void scalarMicroKernel(Index kc, const float *a_panel, const float *b_panel,
+                       float *c, Index ldc) {
+  float acc[kScalarMr][kScalarNr] = {};
+  for (Index p = 0; p < kc; ++p) {
+    for (Index r = 0; r < kScalarMr; ++r) {
+      const float a = a_panel[r];
+      for (Index col = 0; col < kScalarNr; ++col) {
+        acc[r][col] += a * b_panel[col];
+      }
+    }
+    a_panel += kScalarMr;
+    b_panel += kScalarNr;
+  }
+  for (Index r = 0; r < kScalarMr; ++r) {
+    for (Index col = 0; col < kScalarNr; ++col) {
+      c[r * ldc + col] += acc[r][col];
+    }
+  }
+}
+
+constexpr CpuGemmMicroKernel kScalarKernel{
+    CpuIsa::Scalar, kScalarMr, kScalarNr, /*mc=*/64, /*kc=*/256, /*nc=*/256,
+    scalarMicroKernel,
+};
+
+// Below this many multiply-adds a product is not worth spreading over threads.
+constexpr Index kParallelMinWork = Index{1} << 21;
+
+// Packed B is kept for this many floats of batch entries at a time (64 MiB).
+constexpr Index kPackedBLimit = Index{1} << 24;
+
+inline Index ceilDiv(Index value, Index divisor) {
+  return (value + divisor - 1) / divisor;
+}
+
+inline Index roundUp(Index value, Index multiple) {
+  return ceilDiv(value, multiple) * multiple;
+}
+
+inline float loadElement(const float *ptr) { return *ptr; }
+
+inline float loadElement(const std::uint16_t *ptr) {
+  return ::orteaf::internal::detail::halfBitsToFloat32(*ptr);
+}
+
+inline void axpy(const CpuVectorOps &ops, const float *x, Index x_stride,
+                 float *acc, Index count) {
+  ops.axpy_f32(1.0f, x, x_stride, acc, count);
+}
+
+inline void axpy(const CpuVectorOps &ops, const std::uint16_t *x,
+                 Index x_stride, float *acc, Index count) {
+  ops.axpy_f16(1.0f, x, x_stride, acc, count);
+}
+
+inline void storeRow(const CpuVectorOps &, const float *acc, float *out,
+                     Index out_stride, Index count) {
+  if (out_stride == 1) {
+    std::copy(acc, acc + count, out);
+    return;
+  }
+  for (Index j = 0; j < count; ++j) {
+    out[j * out_stride] = acc[j];
+  }
+}
+
+inline void storeRow(const CpuVectorOps &ops, const float *acc,
+                     std::uint16_t *out, Index out_stride, Index count) {
+  ops.store_f16(acc, out, out_stride, count);
+}
+
+/// Per-thread A packing buffer and the F32 accumulator for one C block.
+struct Workspace {
+  std::vector<float> a_pack;
+  std::vector<float> c_block;
+
+  static Workspace &local() {
+    thread_local Workspace workspace;
+    return workspace;
+  }
+
+  void reserve(Index a_size, Index c_size) {
+    a_pack.resize(static_cast<std::size_t>(a_size));
+    c_block.resize(static_cast<std::size_t>(c_size));
+  }
+};
+
+/**
+ * Pack rows [0, rows) x cols [0, depth) of A into mr-row panels laid out as
+ * [panel][k][mr], zero-padding the last panel.
+ */
+template <typename T>
+void packA(const T *a, Index row_stride, Index col_stride, Index rows,
+           Index depth, Index mr, float *out) {
+  for (Index i0 = 0; i0 < rows; i0 += mr) {
+    const Index valid = std::min(mr, rows - i0);
+    for (Index p = 0; p < depth; ++p) {
+      const T *src = a + i0 * row_stride + p * col_stride;
+      Index r = 0;
+      for (; r < valid; ++r) {
+        out[r] = loadElement(src + r * row_stride);
+      }
+      for (; r < mr; ++r) {
+        out[r] = 0.0f;
+      }
+      out += mr;
+    }
+  }
+}
+
+/**
+ * Pack rows [0, depth) x cols [0, cols) of B into nr-column panels laid out as
+ * [panel][k][nr], zero-padding the last panel.
+ */
+template <typename T>
+void packB(const T *b, Index row_stride, Index col_stride, Index depth,
+           Index cols, Index nr, float *out) {
+  for (Index j0 = 0; j0 < cols; j0 += nr) {
+    const Index valid = std::min(nr, cols - j0);
+    for (Index p = 0; p < depth; ++p) {
+      const T *src = b + p * row_stride + j0 * col_stride;
+      Index col = 0;
+      if constexpr (std::is_same_v<T, float>) {
+        if (col_stride == 1) {
+          std::copy(src, src + valid, out);
+          col = valid;
+        }
+      }
+      for (; col < valid; ++col) {
+        out[col] = loadElement(src + col * col_stride);
+      }
+      for (; col < nr; ++col) {
+        out[col] = 0.0f;
+      }
+      out += nr;
+    }
+  }
+}
+
+/// Blocking sizes for one gemm() call, clamped to the problem.
+struct Blocking {
+  Index mc;
+  Index kc;
+  Index nc;
+  Index m_blocks;
+  Index n_blocks;
+  Index k_steps;
+  // Packed B layout: [batch][N block][K step][nr panel][k][nr]. K step p0 of
+  // a block starts p0 * (padded block width) floats into the block.
+  Index b_block_stride;
+  Index b_batch_stride;
+};
+
+Blocking makeBlocking(const CpuGemmMicroKernel &kernel,
+                      const CpuGemmShape &shape) {
+  Blocking blocking{};
+  blocking.mc = std::min(kernel.mc, roundUp(shape.m, kernel.mr));
+  blocking.nc = std::min(kernel.nc, roundUp(shape.n, kernel.nr));
+  blocking.kc = std::max<Index>(1, std::min(kernel.kc, shape.k));
+  blocking.m_blocks = ceilDiv(shape.m, blocking.mc);
+  blocking.n_blocks = ceilDiv(shape.n, blocking.nc);
+  blocking.k_steps = ceilDiv(shape.k, blocking.kc);
+  blocking.b_block_stride = shape.k * roundUp(blocking.nc, kernel.nr);
+  blocking.b_batch_stride = blocking.n_blocks * blocking.b_block_stride;
+  return blocking;
+}
+
+/**
+ * Pack the kc x nc panel of B for one (N block, K step) of one batch entry
+ * into its slot of @p packed_batch.
+ */
+template <typename T>
+void packBPanel(const CpuGemmMicroKernel &kernel, const CpuGemmShape &shape,
+                const Blocking &blocking, const CpuGemmBatch &batch,
+                Index n_block, Index k_step, float *packed_batch) {
+  const Index j0 = n_block * blocking.nc;
+  const Index p0 = k_step * blocking.kc;
+  const Index nb = std::min(blocking.nc, shape.n - j0);
+  const Index kb = std::min(blocking.kc, shape.k - p0);
+  const T *b = static_cast<const T *>(batch.b.data);
+  packB(b + p0 * batch.b.row_stride + j0 * batch.b.col_stride,
+        batch.b.row_stride, batch.b.col_stride, kb, nb, kernel.nr,
+        packed_batch + n_block * blocking.b_block_stride +
+            p0 * roundUp(nb, kernel.nr));
+}
+
+/**
+ * Compute one mc x nc block of C for one batch entry:
+ * pack A (mc x kc) per K step, sweep the micro-kernel over the block against
+ * the already packed B panels, then add bias and narrow into C.
+ */
+template <typename T>
+void gemmBlock(const CpuGemmMicroKernel &kernel, const CpuVectorOps &ops,
+               const CpuGemmShape &shape, const Blocking &blocking,
+               const CpuGemmBatch &batch, const float *packed_b_block,
+               Index i0, Index j0) {
+  const Index mb = std::min(blocking.mc, shape.m - i0);
+  const Index nb = std::min(blocking.nc, shape.n - j0);
+  const Index mb_padded = roundUp(mb, kernel.mr);
+  const Index nb_padded = roundUp(nb, kernel.nr);
+  const Index ldc = nb_padded;
+
+  auto &workspace = Workspace::local();
+  workspace.reserve(mb_padded * blocking.kc, mb_padded * ldc);
+  float *c_block = workspace.c_block.data();
+  std::fill(c_block, c_block + mb_padded * ldc, 0.0f);
+
+  const T *a = static_cast<const T *>(batch.a.data);
+  for (Index p0 = 0; p0 < shape.k; p0 += blocking.kc) {
+    const Index kb = std::min(blocking.kc, shape.k - p0);
+    const float *b_step = packed_b_block + p0 * nb_padded;
+    packA(a + i0 * batch.a.row_stride + p0 * batch.a.col_stride,
+          batch.a.row_stride, batch.a.col_stride, mb, kb, kernel.mr,
+          workspace.a_pack.data());
+    for (Index jr = 0; jr < nb; jr += kernel.nr) {
+      const float *b_panel = b_step + jr * kb;
+      for (Index ir = 0; ir < mb; ir += kernel.mr) {
+        const float *a_panel = workspace.a_pack.data() + ir * kb;
+        kernel.run(kb, a_panel, b_panel, c_block + ir * ldc + jr, ldc);
+      }
+    }
+  }
+
+  const T *bias = static_cast<const T *>(batch.bias.data);
+  T *c = static_cast<T *>(batch.c.data);
+  for (Index i = 0; i < mb; ++i) {
+    float *row = c_block + i * ldc;
+    if (shape.has_bias) {
+      axpy(ops,
+           bias + (i0 + i) * batch.bias.row_stride +
+               j0 * batch.bias.col_stride,
+           batch.bias.col_stride, row, nb);
+    }
+    storeRow(ops, row,
+             c + (i0 + i) * batch.c.row_stride + j0 * batch.c.col_stride,
+             batch.c.col_stride, nb);
+  }
+}
+
+template <typename T>
+void gemmTyped(const CpuGemmMicroKernel &kernel, const CpuVectorOps &ops,
+               const CpuGemmShape &shape,
+               std::span<const CpuGemmBatch> batches, CpuThreadPool *pool) {
+  const Blocking blocking = makeBlocking(kernel, shape);
+  const Index panels_per_batch = blocking.n_blocks * blocking.k_steps;
+  const Index blocks_per_batch = blocking.m_blocks * blocking.n_blocks;
+  const Index work =
+      shape.m * shape.n * std::max<Index>(shape.k, 1) *
+      static_cast<Index>(batches.size());
+  const bool parallel = pool != nullptr && work >= kParallelMinWork;
+  auto split = [&](Index count, auto &&body) {
+    if (parallel) {
+      pool->parallelFor(0, count, 1, body);
+    } else {
+      body(0, count);
+    }
+  };
+
+  // B is packed once per call, not once per M block: each group of batch
+  // entries first packs all of its (N block, K step) panels, then every
+  // M x N block reads them. The buffer is per call because the calling thread
+  // may run other pool chunks, including other gemm() calls, while it waits.
+  const Index group_size = std::clamp<Index>(
+      kPackedBLimit / std::max<Index>(blocking.b_batch_stride, 1), 1,
+      static_cast<Index>(batches.size()));
+  std::vector<float> packed_b(
+      static_cast<std::size_t>(group_size * blocking.b_batch_stride));
+  for (Index first_batch = 0; first_batch < static_cast<Index>(batches.size());
+       first_batch += group_size) {
+    const Index group = std::min(
+        group_size, static_cast<Index>(batches.size()) - first_batch);
+    const auto batch_at = [&](Index index) -> const CpuGemmBatch & {
+      return batches[static_cast<std::size_t>(first_batch + index)];
+    };
+    split(group * panels_per_batch, [&](Index first, Index last) {
+      for (Index task = first; task < last; ++task) {
+        const Index batch = task / panels_per_batch;
+        const Index panel = task % panels_per_batch;
+        packBPanel<T>(kernel, shape, blocking, batch_at(batch),
+                      panel / blocking.k_steps, panel % blocking.k_steps,
+                      packed_b.data() + batch * blocking.b_batch_stride);
+      }
+    });
+    split(group * blocks_per_batch, [&](Index first, Index last) {
+      for (Index task = first; task < last; ++task) {
+        const Index batch = task / blocks_per_batch;
+        const Index block = task % blocks_per_batch;
+        const Index n_block = block % blocking.n_blocks;
+        const Index i0 = (block / blocking.n_blocks) * blocking.mc;
+        const Index j0 = n_block * blocking.nc;
+        gemmBlock<T>(kernel, ops, shape, blocking, batch_at(batch),
+                     packed_b.data() + batch * blocking.b_batch_stride +
+                         n_block * blocking.b_block_stride,
+                     i0, j0);
+      }
+    });
+  }
+}
+
+} // namespace
+
+namespace detail {
+
+const CpuGemmMicroKernel &scalarGemmMicroKernel() noexcept {
+  return kScalarKernel;
+}
+
+} // namespace detail
+
+const CpuGemmMicroKernel &gemmMicroKernel(CpuIsa isa) noexcept {
+  switch (effectiveIsa(isa)) {
+  case CpuIsa::Avx512:
+    return *detail::avx512GemmMicroKernel();
+  case CpuIsa::Avx2:
+    return *detail::avx2GemmMicroKernel();
+  case CpuIsa::Neon:
+    return *detail::neonGemmMicroKernel();
+  case CpuIsa::Scalar:
+    break;
+  }
+  return kScalarKernel;
+}
+
+void gemm(CpuIsa isa, const CpuGemmShape &shape,
+          std::span<const CpuGemmBatch> batches, CpuThreadPool *pool) {
+  if (shape.dtype != DType::F32 && shape.dtype != DType::F16) {
+    throwError(OrteafErrc::Unsupported, "CPU gemm does not support dtype");
+  }
+  if (shape.m < 0 || shape.n < 0 || shape.k < 0) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU gemm dimensions must be non-negative");
+  }
+  if (shape.m == 0 || shape.n == 0 || batches.empty()) {
+    return;
+  }
+  const auto &kernel = gemmMicroKernel(isa);
+  const auto &ops = vectorOps(isa);
+  if (shape.dtype == DType::F32) {
+    gemmTyped<float>(kernel, ops, shape, batches, pool);
+  } else {
+    gemmTyped<std::uint16_t>(kernel, ops, shape, batches, pool);
+  }
+}
+
+} // namespace orteaf::internal::kernel::cpu
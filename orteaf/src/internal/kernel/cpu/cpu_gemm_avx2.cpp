@@ -0,0 +1,75 @@
+#include "orteaf/internal/kernel/cpu/cpu_gemm.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define ORTEAF_CPU_GEMM_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace orteaf::internal::kernel::cpu {
+
+#if defined(ORTEAF_CPU_GEMM_AVX2)
+
+namespace {
+
+using Index = CpuGemmMicroKernel::Index;
+
+constexpr Index kMr = 6;
+constexpr Index kNr = 16;
+
+// 6x16 tile: 12 ymm accumulators + 2 B vectors + 1 broadcast of A.
+__attribute__((target("avx2,fma"))) void
+microKernel(Index kc, const float *a_panel, const float *b_panel, float *c,
+            Index ldc) {
+  __m256 acc[kMr][2];
+#pragma GCC unroll 6
+  for (Index r = 0; r < kMr; ++r) {
+    acc[r][0] = _mm256_setzero_ps();
+    acc[r][1] = _mm256_setzero_ps();
+  }
+  for (Index p = 0; p < kc; ++p) {
+    const __m256 b0 = _mm256_loadu_ps(b_panel);
+    const __m256 b1 = _mm256_loadu_ps(b_panel + 8);
+#pragma GCC unroll 6
+    for (Index r = 0; r < kMr; ++r) {
+      const __m256 a = _mm256_broadcast_ss(a_panel + r);
+      acc[r][0] = _mm256_fmadd_ps(a, b0, acc[r][0]);
+      acc[r][1] = _mm256_fmadd_ps(a, b1, acc[r][1]);
+    }
+    a_panel += kMr;
+    b_panel += kNr;
+  }
+#pragma GCC unroll 6
+  for (Index r = 0; r < kMr; ++r) {
+    float *row = c + r * ldc;
+    _mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), acc[r][0]));
+    _mm256_storeu_ps(row + 8,
+                     _mm256_add_ps(_mm256_loadu_ps(row + 8), acc[r][1]));
+  }
+}
+
+constexpr CpuGemmMicroKernel kAvx2Kernel{
+    CpuIsa::Avx2, kMr, kNr, /*mc=*/120, /*kc=*/256, /*nc=*/512, microKernel,
+};
+
+} // namespace
+
+namespace detail {
+
+const CpuGemmMicroKernel *avx2GemmMicroKernel() noexcept {
+  return &kAvx2Kernel;
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+const CpuGemmMicroKernel *avx2GemmMicroKernel() noexcept { return nullptr; }
+
+} // namespace detail
+
+#endif // ORTEAF_CPU_GEMM_AVX2
+
+} // namespace orteaf::internal::kernel::cpu
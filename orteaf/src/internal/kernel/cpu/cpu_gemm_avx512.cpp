@@ -0,0 +1,75 @@
+#include "orteaf/internal/kernel/cpu/cpu_gemm.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define ORTEAF_CPU_GEMM_AVX512 1
+#include <immintrin.h>
+#endif
+
+namespace orteaf::internal::kernel::cpu {
+
+#if defined(ORTEAF_CPU_GEMM_AVX512)
+
+namespace {
+
+using Index = CpuGemmMicroKernel::Index;
+
+constexpr Index kMr = 8;
+constexpr Index kNr = 32;
+
+// 8x32 tile: 16 zmm accumulators + 2 B vectors + 1 broadcast of A.
+__attribute__((target("avx512f,avx2,fma"))) void
+microKernel(Index kc, const float *a_panel, const float *b_panel, float *c,
+            Index ldc) {
+  __m512 acc[kMr][2];
+#pragma GCC unroll 8
+  for (Index r = 0; r < kMr; ++r) {
+    acc[r][0] = _mm512_setzero_ps();
+    acc[r][1] = _mm512_setzero_ps();
+  }
+  for (Index p = 0; p < kc; ++p) {
+    const __m512 b0 = _mm512_loadu_ps(b_panel);
+    const __m512 b1 = _mm512_loadu_ps(b_panel + 16);
+#pragma GCC unroll 8
+    for (Index r = 0; r < kMr; ++r) {
+      const __m512 a = _mm512_set1_ps(a_panel[r]);
+      acc[r][0] = _mm512_fmadd_ps(a, b0, acc[r][0]);
+      acc[r][1] = _mm512_fmadd_ps(a, b1, acc[r][1]);
+    }
+    a_panel += kMr;
+    b_panel += kNr;
+  }
+#pragma GCC unroll 8
+  for (Index r = 0; r < kMr; ++r) {
+    float *row = c + r * ldc;
+    _mm512_storeu_ps(row, _mm512_add_ps(_mm512_loadu_ps(row), acc[r][0]));
+    _mm512_storeu_ps(row + 16,
+                     _mm512_add_ps(_mm512_loadu_ps(row + 16), acc[r][1]));
+  }
+}
+
+constexpr CpuGemmMicroKernel kAvx512Kernel{
+    CpuIsa::Avx512, kMr, kNr, /*mc=*/128, /*kc=*/384, /*nc=*/1024, microKernel,
+};
+
+} // namespace
+
+namespace detail {
+
+const CpuGemmMicroKernel *avx512GemmMicroKernel() noexcept {
+  return &kAvx512Kernel;
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+const CpuGemmMicroKernel *avx512GemmMicroKernel() noexcept { return nullptr; }
+
+} // namespace detail
+
+#endif // ORTEAF_CPU_GEMM_AVX512
+
+} // namespace orteaf::internal::kernel::cpu
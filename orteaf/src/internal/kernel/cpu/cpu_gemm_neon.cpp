@@ -0,0 +1,82 @@
+#include "orteaf/internal/kernel/cpu/cpu_gemm.h"
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define ORTEAF_CPU_GEMM_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace orteaf::internal::kernel::cpu {
+
+#if defined(ORTEAF_CPU_GEMM_NEON)
+
+namespace {
+
+using Index = CpuGemmMicroKernel::Index;
+
+constexpr Index kMr = 8;
+constexpr Index kNr = 8;
+
+// 8x8 tile: 16 q-register accumulators + 2 B vectors + 2 A vectors.
+void microKernel(Index kc, const float *a_panel, const float *b_panel,
+                 float *c, Index ldc) {
+  float32x4_t acc[kMr][2];
+  for (Index r = 0; r < kMr; ++r) {
+    acc[r][0] = vdupq_n_f32(0.0f);
+    acc[r][1] = vdupq_n_f32(0.0f);
+  }
+  for (Index p = 0; p < kc; ++p) {
+    const float32x4_t b0 = vld1q_f32(b_panel);
+    const float32x4_t b1 = vld1q_f32(b_panel + 4);
+    const float32x4_t a_lo = vld1q_f32(a_panel);
+    const float32x4_t a_hi = vld1q_f32(a_panel + 4);
+    acc[0][0] = vfmaq_laneq_f32(acc[0][0], b0, a_lo, 0);
+    acc[0][1] = vfmaq_laneq_f32(acc[0][1], b1, a_lo, 0);
+    acc[1][0] = vfmaq_laneq_f32(acc[1][0], b0, a_lo, 1);
+    acc[1][1] = vfmaq_laneq_f32(acc[1][1], b1, a_lo, 1);
+    acc[2][0] = vfmaq_laneq_f32(acc[2][0], b0, a_lo, 2);
+    acc[2][1] = vfmaq_laneq_f32(acc[2][1], b1, a_lo, 2);
+    acc[3][0] = vfmaq_laneq_f32(acc[3][0], b0, a_lo, 3);
+    acc[3][1] = vfmaq_laneq_f32(acc[3][1], b1, a_lo, 3);
+    acc[4][0] = vfmaq_laneq_f32(acc[4][0], b0, a_hi, 0);
+    acc[4][1] = vfmaq_laneq_f32(acc[4][1], b1, a_hi, 0);
+    acc[5][0] = vfmaq_laneq_f32(acc[5][0], b0, a_hi, 1);
+    acc[5][1] = vfmaq_laneq_f32(acc[5][1], b1, a_hi, 1);
+    acc[6][0] = vfmaq_laneq_f32(acc[6][0], b0, a_hi, 2);
+    acc[6][1] = vfmaq_laneq_f32(acc[6][1], b1, a_hi, 2);
+    acc[7][0] = vfmaq_laneq_f32(acc[7][0], b0, a_hi, 3);
+    acc[7][1] = vfmaq_laneq_f32(acc[7][1], b1, a_hi, 3);
+    a_panel += kMr;
+    b_panel += kNr;
+  }
+  for (Index r = 0; r < kMr; ++r) {
+    float *row = c + r * ldc;
+    vst1q_f32(row, vaddq_f32(vld1q_f32(row), acc[r][0]));
+    vst1q_f32(row + 4, vaddq_f32(vld1q_f32(row + 4), acc[r][1]));
+  }
+}
+
+constexpr CpuGemmMicroKernel kNeonKernel{
+    CpuIsa::Neon, kMr, kNr, /*mc=*/128, /*kc=*/256, /*nc=*/512, microKernel,
+};
+
+} // namespace
+
+namespace detail {
+
+const CpuGemmMicroKernel *neonGemmMicroKernel() noexcept {
+  return &kNeonKernel;
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+const CpuGemmMicroKernel *neonGemmMicroKernel() noexcept { return nullptr; }
+
+} // namespace detail
+
+#endif // ORTEAF_CPU_GEMM_NEON
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,87 @@
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+namespace arch = ::orteaf::internal::architecture;
+
+CpuIsa isaOf(arch::Architecture architecture) noexcept {
+  switch (architecture) {
+  case arch::Architecture::CpuZen4:
+  case arch::Architecture::CpuSkylake:
+    return CpuIsa::Avx512;
+  case arch::Architecture::CpuIntelCometLake:
+    return CpuIsa::Avx2;
+  case arch::Architecture::CpuGeneric:
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    return CpuIsa::Neon;
+#else
+    return CpuIsa::Scalar;
+#endif
+  default:
+    return CpuIsa::Scalar;
+  }
+}
+
+namespace {
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+bool detectAvx2() noexcept {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+         __builtin_cpu_supports("f16c");
+}
+
+bool detectAvx512() noexcept {
+  __builtin_cpu_init();
+  return detectAvx2() && __builtin_cpu_supports("avx512f") &&
+         __builtin_cpu_supports("avx512bw") &&
+         __builtin_cpu_supports("avx512vl");
+}
+#else
+bool detectAvx2() noexcept { return false; }
+bool detectAvx512() noexcept { return false; }
+#endif
+
+} // namespace
+
+bool isSupported(CpuIsa isa) noexcept {
+  switch (isa) {
+  case CpuIsa::Scalar:
+    return true;
+  case CpuIsa::Neon:
+    return detail::neonVectorOps() != nullptr;
+  case CpuIsa::Avx2: {
+    static const bool supported =
+        detail::avx2VectorOps() != nullptr && detectAvx2();
+    return supported;
+  }
+  case CpuIsa::Avx512: {
+    static const bool supported =
+        detail::avx512VectorOps() != nullptr && detectAvx512();
+    return supported;
+  }
+  }
+  return false;
+}
+
+CpuIsa effectiveIsa(CpuIsa isa) noexcept {
+  switch (isa) {
+  case CpuIsa::Avx512:
+    if (isSupported(CpuIsa::Avx512)) {
+      return CpuIsa::Avx512;
+    }
+    [[fallthrough]];
+  case CpuIsa::Avx2:
+    return isSupported(CpuIsa::Avx2) ? CpuIsa::Avx2 : CpuIsa::Scalar;
+  case CpuIsa::Neon:
+    return isSupported(CpuIsa::Neon) ? CpuIsa::Neon : CpuIsa::Scalar;
+  case CpuIsa::Scalar:
+    return CpuIsa::Scalar;
+  }
+  return CpuIsa::Scalar;
+}
+
+} // namespace orteaf::internal::kernel::cpu
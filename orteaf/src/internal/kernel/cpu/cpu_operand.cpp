@@ -0,0 +1,135 @@
+#include "orteaf/internal/kernel/cpu/cpu_operand.h"
+
+#include <algorithm>
+#include <variant>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+namespace {
+
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+
+} // namespace
+
+CpuOperand
+makeCpuOperand(const ::orteaf::internal::storage::StorageLease &lease,
+               ::orteaf::internal::base::ArrayView<const std::int64_t> shape,
+               ::orteaf::internal::base::ArrayView<const std::int64_t> strides,
+               std::int64_t offset, Access access) {
+  // Heap and file-mapped CPU storages expose the same host pointer API.
+  const auto storage_of = [&](const auto *typed) {
+    return typed != nullptr && *typed ? typed->operator->() : nullptr;
+  };
+  const auto *heap_storage = storage_of(
+      lease.tryAs<::orteaf::internal::storage::CpuStorageLease>());
+  const auto *mapped_storage = storage_of(
+      lease.tryAs<::orteaf::internal::storage::CpuMappedStorageLease>());
+  if (heap_storage == nullptr && mapped_storage == nullptr) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU kernel operand must be bound to a CPU storage");
+  }
+  if (mapped_storage != nullptr && access != Access::Read) {
+    // The mapping is PROT_READ; a write would fault inside the kernel.
+    throwError(OrteafErrc::InvalidParameter,
+               "file-mapped storage is read-only and cannot be a kernel "
+               "output");
+  }
+  if (!strides.empty() && strides.size() != shape.size()) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU kernel operand strides rank does not match shape");
+  }
+
+  CpuOperand operand{};
+  operand.dtype =
+      heap_storage ? heap_storage->dtype() : mapped_storage->dtype();
+  operand.shape.assign(shape.data, shape.data + shape.size());
+  if (strides.empty()) {
+    operand.strides.resize(shape.size());
+    CpuOperand::Dim expected = 1;
+    for (std::size_t i = shape.size(); i > 0; --i) {
+      operand.strides[i - 1] = expected;
+      expected *= shape[i - 1];
+    }
+  } else {
+    operand.strides.assign(strides.data, strides.data + strides.size());
+  }
+
+  // Mapped storage only reaches here for read-only operands, so dropping
+  // const does not expose a writable pointer to the kernel's writes.
+  auto *base = heap_storage
+                   ? static_cast<std::byte *>(heap_storage->data())
+                   : const_cast<std::byte *>(static_cast<const std::byte *>(
+                         mapped_storage->data()));
+  if (base == nullptr && operand.numel() != 0) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU kernel operand storage has no buffer");
+  }
+  operand.data =
+      base == nullptr
+          ? nullptr
+          : base + offset * static_cast<std::int64_t>(
+                                ::orteaf::internal::sizeOf(operand.dtype));
+  return operand;
+}
+
+CpuOperand::Dims broadcastShape(std::span<const CpuOperand::Dim> lhs,
+                                std::span<const CpuOperand::Dim> rhs) {
+  const std::size_t rank = std::max(lhs.size(), rhs.size());
+  CpuOperand::Dims result;
+  result.resize(rank);
+  for (std::size_t i = 0; i < rank; ++i) {
+    const CpuOperand::Dim l =
+        i < lhs.size() ? lhs[lhs.size() - 1 - i] : CpuOperand::Dim{1};
+    const CpuOperand::Dim r =
+        i < rhs.size() ? rhs[rhs.size() - 1 - i] : CpuOperand::Dim{1};
+    if (l != r && l != 1 && r != 1) {
+      throwError(OrteafErrc::InvalidParameter,
+                 "CPU kernel operand shapes are not broadcastable");
+    }
+    result[rank - 1 - i] = l == 1 ? r : l;
+  }
+  return result;
+}
+
+CpuOperand::Dims broadcastStrides(const CpuOperand &operand,
+                                  std::span<const CpuOperand::Dim> target) {
+  const std::size_t rank = operand.rank();
+  if (rank > target.size()) {
+    throwError(OrteafErrc::InvalidParameter,
+               "CPU kernel operand rank exceeds broadcast rank");
+  }
+  CpuOperand::Dims strides;
+  strides.resize(target.size());
+  const std::size_t lead = target.size() - rank;
+  for (std::size_t i = 0; i < target.size(); ++i) {
+    if (i < lead) {
+      strides[i] = 0;
+      continue;
+    }
+    const CpuOperand::Dim dim = operand.shape[i - lead];
+    if (dim == target[i]) {
+      strides[i] = dim == 1 ? 0 : operand.strides[i - lead];
+    } else if (dim == 1) {
+      strides[i] = 0;
+    } else {
+      throwError(OrteafErrc::InvalidParameter,
+                 "CPU kernel operand cannot broadcast to output shape");
+    }
+  }
+  return strides;
+}
+
+::orteaf::internal::architecture::Architecture
+kernelArchitecture(const core::KernelEntry::KernelBaseLease &lease) {
+  const auto *cpu_lease =
+      std::get_if<core::KernelEntry::CpuKernelBaseLease>(&lease);
+  if (cpu_lease == nullptr || !(*cpu_lease)) {
+    throwError(OrteafErrc::InvalidState, "CPU kernel base lease is invalid");
+  }
+  return (*cpu_lease)->architecture();
+}
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,258 @@
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define ORTEAF_CPU_VECTOR_OPS_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace orteaf::internal::kernel::cpu {
+
+#if defined(ORTEAF_CPU_VECTOR_OPS_AVX2)
+
+namespace {
+
+using Index = CpuVectorOps::Index;
+
+// Functions are compiled for AVX2 individually so the rest of the library
+// keeps the baseline ISA; callers only reach them after isSupported(Avx2).
+#define ORTEAF_AVX2_TARGET __attribute__((target("avx2,fma,f16c")))
+
+constexpr Index kF32Lanes = 8;
+
+inline bool vectorizable(Index a_stride, Index b_stride, Index out_stride) {
+  return out_stride == 1 && (a_stride == 0 || a_stride == 1) &&
+         (b_stride == 0 || b_stride == 1);
+}
+
+ORTEAF_AVX2_TARGET inline __m256 loadF32(const float *ptr, Index stride) {
+  return stride == 0 ? _mm256_set1_ps(*ptr) : _mm256_loadu_ps(ptr);
+}
+
+ORTEAF_AVX2_TARGET inline __m256 loadF16(const std::uint16_t *ptr,
+                                         Index stride) {
+  if (stride == 0) {
+    return _mm256_set1_ps(_cvtsh_ss(*ptr));
+  }
+  return _mm256_cvtph_ps(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)));
+}
+
+ORTEAF_AVX2_TARGET inline void storeF16x8(std::uint16_t *ptr, __m256 value) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr),
+                   _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+}
+
+ORTEAF_AVX2_TARGET inline __m256i loadI32(const std::int32_t *ptr,
+                                          Index stride) {
+  return stride == 0
+             ? _mm256_set1_epi32(*ptr)
+             : _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+}
+
+ORTEAF_AVX2_TARGET void addF32(const float *a, Index a_stride, const float *b,
+                               Index b_stride, float *out, Index out_stride,
+                               Index count, float alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_f32(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  const __m256 valpha = _mm256_set1_ps(alpha);
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    const __m256 va = loadF32(a + i * a_stride, a_stride);
+    const __m256 vb = loadF32(b + i * b_stride, b_stride);
+    _mm256_storeu_ps(out + i, _mm256_fmadd_ps(vb, valpha, va));
+  }
+  for (; i < count; ++i) {
+    out[i] = a[i * a_stride] + alpha * b[i * b_stride];
+  }
+}
+
+ORTEAF_AVX2_TARGET void addF16(const std::uint16_t *a, Index a_stride,
+                               const std::uint16_t *b, Index b_stride,
+                               std::uint16_t *out, Index out_stride,
+                               Index count, float alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_f16(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  const __m256 valpha = _mm256_set1_ps(alpha);
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    const __m256 va = loadF16(a + i * a_stride, a_stride);
+    const __m256 vb = loadF16(b + i * b_stride, b_stride);
+    storeF16x8(out + i, _mm256_fmadd_ps(vb, valpha, va));
+  }
+  if (i < count) {
+    detail::scalarVectorOps().add_f16(a + i * a_stride, a_stride,
+                                      b + i * b_stride, b_stride, out + i, 1,
+                                      count - i, alpha);
+  }
+}
+
+ORTEAF_AVX2_TARGET void addI32(const std::int32_t *a, Index a_stride,
+                               const std::int32_t *b, Index b_stride,
+                               std::int32_t *out, Index out_stride,
+                               Index count, std::int32_t alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_i32(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  const __m256i valpha = _mm256_set1_epi32(alpha);
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    const __m256i va = loadI32(a + i * a_stride, a_stride);
+    const __m256i vb = loadI32(b + i * b_stride, b_stride);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                        _mm256_add_epi32(va, _mm256_mullo_epi32(vb, valpha)));
+  }
+  for (; i < count; ++i) {
+    out[i] = detail::wrappingAddI32(a[i * a_stride], b[i * b_stride], alpha);
+  }
+}
+
+ORTEAF_AVX2_TARGET void reluF32(const float *in, Index in_stride, float *out,
+                                Index out_stride, Index count) {
+  if (in_stride != 1 || out_stride != 1) {
+    detail::scalarVectorOps().relu_f32(in, in_stride, out, out_stride, count);
+    return;
+  }
+  const __m256 zero = _mm256_setzero_ps();
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    _mm256_storeu_ps(out + i, _mm256_max_ps(zero, _mm256_loadu_ps(in + i)));
+  }
+  for (; i < count; ++i) {
+    out[i] = in[i] < 0.0f ? 0.0f : in[i];
+  }
+}
+
+ORTEAF_AVX2_TARGET void reluF16(const std::uint16_t *in, Index in_stride,
+                                std::uint16_t *out, Index out_stride,
+                                Index count) {
+  if (in_stride != 1 || out_stride != 1) {
+    detail::scalarVectorOps().relu_f16(in, in_stride, out, out_stride, count);
+    return;
+  }
+  // Operate on the raw bits so NaN payloads and -0 are preserved exactly.
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i magnitude_mask = _mm256_set1_epi16(0x7fff);
+  const __m256i infinity = _mm256_set1_epi16(0x7c00);
+  constexpr Index kLanes = 16;
+  Index i = 0;
+  for (; i + kLanes <= count; i += kLanes) {
+    const __m256i bits =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+    const __m256i magnitude = _mm256_and_si256(bits, magnitude_mask);
+    const __m256i negative = _mm256_cmpgt_epi16(zero, bits);
+    const __m256i is_zero = _mm256_cmpeq_epi16(magnitude, zero);
+    const __m256i is_nan = _mm256_cmpgt_epi16(magnitude, infinity);
+    const __m256i clear = _mm256_andnot_si256(
+        _mm256_or_si256(is_zero, is_nan), negative);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                        _mm256_andnot_si256(clear, bits));
+  }
+  if (i < count) {
+    detail::scalarVectorOps().relu_f16(in + i, 1, out + i, 1, count - i);
+  }
+}
+
+ORTEAF_AVX2_TARGET void reluI32(const std::int32_t *in, Index in_stride,
+                                std::int32_t *out, Index out_stride,
+                                Index count) {
+  if (in_stride != 1 || out_stride != 1) {
+    detail::scalarVectorOps().relu_i32(in, in_stride, out, out_stride, count);
+    return;
+  }
+  const __m256i zero = _mm256_setzero_si256();
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    const __m256i value =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                        _mm256_max_epi32(value, zero));
+  }
+  for (; i < count; ++i) {
+    out[i] = in[i] > 0 ? in[i] : 0;
+  }
+}
+
+ORTEAF_AVX2_TARGET void axpyF32(float a, const float *x, Index x_stride,
+                                float *acc, Index count) {
+  if (x_stride != 1) {
+    detail::scalarVectorOps().axpy_f32(a, x, x_stride, acc, count);
+    return;
+  }
+  const __m256 va = _mm256_set1_ps(a);
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    _mm256_storeu_ps(acc + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i),
+                                              _mm256_loadu_ps(acc + i)));
+  }
+  for (; i < count; ++i) {
+    acc[i] += a * x[i];
+  }
+}
+
+ORTEAF_AVX2_TARGET void axpyF16(float a, const std::uint16_t *x,
+                                Index x_stride, float *acc, Index count) {
+  if (x_stride != 1) {
+    detail::scalarVectorOps().axpy_f16(a, x, x_stride, acc, count);
+    return;
+  }
+  const __m256 va = _mm256_set1_ps(a);
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    _mm256_storeu_ps(acc + i, _mm256_fmadd_ps(va, loadF16(x + i, 1),
+                                              _mm256_loadu_ps(acc + i)));
+  }
+  if (i < count) {
+    detail::scalarVectorOps().axpy_f16(a, x + i, 1, acc + i, count - i);
+  }
+}
+
+ORTEAF_AVX2_TARGET void storeF16(const float *in, std::uint16_t *out,
+                                 Index out_stride, Index count) {
+  if (out_stride != 1) {
+    detail::scalarVectorOps().store_f16(in, out, out_stride, count);
+    return;
+  }
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    storeF16x8(out + i, _mm256_loadu_ps(in + i));
+  }
+  if (i < count) {
+    detail::scalarVectorOps().store_f16(in + i, out + i, 1, count - i);
+  }
+}
+
+#undef ORTEAF_AVX2_TARGET
+
+constexpr CpuVectorOps kAvx2Ops{
+    CpuIsa::Avx2, addF32,  addF16,  addI32,  reluF32,  reluF16,
+    reluI32,      axpyF32, axpyF16, storeF16,
+};
+
+} // namespace
+
+namespace detail {
+
+const CpuVectorOps *avx2VectorOps() noexcept { return &kAvx2Ops; }
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+const CpuVectorOps *avx2VectorOps() noexcept { return nullptr; }
+
+} // namespace detail
+
+#endif // ORTEAF_CPU_VECTOR_OPS_AVX2
+
+} // namespace orteaf::internal::kernel::cpu
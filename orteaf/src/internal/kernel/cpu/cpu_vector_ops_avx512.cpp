@@ -0,0 +1,252 @@
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define ORTEAF_CPU_VECTOR_OPS_AVX512 1
+#include <immintrin.h>
+#endif
+
+namespace orteaf::internal::kernel::cpu {
+
+#if defined(ORTEAF_CPU_VECTOR_OPS_AVX512)
+
+namespace {
+
+using Index = CpuVectorOps::Index;
+
+// Functions are compiled for AVX-512 individually so the rest of the library
+// keeps the baseline ISA; callers only reach them after isSupported(Avx512).
+#define ORTEAF_AVX512_TARGET                                                   \
+  __attribute__((target("avx512f,avx512bw,avx512vl,avx2,fma,f16c")))
+
+constexpr Index kF32Lanes = 16;
+
+inline bool vectorizable(Index a_stride, Index b_stride, Index out_stride) {
+  return out_stride == 1 && (a_stride == 0 || a_stride == 1) &&
+         (b_stride == 0 || b_stride == 1);
+}
+
+inline __mmask16 tailMask(Index remaining) {
+  return static_cast<__mmask16>((1u << remaining) - 1u);
+}
+
+ORTEAF_AVX512_TARGET inline __m512 loadF32(const float *ptr, Index stride,
+                                           __mmask16 mask) {
+  return stride == 0 ? _mm512_set1_ps(*ptr) : _mm512_maskz_loadu_ps(mask, ptr);
+}
+
+ORTEAF_AVX512_TARGET inline __m512 loadF16(const std::uint16_t *ptr,
+                                           Index stride, __mmask16 mask) {
+  if (stride == 0) {
+    return _mm512_set1_ps(_cvtsh_ss(*ptr));
+  }
+  return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, ptr));
+}
+
+ORTEAF_AVX512_TARGET inline void storeF16(std::uint16_t *ptr, __m512 value,
+                                          __mmask16 mask) {
+  _mm256_mask_storeu_epi16(ptr, mask,
+                           _mm512_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+}
+
+ORTEAF_AVX512_TARGET inline __m512i loadI32(const std::int32_t *ptr,
+                                            Index stride, __mmask16 mask) {
+  return stride == 0 ? _mm512_set1_epi32(*ptr)
+                     : _mm512_maskz_loadu_epi32(mask, ptr);
+}
+
+ORTEAF_AVX512_TARGET void addF32(const float *a, Index a_stride,
+                                 const float *b, Index b_stride, float *out,
+                                 Index out_stride, Index count, float alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_f32(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  const __m512 valpha = _mm512_set1_ps(alpha);
+  for (Index i = 0; i < count; i += kF32Lanes) {
+    const Index remaining = count - i;
+    const __mmask16 mask =
+        remaining >= kF32Lanes ? __mmask16{0xffff} : tailMask(remaining);
+    const __m512 va = loadF32(a + i * a_stride, a_stride, mask);
+    const __m512 vb = loadF32(b + i * b_stride, b_stride, mask);
+    _mm512_mask_storeu_ps(out + i, mask, _mm512_fmadd_ps(vb, valpha, va));
+  }
+}
+
+ORTEAF_AVX512_TARGET void addF16(const std::uint16_t *a, Index a_stride,
+                                 const std::uint16_t *b, Index b_stride,
+                                 std::uint16_t *out, Index out_stride,
+                                 Index count, float alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_f16(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  const __m512 valpha = _mm512_set1_ps(alpha);
+  for (Index i = 0; i < count; i += kF32Lanes) {
+    const Index remaining = count - i;
+    const __mmask16 mask =
+        remaining >= kF32Lanes ? __mmask16{0xffff} : tailMask(remaining);
+    const __m512 va = loadF16(a + i * a_stride, a_stride, mask);
+    const __m512 vb = loadF16(b + i * b_stride, b_stride, mask);
+    storeF16(out + i, _mm512_fmadd_ps(vb, valpha, va), mask);
+  }
+}
+
+ORTEAF_AVX512_TARGET void addI32(const std::int32_t *a, Index a_stride,
+                                 const std::int32_t *b, Index b_stride,
+                                 std::int32_t *out, Index out_stride,
+                                 Index count, std::int32_t alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_i32(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  const __m512i valpha = _mm512_set1_epi32(alpha);
+  for (Index i = 0; i < count; i += kF32Lanes) {
+    const Index remaining = count - i;
+    const __mmask16 mask =
+        remaining >= kF32Lanes ? __mmask16{0xffff} : tailMask(remaining);
+    const __m512i va = loadI32(a + i * a_stride, a_stride, mask);
+    const __m512i vb = loadI32(b + i * b_stride, b_stride, mask);
+    _mm512_mask_storeu_epi32(
+        out + i, mask, _mm512_add_epi32(va, _mm512_mullo_epi32(vb, valpha)));
+  }
+}
+
+ORTEAF_AVX512_TARGET void reluF32(const float *in, Index in_stride,
+                                  float *out, Index out_stride, Index count) {
+  if (in_stride != 1 || out_stride != 1) {
+    detail::scalarVectorOps().relu_f32(in, in_stride, out, out_stride, count);
+    return;
+  }
+  const __m512 zero = _mm512_setzero_ps();
+  for (Index i = 0; i < count; i += kF32Lanes) {
+    const Index remaining = count - i;
+    const __mmask16 mask =
+        remaining >= kF32Lanes ? __mmask16{0xffff} : tailMask(remaining);
+    const __m512 value = _mm512_maskz_loadu_ps(mask, in + i);
+    _mm512_mask_storeu_ps(out + i, mask, _mm512_max_ps(zero, value));
+  }
+}
+
+ORTEAF_AVX512_TARGET void reluF16(const std::uint16_t *in, Index in_stride,
+                                  std::uint16_t *out, Index out_stride,
+                                  Index count) {
+  if (in_stride != 1 || out_stride != 1) {
+    detail::scalarVectorOps().relu_f16(in, in_stride, out, out_stride, count);
+    return;
+  }
+  // Operate on the raw bits so NaN payloads and -0 are preserved exactly.
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i magnitude_mask = _mm512_set1_epi16(0x7fff);
+  const __m512i infinity = _mm512_set1_epi16(0x7c00);
+  constexpr Index kLanes = 32;
+  for (Index i = 0; i < count; i += kLanes) {
+    const Index remaining = count - i;
+    const __mmask32 mask =
+        remaining >= kLanes ? ~__mmask32{0}
+                            : static_cast<__mmask32>((1ull << remaining) - 1u);
+    const __m512i bits = _mm512_maskz_loadu_epi16(mask, in + i);
+    const __m512i magnitude = _mm512_and_si512(bits, magnitude_mask);
+    const __mmask32 negative = _mm512_cmplt_epi16_mask(bits, zero);
+    const __mmask32 keep = _mm512_cmpeq_epi16_mask(magnitude, zero) |
+                           _mm512_cmpgt_epi16_mask(magnitude, infinity);
+    const __mmask32 clear = negative & ~keep;
+    _mm512_mask_storeu_epi16(out + i, mask,
+                             _mm512_mask_mov_epi16(bits, clear, zero));
+  }
+}
+
+ORTEAF_AVX512_TARGET void reluI32(const std::int32_t *in, Index in_stride,
+                                  std::int32_t *out, Index out_stride,
+                                  Index count) {
+  if (in_stride != 1 || out_stride != 1) {
+    detail::scalarVectorOps().relu_i32(in, in_stride, out, out_stride, count);
+    return;
+  }
+  const __m512i zero = _mm512_setzero_si512();
+  for (Index i = 0; i < count; i += kF32Lanes) {
+    const Index remaining = count - i;
+    const __mmask16 mask =
+        remaining >= kF32Lanes ? __mmask16{0xffff} : tailMask(remaining);
+    const __m512i value = _mm512_maskz_loadu_epi32(mask, in + i);
+    _mm512_mask_storeu_epi32(out + i, mask, _mm512_max_epi32(value, zero));
+  }
+}
+
+ORTEAF_AVX512_TARGET void axpyF32(float a, const float *x, Index x_stride,
+                                  float *acc, Index count) {
+  if (x_stride != 1) {
+    detail::scalarVectorOps().axpy_f32(a, x, x_stride, acc, count);
+    return;
+  }
+  const __m512 va = _mm512_set1_ps(a);
+  for (Index i = 0; i < count; i += kF32Lanes) {
+    const Index remaining = count - i;
+    const __mmask16 mask =
+        remaining >= kF32Lanes ? __mmask16{0xffff} : tailMask(remaining);
+    const __m512 vx = _mm512_maskz_loadu_ps(mask, x + i);
+    const __m512 vacc = _mm512_maskz_loadu_ps(mask, acc + i);
+    _mm512_mask_storeu_ps(acc + i, mask, _mm512_fmadd_ps(va, vx, vacc));
+  }
+}
+
+ORTEAF_AVX512_TARGET void axpyF16(float a, const std::uint16_t *x,
+                                  Index x_stride, float *acc, Index count) {
+  if (x_stride != 1) {
+    detail::scalarVectorOps().axpy_f16(a, x, x_stride, acc, count);
+    return;
+  }
+  const __m512 va = _mm512_set1_ps(a);
+  for (Index i = 0; i < count; i += kF32Lanes) {
+    const Index remaining = count - i;
+    const __mmask16 mask =
+        remaining >= kF32Lanes ? __mmask16{0xffff} : tailMask(remaining);
+    const __m512 vx = loadF16(x + i, 1, mask);
+    const __m512 vacc = _mm512_maskz_loadu_ps(mask, acc + i);
+    _mm512_mask_storeu_ps(acc + i, mask, _mm512_fmadd_ps(va, vx, vacc));
+  }
+}
+
+ORTEAF_AVX512_TARGET void storeF16Row(const float *in, std::uint16_t *out,
+                                      Index out_stride, Index count) {
+  if (out_stride != 1) {
+    detail::scalarVectorOps().store_f16(in, out, out_stride, count);
+    return;
+  }
+  for (Index i = 0; i < count; i += kF32Lanes) {
+    const Index remaining = count - i;
+    const __mmask16 mask =
+        remaining >= kF32Lanes ? __mmask16{0xffff} : tailMask(remaining);
+    storeF16(out + i, _mm512_maskz_loadu_ps(mask, in + i), mask);
+  }
+}
+
+#undef ORTEAF_AVX512_TARGET
+
+constexpr CpuVectorOps kAvx512Ops{
+    CpuIsa::Avx512, addF32,  addF16,  addI32,     reluF32,  reluF16,
+    reluI32,        axpyF32, axpyF16, storeF16Row,
+};
+
+} // namespace
+
+namespace detail {
+
+const CpuVectorOps *avx512VectorOps() noexcept { return &kAvx512Ops; }
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+const CpuVectorOps *avx512VectorOps() noexcept { return nullptr; }
+
+} // namespace detail
+
+#endif // ORTEAF_CPU_VECTOR_OPS_AVX512
+
+} // namespace orteaf::internal::kernel::cpu
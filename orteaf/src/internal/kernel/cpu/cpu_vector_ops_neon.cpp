@@ -0,0 +1,210 @@
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define ORTEAF_CPU_VECTOR_OPS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace orteaf::internal::kernel::cpu {
+
+#if defined(ORTEAF_CPU_VECTOR_OPS_NEON)
+
+namespace {
+
+using Index = CpuVectorOps::Index;
+
+constexpr Index kF32Lanes = 4;
+
+inline bool vectorizable(Index a_stride, Index b_stride, Index out_stride) {
+  return out_stride == 1 && (a_stride == 0 || a_stride == 1) &&
+         (b_stride == 0 || b_stride == 1);
+}
+
+inline float32x4_t loadF32(const float *ptr, Index stride) {
+  return stride == 0 ? vdupq_n_f32(*ptr) : vld1q_f32(ptr);
+}
+
+inline float32x4_t loadF16(const std::uint16_t *ptr, Index stride) {
+  if (stride == 0) {
+    return vcvt_f32_f16(vreinterpret_f16_u16(vdup_n_u16(*ptr)));
+  }
+  return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(ptr)));
+}
+
+inline void storeF16x4(std::uint16_t *ptr, float32x4_t value) {
+  vst1_u16(ptr, vreinterpret_u16_f16(vcvt_f16_f32(value)));
+}
+
+inline int32x4_t loadI32(const std::int32_t *ptr, Index stride) {
+  return stride == 0 ? vdupq_n_s32(*ptr) : vld1q_s32(ptr);
+}
+
+void addF32(const float *a, Index a_stride, const float *b, Index b_stride,
+            float *out, Index out_stride, Index count, float alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_f32(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    const float32x4_t va = loadF32(a + i * a_stride, a_stride);
+    const float32x4_t vb = loadF32(b + i * b_stride, b_stride);
+    vst1q_f32(out + i, vfmaq_n_f32(va, vb, alpha));
+  }
+  for (; i < count; ++i) {
+    out[i] = a[i * a_stride] + alpha * b[i * b_stride];
+  }
+}
+
+void addF16(const std::uint16_t *a, Index a_stride, const std::uint16_t *b,
+            Index b_stride, std::uint16_t *out, Index out_stride, Index count,
+            float alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_f16(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    const float32x4_t va = loadF16(a + i * a_stride, a_stride);
+    const float32x4_t vb = loadF16(b + i * b_stride, b_stride);
+    storeF16x4(out + i, vfmaq_n_f32(va, vb, alpha));
+  }
+  if (i < count) {
+    detail::scalarVectorOps().add_f16(a + i * a_stride, a_stride,
+                                      b + i * b_stride, b_stride, out + i, 1,
+                                      count - i, alpha);
+  }
+}
+
+void addI32(const std::int32_t *a, Index a_stride, const std::int32_t *b,
+            Index b_stride, std::int32_t *out, Index out_stride, Index count,
+            std::int32_t alpha) {
+  if (!vectorizable(a_stride, b_stride, out_stride)) {
+    detail::scalarVectorOps().add_i32(a, a_stride, b, b_stride, out,
+                                      out_stride, count, alpha);
+    return;
+  }
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    const int32x4_t va = loadI32(a + i * a_stride, a_stride);
+    const int32x4_t vb = loadI32(b + i * b_stride, b_stride);
+    vst1q_s32(out + i, vmlaq_n_s32(va, vb, alpha));
+  }
+  for (; i < count; ++i) {
+    out[i] = detail::wrappingAddI32(a[i * a_stride], b[i * b_stride], alpha);
+  }
+}
+
+void reluF32(const float *in, Index in_stride, float *out, Index out_stride,
+             Index count) {
+  if (in_stride != 1 || out_stride != 1) {
+    detail::scalarVectorOps().relu_f32(in, in_stride, out, out_stride, count);
+    return;
+  }
+  const float32x4_t zero = vdupq_n_f32(0.0f);
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    // vmaxq_f32 would turn NaN into NaN as well, but select keeps the scalar
+    // semantics (clear only lanes that compare less than zero) explicit.
+    const float32x4_t value = vld1q_f32(in + i);
+    vst1q_f32(out + i, vbslq_f32(vcltq_f32(value, zero), zero, value));
+  }
+  for (; i < count; ++i) {
+    out[i] = in[i] < 0.0f ? 0.0f : in[i];
+  }
+}
+
+void reluI32(const std::int32_t *in, Index in_stride, std::int32_t *out,
+             Index out_stride, Index count) {
+  if (in_stride != 1 || out_stride != 1) {
+    detail::scalarVectorOps().relu_i32(in, in_stride, out, out_stride, count);
+    return;
+  }
+  const int32x4_t zero = vdupq_n_s32(0);
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    vst1q_s32(out + i, vmaxq_s32(vld1q_s32(in + i), zero));
+  }
+  for (; i < count; ++i) {
+    out[i] = in[i] > 0 ? in[i] : 0;
+  }
+}
+
+void axpyF32(float a, const float *x, Index x_stride, float *acc,
+             Index count) {
+  if (x_stride != 1) {
+    detail::scalarVectorOps().axpy_f32(a, x, x_stride, acc, count);
+    return;
+  }
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    vst1q_f32(acc + i, vfmaq_n_f32(vld1q_f32(acc + i), vld1q_f32(x + i), a));
+  }
+  for (; i < count; ++i) {
+    acc[i] += a * x[i];
+  }
+}
+
+void axpyF16(float a, const std::uint16_t *x, Index x_stride, float *acc,
+             Index count) {
+  if (x_stride != 1) {
+    detail::scalarVectorOps().axpy_f16(a, x, x_stride, acc, count);
+    return;
+  }
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    vst1q_f32(acc + i, vfmaq_n_f32(vld1q_f32(acc + i), loadF16(x + i, 1), a));
+  }
+  if (i < count) {
+    detail::scalarVectorOps().axpy_f16(a, x + i, 1, acc + i, count - i);
+  }
+}
+
+void storeF16(const float *in, std::uint16_t *out, Index out_stride,
+              Index count) {
+  if (out_stride != 1) {
+    detail::scalarVectorOps().store_f16(in, out, out_stride, count);
+    return;
+  }
+  Index i = 0;
+  for (; i + kF32Lanes <= count; i += kF32Lanes) {
+    storeF16x4(out + i, vld1q_f32(in + i));
+  }
+  if (i < count) {
+    detail::scalarVectorOps().store_f16(in + i, out + i, 1, count - i);
+  }
+}
+
+// Relu on F16 is pure bit manipulation; the scalar loop is already cheap and
+// keeps NaN / -0 handling identical across ISAs.
+void reluF16(const std::uint16_t *in, Index in_stride, std::uint16_t *out,
+             Index out_stride, Index count) {
+  detail::scalarVectorOps().relu_f16(in, in_stride, out, out_stride, count);
+}
+
+constexpr CpuVectorOps kNeonOps{
+    CpuIsa::Neon, addF32,  addF16,  addI32,  reluF32,  reluF16,
+    reluI32,      axpyF32, axpyF16, storeF16,
+};
+
+} // namespace
+
+namespace detail {
+
+const CpuVectorOps *neonVectorOps() noexcept { return &kNeonOps; }
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+const CpuVectorOps *neonVectorOps() noexcept { return nullptr; }
+
+} // namespace detail
+
+#endif // ORTEAF_CPU_VECTOR_OPS_NEON
+
+} // namespace orteaf::internal::kernel::cpu
@@ -0,0 +1,135 @@
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+#include <cmath>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/dtype/float16.h"
+
+namespace orteaf::internal::kernel::cpu {
+
+namespace {
+
+using Index = CpuVectorOps::Index;
+
+inline float loadHalf(const std::uint16_t *ptr) {
+  return ::orteaf::internal::detail::halfBitsToFloat32(*ptr);
+}
+
+inline std::uint16_t toHalf(float value) {
+  return ::orteaf::internal::detail::float32ToHalfBits(value);
+}
+
+void addF32(const float *a, Index a_stride, const float *b, Index b_stride,
+            float *out, Index out_stride, Index count, float alpha) {
+  for (Index i = 0; i < count; ++i) {
+    out[i * out_stride] = a[i * a_stride] + alpha * b[i * b_stride];
+  }
+}
+
+void addF16(const std::uint16_t *a, Index a_stride, const std::uint16_t *b,
+            Index b_stride, std::uint16_t *out, Index out_stride, Index count,
+            float alpha) {
+  for (Index i = 0; i < count; ++i) {
+    out[i * out_stride] =
+        toHalf(loadHalf(a + i * a_stride) + alpha * loadHalf(b + i * b_stride));
+  }
+}
+
+void addI32(const std::int32_t *a, Index a_stride, const std::int32_t *b,
+            Index b_stride, std::int32_t *out, Index out_stride, Index count,
+            std::int32_t alpha) {
+  for (Index i = 0; i < count; ++i) {
+    out[i * out_stride] =
+        detail::wrappingAddI32(a[i * a_stride], b[i * b_stride], alpha);
+  }
+}
+
+void reluF32(const float *in, Index in_stride, float *out, Index out_stride,
+             Index count) {
+  for (Index i = 0; i < count; ++i) {
+    // Written so NaN propagates, matching max(0, x) in the SIMD paths.
+    const float value = in[i * in_stride];
+    out[i * out_stride] = value < 0.0f ? 0.0f : value;
+  }
+}
+
+void reluF16(const std::uint16_t *in, Index in_stride, std::uint16_t *out,
+             Index out_stride, Index count) {
+  for (Index i = 0; i < count; ++i) {
+    const std::uint16_t bits = in[i * in_stride];
+    // Negative values clamp to +0; NaNs and -0 pass through unchanged.
+    const std::uint16_t magnitude = bits & 0x7fffu;
+    const bool negative =
+        (bits & 0x8000u) != 0 && magnitude != 0 && magnitude <= 0x7c00u;
+    out[i * out_stride] = negative ? std::uint16_t{0} : bits;
+  }
+}
+
+void reluI32(const std::int32_t *in, Index in_stride, std::int32_t *out,
+             Index out_stride, Index count) {
+  for (Index i = 0; i < count; ++i) {
+    const std::int32_t value = in[i * in_stride];
+    out[i * out_stride] = value > 0 ? value : 0;
+  }
+}
+
+void axpyF32(float a, const float *x, Index x_stride, float *acc,
+             Index count) {
+  for (Index i = 0; i < count; ++i) {
+    acc[i] += a * x[i * x_stride];
+  }
+}
+
+void axpyF16(float a, const std::uint16_t *x, Index x_stride, float *acc,
+             Index count) {
+  for (Index i = 0; i < count; ++i) {
+    acc[i] += a * loadHalf(x + i * x_stride);
+  }
+}
+
+void storeF16(const float *in, std::uint16_t *out, Index out_stride,
+              Index count) {
+  for (Index i = 0; i < count; ++i) {
+    out[i * out_stride] = toHalf(in[i]);
+  }
+}
+
+constexpr CpuVectorOps kScalarOps{
+    CpuIsa::Scalar, addF32,  addF16,  addI32,  reluF32,  reluF16,
+    reluI32,        axpyF32, axpyF16, storeF16,
+};
+
+} // namespace
+
+namespace detail {
+
+const CpuVectorOps &scalarVectorOps() noexcept { return kScalarOps; }
+
+} // namespace detail
+
+const CpuVectorOps &vectorOps(CpuIsa isa) noexcept {
+  switch (effectiveIsa(isa)) {
+  case CpuIsa::Avx512:
+    return *detail::avx512VectorOps();
+  case CpuIsa::Avx2:
+    return *detail::avx2VectorOps();
+  case CpuIsa::Neon:
+    return *detail::neonVectorOps();
+  case CpuIsa::Scalar:
+    break;
+  }
+  return kScalarOps;
+}
+
+std::int32_t i32AddAlpha(float alpha) {
+  // 2^31 is exact in float; every float below it converts without overflow.
+  if (std::trunc(alpha) != alpha || alpha < -2147483648.0f ||
+      alpha >= 2147483648.0f) {
+    ::orteaf::internal::diagnostics::error::throwError(
+        ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+        "I32 add requires an integral alpha");
+  }
+  return static_cast<std::int32_t>(alpha);
+}
+
+} // namespace orteaf::internal::kernel::cpu
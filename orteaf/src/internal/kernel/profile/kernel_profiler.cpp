@@ -0,0 +1,198 @@
+#include "orteaf/internal/kernel/profile/kernel_profiler.h"
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <sstream>
+
+#include <orteaf/internal/architecture/architecture.h>
+#include <orteaf/internal/base/array_view.h>
+#include <orteaf/internal/dtype/dtype.h>
+#include <orteaf/internal/kernel/core/kernel_args.h>
+#include <orteaf/internal/ops/ops.h>
+
+namespace orteaf::internal::kernel::profile {
+
+namespace {
+
+namespace kk = ::orteaf::internal::kernel::kernel_key;
+
+void writeSummary(std::ostringstream &out, const LatencySummary &summary,
+                  std::uint32_t sample_every) {
+  out << "{\"calls\":" << summary.calls << ",\"estimated_calls\":"
+      << summary.calls * std::max<std::uint32_t>(sample_every, 1)
+      << ",\"total_ns\":" << summary.total_ns
+      << ",\"min_ns\":" << (summary.calls == 0 ? 0 : summary.min_ns)
+      << ",\"max_ns\":" << summary.max_ns
+      << ",\"mean_ns\":" << summary.meanNs() << ",\"histogram\":[";
+  // Trailing empty buckets are dropped; index i covers [2^i, 2^(i+1)) ns.
+  std::size_t used = summary.histogram.size();
+  while (used > 0 && summary.histogram[used - 1] == 0) {
+    --used;
+  }
+  for (std::size_t i = 0; i < used; ++i) {
+    out << (i == 0 ? "" : ",") << summary.histogram[i];
+  }
+  out << "]}";
+}
+
+} // namespace
+
+std::size_t sizeBucketOf(std::int64_t elements) noexcept {
+  if (elements < 0) {
+    return kUnknownSizeBucket;
+  }
+  if (elements == 0) {
+    return 0;
+  }
+  // floor(log16(elements)), clamped below the unknown bucket.
+  const auto log2 = static_cast<std::size_t>(
+      std::bit_width(static_cast<std::uint64_t>(elements)) - 1);
+  return std::min(log2 / 4, kUnknownSizeBucket - 1);
+}
+
+std::size_t sizeBucketOf(const KernelArgs &args) noexcept {
+  using View = ::orteaf::internal::base::ArrayView<const std::int64_t>;
+  std::int64_t largest = -1;
+  for (const auto &param : args.paramList()) {
+    if (param.id() != ParamId::Shape) {
+      continue;
+    }
+    const auto *shape = param.tryGet<View>();
+    if (shape == nullptr) {
+      continue;
+    }
+    std::int64_t elements = 1;
+    for (std::size_t i = 0; i < shape->count; ++i) {
+      elements *= (*shape)[i];
+    }
+    largest = std::max(largest, elements);
+  }
+  return sizeBucketOf(largest);
+}
+
+std::size_t latencyBucketOf(std::uint64_t nanoseconds) noexcept {
+  if (nanoseconds == 0) {
+    return 0;
+  }
+  const auto bucket = static_cast<std::size_t>(std::bit_width(nanoseconds)) - 1;
+  return std::min(bucket, kLatencyBucketCount - 1);
+}
+
+void LatencySummary::add(std::uint64_t nanoseconds) noexcept {
+  ++calls;
+  total_ns += nanoseconds;
+  min_ns = std::min(min_ns, nanoseconds);
+  max_ns = std::max(max_ns, nanoseconds);
+  ++histogram[latencyBucketOf(nanoseconds)];
+}
+
+void LatencySummary::merge(const LatencySummary &other) noexcept {
+  calls += other.calls;
+  total_ns += other.total_ns;
+  min_ns = std::min(min_ns, other.min_ns);
+  max_ns = std::max(max_ns, other.max_ns);
+  for (std::size_t i = 0; i < histogram.size(); ++i) {
+    histogram[i] += other.histogram[i];
+  }
+}
+
+void KernelProfiler::record(KernelKey key, std::size_t size_bucket,
+                            std::uint64_t nanoseconds) {
+  size_bucket = std::min(size_bucket, kUnknownSizeBucket);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &profile = profiles_[key];
+  profile.key = key;
+  profile.total.add(nanoseconds);
+  profile.by_size[size_bucket].add(nanoseconds);
+}
+
+std::optional<KernelProfile> KernelProfiler::find(KernelKey key) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = profiles_.find(key);
+  if (it == profiles_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+std::vector<KernelProfile> KernelProfiler::snapshot() const {
+  std::vector<KernelProfile> profiles;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    profiles.reserve(profiles_.size());
+    for (const auto &[key, profile] : profiles_) {
+      profiles.push_back(profile);
+    }
+  }
+  std::sort(profiles.begin(), profiles.end(),
+            [](const KernelProfile &lhs, const KernelProfile &rhs) {
+              if (lhs.total.total_ns != rhs.total.total_ns) {
+                return lhs.total.total_ns > rhs.total.total_ns;
+              }
+              return static_cast<std::uint64_t>(lhs.key) <
+                     static_cast<std::uint64_t>(rhs.key);
+            });
+  return profiles;
+}
+
+void KernelProfiler::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  profiles_.clear();
+}
+
+std::string KernelProfiler::toJson() const {
+  const auto profiles = snapshot();
+  std::ostringstream out;
+  out << "{\"sample_every\":" << std::max<std::uint32_t>(config_.sample_every, 1)
+      << ",\"kernels\":[";
+  for (std::size_t i = 0; i < profiles.size(); ++i) {
+    const auto &profile = profiles[i];
+    const auto key = profile.key;
+    out << (i == 0 ? "" : ",") << "{\"key\":"
+        << static_cast<std::uint64_t>(key) << ",\"op\":\""
+        << ::orteaf::internal::ops::idOf(kk::getOp(key)) << "\",\"dtype\":\""
+        << ::orteaf::internal::idOf(kk::getDType(key))
+        << "\",\"architecture\":\""
+        << ::orteaf::internal::architecture::idOf(kk::getArchitecture(key))
+        << "\",\"layout\":" << static_cast<unsigned>(kk::getLayout(key))
+        << ",\"variant\":" << static_cast<unsigned>(kk::getVariant(key))
+        << ",\"total\":";
+    writeSummary(out, profile.total, config_.sample_every);
+    out << ",\"by_size\":[";
+    bool first = true;
+    for (std::size_t bucket = 0; bucket < profile.by_size.size(); ++bucket) {
+      const auto &summary = profile.by_size[bucket];
+      if (summary.calls == 0) {
+        continue;
+      }
+      out << (first ? "" : ",") << "{\"bucket\":";
+      if (bucket == kUnknownSizeBucket) {
+        out << "\"unknown\"";
+      } else if (bucket == kUnknownSizeBucket - 1) {
+        out << "\">=" << (std::uint64_t{1} << (4 * bucket)) << "\"";
+      } else {
+        // Upper bound (exclusive) on the element count of the bucket.
+        out << "\"<" << (std::uint64_t{1} << (4 * (bucket + 1))) << "\"";
+      }
+      out << ",\"latency\":";
+      writeSummary(out, summary, config_.sample_every);
+      out << "}";
+      first = false;
+    }
+    out << "]}";
+  }
+  out << "]}";
+  return out.str();
+}
+
+bool KernelProfiler::writeJson(const std::string &path) const {
+  std::ofstream file(path, std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+  file << toJson() << '\n';
+  return static_cast<bool>(file);
+}
+
+} // namespace orteaf::internal::kernel::profile
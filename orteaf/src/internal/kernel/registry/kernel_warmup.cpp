@@ -0,0 +1,153 @@
+#include "orteaf/internal/kernel/registry/kernel_warmup.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+namespace orteaf::internal::kernel::registry {
+
+namespace {
+
+// First line of a manifest file. Bump when the line format changes.
+constexpr const char *kFileHeader = "orteaf-manifest 1";
+
+} // namespace
+
+KernelManifest recordManifest(const KernelRegistry &registry) {
+  KernelManifest manifest;
+  registry.forEachResidentKey([&](KernelKey key) {
+    manifest.push_back(KernelManifestEntry::fromKey(key));
+  });
+  return manifest;
+}
+
+bool saveManifest(const std::string &path, const KernelManifest &manifest) {
+  std::ofstream out(path, std::ios::trunc);
+  if (!out) {
+    return false;
+  }
+  // op dtype architecture variant layout, as integers
+  out << kFileHeader << '\n';
+  for (const auto &entry : manifest) {
+    out << static_cast<unsigned>(entry.op) << ' '
+        << static_cast<unsigned>(entry.dtype) << ' '
+        << static_cast<unsigned>(entry.architecture) << ' '
+        << static_cast<std::uint64_t>(entry.variant) << ' '
+        << static_cast<std::uint64_t>(entry.layout) << '\n';
+  }
+  return static_cast<bool>(out);
+}
+
+KernelManifest loadManifest(const std::string &path) {
+  KernelManifest manifest;
+  std::ifstream in(path);
+  std::string line;
+  if (!in || !std::getline(in, line) || line != kFileHeader) {
+    return manifest;
+  }
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    unsigned op = 0;
+    unsigned dtype = 0;
+    unsigned architecture = 0;
+    std::uint64_t variant = 0;
+    std::uint64_t layout = 0;
+    if (!(fields >> op >> dtype >> architecture >> variant >> layout)) {
+      continue;
+    }
+    manifest.push_back(
+        {static_cast<::orteaf::internal::ops::Op>(op),
+         static_cast<::orteaf::internal::DType>(dtype),
+         static_cast<::orteaf::internal::architecture::Architecture>(
+             architecture),
+         static_cast<Variant>(variant), static_cast<Layout>(layout)});
+  }
+  return manifest;
+}
+
+KernelWarmup::KernelWarmup(KernelRegistry &registry,
+                           std::span<const KernelManifestEntry> manifest,
+                           std::size_t threads)
+    : registry_(registry), start_(std::chrono::steady_clock::now()) {
+  keys_.reserve(manifest.size());
+  for (const auto &entry : manifest) {
+    keys_.push_back(entry.key());
+  }
+  registry_.beginPrefetch(keys_.size());
+
+  const std::size_t workers =
+      std::min(std::max<std::size_t>(threads, 1), keys_.size());
+  if (workers == 0) {
+    finish();
+    return;
+  }
+  running_.store(workers, std::memory_order_relaxed);
+  workers_.reserve(workers);
+  std::size_t spawned = 0;
+  try {
+    for (; spawned < workers; ++spawned) {
+      workers_.emplace_back([this] { work(); });
+    }
+  } catch (const std::system_error &) {
+    // Out of threads: the caller covers for the workers it could not start.
+    for (; spawned < workers; ++spawned) {
+      work();
+    }
+  }
+
+  if (!registry_.config().concurrent) {
+    wait();
+  }
+}
+
+KernelWarmup::~KernelWarmup() {
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+void KernelWarmup::wait() const noexcept {
+  while (!finished_.load(std::memory_order_acquire)) {
+    finished_.wait(false, std::memory_order_acquire);
+  }
+}
+
+KernelWarmup::Progress KernelWarmup::progress() const noexcept {
+  Progress progress;
+  progress.total = keys_.size();
+  progress.completed = completed_.load(std::memory_order_acquire);
+  progress.warmed = warmed_.load(std::memory_order_relaxed);
+  progress.missing = missing_.load(std::memory_order_relaxed);
+  progress.nanoseconds = nanoseconds_.load(std::memory_order_acquire);
+  return progress;
+}
+
+void KernelWarmup::work() {
+  for (std::size_t index = next_.fetch_add(1, std::memory_order_relaxed);
+       index < keys_.size();
+       index = next_.fetch_add(1, std::memory_order_relaxed)) {
+    if (registry_.prefetchForWarmup(keys_[index])) {
+      warmed_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      missing_.fetch_add(1, std::memory_order_relaxed);
+    }
+    completed_.fetch_add(1, std::memory_order_release);
+  }
+  if (running_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    finish();
+  }
+}
+
+void KernelWarmup::finish() noexcept {
+  nanoseconds_.store(
+      static_cast<std::uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - start_)
+              .count()),
+      std::memory_order_relaxed);
+  finished_.store(true, std::memory_order_release);
+  finished_.notify_all();
+}
+
+} // namespace orteaf::internal::kernel::registry
@@ -0,0 +1,283 @@
+#include "orteaf/internal/kernel/registry/persistent_kernel_store.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+
+namespace orteaf::internal::kernel::registry {
+
+namespace {
+
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+
+constexpr char kMagic[8] = {'O', 'R', 'T', 'K', 'S', 'T', 'R', '\0'};
+
+// Exclusive flock on the store file for the lifetime of the object.
+class FileLock {
+public:
+  explicit FileLock(int fd) : fd_(fd) {
+    while (::flock(fd_, LOCK_EX) != 0) {
+      if (errno != EINTR) {
+        throwError(OrteafErrc::OperationFailed,
+                   "cannot lock persistent kernel store");
+      }
+    }
+  }
+  ~FileLock() { ::flock(fd_, LOCK_UN); }
+
+  FileLock(const FileLock &) = delete;
+  FileLock &operator=(const FileLock &) = delete;
+
+private:
+  int fd_;
+};
+
+[[noreturn]] void throwForeign(const std::string &path, const char *what) {
+  throwError(OrteafErrc::InvalidParameter,
+             "refusing persistent kernel store '" + path + "': " + what);
+}
+
+} // namespace
+
+PersistentKernelStore::FileHandle::~FileHandle() {
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+}
+
+PersistentKernelStore::Mapping::~Mapping() {
+  if (base_ != nullptr) {
+    ::munmap(base_, bytes_);
+  }
+}
+
+void PersistentKernelStore::Mapping::map(int fd, std::size_t capacity) {
+  const std::size_t bytes = sizeof(Header) + capacity * sizeof(Record);
+  void *base =
+      ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    throwError(OrteafErrc::OperationFailed,
+               "cannot map persistent kernel store");
+  }
+  if (base_ != nullptr) {
+    ::munmap(base_, bytes_);
+  }
+  base_ = base;
+  bytes_ = bytes;
+  capacity_ = capacity;
+}
+
+PersistentKernelStore::PersistentKernelStore(std::string path,
+                                             std::size_t initial_capacity)
+    : path_(std::move(path)),
+      fd_(::open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)) {
+  if (fd_.get() < 0) {
+    throwError(OrteafErrc::OperationFailed,
+               "cannot open persistent kernel store");
+  }
+  // Creation is atomic with respect to other processes opening the file.
+  FileLock file_lock(fd_.get());
+  struct stat info {};
+  if (::fstat(fd_.get(), &info) != 0) {
+    throwError(OrteafErrc::OperationFailed,
+               "cannot stat persistent kernel store");
+  }
+
+  const auto file_size = static_cast<std::size_t>(info.st_size);
+  if (file_size == 0) {
+    initialize(std::max<std::size_t>(initial_capacity, 16));
+  } else {
+    Header existing{};
+    if (file_size < sizeof(Header) ||
+        ::pread(fd_.get(), &existing, sizeof(existing), 0) !=
+            static_cast<ssize_t>(sizeof(existing)) ||
+        std::memcmp(existing.magic, kMagic, sizeof(kMagic)) != 0) {
+      throwForeign(path_, "not a kernel store");
+    }
+    if (existing.format_version != kFormatVersion ||
+        existing.key_version != kernel_key::kCurrentVersion) {
+      throwForeign(path_, "written with another format or key version");
+    }
+    if (existing.count > existing.capacity ||
+        file_size < sizeof(Header) + existing.capacity * sizeof(Record)) {
+      throwForeign(path_, "file is truncated");
+    }
+    mapping_.map(fd_.get(), existing.capacity);
+  }
+  refresh();
+}
+
+PersistentKernelStore::~PersistentKernelStore() {
+  if (mapping_.base() != nullptr) {
+    ::msync(mapping_.base(), mapping_.bytes(), MS_ASYNC);
+  }
+}
+
+bool PersistentKernelStore::putMetadata(Key key,
+                                        const MetadataRecord &record) {
+  if (kernel_key::getVersion(key) != kernel_key::kCurrentVersion) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  upsert(Kind::Metadata, static_cast<std::uint64_t>(key), 0,
+         static_cast<std::uint64_t>(record.architecture),
+         record.resident ? kResidentFlag : 0u);
+  return true;
+}
+
+std::optional<PersistentKernelStore::MetadataRecord>
+PersistentKernelStore::findMetadata(Key key) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const Record *record =
+      find(Kind::Metadata, static_cast<std::uint64_t>(key), 0);
+  if (record == nullptr) {
+    return std::nullopt;
+  }
+  return toMetadata(*record);
+}
+
+void PersistentKernelStore::putResolution(const KeyRequest &request,
+                                          std::uint64_t signature,
+                                          std::uint64_t fingerprint,
+                                          Key result) {
+  if (kernel_key::getVersion(result) != kernel_key::kCurrentVersion) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  upsert(Kind::Resolution, packRequest(request), signature,
+         static_cast<std::uint64_t>(result), foldFingerprint(fingerprint));
+}
+
+std::optional<PersistentKernelStore::Key>
+PersistentKernelStore::findResolution(const KeyRequest &request,
+                                      std::uint64_t signature,
+                                      std::uint64_t fingerprint) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const Record *record = find(Kind::Resolution, packRequest(request), signature);
+  if (record == nullptr || record->flags != foldFingerprint(fingerprint)) {
+    return std::nullopt;
+  }
+  return static_cast<Key>(record->b);
+}
+
+void PersistentKernelStore::putTuning(const KeyRequest &request,
+                                      std::uint64_t bucket, Key winner) {
+  if (kernel_key::getVersion(winner) != kernel_key::kCurrentVersion) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  upsert(Kind::Tuning, packRequest(request), bucket,
+         static_cast<std::uint64_t>(winner), 0);
+}
+
+std::optional<PersistentKernelStore::Key>
+PersistentKernelStore::findTuning(const KeyRequest &request,
+                                  std::uint64_t bucket) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const Record *record = find(Kind::Tuning, packRequest(request), bucket);
+  if (record == nullptr) {
+    return std::nullopt;
+  }
+  return static_cast<Key>(record->b);
+}
+
+void PersistentKernelStore::sync() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ::msync(mapping_.base(), mapping_.bytes(), MS_SYNC);
+}
+
+std::size_t PersistentKernelStore::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return indexed_;
+}
+
+std::uint64_t
+PersistentKernelStore::packRequest(const KeyRequest &request) noexcept {
+  return static_cast<std::uint64_t>(
+      makeKey({request.op, request.dtype},
+              {request.architecture, static_cast<Layout>(0),
+               static_cast<Variant>(0)}));
+}
+
+void PersistentKernelStore::initialize(std::size_t capacity) {
+  const std::size_t bytes = sizeof(Header) + capacity * sizeof(Record);
+  if (::ftruncate(fd_.get(), static_cast<off_t>(bytes)) != 0) {
+    throwError(OrteafErrc::OperationFailed,
+               "cannot size persistent kernel store");
+  }
+  mapping_.map(fd_.get(), capacity);
+  Header *head = header();
+  std::memcpy(head->magic, kMagic, sizeof(kMagic));
+  head->format_version = kFormatVersion;
+  head->key_version = kernel_key::kCurrentVersion;
+  head->count = 0;
+  head->capacity = capacity;
+  std::memset(head->reserved, 0, sizeof(head->reserved));
+}
+
+void PersistentKernelStore::refresh() {
+  // Another process may have grown the file or appended records.
+  const std::size_t capacity = header()->capacity;
+  if (capacity != mapping_.capacity()) {
+    mapping_.map(fd_.get(), capacity);
+  }
+  const std::size_t total = std::min(count(), capacity);
+  for (; indexed_ < total; ++indexed_) {
+    const Record &record = records()[indexed_];
+    index_[{record.kind, record.key, record.a}] = indexed_;
+  }
+}
+
+void PersistentKernelStore::grow() {
+  const std::size_t capacity = header()->capacity * 2;
+  const std::size_t bytes = sizeof(Header) + capacity * sizeof(Record);
+  if (::ftruncate(fd_.get(), static_cast<off_t>(bytes)) != 0) {
+    throwError(OrteafErrc::OperationFailed,
+               "cannot grow persistent kernel store");
+  }
+  mapping_.map(fd_.get(), capacity);
+  header()->capacity = capacity;
+}
+
+void PersistentKernelStore::upsert(Kind kind, std::uint64_t key,
+                                   std::uint64_t a, std::uint64_t b,
+                                   std::uint32_t flags) {
+  FileLock file_lock(fd_.get());
+  refresh();
+  const IndexKey index_key{static_cast<std::uint32_t>(kind), key, a};
+  auto it = index_.find(index_key);
+  if (it != index_.end()) {
+    Record &record = records()[it->second];
+    record.b = b;
+    record.flags = flags;
+    return;
+  }
+  if (count() == header()->capacity) {
+    grow();
+  }
+  const std::size_t slot = count();
+  records()[slot] = Record{key, static_cast<std::uint32_t>(kind), flags, a, b};
+  // Publish the record before counting it, so a torn write is dropped.
+  header()->count = slot + 1;
+  index_.emplace(index_key, slot);
+  indexed_ = slot + 1;
+}
+
+const PersistentKernelStore::Record *
+PersistentKernelStore::find(Kind kind, std::uint64_t key,
+                            std::uint64_t a) const {
+  auto it = index_.find({static_cast<std::uint32_t>(kind), key, a});
+  return it == index_.end() ? nullptr : &records()[it->second];
+}
+
+} // namespace orteaf::internal::kernel::registry
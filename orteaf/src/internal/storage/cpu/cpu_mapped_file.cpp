@@ -0,0 +1,70 @@
+#include "orteaf/internal/storage/cpu/cpu_mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+
+namespace orteaf::internal::storage::cpu {
+
+namespace {
+
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+
+} // namespace
+
+std::shared_ptr<const CpuMappedFile>
+CpuMappedFile::open(const std::string &path, Options options) {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throwError(OrteafErrc::InvalidParameter,
+               "cannot open mapped file '" + path + "': " +
+                   std::strerror(errno));
+  }
+
+  struct stat info {};
+  if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+    ::close(fd);
+    throwError(OrteafErrc::InvalidParameter,
+               "mapped file '" + path + "' is not a regular file");
+  }
+
+  const auto size = static_cast<std::size_t>(info.st_size);
+  void *base = nullptr;
+  if (size != 0) {
+    base = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  // The mapping keeps its own reference to the file.
+  ::close(fd);
+  if (base == MAP_FAILED) {
+    throwError(OrteafErrc::OperationFailed,
+               "mmap of '" + path + "' failed: " + std::strerror(errno));
+  }
+
+  if (base != nullptr) {
+    // Hints only; a kernel that ignores them still serves faults.
+    if (options.sequential) {
+      (void)::madvise(base, size, MADV_SEQUENTIAL);
+    }
+    if (options.will_need) {
+      (void)::madvise(base, size, MADV_WILLNEED);
+    }
+  }
+
+  return std::shared_ptr<const CpuMappedFile>(
+      new CpuMappedFile(path, static_cast<const std::byte *>(base), size));
+}
+
+CpuMappedFile::~CpuMappedFile() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<std::byte *>(data_), size_);
+  }
+}
+
+} // namespace orteaf::internal::storage::cpu
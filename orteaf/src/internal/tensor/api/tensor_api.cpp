@@ -1,6 +1,10 @@
 #include "orteaf/internal/tensor/api/tensor_api.h"
 
+#include <cstring>
+
 #include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/diagnostics/trace/trace.h"
+#include "orteaf/internal/execution_context/cpu/current_context.h"
 
 namespace orteaf::internal::tensor::api {
 
@@ -95,11 +99,86 @@ bool TensorApi::hasImplName(std::string_view impl_name) {
   return Registry::hasName(impl_name);
 }
 
+// ===== Existing Storage =====
+
+TensorApi::StorageLease
+TensorApi::mapStorage(std::shared_ptr<const MappedFile> file,
+                      std::size_t byte_offset, DType dtype, std::size_t numel) {
+  ORTEAF_TRACE_SPAN_ARG("TensorApi::mapStorage", "tensor", "bytes",
+                        numel * ::orteaf::internal::sizeOf(dtype));
+  ensureConfigured();
+
+  ::orteaf::internal::storage::CpuMappedStorageManager::Request request{};
+  request.mapped_file = std::move(file);
+  request.byte_offset = byte_offset;
+  request.dtype = dtype;
+  request.numel = numel;
+  auto lease = storageRegistrySingleton()
+                   .template get<::orteaf::internal::storage::cpu::
+                                     CpuMappedStorage>()
+                   .acquire(request);
+  return StorageLease::erase(std::move(lease));
+}
+
+TensorApi::StorageLease TensorApi::cloneStorage(const StorageLease &source) {
+  ensureConfigured();
+  const auto copy_from = [](const auto &storage) {
+    ::orteaf::internal::storage::CpuStorageManager::Request request{};
+    request.device =
+        ::orteaf::internal::execution_context::cpu::currentDeviceHandle();
+    request.dtype = storage.dtype();
+    request.numel = storage.numel();
+    auto lease = storageRegistrySingleton()
+                     .template get<::orteaf::internal::storage::cpu::
+                                       CpuStorage>()
+                     .acquire(request);
+    const std::size_t bytes =
+        storage.numel() * ::orteaf::internal::sizeOf(storage.dtype());
+    if (bytes != 0) {
+      std::memcpy(lease->data(), storage.data(), bytes);
+    }
+    return StorageLease::erase(std::move(lease));
+  };
+  if (const auto *heap =
+          source.tryAs<::orteaf::internal::storage::CpuStorageLease>();
+      heap != nullptr && *heap) {
+    return copy_from(*heap->operator->());
+  }
+  if (const auto *mapped =
+          source.tryAs<::orteaf::internal::storage::CpuMappedStorageLease>();
+      mapped != nullptr && *mapped) {
+    return copy_from(*mapped->operator->());
+  }
+  return {};
+}
+
+TensorApi::LeaseVariant TensorApi::fromStorage(StorageLease storage,
+                                               std::span<const Dim> shape,
+                                               Dim offset) {
+  ensureConfigured();
+  if (!storage) {
+    throwInvalidState("Cannot wrap invalid storage");
+  }
+
+  auto layout = DenseTensorImpl::Layout::contiguous(shape);
+  const Dim numel = layout.numel();
+  const auto capacity = static_cast<Dim>(storage.numel());
+  if (offset < 0 || offset > capacity || numel > capacity - offset) {
+    ::orteaf::internal::diagnostics::error::throwError(
+        ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+        "Tensor does not fit in the wrapped storage");
+  }
+  DenseTensorImpl::Layout placed(layout.shape(), layout.strides(), offset);
+  return registrySingleton().template get<DenseTensorImpl>().fromStorage(
+      std::move(placed), std::move(storage));
+}
+
 // ===== Auto-dispatch Operations =====
 
 TensorApi::LeaseVariant
 TensorApi::transpose(const LeaseVariant &src,
                      std::span<const std::size_t> perm) {
+  ORTEAF_TRACE_SPAN("TensorApi::transpose", "tensor");
   return std::visit(
       [&](const auto &lease) -> LeaseVariant {
         using LeaseType = std::decay_t<decltype(lease)>;
@@ -118,6 +197,7 @@ TensorApi::transpose(const LeaseVariant &src,
 TensorApi::LeaseVariant TensorApi::slice(const LeaseVariant &src,
                                          std::span<const Dim> starts,
                                          std::span<const Dim> sizes) {
+  ORTEAF_TRACE_SPAN("TensorApi::slice", "tensor");
   return std::visit(
       [&](const auto &lease) -> LeaseVariant {
         using LeaseType = std::decay_t<decltype(lease)>;
@@ -136,6 +216,7 @@ TensorApi::LeaseVariant TensorApi::slice(const LeaseVariant &src,
 
 TensorApi::LeaseVariant TensorApi::reshape(const LeaseVariant &src,
                                            std::span<const Dim> new_shape) {
+  ORTEAF_TRACE_SPAN("TensorApi::reshape", "tensor");
   return std::visit(
       [&](const auto &lease) -> LeaseVariant {
         using LeaseType = std::decay_t<decltype(lease)>;
@@ -153,6 +234,7 @@ TensorApi::LeaseVariant TensorApi::reshape(const LeaseVariant &src,
 }
 
 TensorApi::LeaseVariant TensorApi::squeeze(const LeaseVariant &src) {
+  ORTEAF_TRACE_SPAN("TensorApi::squeeze", "tensor");
   return std::visit(
       [&](const auto &lease) -> LeaseVariant {
         using LeaseType = std::decay_t<decltype(lease)>;
@@ -170,6 +252,7 @@ TensorApi::LeaseVariant TensorApi::squeeze(const LeaseVariant &src) {
 
 TensorApi::LeaseVariant TensorApi::unsqueeze(const LeaseVariant &src,
                                              std::size_t dim) {
+  ORTEAF_TRACE_SPAN("TensorApi::unsqueeze", "tensor");
   return std::visit(
       [&](const auto &lease) -> LeaseVariant {
         using LeaseType = std::decay_t<decltype(lease)>;
@@ -185,4 +268,23 @@ TensorApi::LeaseVariant TensorApi::unsqueeze(const LeaseVariant &src,
       src);
 }
 
+// ===== Materialization =====
+
+TensorApi::LeaseVariant TensorApi::contiguous(const LeaseVariant &src) {
+  ORTEAF_TRACE_SPAN("TensorApi::contiguous", "tensor");
+  return std::visit(
+      [&](const auto &lease) -> LeaseVariant {
+        using LeaseType = std::decay_t<decltype(lease)>;
+        if constexpr (std::is_same_v<LeaseType, std::monostate>) {
+          throwInvalidState("Cannot make invalid tensor contiguous");
+          return std::monostate{};
+        } else {
+          return Registry::dispatch(lease, [&]<typename Impl>(const auto &l) {
+            return registrySingleton().template get<Impl>().contiguous(l);
+          });
+        }
+      },
+      src);
+}
+
 } // namespace orteaf::internal::tensor::api
@@ -0,0 +1,323 @@
+#include "orteaf/internal/tensor/format/safetensors.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+
+namespace orteaf::internal::tensor::format {
+
+namespace {
+
+using ::orteaf::internal::DType;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+using MappedFile = ::orteaf::internal::storage::cpu::CpuMappedFile;
+
+struct DTypeName {
+  std::string_view name;
+  DType dtype;
+};
+
+constexpr DTypeName kDTypeNames[] = {
+    {"BOOL", DType::Bool},       {"U8", DType::U8},   {"I8", DType::I8},
+    {"U16", DType::U16},         {"I16", DType::I16}, {"U32", DType::U32},
+    {"I32", DType::I32},         {"U64", DType::U64}, {"I64", DType::I64},
+    {"F8_E4M3", DType::F8E4M3}, {"F8_E5M2", DType::F8E5M2},
+    {"F16", DType::F16},         {"F32", DType::F32}, {"F64", DType::F64},
+};
+
+// Largest header the reference safetensors implementation accepts.
+constexpr std::uint64_t kMaxHeaderBytes = 100'000'000;
+
+// Parser for the subset of JSON a safetensors header uses: one object of
+// tensor objects with string, integer-array and nested "__metadata__"
+// values. Other values are skipped, nested at most kMaxDepth levels deep.
+class HeaderParser {
+public:
+  static constexpr int kMaxDepth = 64;
+
+  HeaderParser(std::string_view text, const std::string &path)
+      : text_(text), path_(path) {}
+
+  std::vector<WeightFileEntry> parse(std::uint64_t data_start,
+                                     std::uint64_t data_size) {
+    std::vector<WeightFileEntry> entries;
+    expect('{');
+    if (peek() == '}') {
+      ++pos_;
+      return entries;
+    }
+    do {
+      std::string name = parseString();
+      expect(':');
+      if (name == "__metadata__") {
+        skipValue();
+        continue;
+      }
+      entries.push_back(parseTensor(std::move(name), data_start, data_size));
+    } while (consume(','));
+    expect('}');
+    return entries;
+  }
+
+private:
+  WeightFileEntry parseTensor(std::string name, std::uint64_t data_start,
+                              std::uint64_t data_size) {
+    WeightFileEntry entry;
+    entry.name = std::move(name);
+    bool has_dtype = false;
+    bool has_shape = false;
+    std::vector<std::uint64_t> offsets;
+    expect('{');
+    do {
+      const std::string key = parseString();
+      expect(':');
+      if (key == "dtype") {
+        entry.dtype = dtypeOf(parseString());
+        has_dtype = true;
+      } else if (key == "shape") {
+        for (const auto dim : parseIntArray()) {
+          if (dim > static_cast<std::uint64_t>(
+                        std::numeric_limits<std::int64_t>::max())) {
+            fail("tensor dimension is too large");
+          }
+          entry.shape.push_back(static_cast<std::int64_t>(dim));
+        }
+        has_shape = true;
+      } else if (key == "data_offsets") {
+        offsets = parseIntArray();
+      } else {
+        skipValue();
+      }
+    } while (consume(','));
+    expect('}');
+
+    if (!has_dtype || !has_shape || offsets.size() != 2 ||
+        offsets[0] > offsets[1] || offsets[1] > data_size) {
+      fail("tensor entry is incomplete or out of range");
+    }
+    entry.byte_offset = data_start + offsets[0];
+    entry.byte_size = offsets[1] - offsets[0];
+    entry.alignment = static_cast<std::uint32_t>(
+        ::orteaf::internal::alignmentOf(entry.dtype));
+    return entry;
+  }
+
+  DType dtypeOf(const std::string &name) {
+    for (const auto &known : kDTypeNames) {
+      if (known.name == name) {
+        return known.dtype;
+      }
+    }
+    throwError(OrteafErrc::Unsupported,
+               "safetensors dtype '" + name + "' is not supported");
+  }
+
+  std::vector<std::uint64_t> parseIntArray() {
+    std::vector<std::uint64_t> values;
+    expect('[');
+    if (consume(']')) {
+      return values;
+    }
+    do {
+      skipSpace();
+      if (pos_ >= text_.size() || text_[pos_] < '0' || text_[pos_] > '9') {
+        fail("expected a non-negative integer");
+      }
+      constexpr auto kMax = std::numeric_limits<std::uint64_t>::max();
+      std::uint64_t value = 0;
+      while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9') {
+        const auto digit = static_cast<std::uint64_t>(text_[pos_++] - '0');
+        if (value > (kMax - digit) / 10) {
+          fail("integer is too large");
+        }
+        value = value * 10 + digit;
+      }
+      values.push_back(value);
+    } while (consume(','));
+    expect(']');
+    return values;
+  }
+
+  std::string parseString() {
+    expect('"');
+    std::string out;
+    while (pos_ < text_.size() && text_[pos_] != '"') {
+      char c = text_[pos_++];
+      if (c == '\\') {
+        if (pos_ >= text_.size()) {
+          break;
+        }
+        c = text_[pos_++];
+        switch (c) {
+        case 'n':
+          c = '\n';
+          break;
+        case 't':
+          c = '\t';
+          break;
+        case 'r':
+          c = '\r';
+          break;
+        case 'b':
+          c = '\b';
+          break;
+        case 'f':
+          c = '\f';
+          break;
+        case 'u':
+          // Tensor names are ASCII in practice; keep the escape verbatim.
+          out += "\\u";
+          continue;
+        default:
+          break;
+        }
+      }
+      out += c;
+    }
+    expect('"');
+    return out;
+  }
+
+  void skipValue(int depth = 0) {
+    const char c = peek();
+    if (c == '"') {
+      parseString();
+    } else if (c == '{' || c == '[') {
+      if (depth >= kMaxDepth) {
+        fail("header is nested too deeply");
+      }
+      const char close = c == '{' ? '}' : ']';
+      ++pos_;
+      if (consume(close)) {
+        return;
+      }
+      do {
+        if (c == '{') {
+          parseString();
+          expect(':');
+        }
+        skipValue(depth + 1);
+      } while (consume(','));
+      expect(close);
+    } else {
+      while (pos_ < text_.size() &&
+             std::strchr(",}] \t\r\n", text_[pos_]) == nullptr) {
+        ++pos_;
+      }
+    }
+  }
+
+  void skipSpace() {
+    while (pos_ < text_.size() && std::strchr(" \t\r\n", text_[pos_])) {
+      ++pos_;
+    }
+  }
+
+  char peek() {
+    skipSpace();
+    if (pos_ >= text_.size()) {
+      fail("unexpected end of header");
+    }
+    return text_[pos_];
+  }
+
+  bool consume(char c) {
+    skipSpace();
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  void expect(char c) {
+    if (!consume(c)) {
+      fail("unexpected character in header");
+    }
+  }
+
+  [[noreturn]] void fail(const char *what) {
+    throwError(OrteafErrc::InvalidParameter,
+               "malformed safetensors file '" + path_ + "': " + what);
+  }
+
+  std::string_view text_;
+  std::size_t pos_{0};
+  const std::string &path_;
+};
+
+struct ParsedSafetensors {
+  std::shared_ptr<const MappedFile> file;
+  std::vector<WeightFileEntry> entries;
+};
+
+ParsedSafetensors parseSafetensors(const std::string &path) {
+  auto file = MappedFile::open(path);
+  std::uint64_t header_size = 0;
+  if (file->size() < sizeof(header_size)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "malformed safetensors file '" + path + "': too small");
+  }
+  std::memcpy(&header_size, file->data(), sizeof(header_size));
+  if (header_size > kMaxHeaderBytes) {
+    throwError(OrteafErrc::InvalidParameter,
+               "malformed safetensors file '" + path +
+                   "': header is larger than 100 MB");
+  }
+  if (header_size > file->size() - sizeof(header_size)) {
+    throwError(OrteafErrc::InvalidParameter,
+               "malformed safetensors file '" + path +
+                   "': header extends past the end of the file");
+  }
+  const std::uint64_t data_start = sizeof(header_size) + header_size;
+  HeaderParser parser(
+      std::string_view(
+          reinterpret_cast<const char *>(file->data() + sizeof(header_size)),
+          static_cast<std::size_t>(header_size)),
+      path);
+  auto entries = parser.parse(data_start, file->size() - data_start);
+  std::sort(entries.begin(), entries.end(),
+            [](const WeightFileEntry &a, const WeightFileEntry &b) {
+              return a.byte_offset < b.byte_offset;
+            });
+  return {std::move(file), std::move(entries)};
+}
+
+} // namespace
+
+WeightFile openSafetensors(const std::string &path) {
+  auto parsed = parseSafetensors(path);
+  for (const auto &entry : parsed.entries) {
+    if (entry.byte_offset % entry.alignment != 0) {
+      throwError(OrteafErrc::Misaligned,
+                 "safetensors tensor '" + entry.name +
+                     "' is not aligned; convert the file instead");
+    }
+  }
+  return WeightFile(std::move(parsed.file), std::move(parsed.entries));
+}
+
+void convertSafetensors(const std::string &source,
+                        const std::string &destination) {
+  auto parsed = parseSafetensors(source);
+  // Validates sizes against shapes before anything is written.
+  WeightFile validated(parsed.file, parsed.entries);
+
+  WeightFileWriter writer(destination);
+  for (const auto &entry : validated.entries()) {
+    writer.declare(entry.name, entry.dtype, entry.shape);
+  }
+  for (const auto &entry : validated.entries()) {
+    writer.append(parsed.file->data() + entry.byte_offset,
+                  static_cast<std::size_t>(entry.byte_size));
+  }
+  writer.finish();
+}
+
+} // namespace orteaf::internal::tensor::format
@@ -0,0 +1,378 @@
+#include "orteaf/internal/tensor/format/weight_file.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+
+namespace orteaf::internal::tensor::format {
+
+namespace {
+
+using ::orteaf::internal::DType;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::diagnostics::error::throwError;
+
+static_assert(std::endian::native == std::endian::little,
+              "weight files are read by reinterpreting little-endian data");
+
+constexpr char kMagic[8] = {'O', 'R', 'T', 'E', 'A', 'F', 'W', 'T'};
+constexpr std::size_t kHeaderBytes = 64;
+
+struct Header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t count;
+  std::uint64_t index_bytes;
+  std::uint64_t file_size;
+  std::byte reserved[kHeaderBytes - 32];
+};
+static_assert(sizeof(Header) == kHeaderBytes);
+
+constexpr std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+[[noreturn]] void throwMalformed(const std::string &path, const char *what) {
+  throwError(OrteafErrc::InvalidParameter,
+             "malformed weight file '" + path + "': " + what);
+}
+
+// Index bytes of an entry with an empty name, an empty dtype id and rank 0;
+// bounds how many entries an index of a given size can hold.
+constexpr std::uint64_t kMinIndexEntryBytes =
+    sizeof(std::uint32_t) + sizeof(std::uint8_t) + sizeof(std::uint32_t) +
+    2 * sizeof(std::uint64_t) + sizeof(std::uint32_t);
+
+std::uint64_t indexBytesOf(const WeightFileEntry &entry) {
+  return sizeof(std::uint32_t) + entry.name.size() + sizeof(std::uint8_t) +
+         ::orteaf::internal::idOf(entry.dtype).size() +
+         sizeof(std::uint32_t) + entry.shape.size() * sizeof(std::int64_t) +
+         2 * sizeof(std::uint64_t) + sizeof(std::uint32_t);
+}
+
+// Bounds-checked cursor over the mapped index.
+class IndexReader {
+public:
+  IndexReader(const std::byte *data, std::size_t size, const std::string &path)
+      : data_(data), size_(size), path_(path) {}
+
+  template <typename T> T read() {
+    T value{};
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  std::string_view readString(std::size_t length) {
+    return {reinterpret_cast<const char *>(take(length)), length};
+  }
+
+private:
+  const std::byte *take(std::size_t bytes) {
+    if (bytes > size_ - pos_) {
+      throwMalformed(path_, "index is truncated");
+    }
+    const std::byte *at = data_ + pos_;
+    pos_ += bytes;
+    return at;
+  }
+
+  const std::byte *data_;
+  std::size_t size_;
+  std::size_t pos_{0};
+  const std::string &path_;
+};
+
+bool dtypeFromId(std::string_view id, DType &out) {
+  for (const DType dtype : ::orteaf::internal::kAllDTypes) {
+    if (::orteaf::internal::idOf(dtype) == id) {
+      out = dtype;
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+std::int64_t WeightFileEntry::numel() const noexcept {
+  std::int64_t total = 1;
+  for (const auto dim : shape) {
+    total *= dim;
+  }
+  return total;
+}
+
+// =============================================================================
+// WeightFile
+// =============================================================================
+
+WeightFile WeightFile::open(const std::string &path) {
+  auto file = MappedFile::open(path);
+  if (file->size() < kHeaderBytes) {
+    throwMalformed(path, "file is smaller than the header");
+  }
+  Header header{};
+  std::memcpy(&header, file->data(), sizeof(header));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    throwMalformed(path, "bad magic");
+  }
+  if (header.version != kFormatVersion) {
+    throwMalformed(path, "unsupported format version");
+  }
+  if (header.file_size != file->size()) {
+    throwMalformed(path, "file size does not match the header");
+  }
+  if (header.index_bytes > file->size() - kHeaderBytes) {
+    throwMalformed(path, "index extends past the end of the file");
+  }
+  if (header.count > header.index_bytes / kMinIndexEntryBytes) {
+    throwMalformed(path, "tensor count does not fit in the index");
+  }
+
+  IndexReader reader(file->data() + kHeaderBytes,
+                     static_cast<std::size_t>(header.index_bytes), path);
+  std::vector<WeightFileEntry> entries;
+  entries.reserve(header.count);
+  for (std::uint32_t i = 0; i < header.count; ++i) {
+    WeightFileEntry entry;
+    entry.name = std::string(reader.readString(reader.read<std::uint32_t>()));
+    if (!dtypeFromId(reader.readString(reader.read<std::uint8_t>()),
+                     entry.dtype)) {
+      throwMalformed(path, "unknown dtype");
+    }
+    const auto rank = reader.read<std::uint32_t>();
+    for (std::uint32_t d = 0; d < rank; ++d) {
+      entry.shape.push_back(reader.read<std::int64_t>());
+    }
+    entry.byte_offset = reader.read<std::uint64_t>();
+    entry.byte_size = reader.read<std::uint64_t>();
+    entry.alignment = reader.read<std::uint32_t>();
+    if (entry.alignment < kPayloadAlignment ||
+        !std::has_single_bit(entry.alignment) ||
+        entry.byte_offset % entry.alignment != 0) {
+      throwMalformed(path, "payload is not aligned");
+    }
+    entries.push_back(std::move(entry));
+  }
+  return WeightFile(std::move(file), std::move(entries));
+}
+
+WeightFile::WeightFile(std::shared_ptr<const MappedFile> file,
+                       std::vector<WeightFileEntry> entries)
+    : file_(std::move(file)), entries_(std::move(entries)) {
+  if (!file_) {
+    throwError(OrteafErrc::NullPointer, "WeightFile requires a mapped file");
+  }
+  for (const auto &entry : entries_) {
+    constexpr auto kMaxBytes = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t bytes = ::orteaf::internal::sizeOf(entry.dtype);
+    for (const auto dim : entry.shape) {
+      const auto extent = static_cast<std::uint64_t>(dim);
+      if (dim < 0 || (dim != 0 && bytes > kMaxBytes / extent)) {
+        throwMalformed(file_->path(), "invalid shape");
+      }
+      bytes *= extent;
+    }
+    if (bytes != entry.byte_size) {
+      throwMalformed(file_->path(), "payload size does not match its shape");
+    }
+    if (entry.byte_offset > file_->size() ||
+        entry.byte_size > file_->size() - entry.byte_offset) {
+      throwMalformed(file_->path(), "payload extends past the end of the file");
+    }
+  }
+}
+
+const WeightFileEntry *WeightFile::find(std::string_view name) const noexcept {
+  for (const auto &entry : entries_) {
+    if (entry.name == name) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+WeightFile::LeaseVariant WeightFile::load(std::string_view name) const {
+  using TensorApi = ::orteaf::internal::tensor::api::TensorApi;
+  const auto *entry = find(name);
+  if (entry == nullptr) {
+    throwError(OrteafErrc::InvalidArgument,
+               "weight file has no tensor named '" + std::string(name) + "'");
+  }
+  const auto numel = entry->numel();
+  if (numel == 0) {
+    throwError(OrteafErrc::InvalidArgument,
+               "empty tensor '" + entry->name + "' cannot be mapped");
+  }
+  auto storage =
+      TensorApi::mapStorage(file_, static_cast<std::size_t>(entry->byte_offset),
+                            entry->dtype, static_cast<std::size_t>(numel));
+  return TensorApi::fromStorage(
+      std::move(storage),
+      std::span<const TensorApi::Dim>(entry->shape.data(),
+                                      entry->shape.size()));
+}
+
+// =============================================================================
+// WeightFileWriter
+// =============================================================================
+
+WeightFileWriter::WeightFileWriter(std::string path)
+    : path_(std::move(path)),
+      out_(path_, std::ios::binary | std::ios::trunc) {
+  if (!out_) {
+    throwError(OrteafErrc::OperationFailed,
+               "cannot create weight file '" + path_ + "'");
+  }
+}
+
+void WeightFileWriter::declare(std::string name, DType dtype,
+                               std::span<const std::int64_t> shape,
+                               std::uint32_t alignment) {
+  if (index_written_) {
+    throwError(OrteafErrc::InvalidState,
+               "WeightFileWriter cannot declare tensors after appending data");
+  }
+  if (alignment < WeightFile::kPayloadAlignment ||
+      !std::has_single_bit(alignment)) {
+    throwError(OrteafErrc::InvalidArgument,
+               "weight payload alignment must be a power of two >= 64");
+  }
+  if (std::any_of(entries_.begin(), entries_.end(),
+                  [&](const WeightFileEntry &e) { return e.name == name; })) {
+    throwError(OrteafErrc::InvalidArgument,
+               "duplicate weight tensor name '" + name + "'");
+  }
+
+  WeightFileEntry entry;
+  entry.name = std::move(name);
+  entry.dtype = dtype;
+  entry.alignment = alignment;
+  entry.byte_size = ::orteaf::internal::sizeOf(dtype);
+  for (const auto dim : shape) {
+    if (dim < 0) {
+      throwError(OrteafErrc::InvalidArgument,
+                 "weight tensor dims must be non-negative");
+    }
+    const auto extent = static_cast<std::uint64_t>(dim);
+    if (extent != 0 &&
+        entry.byte_size > std::numeric_limits<std::uint64_t>::max() / extent) {
+      throwError(OrteafErrc::InvalidArgument,
+                 "weight tensor '" + entry.name + "' byte size overflows");
+    }
+    entry.shape.push_back(dim);
+    entry.byte_size *= extent;
+  }
+  entries_.push_back(std::move(entry));
+}
+
+void WeightFileWriter::writeIndex() {
+  index_bytes_ = 0;
+  for (const auto &entry : entries_) {
+    index_bytes_ += indexBytesOf(entry);
+  }
+  std::uint64_t cursor = kHeaderBytes + index_bytes_;
+  for (auto &entry : entries_) {
+    entry.byte_offset = alignUp(cursor, entry.alignment);
+    cursor = entry.byte_offset + entry.byte_size;
+  }
+  file_size_ = alignUp(cursor, WeightFile::kPayloadAlignment);
+
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = WeightFile::kFormatVersion;
+  header.count = static_cast<std::uint32_t>(entries_.size());
+  header.index_bytes = index_bytes_;
+  header.file_size = file_size_;
+  out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  const auto put = [&](const auto &value) {
+    out_.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+  for (const auto &entry : entries_) {
+    const std::string_view id = ::orteaf::internal::idOf(entry.dtype);
+    put(static_cast<std::uint32_t>(entry.name.size()));
+    out_.write(entry.name.data(),
+               static_cast<std::streamsize>(entry.name.size()));
+    put(static_cast<std::uint8_t>(id.size()));
+    out_.write(id.data(), static_cast<std::streamsize>(id.size()));
+    put(static_cast<std::uint32_t>(entry.shape.size()));
+    for (const auto dim : entry.shape) {
+      put(dim);
+    }
+    put(entry.byte_offset);
+    put(entry.byte_size);
+    put(entry.alignment);
+  }
+  position_ = kHeaderBytes + index_bytes_;
+  index_written_ = true;
+}
+
+void WeightFileWriter::padTo(std::uint64_t offset) {
+  static constexpr char kZeros[WeightFile::kPayloadAlignment] = {};
+  while (position_ < offset) {
+    const auto n = std::min<std::uint64_t>(offset - position_, sizeof(kZeros));
+    out_.write(kZeros, static_cast<std::streamsize>(n));
+    position_ += n;
+  }
+}
+
+void WeightFileWriter::append(const void *data, std::size_t size) {
+  if (finished_) {
+    throwError(OrteafErrc::InvalidState, "WeightFileWriter is finished");
+  }
+  if (!index_written_) {
+    writeIndex();
+  }
+  const auto *bytes = static_cast<const char *>(data);
+  while (size > 0) {
+    while (current_ < entries_.size() &&
+           position_ == entries_[current_].byte_offset +
+                            entries_[current_].byte_size &&
+           position_ >= entries_[current_].byte_offset) {
+      ++current_;
+    }
+    if (current_ == entries_.size()) {
+      throwError(OrteafErrc::OutOfRange,
+                 "more weight bytes appended than declared");
+    }
+    const auto &entry = entries_[current_];
+    padTo(entry.byte_offset);
+    const auto n = std::min<std::uint64_t>(
+        size, entry.byte_offset + entry.byte_size - position_);
+    out_.write(bytes, static_cast<std::streamsize>(n));
+    bytes += n;
+    size -= static_cast<std::size_t>(n);
+    position_ += n;
+  }
+}
+
+void WeightFileWriter::finish() {
+  if (finished_) {
+    return;
+  }
+  if (!index_written_) {
+    writeIndex();
+  }
+  for (std::size_t i = current_; i < entries_.size(); ++i) {
+    const auto &entry = entries_[i];
+    if (entry.byte_size != 0 &&
+        position_ < entry.byte_offset + entry.byte_size) {
+      throwError(OrteafErrc::InvalidState,
+                 "weight tensor '" + entry.name + "' is missing payload bytes");
+    }
+  }
+  padTo(file_size_);
+  out_.close();
+  if (out_.fail()) {
+    throwError(OrteafErrc::OperationFailed,
+               "failed to write weight file '" + path_ + "'");
+  }
+  finished_ = true;
+}
+
+} // namespace orteaf::internal::tensor::format
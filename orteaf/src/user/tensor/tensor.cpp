@@ -172,4 +172,14 @@ Tensor Tensor::unsqueeze(std::size_t dim) const {
   return result;
 }
 
+// ===== Materialization =====
+
+Tensor Tensor::contiguous() const {
+  ensureValid(*this);
+  auto new_impl = TensorApi::contiguous(impl_);
+  Tensor result;
+  result.impl_ = std::move(new_impl);
+  return result;
+}
+
 } // namespace orteaf::user::tensor
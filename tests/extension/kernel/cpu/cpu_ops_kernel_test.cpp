@@ -0,0 +1,743 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <variant>
+#include <vector>
+
+#include "orteaf/extension/kernel/cpu/cpu_kernel_registration.h"
+#include "orteaf/extension/kernel/cpu/ops/add_kernel.h"
+#include "orteaf/extension/kernel/cpu/ops/fused_elementwise_kernel.h"
+#include "orteaf/extension/kernel/cpu/ops/matmul_kernel.h"
+#include "orteaf/extension/kernel/cpu/ops/relu_kernel.h"
+#include "orteaf/internal/architecture/architecture.h"
+#include "orteaf/internal/dtype/float16.h"
+#include "orteaf/internal/execution/cpu/api/cpu_execution_api.h"
+#include "orteaf/internal/execution/cpu/platform/cpu_slow_ops.h"
+#include "orteaf/internal/execution_context/cpu/current_context.h"
+#include "orteaf/internal/kernel/autotune/kernel_autotuner.h"
+#include "orteaf/internal/kernel/core/bound_launch.h"
+#include "orteaf/internal/kernel/core/context_any.h"
+#include "orteaf/internal/kernel/core/kernel_args.h"
+#include "orteaf/internal/kernel/core/key_resolver.h"
+#include "orteaf/internal/kernel/cpu/cpu_bound_launch.h"
+#include "orteaf/internal/kernel/profile/kernel_profiler.h"
+#include "orteaf/internal/kernel/registry/kernel_registry.h"
+#include "orteaf/internal/tensor/api/tensor_api.h"
+
+namespace architecture = ::orteaf::internal::architecture;
+namespace cpu = ::orteaf::internal::execution::cpu;
+namespace cpu_api = ::orteaf::internal::execution::cpu::api;
+namespace cpu_context = ::orteaf::internal::execution_context::cpu;
+namespace cpu_ops = ::orteaf::extension::kernel::cpu::ops;
+namespace cpu_platform = ::orteaf::internal::execution::cpu::platform;
+namespace cpu_registration = ::orteaf::extension::kernel::cpu;
+namespace kernel = ::orteaf::internal::kernel;
+namespace tensor_api = ::orteaf::internal::tensor::api;
+using Architecture = architecture::Architecture;
+using DenseTensorImpl = ::orteaf::extension::tensor::DenseTensorImpl;
+using DType = ::orteaf::internal::DType;
+using Execution = ::orteaf::internal::execution::Execution;
+
+namespace {
+
+namespace fused = ::orteaf::internal::kernel::cpu;
+
+/// relu(Input0 + Input1) + Input2.
+constexpr auto kAddReluAdd = fused::makeFusedExpression(
+    fused::fusedAdd(fused::fusedInput(0), fused::fusedInput(1)),
+    fused::fusedRelu(fused::fusedResult(0)),
+    fused::fusedAdd(fused::fusedResult(1), fused::fusedInput(2)));
+
+/// Real host allocation with a fixed reported architecture.
+class FixedArchSlowOps final : public cpu_platform::CpuSlowOps {
+public:
+  explicit FixedArchSlowOps(Architecture arch) : arch_(arch) {}
+
+  int getDeviceCount() override { return 1; }
+  Architecture detectArchitecture(cpu::CpuDeviceHandle) override {
+    return arch_;
+  }
+  void *allocBuffer(std::size_t size, std::size_t alignment) override {
+    return impl_.allocBuffer(size, alignment);
+  }
+  void deallocBuffer(void *ptr, std::size_t size) override {
+    impl_.deallocBuffer(ptr, size);
+  }
+
+private:
+  Architecture arch_;
+  cpu_platform::CpuSlowOpsImpl impl_{};
+};
+
+using TensorLease = decltype(tensor_api::TensorApi::create<DenseTensorImpl>(
+    std::span<const std::int64_t>{}, DType::F32, Execution::Cpu));
+
+class CpuOpsKernelTest : public ::testing::TestWithParam<Architecture> {
+protected:
+  void SetUp() override {
+    cpu_api::CpuExecutionApi::ExecutionManager::Config cpu_config{};
+    cpu_config.slow_ops = new FixedArchSlowOps(GetParam());
+    cpu_api::CpuExecutionApi::configure(cpu_config);
+    cpu_context::reset();
+    tensor_api::TensorApi::configure({});
+  }
+
+  void TearDown() override {
+    tensor_api::TensorApi::shutdown();
+    cpu_context::reset();
+    cpu_api::CpuExecutionApi::shutdown();
+  }
+
+  static TensorLease makeTensor(std::vector<std::int64_t> shape,
+                                DType dtype = DType::F32) {
+    return tensor_api::TensorApi::create<DenseTensorImpl>(shape, dtype,
+                                                          Execution::Cpu);
+  }
+
+  template <typename T> static T *dataOf(const TensorLease &tensor) {
+    using CpuStorageLease = ::orteaf::internal::storage::CpuStorageLease;
+    const auto *lease = tensor->storageLease().tryAs<CpuStorageLease>();
+    EXPECT_NE(lease, nullptr);
+    return static_cast<T *>((*lease)->data()) + tensor->offset();
+  }
+
+  template <typename T>
+  static void fill(const TensorLease &tensor, const std::vector<T> &values) {
+    auto *data = dataOf<T>(tensor);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      data[i] = values[i];
+    }
+  }
+
+  static kernel::KernelArgs makeArgs() {
+    return kernel::KernelArgs(
+        kernel::ContextAny::erase(cpu_context::currentContext()));
+  }
+
+  static kernel::core::KernelEntry::CpuKernelBaseLease kernelBase() {
+    return cpu_api::CpuExecutionApi::acquireKernelBase(GetParam());
+  }
+};
+
+TEST_P(CpuOpsKernelTest, AddBroadcastsWithAlpha) {
+  auto lhs = makeTensor({2, 3});
+  auto rhs = makeTensor({3});
+  auto out = makeTensor({2, 3});
+  fill<float>(lhs, {1, 2, 3, 4, 5, 6});
+  fill<float>(rhs, {10, 20, 30});
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+  args.addParam(kernel::Param(kernel::ParamId::Alpha, 0.5f));
+
+  auto entry = cpu_ops::createAddKernel(kernelBase());
+  entry.run(args);
+
+  const std::array<float, 6> expected{6, 12, 18, 9, 15, 21};
+  const float *result = dataOf<float>(out);
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(result[i], expected[i]) << "i=" << i;
+  }
+}
+
+TEST_P(CpuOpsKernelTest, AddReadsPackedParams) {
+  auto lhs = makeTensor({2, 3});
+  auto rhs = makeTensor({3});
+  auto out = makeTensor({2, 3});
+  fill<float>(lhs, {1, 2, 3, 4, 5, 6});
+  fill<float>(rhs, {10, 20, 30});
+
+  // Storages only; every parameter comes from the packed schema.
+  auto args = makeArgs();
+  args.addStorage(kernel::OperandId::Input0, lhs->storageLease());
+  args.addStorage(kernel::OperandId::Input1, rhs->storageLease());
+  args.addStorage(kernel::OperandId::Output, out->storageLease());
+
+  const auto view = [](const auto &dims) {
+    return kernel::cpu::CpuLayoutFields<kernel::OperandId::Input0>::View(
+        dims.data(), dims.size());
+  };
+  cpu_ops::AddParams params;
+  params.lhs.assign(view(lhs->shape()), view(lhs->strides()), lhs->offset());
+  params.rhs.assign(view(rhs->shape()), view(rhs->strides()), rhs->offset());
+  params.output.assign(view(out->shape()), view(out->strides()),
+                       out->offset());
+  params.alpha.set(0.5f);
+  args.setPackedParams(params);
+  ASSERT_EQ(args.paramList().size(), 0u);
+
+  auto entry = cpu_ops::createAddKernel(kernelBase());
+  entry.run(args);
+
+  const std::array<float, 6> expected{6, 12, 18, 9, 15, 21};
+  const float *result = dataOf<float>(out);
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(result[i], expected[i]) << "i=" << i;
+  }
+}
+
+TEST_P(CpuOpsKernelTest, AddReadsTransposedInput) {
+  auto lhs = makeTensor({3, 40});
+  auto rhs = makeTensor({40, 3});
+  auto out = makeTensor({3, 40});
+  std::vector<float> lhs_values(120), rhs_values(120);
+  for (std::size_t i = 0; i < 120; ++i) {
+    lhs_values[i] = static_cast<float>(i);
+    rhs_values[i] = static_cast<float>(1000 + i);
+  }
+  fill(lhs, lhs_values);
+  fill(rhs, rhs_values);
+
+  std::array<std::size_t, 2> perm{1, 0};
+  auto rhs_t = std::get<TensorLease>(
+      tensor_api::TensorApi::transpose(rhs, perm));
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs_t->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  auto entry = cpu_ops::createAddKernel(kernelBase());
+  entry.run(args);
+
+  const float *result = dataOf<float>(out);
+  for (std::size_t r = 0; r < 3; ++r) {
+    for (std::size_t c = 0; c < 40; ++c) {
+      EXPECT_FLOAT_EQ(result[r * 40 + c],
+                      lhs_values[r * 40 + c] + rhs_values[c * 3 + r]);
+    }
+  }
+}
+
+TEST_P(CpuOpsKernelTest, AddSupportsF16AndI32) {
+  auto lhs_h = makeTensor({20}, DType::F16);
+  auto rhs_h = makeTensor({20}, DType::F16);
+  auto out_h = makeTensor({20}, DType::F16);
+  auto lhs_i = makeTensor({20}, DType::I32);
+  auto rhs_i = makeTensor({20}, DType::I32);
+  auto out_i = makeTensor({20}, DType::I32);
+  for (int i = 0; i < 20; ++i) {
+    dataOf<std::uint16_t>(lhs_h)[i] =
+        ::orteaf::internal::detail::float32ToHalfBits(static_cast<float>(i));
+    dataOf<std::uint16_t>(rhs_h)[i] =
+        ::orteaf::internal::detail::float32ToHalfBits(0.5f);
+    dataOf<std::int32_t>(lhs_i)[i] = i;
+    dataOf<std::int32_t>(rhs_i)[i] = -i;
+  }
+
+  auto entry = cpu_ops::createAddKernel(kernelBase());
+  auto args_h = makeArgs();
+  lhs_h->bindAllArgs(args_h, kernel::OperandId::Input0);
+  rhs_h->bindAllArgs(args_h, kernel::OperandId::Input1);
+  out_h->bindAllArgs(args_h, kernel::OperandId::Output);
+  entry.run(args_h);
+
+  auto args_i = makeArgs();
+  lhs_i->bindAllArgs(args_i, kernel::OperandId::Input0);
+  rhs_i->bindAllArgs(args_i, kernel::OperandId::Input1);
+  out_i->bindAllArgs(args_i, kernel::OperandId::Output);
+  args_i.addParam(kernel::Param(kernel::ParamId::Alpha, 2.0f));
+  entry.run(args_i);
+
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_FLOAT_EQ(::orteaf::internal::detail::halfBitsToFloat32(
+                        dataOf<std::uint16_t>(out_h)[i]),
+                    static_cast<float>(i) + 0.5f);
+    EXPECT_EQ(dataOf<std::int32_t>(out_i)[i], -i);
+  }
+}
+
+TEST_P(CpuOpsKernelTest, AddRejectsNonIntegralAlphaForI32) {
+  auto lhs = makeTensor({4}, DType::I32);
+  auto rhs = makeTensor({4}, DType::I32);
+  auto out = makeTensor({4}, DType::I32);
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+  args.addParam(kernel::Param(kernel::ParamId::Alpha, 0.5f));
+
+  auto entry = cpu_ops::createAddKernel(kernelBase());
+  EXPECT_THROW(entry.run(args), std::system_error);
+}
+
+TEST_P(CpuOpsKernelTest, AddRejectsMismatchedShapes) {
+  auto lhs = makeTensor({2, 3});
+  auto rhs = makeTensor({4});
+  auto out = makeTensor({2, 3});
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  auto entry = cpu_ops::createAddKernel(kernelBase());
+  EXPECT_THROW(entry.run(args), std::system_error);
+}
+
+TEST_P(CpuOpsKernelTest, ReluClampsNegatives) {
+  auto in = makeTensor({5, 7});
+  auto out = makeTensor({5, 7});
+  std::vector<float> values(35);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<float>(i) - 17.0f;
+  }
+  fill(in, values);
+
+  auto args = makeArgs();
+  in->bindAllArgs(args, kernel::OperandId::Input0);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  auto entry = cpu_ops::createReluKernel(kernelBase());
+  entry.run(args);
+
+  const float *result = dataOf<float>(out);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_FLOAT_EQ(result[i], values[i] < 0 ? 0.0f : values[i]);
+  }
+}
+
+TEST_P(CpuOpsKernelTest, MatMulBatchedWithTransposedRhsAndBias) {
+  constexpr std::int64_t kBatch = 2, kM = 3, kK = 5, kN = 17;
+  auto lhs = makeTensor({kBatch, kM, kK});
+  auto rhs_storage = makeTensor({kN, kK});
+  auto bias = makeTensor({kN});
+  auto out = makeTensor({kBatch, kM, kN});
+
+  std::vector<float> lhs_values(kBatch * kM * kK), rhs_values(kN * kK),
+      bias_values(kN);
+  for (std::size_t i = 0; i < lhs_values.size(); ++i) {
+    lhs_values[i] = static_cast<float>(static_cast<int>(i % 7) - 3);
+  }
+  for (std::size_t i = 0; i < rhs_values.size(); ++i) {
+    rhs_values[i] = static_cast<float>(static_cast<int>(i % 5) - 2) * 0.5f;
+  }
+  for (std::size_t i = 0; i < bias_values.size(); ++i) {
+    bias_values[i] = static_cast<float>(i);
+  }
+  fill(lhs, lhs_values);
+  fill(rhs_storage, rhs_values);
+  fill(bias, bias_values);
+
+  // rhs is [K, N] viewed through a transpose of an [N, K] buffer; the batch
+  // dimension broadcasts.
+  std::array<std::size_t, 2> perm{1, 0};
+  auto rhs = std::get<TensorLease>(
+      tensor_api::TensorApi::transpose(rhs_storage, perm));
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  bias->bindAllArgs(args, kernel::OperandId::Input2);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  auto entry = cpu_ops::createMatMulKernel(kernelBase());
+  entry.run(args);
+
+  const float *result = dataOf<float>(out);
+  for (std::int64_t b = 0; b < kBatch; ++b) {
+    for (std::int64_t m = 0; m < kM; ++m) {
+      for (std::int64_t n = 0; n < kN; ++n) {
+        float expected = bias_values[n];
+        for (std::int64_t k = 0; k < kK; ++k) {
+          expected += lhs_values[(b * kM + m) * kK + k] *
+                      rhs_values[n * kK + k];
+        }
+        EXPECT_FLOAT_EQ(result[(b * kM + m) * kN + n], expected)
+            << "b=" << b << " m=" << m << " n=" << n;
+      }
+    }
+  }
+}
+
+TEST_P(CpuOpsKernelTest, MatMulF16AccumulatesInF32) {
+  constexpr std::int64_t kM = 2, kK = 9, kN = 20;
+  auto lhs = makeTensor({kM, kK}, DType::F16);
+  auto rhs = makeTensor({kK, kN}, DType::F16);
+  auto out = makeTensor({kM, kN}, DType::F16);
+  for (std::int64_t i = 0; i < kM * kK; ++i) {
+    dataOf<std::uint16_t>(lhs)[i] =
+        ::orteaf::internal::detail::float32ToHalfBits(1.0f);
+  }
+  for (std::int64_t i = 0; i < kK * kN; ++i) {
+    dataOf<std::uint16_t>(rhs)[i] =
+        ::orteaf::internal::detail::float32ToHalfBits(
+            static_cast<float>(i % kN) * 0.25f);
+  }
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  auto entry = cpu_ops::createMatMulKernel(kernelBase());
+  entry.run(args);
+
+  for (std::int64_t m = 0; m < kM; ++m) {
+    for (std::int64_t n = 0; n < kN; ++n) {
+      EXPECT_FLOAT_EQ(::orteaf::internal::detail::halfBitsToFloat32(
+                          dataOf<std::uint16_t>(out)[m * kN + n]),
+                      static_cast<float>(kK) * static_cast<float>(n) * 0.25f);
+    }
+  }
+}
+
+TEST_P(CpuOpsKernelTest, RegisteredKernelsResolveForDeviceArchitecture) {
+  kernel::registry::KernelRegistry registry;
+  cpu_registration::registerCpuKernels(registry);
+
+  auto lhs = makeTensor({4});
+  auto rhs = makeTensor({4});
+  auto out = makeTensor({4});
+  fill<float>(lhs, {1, -2, 3, -4});
+  fill<float>(rhs, {1, 1, 1, 1});
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  const kernel::KeyRequest request{::orteaf::internal::ops::Op::Add,
+                                   DType::F32, GetParam()};
+  auto key = kernel::key_resolver::resolve(registry, request, args);
+  ASSERT_TRUE(key.has_value());
+  EXPECT_EQ(kernel::kernel_key::getArchitecture(*key), GetParam());
+
+  auto *entry = registry.lookup(*key);
+  ASSERT_NE(entry, nullptr);
+  entry->run(args);
+
+  const std::array<float, 4> expected{2, -1, 4, -3};
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(dataOf<float>(out)[i], expected[i]);
+  }
+
+  const kernel::KeyRequest matmul_i32{::orteaf::internal::ops::Op::MatMul,
+                                      DType::I32, GetParam()};
+  EXPECT_FALSE(
+      kernel::key_resolver::resolve(registry, matmul_i32, args).has_value());
+
+  // Relu is floating-point only (configs/ops/ops.yml); Add also takes I32.
+  const auto keyFor = [&](::orteaf::internal::ops::Op op, DType dtype) {
+    return kernel::kernel_key::make(op, GetParam(), kernel::Layout{0}, dtype,
+                                    kernel::variant::kDefault);
+  };
+  EXPECT_NE(registry.lookup(keyFor(::orteaf::internal::ops::Op::Relu,
+                                   DType::F16)),
+            nullptr);
+  EXPECT_EQ(registry.lookup(keyFor(::orteaf::internal::ops::Op::Relu,
+                                   DType::I32)),
+            nullptr);
+  EXPECT_NE(registry.lookup(keyFor(::orteaf::internal::ops::Op::Add,
+                                   DType::I32)),
+            nullptr);
+}
+
+TEST_P(CpuOpsKernelTest, BoundLaunchReplaysWithPatchedStorage) {
+  kernel::registry::KernelRegistry registry;
+  cpu_registration::registerCpuKernels(registry);
+
+  auto lhs = makeTensor({2, 3});
+  auto rhs = makeTensor({3});
+  auto out = makeTensor({2, 3});
+  fill<float>(lhs, {1, 2, 3, 4, 5, 6});
+  fill<float>(rhs, {10, 20, 30});
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  const kernel::KeyRequest request{::orteaf::internal::ops::Op::Add,
+                                   DType::F32, GetParam()};
+  auto launch =
+      kernel::core::BoundLaunch::resolve(registry, request, std::move(args));
+  ASSERT_TRUE(launch.valid());
+
+  // Shape params are owned by the bound launch, not the source layout.
+  const auto *shape = launch.args().findParam(kernel::ParamKey::scoped(
+      kernel::ParamId::Shape,
+      kernel::makeOperandKey(kernel::OperandId::Input0)));
+  ASSERT_NE(shape, nullptr);
+  const auto *view = shape->tryGet<
+      ::orteaf::internal::base::ArrayView<const std::int64_t>>();
+  ASSERT_NE(view, nullptr);
+  EXPECT_NE(view->data, lhs->shape().data());
+  EXPECT_EQ(view->count, 2u);
+
+  // Packing reads the owned arrays once; replays skip the ParamList search.
+  launch.packParams<cpu_ops::AddParams>();
+  const auto *packed = launch.args().packedParams<cpu_ops::AddParams>();
+  ASSERT_NE(packed, nullptr);
+  EXPECT_EQ(packed->lhs.shape.value.data, view->data);
+
+  launch.run();
+  EXPECT_FLOAT_EQ(dataOf<float>(out)[5], 36.0f);
+
+  auto lhs2 = makeTensor({2, 3});
+  auto out2 = makeTensor({2, 3});
+  fill<float>(lhs2, {100, 200, 300, 400, 500, 600});
+  launch.setStorage(launch.storageSlot(kernel::OperandId::Input0),
+                    lhs2->storageLease());
+  launch.setStorage(launch.storageSlot(kernel::OperandId::Output),
+                    out2->storageLease());
+  launch.run();
+
+  const std::array<float, 6> expected{110, 220, 330, 410, 520, 630};
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(dataOf<float>(out2)[i], expected[i]) << "i=" << i;
+  }
+  EXPECT_FLOAT_EQ(dataOf<float>(out)[5], 36.0f);
+  EXPECT_EQ(launch.launchCount(), 2u);
+
+  EXPECT_THROW(launch.storageSlot(kernel::OperandId::Input2),
+               std::system_error);
+  EXPECT_THROW(launch.setStorage(3, lhs2->storageLease()), std::system_error);
+}
+
+TEST_P(CpuOpsKernelTest, BoundLaunchRejectsStorageThatDoesNotFit) {
+  kernel::registry::KernelRegistry registry;
+  cpu_registration::registerCpuKernels(registry);
+
+  auto lhs = makeTensor({2, 3});
+  auto rhs = makeTensor({3});
+  auto out = makeTensor({2, 3});
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  const kernel::KeyRequest request{::orteaf::internal::ops::Op::Add,
+                                   DType::F32, GetParam()};
+  auto launch =
+      kernel::core::BoundLaunch::resolve(registry, request, std::move(args));
+  const auto slot = launch.storageSlot(kernel::OperandId::Input0);
+
+  EXPECT_THROW(launch.setStorage(slot, {}), std::system_error);
+  EXPECT_THROW(launch.setStorage(slot, makeTensor({2, 3}, DType::I32)
+                                           ->storageLease()),
+               std::system_error);
+  EXPECT_THROW(launch.setStorage(slot, makeTensor({5})->storageLease()),
+               std::system_error);
+
+  // A larger storage of the same dtype fits the captured layout.
+  auto bigger = makeTensor({8});
+  EXPECT_NO_THROW(launch.setStorage(slot, bigger->storageLease()));
+}
+
+TEST_P(CpuOpsKernelTest, BoundLaunchEnqueuesSnapshots) {
+  kernel::registry::KernelRegistry registry;
+  cpu_registration::registerCpuKernels(registry);
+
+  auto lhs = makeTensor({4});
+  auto rhs = makeTensor({4});
+  auto out = makeTensor({4});
+  fill<float>(lhs, {1, 2, 3, 4});
+  fill<float>(rhs, {10, 10, 10, 10});
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  const kernel::KeyRequest request{::orteaf::internal::ops::Op::Add,
+                                   DType::F32, GetParam()};
+  auto launch =
+      kernel::core::BoundLaunch::resolve(registry, request, std::move(args));
+  launch.packParams<cpu_ops::AddParams>();
+  auto queue = cpu_api::CpuExecutionApi::commandQueue(cpu::CpuDeviceHandle{0});
+
+  const auto first = kernel::cpu::enqueue(launch, *queue);
+  // Rebinding right away only affects the next launch.
+  auto out2 = makeTensor({4});
+  launch.setStorage(launch.storageSlot(kernel::OperandId::Output),
+                    out2->storageLease());
+  const auto second = kernel::cpu::enqueue(launch, *queue);
+  EXPECT_LT(first.epoch, second.epoch);
+  EXPECT_EQ(launch.launchCount(), 2u);
+  // Snapshots own their packed views; the source launch may go away.
+  launch = kernel::core::BoundLaunch{};
+
+  // The queued launches keep the output storages alive on their own.
+  out = TensorLease{};
+  queue->synchronize();
+  EXPECT_TRUE(first.isCompleted());
+  EXPECT_TRUE(second.isCompleted());
+  EXPECT_EQ(queue->retainedCount(), 0u);
+
+  const std::array<float, 4> expected{11, 12, 13, 14};
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(dataOf<float>(out2)[i], expected[i]) << "i=" << i;
+  }
+
+  kernel::core::BoundLaunch unbound;
+  EXPECT_THROW(kernel::cpu::enqueue(unbound, *queue), std::system_error);
+}
+
+TEST_P(CpuOpsKernelTest, ProfilerRecordsRegisteredKernelLaunches) {
+  kernel::registry::KernelRegistry registry;
+  cpu_registration::registerCpuKernels(registry);
+
+  auto lhs = makeTensor({4});
+  auto rhs = makeTensor({4});
+  auto out = makeTensor({4});
+  fill<float>(lhs, {1, 2, 3, 4});
+  fill<float>(rhs, {1, 1, 1, 1});
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  const kernel::KeyRequest request{::orteaf::internal::ops::Op::Add,
+                                   DType::F32, GetParam()};
+  auto key = kernel::key_resolver::resolve(registry, request, args);
+  ASSERT_TRUE(key.has_value());
+  auto *entry = registry.lookup(*key);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->key(), *key);
+
+  kernel::profile::KernelProfiler profiler;
+  kernel::profile::KernelProfiler::install(&profiler);
+  entry->run(args);
+  entry->run(args);
+  kernel::profile::KernelProfiler::install(nullptr);
+  entry->run(args);
+
+  auto recorded = profiler.find(*key);
+  ASSERT_TRUE(recorded.has_value());
+  EXPECT_EQ(recorded->total.calls, 2u);
+  EXPECT_EQ(recorded->by_size[kernel::profile::sizeBucketOf(4)].calls, 2u);
+}
+
+TEST_P(CpuOpsKernelTest, FusedAddReluAddRunsInOneKernel) {
+  auto a = makeTensor({2, 3});
+  auto b = makeTensor({3});
+  auto c = makeTensor({2, 1});
+  auto out = makeTensor({2, 3});
+  fill<float>(a, {1, -2, 3, -4, 5, -6});
+  fill<float>(b, {-1, 0, 1});
+  fill<float>(c, {10, 100});
+
+  auto args = makeArgs();
+  a->bindAllArgs(args, kernel::OperandId::Input0);
+  b->bindAllArgs(args, kernel::OperandId::Input1);
+  c->bindAllArgs(args, kernel::OperandId::Input2);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  auto entry = cpu_ops::createFusedElementwiseKernel<kAddReluAdd>(kernelBase());
+  entry.run(args);
+
+  const std::array<float, 6> expected{10, 10, 14, 100, 105, 100};
+  const float *result = dataOf<float>(out);
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(result[i], expected[i]) << "i=" << i;
+  }
+}
+
+TEST_P(CpuOpsKernelTest, FusedKernelsRegisterUnderDedicatedVariant) {
+  kernel::registry::KernelRegistry registry;
+  cpu_registration::registerCpuKernels(registry);
+  cpu_ops::registerFusedElementwiseKernel<kAddReluAdd>(registry, 0);
+
+  auto a = makeTensor({4});
+  auto b = makeTensor({4});
+  auto c = makeTensor({4});
+  auto out = makeTensor({4});
+  fill<float>(a, {1, -2, 3, -4});
+  fill<float>(b, {1, 1, 1, 1});
+  fill<float>(c, {5, 5, 5, 5});
+
+  auto args = makeArgs();
+  a->bindAllArgs(args, kernel::OperandId::Input0);
+  b->bindAllArgs(args, kernel::OperandId::Input1);
+  c->bindAllArgs(args, kernel::OperandId::Input2);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  // The default variant still resolves to the plain Add kernel.
+  const kernel::KeyRequest request{::orteaf::internal::ops::Op::Add,
+                                   DType::F32, GetParam()};
+  auto resolved = kernel::key_resolver::resolve(registry, request, args);
+  ASSERT_TRUE(resolved.has_value());
+  EXPECT_EQ(kernel::kernel_key::getVariant(*resolved),
+            kernel::variant::kDefault);
+
+  const auto fused_key = kernel::kernel_key::make(
+      ::orteaf::internal::ops::Op::Add, GetParam(), kernel::Layout{0},
+      DType::F32, kernel::variant::fusedElementwise(0));
+  EXPECT_NE(fused_key, *resolved);
+  auto *entry = registry.lookup(fused_key);
+  ASSERT_NE(entry, nullptr);
+  entry->run(args);
+
+  const std::array<float, 4> expected{7, 5, 9, 5};
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(dataOf<float>(out)[i], expected[i]);
+  }
+  EXPECT_EQ(registry.lookup(kernel::kernel_key::make(
+                ::orteaf::internal::ops::Op::Add, GetParam(),
+                kernel::Layout{0}, DType::F32,
+                kernel::variant::fusedElementwise(1))),
+            nullptr);
+}
+
+TEST_P(CpuOpsKernelTest, AutotunerTimesSerialVariantOnScratchOutputs) {
+  kernel::registry::KernelRegistry registry;
+  cpu_registration::registerCpuKernels(registry);
+
+  auto lhs = makeTensor({4});
+  auto rhs = makeTensor({4});
+  auto out = makeTensor({4});
+  fill<float>(lhs, {1, -2, 3, -4});
+  fill<float>(rhs, {1, 1, 1, 1});
+  fill<float>(out, {-7, -7, -7, -7});
+
+  auto args = makeArgs();
+  lhs->bindAllArgs(args, kernel::OperandId::Input0);
+  rhs->bindAllArgs(args, kernel::OperandId::Input1);
+  out->bindAllArgs(args, kernel::OperandId::Output);
+
+  kernel::autotune::KernelAutotuner::Config config{};
+  config.repetitions = 1;
+  config.scratch = &tensor_api::TensorApi::cloneStorage;
+  kernel::autotune::KernelAutotuner tuner(config);
+  const kernel::KeyRequest request{::orteaf::internal::ops::Op::Add,
+                                   DType::F32, GetParam()};
+  const std::array<std::int64_t, 1> shape{4};
+  auto chosen = tuner.select(registry, request, args,
+                             kernel::autotune::shapeBucket(shape));
+  ASSERT_TRUE(chosen.has_value());
+  EXPECT_EQ(tuner.stats().candidates_timed, 2u);
+  const auto variant = kernel::kernel_key::getVariant(*chosen);
+  EXPECT_TRUE(variant == kernel::variant::kDefault ||
+              variant == cpu_registration::kSerialVariant);
+  // Timing ran on scratch copies; the caller's output is untouched.
+  for (std::size_t i = 0; i < 4; ++i) {
+    EXPECT_FLOAT_EQ(dataOf<float>(out)[i], -7.0f);
+  }
+
+  auto *serial = registry.lookup(kernel::kernel_key::make(
+      ::orteaf::internal::ops::Op::Add, GetParam(), kernel::Layout{0},
+      DType::F32, cpu_registration::kSerialVariant));
+  ASSERT_NE(serial, nullptr);
+  serial->run(args);
+  const std::array<float, 4> expected{2, -1, 4, -3};
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(dataOf<float>(out)[i], expected[i]);
+  }
+  // The worker pool is restored after the serial run.
+  EXPECT_NE(args.context().tryAs<cpu_context::Context>()->thread_pool,
+            nullptr);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CpuArchitectures, CpuOpsKernelTest,
+    ::testing::Values(Architecture::CpuGeneric,
+                      Architecture::CpuIntelCometLake,
+                      Architecture::CpuSkylake, Architecture::CpuZen4));
+
+} // namespace
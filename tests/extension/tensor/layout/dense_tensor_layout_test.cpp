@@ -195,6 +195,41 @@ TEST(DenseTensorLayoutTest, ReshapeRejectsInvalidRequests) {
               [&]() { (void)non_contiguous.reshape(reshape_one); });
 }
 
+TEST(DenseTensorLayoutTest, TryReshapeViewsStridedLayouts) {
+  const std::array<Layout::Dim, 2> shape{4, 6};
+  Layout layout = Layout::contiguous(shape);
+
+  // Columns 0 and 2 of every row: splitting the rows stays a view.
+  const std::array<Layout::Dim, 2> starts{0, 0};
+  const std::array<Layout::Dim, 2> sizes{4, 2};
+  const std::array<Layout::Dim, 2> steps{1, 2};
+  Layout strided = layout.slice(starts, sizes, steps);
+  ASSERT_FALSE(strided.isContiguous());
+
+  const std::array<Layout::Dim, 3> split{2, 2, 2};
+  auto view = strided.tryReshape(split);
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(view->strides()[0], 12);
+  EXPECT_EQ(view->strides()[1], 6);
+  EXPECT_EQ(view->strides()[2], 2);
+
+  // Merging rows with the strided columns needs a copy.
+  const std::array<Layout::Dim, 1> flat{8};
+  EXPECT_FALSE(strided.tryReshape(flat).has_value());
+  ExpectError(Errc::InvalidState, [&]() { (void)strided.reshape(flat); });
+
+  const std::array<std::size_t, 2> perm{1, 0};
+  Layout transposed = layout.transpose(perm);
+  const std::array<Layout::Dim, 1> flat_all{24};
+  EXPECT_FALSE(transposed.tryReshape(flat_all).has_value());
+  const std::array<Layout::Dim, 3> split_outer{2, 3, 4};
+  auto outer_view = transposed.tryReshape(split_outer);
+  ASSERT_TRUE(outer_view.has_value());
+  EXPECT_EQ(outer_view->strides()[0], 3);
+  EXPECT_EQ(outer_view->strides()[1], 1);
+  EXPECT_EQ(outer_view->strides()[2], 6);
+}
+
 TEST(DenseTensorLayoutTest, ReshapeHandlesZero) {
   const std::array<Layout::Dim, 2> shape{0, 3};
   Layout layout = Layout::contiguous(shape);
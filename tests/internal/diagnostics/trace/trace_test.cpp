@@ -0,0 +1,168 @@
+#include "orteaf/internal/diagnostics/trace/trace.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace trace = orteaf::internal::diagnostics::trace;
+
+namespace {
+
+class DiagnosticsTrace : public ::testing::Test {
+protected:
+  void SetUp() override {
+    trace::TraceRecorder::stop();
+    trace::TraceRecorder::clear();
+  }
+
+  void TearDown() override {
+    trace::TraceRecorder::stop();
+    trace::TraceRecorder::clear();
+  }
+};
+
+std::vector<trace::TraceEvent> eventsNamed(const char *name) {
+  std::vector<trace::TraceEvent> all;
+  trace::TraceRecorder::flush(all);
+  std::vector<trace::TraceEvent> matching;
+  for (const auto &event : all) {
+    if (std::strcmp(event.name, name) == 0) {
+      matching.push_back(event);
+    }
+  }
+  return matching;
+}
+
+} // namespace
+
+TEST_F(DiagnosticsTrace, SpanIsIgnoredWhileStopped) {
+  { trace::TraceSpan span("stopped", "test"); }
+  EXPECT_TRUE(eventsNamed("stopped").empty());
+}
+
+TEST_F(DiagnosticsTrace, SpanRecordsDurationAndArgument) {
+  trace::TraceRecorder::start();
+  {
+    trace::TraceSpan span("work", "test", "bytes", 256);
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+  trace::TraceRecorder::stop();
+
+  const auto events = eventsNamed("work");
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_STREQ(events[0].category, "test");
+  EXPECT_STREQ(events[0].arg_name, "bytes");
+  EXPECT_EQ(events[0].arg_value, 256u);
+  EXPECT_GE(events[0].duration_ns, 50'000u);
+  EXPECT_NE(events[0].thread_id, 0u);
+
+  // Flushed events are not returned twice.
+  EXPECT_TRUE(eventsNamed("work").empty());
+}
+
+TEST_F(DiagnosticsTrace, FlushJsonEmitsCompleteEvents) {
+  trace::TraceRecorder::start();
+  trace::TraceRecorder::record("json \"span\"", "test", 2'000, 1'500, "n", 7);
+  trace::TraceRecorder::stop();
+
+  const std::string json = trace::TraceRecorder::flushJson();
+  EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"json \\\"span\\\"\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\",\"ts\":2.000,\"dur\":1.500"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"args\":{\"n\":7}"), std::string::npos);
+}
+
+TEST_F(DiagnosticsTrace, ThreadsGetDistinctIds) {
+  trace::TraceRecorder::start();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 10; ++j) {
+        trace::TraceSpan span("threaded", "test");
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  trace::TraceRecorder::stop();
+
+  const auto events = eventsNamed("threaded");
+  EXPECT_EQ(events.size(), 40u);
+  std::set<std::uint32_t> ids;
+  for (const auto &event : events) {
+    ids.insert(event.thread_id);
+  }
+  EXPECT_EQ(ids.size(), 4u);
+}
+
+TEST_F(DiagnosticsTrace, OverflowKeepsNewestAndCountsDropped) {
+  // A fresh thread picks up the small capacity configured by start().
+  trace::TraceRecorder::start({.events_per_thread = 8});
+  std::thread([] {
+    for (std::uint64_t i = 0; i < 20; ++i) {
+      trace::TraceRecorder::record("overflow", "test", i + 1, 1, "i", i);
+    }
+  }).join();
+  trace::TraceRecorder::stop();
+
+  const auto events = eventsNamed("overflow");
+  ASSERT_EQ(events.size(), 8u);
+  EXPECT_EQ(events.front().arg_value, 12u);
+  EXPECT_EQ(events.back().arg_value, 19u);
+  EXPECT_EQ(trace::TraceRecorder::dropped(), 12u);
+}
+
+TEST_F(DiagnosticsTrace, ClearDiscardsBufferedEvents) {
+  trace::TraceRecorder::start();
+  { trace::TraceSpan span("cleared", "test"); }
+  trace::TraceRecorder::clear();
+  trace::TraceRecorder::stop();
+  EXPECT_TRUE(eventsNamed("cleared").empty());
+  EXPECT_EQ(trace::TraceRecorder::dropped(), 0u);
+}
+
+TEST_F(DiagnosticsTrace, ExitedThreadBuffersAreReleasedOnceFlushed) {
+  trace::TraceRecorder::start();
+  { trace::TraceSpan span("baseline", "test"); }
+  eventsNamed("baseline");
+  const std::size_t baseline = trace::TraceRecorder::threadBufferCount();
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] { trace::TraceSpan span("exited", "test"); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  trace::TraceRecorder::stop();
+
+  // Unflushed events keep the buffers of exited threads alive.
+  EXPECT_EQ(trace::TraceRecorder::threadBufferCount(), baseline + 4);
+  EXPECT_EQ(eventsNamed("exited").size(), 4u);
+  EXPECT_EQ(trace::TraceRecorder::threadBufferCount(), baseline);
+
+  trace::TraceRecorder::start();
+  std::thread([] { trace::TraceSpan span("cleared", "test"); }).join();
+  trace::TraceRecorder::stop();
+  trace::TraceRecorder::clear();
+  EXPECT_EQ(trace::TraceRecorder::threadBufferCount(), baseline);
+}
+
+TEST_F(DiagnosticsTrace, UnallocatableBufferDropsTheSample) {
+  // No address space holds a ring this large.
+  trace::TraceRecorder::start({.events_per_thread = std::size_t{1} << 50});
+  std::thread([] {
+    trace::TraceRecorder::record("unallocated", "test", 1, 1);
+  }).join();
+  trace::TraceRecorder::start();
+  trace::TraceRecorder::stop();
+
+  EXPECT_TRUE(eventsNamed("unallocated").empty());
+  EXPECT_EQ(trace::TraceRecorder::dropped(), 1u);
+}
@@ -71,6 +71,24 @@ TEST_F(HierarchicalSlotAllocatorTest, DeallocateCallsUnmap) {
   allocator_.deallocate(view);
 }
 
+TEST_F(HierarchicalSlotAllocatorTest, DestructionReleasesReservedRegions) {
+  void *base = reinterpret_cast<void *>(0x3000);
+  EXPECT_CALL(impl_, reserve(256)).WillOnce(Return(HeapRegion{base, 256}));
+  EXPECT_CALL(impl_, map(_)).WillOnce(::testing::Invoke(MapReturn));
+  EXPECT_CALL(impl_, release(::testing::Truly([base](HeapRegion region) {
+                return region.data() == base && region.size() == 256;
+              })))
+      .WillOnce(Return(true));
+
+  Allocator::Config cfg{};
+  cfg.levels = {256};
+  {
+    Allocator allocator;
+    allocator.initialize(cfg, &heap_ops_);
+    EXPECT_TRUE(allocator.allocate(256));
+  }
+}
+
 TEST_F(HierarchicalSlotAllocatorTest, AllocateSmallSizeFromLargerSlot) {
   // levels = {256, 128} で 128 バイトを要求
   // 256 バイトのスロットから 128 バイトのスロットに分割されるはず
@@ -0,0 +1,192 @@
+#include "orteaf/internal/execution/allocator/policies/threading/thread_caching_policy.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/execution_buffer.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
+#include "orteaf/internal/execution/execution.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace allocator = ::orteaf::internal::execution::allocator;
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+using Execution = ::orteaf::internal::execution::Execution;
+using CpuView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
+
+namespace {
+
+struct FakeResource {
+  using BufferBlock = allocator::ExecutionBufferBlock<Execution::Cpu>;
+};
+
+using Policy = policies::ThreadCachingThreadingPolicy<FakeResource>;
+using Block = FakeResource::BufferBlock;
+using BufferViewHandle = Block::BufferViewHandle;
+
+Block makeBlock(std::uint32_t id) {
+  return Block{BufferViewHandle{id},
+               CpuView{reinterpret_cast<void *>(0x1000), id * 64u, 64}};
+}
+
+Policy::Config<FakeResource> makeConfig(std::size_t capacity,
+                                        std::size_t batch) {
+  Policy::Config<FakeResource> cfg{};
+  cfg.magazine_capacity = capacity;
+  cfg.batch_size = batch;
+  return cfg;
+}
+
+TEST(ThreadCachingThreadingPolicy, InitializeRejectsInvalidBatch) {
+  Policy policy;
+  orteaf::tests::ExpectError(
+      ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+      [&] { policy.initialize(makeConfig(4, 0)); });
+  orteaf::tests::ExpectError(
+      ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidParameter,
+      [&] { policy.initialize(makeConfig(4, 8)); });
+}
+
+TEST(ThreadCachingThreadingPolicy, MagazineIsLifoAndBounded) {
+  Policy policy;
+  policy.initialize(makeConfig(2, 1));
+
+  Block block{};
+  EXPECT_FALSE(policy.popCached(0, block));
+  EXPECT_TRUE(policy.pushCached(3, makeBlock(1)));
+  EXPECT_TRUE(policy.pushCached(3, makeBlock(2)));
+  EXPECT_FALSE(policy.pushCached(3, makeBlock(3)));
+  EXPECT_FALSE(policy.popCached(2, block));
+
+  ASSERT_TRUE(policy.popCached(3, block));
+  EXPECT_EQ(static_cast<std::uint32_t>(block.handle), 2u);
+  ASSERT_TRUE(policy.popCached(3, block));
+  EXPECT_EQ(static_cast<std::uint32_t>(block.handle), 1u);
+  EXPECT_FALSE(policy.popCached(3, block));
+}
+
+TEST(ThreadCachingThreadingPolicy, HighWaterBytesCapEachMagazine) {
+  Policy policy;
+  auto config = makeConfig(8, 1);
+  config.high_water_bytes = 256;
+  policy.initialize(config);
+  EXPECT_EQ(policy.highWaterBytes(), 256u);
+
+  // Four 64-byte blocks reach the mark; the fifth would pass it.
+  for (std::uint32_t id = 1; id <= 4; ++id) {
+    EXPECT_TRUE(policy.pushCached(0, makeBlock(id), 64));
+  }
+  EXPECT_FALSE(policy.pushCached(0, makeBlock(5), 64));
+  // Lists are capped separately, and blocks over the mark are never cached.
+  EXPECT_TRUE(policy.pushCached(1, makeBlock(6), 128));
+  EXPECT_FALSE(policy.pushCached(2, makeBlock(7), 512));
+}
+
+TEST(ThreadCachingThreadingPolicy, TakeCachedRemovesOldestFirst) {
+  Policy policy;
+  policy.initialize(makeConfig(8, 2));
+  for (std::uint32_t id = 1; id <= 5; ++id) {
+    ASSERT_TRUE(policy.pushCached(0, makeBlock(id)));
+  }
+
+  std::vector<std::uint32_t> taken;
+  EXPECT_EQ(policy.takeCached(0, policy.batchSize(),
+                              [&](const Block &block) {
+                                taken.push_back(
+                                    static_cast<std::uint32_t>(block.handle));
+                              }),
+            2u);
+  EXPECT_EQ(taken, (std::vector<std::uint32_t>{1, 2}));
+
+  Block block{};
+  ASSERT_TRUE(policy.popCached(0, block));
+  EXPECT_EQ(static_cast<std::uint32_t>(block.handle), 5u);
+  EXPECT_EQ(policy.takeCached(7, 4, [](const Block &) {}), 0u);
+}
+
+TEST(ThreadCachingThreadingPolicy, MagazinesArePerThread) {
+  Policy policy;
+  policy.initialize(makeConfig(4, 1));
+  ASSERT_TRUE(policy.pushCached(0, makeBlock(1)));
+
+  std::thread other([&] {
+    Block block{};
+    EXPECT_FALSE(policy.popCached(0, block));
+    EXPECT_TRUE(policy.pushCached(0, makeBlock(2)));
+  });
+  other.join();
+
+  Block block{};
+  ASSERT_TRUE(policy.popCached(0, block));
+  EXPECT_EQ(static_cast<std::uint32_t>(block.handle), 1u);
+  EXPECT_FALSE(policy.popCached(0, block));
+}
+
+TEST(ThreadCachingThreadingPolicy, DrainCollectsEveryThread) {
+  Policy policy;
+  policy.initialize(makeConfig(4, 1));
+  ASSERT_TRUE(policy.pushCached(1, makeBlock(1)));
+  std::thread other([&] { EXPECT_TRUE(policy.pushCached(2, makeBlock(2))); });
+  other.join();
+
+  std::vector<std::pair<std::size_t, std::uint32_t>> drained;
+  {
+    std::lock_guard<Policy> lock(policy);
+    EXPECT_EQ(policy.drainCached([&](std::size_t index, const Block &block) {
+      drained.emplace_back(index, static_cast<std::uint32_t>(block.handle));
+    }),
+              2u);
+  }
+  EXPECT_EQ(drained.size(), 2u);
+  Block block{};
+  EXPECT_FALSE(policy.popCached(1, block));
+}
+
+TEST(ThreadCachingThreadingPolicy, ExitedThreadHandsBackItsMagazines) {
+  Policy policy;
+  policy.initialize(makeConfig(4, 1));
+  ASSERT_TRUE(policy.pushCached(0, makeBlock(1)));
+  std::thread other([&] {
+    EXPECT_TRUE(policy.pushCached(2, makeBlock(2)));
+    EXPECT_TRUE(policy.pushCached(2, makeBlock(3)));
+  });
+  other.join();
+
+  std::vector<std::pair<std::size_t, std::uint32_t>> exited;
+  {
+    std::lock_guard<Policy> lock(policy);
+    EXPECT_EQ(policy.drainExited([&](std::size_t index, const Block &block) {
+      exited.emplace_back(index, static_cast<std::uint32_t>(block.handle));
+    }),
+              2u);
+    EXPECT_EQ(policy.drainExited([](std::size_t, const Block &) {}), 0u);
+    // Only the live thread's cache is still registered.
+    EXPECT_EQ(policy.drainCached([](std::size_t, const Block &) {}), 1u);
+  }
+  EXPECT_EQ(exited, (std::vector<std::pair<std::size_t, std::uint32_t>>{
+                        {2, 2}, {2, 3}}));
+}
+
+TEST(ThreadCachingThreadingPolicy, ThreadMayOutliveThePolicy) {
+  auto policy = std::make_unique<Policy>();
+  policy->initialize(makeConfig(4, 1));
+  std::atomic<bool> cached{false};
+  std::atomic<bool> destroyed{false};
+  std::thread other([&] {
+    EXPECT_TRUE(policy->pushCached(0, makeBlock(1)));
+    cached.store(true);
+    cached.notify_one();
+    destroyed.wait(false);
+  });
+  cached.wait(false);
+  policy.reset();
+  destroyed.store(true);
+  destroyed.notify_one();
+  other.join();
+}
+
+} // namespace
@@ -3,13 +3,21 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 #include "orteaf/internal/execution/allocator/execution_buffer.h"
 #include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
 #include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
 #include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
 #include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
 #include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/thread_caching_policy.h"
 #include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_resource.h"
 #include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
 #include "orteaf/internal/execution/execution.h"
 #include "tests/internal/execution/allocator/testing/mock_resource.h"
@@ -358,4 +366,221 @@ TEST(SegregatePool, StatsTracking) {
   }
 }
 
+// ---------------------------------------------------------------------------
+// Thread-caching policy (real CPU memory)
+// ---------------------------------------------------------------------------
+struct CountingCpuResource : ::orteaf::internal::execution::cpu::CpuResource {
+  using Base = ::orteaf::internal::execution::cpu::CpuResource;
+
+  static inline std::atomic<int> live{0};
+
+  static BufferView allocate(std::size_t size, std::size_t alignment) {
+    ++live;
+    return Base::allocate(size, alignment);
+  }
+
+  static void deallocate(BufferView view, std::size_t size,
+                         std::size_t alignment) {
+    --live;
+    Base::deallocate(view, size, alignment);
+  }
+};
+
+using CachingPool =
+    ::orteaf::internal::execution::allocator::pool::SegregatePool<
+        CountingCpuResource, policies::FastFreePolicy,
+        policies::ThreadCachingThreadingPolicy<CountingCpuResource>,
+        policies::DirectResourceLargeAllocPolicy<CountingCpuResource>,
+        policies::DirectChunkLocatorPolicy<CountingCpuResource>,
+        policies::DeferredReusePolicy<CountingCpuResource>,
+        policies::HostStackFreelistPolicy<CountingCpuResource>>;
+
+void initializeCachingPool(CachingPool &pool, std::size_t chunk_size) {
+  CachingPool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.threading.magazine_capacity = 8;
+  cfg.threading.batch_size = 4;
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = chunk_size;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 1024;
+  pool.initialize(cfg);
+}
+
+static_assert(CachingPool::kThreadCaching);
+static_assert(!Pool::kThreadCaching);
+
+TEST(SegregatePool, ThreadCacheServesFreedBlocksAndRefillsInBatches) {
+  CachingPool pool;
+  initializeCachingPool(pool, 1024);
+  CachingPool::LaunchParams params{};
+
+  auto first = pool.allocate(100, 0, params);
+  ASSERT_TRUE(first.valid());
+  // The refill moved batch_size - 1 more 128-byte blocks into the magazine,
+  // so the next ones come from the same chunk without a central pop.
+  auto second = pool.allocate(128, 0, params);
+  ASSERT_TRUE(second.valid());
+  EXPECT_EQ(first.view.raw(), second.view.raw());
+  EXPECT_EQ(pool.free_list_policy().empty(1), false);
+
+  pool.deallocate(second, 128, 0, params);
+  auto again = pool.allocate(90, 0, params);
+  EXPECT_EQ(again.view.data(), second.view.data());
+
+  pool.deallocate(first, 100, 0, params);
+  pool.deallocate(again, 90, 0, params);
+  pool.releaseChunk(params);
+  EXPECT_EQ(CountingCpuResource::live.load(), 0);
+}
+
+TEST(SegregatePool, ThreadCacheFlushesWhenMagazineIsFull) {
+  CachingPool pool;
+  initializeCachingPool(pool, 4096);
+  CachingPool::LaunchParams params{};
+
+  std::vector<CachingPool::BufferResource> blocks;
+  for (int i = 0; i < 20; ++i) {
+    blocks.push_back(pool.allocate(64, 0, params));
+    ASSERT_TRUE(blocks.back().valid());
+  }
+  // 20 frees overflow the 8-block magazine several times.
+  for (auto &block : blocks) {
+    pool.deallocate(block, 64, 0, params);
+  }
+  EXPECT_FALSE(pool.free_list_policy().empty(0));
+
+  pool.releaseChunk(params);
+  EXPECT_EQ(CountingCpuResource::live.load(), 0);
+}
+
+TEST(SegregatePool, ThreadCacheFlushesPastHighWaterBytes) {
+  CachingPool pool;
+  CachingPool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.threading.magazine_capacity = 8;
+  cfg.threading.batch_size = 4;
+  cfg.threading.high_water_bytes = 512;
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 4096;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 1024;
+  pool.initialize(cfg);
+  CachingPool::LaunchParams params{};
+
+  // 256-byte blocks: at most two stay in the magazine.
+  std::vector<CachingPool::BufferResource> blocks;
+  for (int i = 0; i < 4; ++i) {
+    blocks.push_back(pool.allocate(256, 0, params));
+    ASSERT_TRUE(blocks.back().valid());
+  }
+  for (auto &block : blocks) {
+    pool.deallocate(block, 256, 0, params);
+  }
+  auto &threading = pool.threading_policy();
+  std::vector<CachingPool::BufferBlock> cached;
+  CachingPool::BufferBlock popped{};
+  while (threading.popCached(2, popped)) {
+    cached.push_back(popped);
+  }
+  EXPECT_EQ(cached.size(), 2u);
+  for (const auto &block : cached) {
+    EXPECT_TRUE(threading.pushCached(2, block, 256));
+  }
+
+  // 1024-byte blocks are over the mark on their own and go straight back to
+  // the shared free list.
+  auto large = pool.allocate(1024, 0, params);
+  ASSERT_TRUE(large.valid());
+  pool.deallocate(large, 1024, 0, params);
+  EXPECT_FALSE(pool.free_list_policy().empty(4));
+  auto again = pool.allocate(1024, 0, params);
+  EXPECT_EQ(again.view.data(), large.view.data());
+  pool.deallocate(again, 1024, 0, params);
+
+  pool.releaseChunk(params);
+  EXPECT_EQ(CountingCpuResource::live.load(), 0);
+}
+
+TEST(SegregatePool, ThreadCacheOfExitedThreadReturnsToFreeList) {
+  CachingPool pool;
+  // One chunk holds exactly four 64-byte blocks.
+  initializeCachingPool(pool, 256);
+
+  std::thread([&] {
+    CachingPool::LaunchParams params{};
+    // The refill moves the other three blocks into this thread's magazine.
+    auto block = pool.allocate(64, 0, params);
+    ASSERT_TRUE(block.valid());
+    pool.deallocate(block, 64, 0, params);
+  }).join();
+  EXPECT_TRUE(pool.free_list_policy().empty(0));
+  ASSERT_EQ(CountingCpuResource::live.load(), 1);
+
+  // The exited thread's blocks serve this allocation without a new chunk.
+  CachingPool::LaunchParams params{};
+  auto block = pool.allocate(64, 0, params);
+  ASSERT_TRUE(block.valid());
+  EXPECT_EQ(CountingCpuResource::live.load(), 1);
+  pool.deallocate(block, 64, 0, params);
+
+  pool.releaseChunk(params);
+  EXPECT_EQ(CountingCpuResource::live.load(), 0);
+}
+
+TEST(SegregatePool, ThreadCacheConcurrentAllocationsStayDisjoint) {
+  CachingPool pool;
+  initializeCachingPool(pool, 16 * 1024);
+
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 2000;
+  std::atomic<int> corrupted{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      CachingPool::LaunchParams params{};
+      std::vector<std::pair<CachingPool::BufferResource, std::size_t>> live;
+      for (int i = 0; i < kIterations; ++i) {
+        const std::size_t size = 64u << ((i + t) % 4);
+        auto block = pool.allocate(size, 0, params);
+        ASSERT_TRUE(block.valid());
+        std::memset(block.view.data(), t + 1, size);
+        live.emplace_back(block, size);
+        if (live.size() > 16 || i % 3 == 0) {
+          auto [victim, victim_size] = live.front();
+          live.erase(live.begin());
+          const auto *bytes =
+              static_cast<const unsigned char *>(victim.view.data());
+          for (std::size_t b = 0; b < victim_size; ++b) {
+            if (bytes[b] != static_cast<unsigned char>(t + 1)) {
+              ++corrupted;
+              break;
+            }
+          }
+          pool.deallocate(victim, victim_size, 0, params);
+        }
+      }
+      for (auto &[block, size] : live) {
+        pool.deallocate(block, size, 0, params);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(corrupted.load(), 0);
+
+  CachingPool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_EQ(CountingCpuResource::live.load(), 0);
+}
+
 } // namespace
@@ -2,6 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstdint>
+
+#include "orteaf/internal/execution/cpu/resource/cpu_command_queue.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_heap_ops.h"
 #include "tests/internal/testing/error_assert.h"
 
 namespace orteaf::tests {
@@ -33,6 +38,53 @@ TEST(CpuResourceTest, AllocateAndDeallocateSucceeds) {
     CpuResource::deallocate(view, kSize, kAlign);
 }
 
+TEST(CpuResourceTest, DefaultAlignmentIsCacheLine) {
+    constexpr std::size_t kSize = 100;
+    auto view = CpuResource::allocate(kSize, 0);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.data()) % CpuResource::kDefaultAlignment, 0u);
+    CpuResource::deallocate(view, kSize, 0);
+}
+
+TEST(CpuResourceTest, LargeAllocationsFollowHeapPagePolicy) {
+    namespace res = ::orteaf::internal::execution::cpu::resource;
+    constexpr std::size_t kSize = 4 * 1024 * 1024;
+    res::CpuHeapOps::configure(res::CpuHeapConfig{.page_kind = res::CpuPageKind::TransparentHuge});
+    const auto before = res::CpuHeapOps::stats();
+    auto view = CpuResource::allocate(kSize, CpuResource::kDefaultAlignment);
+    ASSERT_TRUE(view);
+    const auto after = res::CpuHeapOps::stats();
+    std::size_t added = 0;
+    for (std::size_t kind = 0; kind < res::kCpuPageKindCount; ++kind) {
+        added += after.regions[kind] - before.regions[kind];
+    }
+    EXPECT_EQ(added, 1u);
+    static_cast<unsigned char*>(view.data())[kSize - 1] = 1;
+
+    CpuResource::deallocate(view, kSize, CpuResource::kDefaultAlignment);
+    EXPECT_FALSE(res::CpuHeapOps::release(res::CpuHeapOps::HeapRegion{view.data(), kSize}));
+    res::CpuHeapOps::configure({});
+}
+
+TEST(CpuResourceTest, TokensCompleteWithTheirQueue) {
+    namespace res = ::orteaf::internal::execution::cpu::resource;
+    EXPECT_TRUE(CpuResource::isCompleted(CpuResource::FenceToken{}));
+    EXPECT_TRUE(CpuResource::isCompleted(CpuResource::ReuseToken{}));
+
+    res::CpuCommandQueue queue;
+    std::atomic<bool> open{false};
+    const auto fence = queue.submit([&open] { open.wait(false); });
+    const CpuResource::ReuseToken reuse{fence};
+    EXPECT_FALSE(CpuResource::isCompleted(fence));
+    EXPECT_FALSE(CpuResource::isCompleted(reuse));
+
+    open.store(true);
+    open.notify_all();
+    queue.synchronize();
+    EXPECT_TRUE(CpuResource::isCompleted(fence));
+    EXPECT_TRUE(CpuResource::isCompleted(reuse));
+}
+
 TEST(CpuResourceTest, DeallocateOnEmptyIsNoOp) {
     CpuResource::deallocate({}, 0, 0);
     SUCCEED();
@@ -23,6 +23,7 @@ public:
   MOCK_METHOD(HeapRegion, reserve, (std::size_t size));
   MOCK_METHOD(BufferView, map, (HeapRegion region));
   MOCK_METHOD(void, unmap, (HeapRegion region, std::size_t size));
+  MOCK_METHOD(bool, release, (HeapRegion region));
 };
 
 // Static-API wrapper that forwards to a shared MockCpuHeapOpsImpl instance.
@@ -45,6 +46,9 @@ struct MockCpuHeapOps {
     if (impl_)
       impl_->unmap(region, size);
   }
+  static bool release(HeapRegion region) {
+    return impl_ ? impl_->release(region) : false;
+  }
 
 private:
   static inline MockCpuHeapOpsImpl *impl_{nullptr};
@@ -1,12 +1,17 @@
 #include "orteaf/internal/execution/cpu/manager/cpu_buffer_manager.h"
 #include "orteaf/internal/execution/cpu/platform/cpu_slow_ops.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_command_queue.h"
 #include <gtest/gtest.h>
 #include <system_error>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 
 namespace cpu_rt = orteaf::internal::execution::cpu::manager;
 namespace cpu_platform = orteaf::internal::execution::cpu::platform;
+namespace cpu_resource = orteaf::internal::execution::cpu::resource;
 
 class CpuBufferManagerTest : public ::testing::Test {
 protected:
@@ -129,3 +134,137 @@ TEST_F(CpuBufferManagerTest, BufferViewFromLeaseIsValid) {
 TEST_F(CpuBufferManagerTest, NotConfiguredThrows) {
   EXPECT_THROW(manager_->acquire(1024), std::system_error);
 }
+
+TEST_F(CpuBufferManagerTest, ReleasedSlotIsRecreatedForNewSize) {
+  configureManager();
+  { auto lease = manager_->acquire(16); }
+
+  auto lease = manager_->acquire(4096);
+  ASSERT_TRUE(lease);
+  EXPECT_EQ(lease->view.size(), 4096u);
+}
+
+TEST_F(CpuBufferManagerTest, PooledBuffersShareChunks) {
+  cpu_rt::CpuBufferManager::Config config{};
+  config.allocation_mode = cpu_rt::CpuBufferManager::AllocationMode::Pooled;
+  config.chunk_size = 4096;
+  config.min_block_size = 64;
+  config.max_block_size = 1024;
+  manager_->configureForTest(config, slow_ops_.get());
+  ASSERT_NE(manager_->poolForTest(), nullptr);
+
+  auto first = manager_->acquire(100);
+  auto second = manager_->acquire(120);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  EXPECT_EQ(first->view.size(), 100u);
+  EXPECT_EQ(second->view.size(), 120u);
+  // Both land in the 128-byte class of the same chunk.
+  EXPECT_EQ(first->view.raw(), second->view.raw());
+  EXPECT_NE(first->view.data(), second->view.data());
+  for (const auto *buffer : {first.operator->(), second.operator->()}) {
+    const auto address =
+        reinterpret_cast<std::uintptr_t>(buffer->view.data());
+    EXPECT_EQ(address % 64, 0u);
+  }
+}
+
+TEST_F(CpuBufferManagerTest, PooledBlockIsReusedAfterRelease) {
+  cpu_rt::CpuBufferManager::Config config{};
+  config.allocation_mode = cpu_rt::CpuBufferManager::AllocationMode::Pooled;
+  manager_->configureForTest(config, slow_ops_.get());
+
+  void *released = nullptr;
+  {
+    auto lease = manager_->acquire(200);
+    released = lease->view.data();
+  }
+  // Different size in the same class: the slot is recreated and the pool
+  // hands back the block it just got.
+  auto lease = manager_->acquire(250);
+  ASSERT_TRUE(lease);
+  EXPECT_EQ(lease->view.size(), 250u);
+  EXPECT_EQ(lease->view.data(), released);
+}
+
+TEST_F(CpuBufferManagerTest, PooledLargeAndOverAlignedRequests) {
+  cpu_rt::CpuBufferManager::Config config{};
+  config.allocation_mode = cpu_rt::CpuBufferManager::AllocationMode::Pooled;
+  config.chunk_size = 4096;
+  config.max_block_size = 1024;
+  manager_->configureForTest(config, slow_ops_.get());
+
+  auto large = manager_->acquire(8192);
+  ASSERT_TRUE(large);
+  EXPECT_EQ(large->view.size(), 8192u);
+
+  constexpr std::size_t kAlignment = 512;
+  auto aligned = manager_->acquire(100, kAlignment);
+  ASSERT_TRUE(aligned);
+  EXPECT_EQ(aligned->view.size(), 100u);
+  EXPECT_EQ(
+      reinterpret_cast<std::uintptr_t>(aligned->view.data()) % kAlignment,
+      0u);
+
+  large.release();
+  aligned.release();
+  manager_->shutdown();
+  EXPECT_EQ(manager_->poolForTest(), nullptr);
+}
+
+TEST_F(CpuBufferManagerTest, PooledRejectsInvalidBlockSizes) {
+  cpu_rt::CpuBufferManager::Config config{};
+  config.allocation_mode = cpu_rt::CpuBufferManager::AllocationMode::Pooled;
+  config.min_block_size = 96;
+  EXPECT_THROW(manager_->configureForTest(config, slow_ops_.get()),
+               std::system_error);
+}
+
+TEST_F(CpuBufferManagerTest, PooledBlockInUseByQueueIsNotReused) {
+  cpu_rt::CpuBufferManager::Config config{};
+  config.allocation_mode = cpu_rt::CpuBufferManager::AllocationMode::Pooled;
+  manager_->configureForTest(config, slow_ops_.get());
+
+  cpu_resource::CpuCommandQueue queue;
+  std::atomic<bool> open{false};
+  void *in_flight = nullptr;
+  {
+    auto lease = manager_->acquire(200);
+    in_flight = lease->view.data();
+    lease->reuse_token.addOrReplace(queue.submit([&open] { open.wait(false); }));
+  }
+  // Same size and slot, but the queued task may still touch the block.
+  auto lease = manager_->acquire(200);
+  ASSERT_TRUE(lease);
+  EXPECT_NE(lease->view.data(), in_flight);
+  auto other = manager_->acquire(250);
+  EXPECT_NE(other->view.data(), in_flight);
+
+  open.store(true);
+  open.notify_all();
+  queue.synchronize();
+  EXPECT_TRUE(manager_->acquire(200));
+}
+
+TEST_F(CpuBufferManagerTest, DirectReleaseWaitsForQueuedWork) {
+  configureManager();
+
+  cpu_resource::CpuCommandQueue queue;
+  std::atomic<bool> open{false};
+  auto lease = manager_->acquire(64);
+  const auto token = queue.submit([&open] { open.wait(false); });
+  lease->reuse_token.addOrReplace(token);
+
+  std::thread opener([&open] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    open.store(true);
+    open.notify_all();
+  });
+  // Reacquiring at another size recreates the slot, which frees the old
+  // buffer only after the task is done.
+  lease.release();
+  auto recreated = manager_->acquire(128);
+  EXPECT_TRUE(token.isCompleted());
+  EXPECT_TRUE(recreated);
+  opener.join();
+}
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <system_error>
+#include <vector>
 
 #include "orteaf/internal/architecture/architecture.h"
 #include "orteaf/internal/execution/cpu/manager/cpu_device_manager.h"
@@ -13,6 +14,7 @@ namespace architecture = orteaf::internal::architecture;
 namespace cpu = orteaf::internal::execution::cpu;
 namespace cpu_rt = orteaf::internal::execution::cpu::manager;
 namespace cpu_platform = orteaf::internal::execution::cpu::platform;
+using ::testing::_;
 using ::testing::NiceMock;
 using ::testing::Return;
 
@@ -29,6 +31,12 @@ public:
   MOCK_METHOD(void *, allocBuffer, (std::size_t size, std::size_t alignment),
               (override));
   MOCK_METHOD(void, deallocBuffer, (void *ptr, std::size_t size), (override));
+  MOCK_METHOD(int, numaNodeOf, (cpu::CpuDeviceHandle device_id), (override));
+  MOCK_METHOD(std::vector<std::size_t>, coresOf,
+              (cpu::CpuDeviceHandle device_id), (override));
+  MOCK_METHOD(void *, allocBufferOnNode,
+              (std::size_t size, std::size_t alignment, int numa_node),
+              (override));
 };
 
 } // namespace
@@ -96,3 +104,43 @@ TEST_F(CpuDeviceManagerMockTest, InvalidDeviceIdThrows) {
   // Device handle 1 is invalid for CPU (only 0 is valid)
   EXPECT_THROW(manager_->acquire(cpu::CpuDeviceHandle{1}), std::system_error);
 }
+
+TEST_F(CpuDeviceManagerMockTest, NumaNodesBecomeSeparateDevices) {
+  ON_CALL(*mock_ops_, getDeviceCount()).WillByDefault(Return(2));
+  ON_CALL(*mock_ops_, numaNodeOf(_))
+      .WillByDefault([](cpu::CpuDeviceHandle device) {
+        return static_cast<int>(device.index);
+      });
+  ON_CALL(*mock_ops_, coresOf(cpu::CpuDeviceHandle{1}))
+      .WillByDefault(Return(std::vector<std::size_t>{4, 5}));
+  manager_->configureForTest(cpu_rt::CpuDeviceManager::Config{},
+                             mock_ops_.get());
+
+  EXPECT_EQ(manager_->deviceCount(), 2u);
+  auto node0 = manager_->acquire(cpu::CpuDeviceHandle{0});
+  auto node1 = manager_->acquire(cpu::CpuDeviceHandle{1});
+  EXPECT_EQ(node0->numa_node, 0);
+  EXPECT_EQ(node1->numa_node, 1);
+  EXPECT_EQ(node1->cores, (std::vector<std::size_t>{4, 5}));
+  EXPECT_EQ(node1->buffer_manager.numaNode(), 1);
+  EXPECT_THROW(manager_->acquire(cpu::CpuDeviceHandle{2}), std::system_error);
+
+  // Direct-mode buffers of device 1 are requested on node 1.
+  alignas(64) static unsigned char storage[128];
+  EXPECT_CALL(*mock_ops_, allocBufferOnNode(128, 0, 1))
+      .WillOnce(Return(static_cast<void *>(storage)));
+  auto buffer = node1->buffer_manager.acquire(128);
+  EXPECT_TRUE(buffer);
+  buffer.release();
+}
+
+TEST_F(CpuDeviceManagerMockTest, NonPositiveDeviceCountStillHasHost) {
+  ON_CALL(*mock_ops_, getDeviceCount()).WillByDefault(Return(0));
+  manager_->configureForTest(cpu_rt::CpuDeviceManager::Config{},
+                             mock_ops_.get());
+
+  EXPECT_EQ(manager_->deviceCount(), 1u);
+  auto lease = manager_->acquire(cpu::CpuDeviceHandle{0});
+  EXPECT_TRUE(lease);
+  EXPECT_EQ(lease->numa_node, 0);
+}
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <vector>
 
 namespace cpu = orteaf::internal::execution::cpu;
 namespace cpu_rt = orteaf::internal::execution::cpu::manager;
@@ -27,6 +28,8 @@ public:
   MOCK_METHOD(void *, allocBuffer, (std::size_t size, std::size_t alignment),
               (override));
   MOCK_METHOD(void, deallocBuffer, (void *ptr, std::size_t size), (override));
+  MOCK_METHOD(std::vector<std::size_t>, coresOf,
+              (cpu::CpuDeviceHandle device_id), (override));
 };
 
 } // namespace
@@ -116,3 +119,99 @@ TEST_F(CpuExecutionManagerTest, DeviceManagerIsAlive) {
   auto &device_manager = manager_->deviceManager();
   EXPECT_TRUE(device_manager.isAliveForTest(cpu::CpuDeviceHandle{0}));
 }
+
+TEST_F(CpuExecutionManagerTest, KernelManagersAreConfigured) {
+  manager_->configure({});
+
+  EXPECT_TRUE(manager_->kernelBaseManager().isConfiguredForTest());
+  EXPECT_TRUE(manager_->kernelMetadataManager().isConfiguredForTest());
+
+  auto base = manager_->kernelBaseManager().acquire(
+      architecture::Architecture::CpuSkylake);
+  ASSERT_TRUE(base);
+  EXPECT_EQ(base->architecture(), architecture::Architecture::CpuSkylake);
+
+  auto metadata = manager_->kernelMetadataManager().acquire(
+      architecture::Architecture::CpuSkylake);
+  ASSERT_TRUE(metadata);
+  EXPECT_EQ(metadata->architecture(), architecture::Architecture::CpuSkylake);
+}
+
+TEST_F(CpuExecutionManagerTest, ShutdownClearsKernelManagers) {
+  manager_->configure({});
+  manager_->shutdown();
+
+  EXPECT_FALSE(manager_->kernelBaseManager().isConfiguredForTest());
+  EXPECT_FALSE(manager_->kernelMetadataManager().isConfiguredForTest());
+}
+
+TEST_F(CpuExecutionManagerTest, ThreadPoolFollowsConfig) {
+  EXPECT_EQ(manager_->threadPool(), nullptr);
+
+  cpu_rt::CpuExecutionManager::Config config{};
+  config.thread_pool_config.thread_count = 3;
+  manager_->configure(config);
+
+  auto pool = manager_->threadPool();
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(pool->concurrency(), 3u);
+
+  manager_->shutdown();
+  EXPECT_EQ(manager_->threadPool(), nullptr);
+  // Outstanding references keep the pool usable after shutdown.
+  EXPECT_EQ(pool->parallelReduce(
+                0, 100, 1, 0, [](auto b, auto e) { return int(e - b); },
+                [](int lhs, int rhs) { return lhs + rhs; }),
+            100);
+}
+
+TEST_F(CpuExecutionManagerTest, NumaDevicesGetPinnedPools) {
+  auto *mock_ops = new NiceMock<CpuSlowOpsMock>();
+  ON_CALL(*mock_ops, getDeviceCount()).WillByDefault(Return(2));
+  ON_CALL(*mock_ops, coresOf(cpu::CpuDeviceHandle{0}))
+      .WillByDefault(Return(std::vector<std::size_t>{0, 1}));
+  ON_CALL(*mock_ops, coresOf(cpu::CpuDeviceHandle{1}))
+      .WillByDefault(Return(std::vector<std::size_t>{}));
+
+  cpu_rt::CpuExecutionManager::Config config{};
+  config.slow_ops = mock_ops;
+  config.thread_pool_config.thread_count = 3;
+  manager_->configure(config);
+
+  auto shared = manager_->threadPool();
+  auto node0 = manager_->threadPool(cpu::CpuDeviceHandle{0});
+  ASSERT_NE(node0, nullptr);
+  EXPECT_NE(node0, shared);
+  EXPECT_EQ(node0->concurrency(), 3u);
+  // Without known cores a device falls back to the shared pool.
+  EXPECT_EQ(manager_->threadPool(cpu::CpuDeviceHandle{1}), shared);
+}
+
+TEST_F(CpuExecutionManagerTest, FullyPinnedHostHasNoExtraSharedPool) {
+  auto *mock_ops = new NiceMock<CpuSlowOpsMock>();
+  ON_CALL(*mock_ops, getDeviceCount()).WillByDefault(Return(2));
+  ON_CALL(*mock_ops, coresOf(cpu::CpuDeviceHandle{0}))
+      .WillByDefault(Return(std::vector<std::size_t>{0, 1}));
+  ON_CALL(*mock_ops, coresOf(cpu::CpuDeviceHandle{1}))
+      .WillByDefault(Return(std::vector<std::size_t>{2, 3}));
+
+  cpu_rt::CpuExecutionManager::Config config{};
+  config.slow_ops = mock_ops;
+  manager_->configure(config);
+
+  auto node0 = manager_->threadPool(cpu::CpuDeviceHandle{0});
+  auto node1 = manager_->threadPool(cpu::CpuDeviceHandle{1});
+  ASSERT_NE(node0, nullptr);
+  EXPECT_NE(node0, node1);
+  EXPECT_EQ(node0->concurrency(), 2u);
+  EXPECT_EQ(manager_->threadPool(), node0);
+}
+
+TEST_F(CpuExecutionManagerTest, SingleDeviceUsesSharedPool) {
+  manager_->configure({});
+  if (manager_->deviceManager().deviceCount() > 1) {
+    GTEST_SKIP() << "host has several NUMA nodes";
+  }
+  EXPECT_EQ(manager_->threadPool(cpu::CpuDeviceHandle{0}),
+            manager_->threadPool());
+}
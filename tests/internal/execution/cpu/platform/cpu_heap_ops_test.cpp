@@ -2,8 +2,31 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include "orteaf/internal/execution/cpu/resource/cpu_thread_pool.h"
+
 namespace orteaf::tests {
+using orteaf::internal::execution::cpu::resource::CpuHeapConfig;
 using orteaf::internal::execution::cpu::resource::CpuHeapOps;
+using orteaf::internal::execution::cpu::resource::CpuPageKind;
+using orteaf::internal::execution::cpu::resource::CpuThreadPool;
+
+namespace {
+
+std::size_t kindIndex(CpuPageKind kind) { return static_cast<std::size_t>(kind); }
+
+// Restores the default page policy when a test changes it.
+struct HeapConfigGuard {
+    explicit HeapConfigGuard(const CpuHeapConfig& config) { CpuHeapOps::configure(config); }
+    ~HeapConfigGuard() { CpuHeapOps::configure({}); }
+};
+
+}  // namespace
 
 TEST(CpuHeapOpsTest, ReserveZeroReturnsEmpty) {
     auto region = CpuHeapOps::reserve(0);
@@ -24,10 +47,173 @@ TEST(CpuHeapOpsTest, ReserveMapUnmapRoundTrip) {
     CpuHeapOps::unmap(region, kSize);
 }
 
+TEST(CpuHeapOpsTest, RegionCanBeMappedAgainAfterUnmap) {
+    constexpr std::size_t kSize = 4096;
+    auto region = CpuHeapOps::reserve(kSize);
+    ASSERT_TRUE(region);
+
+    auto mapped = CpuHeapOps::map(region);
+    static_cast<unsigned char*>(mapped.data())[0] = 0x5a;
+    CpuHeapOps::unmap(region, kSize);
+
+    auto remapped = CpuHeapOps::map(region);
+    ASSERT_TRUE(remapped);
+    EXPECT_EQ(remapped.data(), mapped.data());
+    // Decommitted pages come back zero-filled.
+    EXPECT_EQ(static_cast<unsigned char*>(remapped.data())[0], 0);
+    CpuHeapOps::unmap(region, kSize);
+}
+
 TEST(CpuHeapOpsTest, MapUnmapOnEmptyIsNoOp) {
     CpuHeapOps::map({});          // no-throw
     CpuHeapOps::unmap(CpuHeapOps::HeapRegion{}, 0);     // no-throw
     SUCCEED();
 }
 
+TEST(CpuHeapOpsTest, DefaultConfigReservesBasePages) {
+    constexpr std::size_t kSize = 4 * 1024 * 1024;
+    const auto before = CpuHeapOps::stats();
+    auto region = CpuHeapOps::reserve(kSize);
+    ASSERT_TRUE(region);
+    EXPECT_EQ(CpuHeapOps::pageKindOf(region.data()), CpuPageKind::Base);
+
+    const auto after = CpuHeapOps::stats();
+    const auto base = kindIndex(CpuPageKind::Base);
+    EXPECT_EQ(after.regions[base], before.regions[base] + 1);
+    EXPECT_EQ(after.reserved_bytes[base], before.reserved_bytes[base] + kSize);
+    EXPECT_EQ(after.huge_page_fallbacks, before.huge_page_fallbacks);
+    EXPECT_TRUE(CpuHeapOps::release(region));
+}
+
+TEST(CpuHeapOpsTest, HugePageRequestIsUsableWithOrWithoutFallback) {
+    constexpr std::size_t kSize = 4 * 1024 * 1024;
+    for (auto kind : {CpuPageKind::TransparentHuge, CpuPageKind::ExplicitHuge}) {
+        HeapConfigGuard guard(CpuHeapConfig{.page_kind = kind});
+        const auto before = CpuHeapOps::stats();
+        auto region = CpuHeapOps::reserve(kSize);
+        ASSERT_TRUE(region);
+        EXPECT_EQ(region.size(), kSize);
+
+        const auto got = CpuHeapOps::pageKindOf(region.data());
+        const auto after = CpuHeapOps::stats();
+        EXPECT_EQ(after.regions[kindIndex(got)], before.regions[kindIndex(got)] + 1);
+        // Whatever the machine provides, a downgrade is counted.
+        EXPECT_EQ(after.huge_page_fallbacks, before.huge_page_fallbacks + (got == kind ? 0 : 1));
+        if (got != CpuPageKind::Base) {
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(region.data()) % (2 * 1024 * 1024), 0u);
+        }
+
+        auto mapped = CpuHeapOps::map(region);
+        ASSERT_TRUE(mapped);
+        std::memset(mapped.data(), 0x3c, kSize);
+        EXPECT_EQ(static_cast<unsigned char*>(mapped.data())[kSize - 1], 0x3c);
+        CpuHeapOps::unmap(region, kSize);
+        EXPECT_TRUE(CpuHeapOps::release(region));
+    }
+}
+
+TEST(CpuHeapOpsTest, UnsupportedHugePageSizeFallsBack) {
+    // No system has 1 TiB pages, so the hugetlb mapping always fails.
+    constexpr std::size_t kSize = 2 * 1024 * 1024;
+    HeapConfigGuard guard(
+        CpuHeapConfig{.page_kind = CpuPageKind::ExplicitHuge, .huge_page_size = std::size_t{1} << 40});
+    const auto before = CpuHeapOps::stats();
+    auto region = CpuHeapOps::reserve(kSize);
+    ASSERT_TRUE(region);
+    EXPECT_NE(CpuHeapOps::pageKindOf(region.data()), CpuPageKind::ExplicitHuge);
+    EXPECT_EQ(CpuHeapOps::stats().huge_page_fallbacks, before.huge_page_fallbacks + 1);
+    EXPECT_TRUE(CpuHeapOps::release(region));
+}
+
+TEST(CpuHeapOpsTest, ConfigReadsSeeWholeSnapshots) {
+    HeapConfigGuard guard(CpuHeapConfig{});
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        for (std::size_t i = 1; i <= 1000; ++i) {
+            CpuHeapOps::configure(CpuHeapConfig{.huge_page_threshold = i, .huge_page_size = i});
+        }
+        stop.store(true);
+    });
+    while (!stop.load()) {
+        const auto config = CpuHeapOps::config();
+        if (config.huge_page_size != 0) {
+            ASSERT_EQ(config.huge_page_threshold, config.huge_page_size);
+        }
+    }
+    writer.join();
+    EXPECT_EQ(CpuHeapOps::config().huge_page_threshold, 1000u);
+}
+
+TEST(CpuHeapOpsTest, SmallRegionsIgnoreHugePagePolicy) {
+    HeapConfigGuard guard(CpuHeapConfig{.page_kind = CpuPageKind::TransparentHuge});
+    const auto before = CpuHeapOps::stats();
+    auto region = CpuHeapOps::reserve(4096);
+    EXPECT_EQ(CpuHeapOps::pageKindOf(region.data()), CpuPageKind::Base);
+    EXPECT_EQ(CpuHeapOps::stats().huge_page_fallbacks, before.huge_page_fallbacks);
+    EXPECT_TRUE(CpuHeapOps::release(region));
+}
+
+TEST(CpuHeapOpsTest, ParallelPrefaultPopulatesMappedRegion) {
+    constexpr std::size_t kSize = 1024 * 1024;
+    auto pool = std::make_shared<CpuThreadPool>(CpuThreadPool::Config{.thread_count = 4});
+    HeapConfigGuard guard(CpuHeapConfig{
+        .prefault = true, .parallel_prefault_threshold = 64 * 1024, .prefault_pool = pool});
+    const auto before = CpuHeapOps::stats();
+    auto region = CpuHeapOps::reserve(kSize);
+    auto mapped = CpuHeapOps::map(region);
+    ASSERT_TRUE(mapped);
+    EXPECT_EQ(CpuHeapOps::stats().prefaulted_bytes, before.prefaulted_bytes + kSize);
+
+    const auto* bytes = static_cast<const unsigned char*>(mapped.data());
+    EXPECT_EQ(bytes[0], 0);
+    EXPECT_EQ(bytes[kSize - 1], 0);
+    CpuHeapOps::unmap(region, kSize);
+    EXPECT_TRUE(CpuHeapOps::release(region));
+}
+
+TEST(CpuHeapOpsTest, PrefaultRunsOnCallerOnceThePoolIsGone) {
+    constexpr std::size_t kSize = 256 * 1024;
+    auto pool = std::make_shared<CpuThreadPool>(CpuThreadPool::Config{.thread_count = 2});
+    HeapConfigGuard guard(CpuHeapConfig{
+        .prefault = true, .parallel_prefault_threshold = 64 * 1024, .prefault_pool = pool});
+    pool.reset();
+
+    const auto before = CpuHeapOps::stats();
+    auto region = CpuHeapOps::reserve(kSize);
+    auto mapped = CpuHeapOps::map(region);
+    ASSERT_TRUE(mapped);
+    EXPECT_EQ(CpuHeapOps::stats().prefaulted_bytes, before.prefaulted_bytes + kSize);
+    CpuHeapOps::unmap(region, kSize);
+    EXPECT_TRUE(CpuHeapOps::release(region));
+}
+
+TEST(CpuHeapOpsTest, RegionStatsTrackMappedSlices) {
+    constexpr std::size_t kSize = 64 * 1024;
+    auto region = CpuHeapOps::reserve(kSize);
+    CpuHeapOps::HeapRegion slice{static_cast<char*>(region.data()) + 4096, 8192};
+    CpuHeapOps::map(slice);
+
+    bool found = false;
+    for (const auto& entry : CpuHeapOps::regionStats()) {
+        if (entry.base != region.data()) continue;
+        found = true;
+        EXPECT_EQ(entry.size, kSize);
+        EXPECT_EQ(entry.kind, CpuPageKind::Base);
+        EXPECT_GT(entry.page_size, 0u);
+        EXPECT_EQ(entry.mapped_bytes, 8192u);
+    }
+    EXPECT_TRUE(found);
+
+    CpuHeapOps::unmap(slice, slice.size());
+    EXPECT_TRUE(CpuHeapOps::release(region));
+}
+
+TEST(CpuHeapOpsTest, ReleaseRejectsUnknownRegions) {
+    auto region = CpuHeapOps::reserve(8192);
+    CpuHeapOps::HeapRegion interior{static_cast<char*>(region.data()) + 4096, 4096};
+    EXPECT_FALSE(CpuHeapOps::release(interior));
+    EXPECT_TRUE(CpuHeapOps::release(region));
+    EXPECT_FALSE(CpuHeapOps::release(region));
+}
+
 }  // namespace orteaf::tests
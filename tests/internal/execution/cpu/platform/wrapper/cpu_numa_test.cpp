@@ -0,0 +1,61 @@
+/**
+ * @file cpu_numa_test.cpp
+ * @brief Tests for NUMA topology queries and memory placement.
+ */
+
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <sys/mman.h>
+
+namespace cpu = orteaf::internal::execution::cpu::platform::wrapper;
+
+/**
+ * @brief Test that the host always reports at least one node.
+ */
+TEST(CpuNuma, ReportsAtLeastOneNode) {
+    const auto nodes = cpu::numaNodes();
+    ASSERT_FALSE(nodes.empty());
+    for (std::size_t i = 1; i < nodes.size(); ++i) {
+        EXPECT_LT(nodes[i - 1], nodes[i]);
+    }
+}
+
+/**
+ * @brief Test that an invalid node has no cores.
+ */
+TEST(CpuNuma, NegativeNodeHasNoCores) {
+    EXPECT_TRUE(cpu::numaNodeCores(-1).empty());
+}
+
+/**
+ * @brief Test that invalid placement requests are rejected.
+ */
+TEST(CpuNuma, BindRejectsInvalidArguments) {
+    int value = 0;
+    EXPECT_FALSE(cpu::bindToNumaNode(nullptr, 4096, 0));
+    EXPECT_FALSE(cpu::bindToNumaNode(&value, sizeof(value), -1));
+}
+
+/**
+ * @brief Test that bound pages fault in on the requested node.
+ */
+TEST(CpuNuma, BoundPagesLandOnNode) {
+    constexpr std::size_t kSize = 1 << 20;
+    void* region = mmap(nullptr, kSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    ASSERT_NE(region, MAP_FAILED);
+    const int node = cpu::numaNodes().back();
+    if (!cpu::bindToNumaNode(region, kSize, node)) {
+        munmap(region, kSize);
+        GTEST_SKIP() << "mbind is not available";
+    }
+    std::memset(region, 1, kSize);
+    const int actual = cpu::numaNodeOfAddress(region);
+    if (actual >= 0) {
+        EXPECT_EQ(actual, node);
+    }
+    munmap(region, kSize);
+}
@@ -0,0 +1,141 @@
+#include "orteaf/internal/execution/cpu/resource/cpu_command_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace cpu_resource = ::orteaf::internal::execution::cpu::resource;
+
+namespace {
+
+using Queue = cpu_resource::CpuCommandQueue;
+
+// Holds queued tasks until release() is called.
+class Gate {
+public:
+  void wait() { open_.wait(false); }
+  void release() {
+    open_.store(true);
+    open_.notify_all();
+  }
+
+private:
+  std::atomic<bool> open_{false};
+};
+
+TEST(CpuCommandQueueTest, RunsTasksInSubmissionOrder) {
+  Queue queue;
+  std::vector<int> order;
+  for (int i = 0; i < 16; ++i) {
+    queue.submit([&order, i] { order.push_back(i); });
+  }
+  queue.synchronize();
+
+  ASSERT_EQ(order.size(), 16u);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(order[static_cast<std::size_t>(i)], i);
+  }
+  EXPECT_EQ(queue.submittedEpoch(), 16u);
+  EXPECT_EQ(queue.completedEpoch(), 16u);
+}
+
+TEST(CpuCommandQueueTest, SubmitReturnsBeforeTaskCompletes) {
+  Queue queue;
+  Gate gate;
+  const auto token = queue.submit([&gate] { gate.wait(); });
+  EXPECT_FALSE(token.empty());
+  EXPECT_FALSE(token.isCompleted());
+  EXPECT_FALSE(queue.lastToken().isCompleted());
+
+  gate.release();
+  token.wait();
+  EXPECT_TRUE(token.isCompleted());
+}
+
+TEST(CpuCommandQueueTest, DefaultTokensAreCompleted) {
+  const cpu_resource::FenceToken fence{};
+  EXPECT_TRUE(fence.empty());
+  EXPECT_TRUE(fence.isCompleted());
+  fence.wait();
+
+  const cpu_resource::ReuseToken reuse{};
+  EXPECT_TRUE(reuse.empty());
+  EXPECT_TRUE(reuse.isCompleted());
+
+  Queue queue;
+  EXPECT_TRUE(queue.lastToken().isCompleted());
+}
+
+TEST(CpuCommandQueueTest, ReuseTokenKeepsLatestFencePerQueue) {
+  Queue first;
+  Queue second;
+  Gate gate;
+  cpu_resource::ReuseToken reuse;
+  reuse.addOrReplace(first.submit([] {}));
+  reuse.addOrReplace(first.submit([&gate] { gate.wait(); }));
+  reuse.addOrReplace(second.submit([] {}));
+  reuse.addOrReplace(cpu_resource::FenceToken{});
+  ASSERT_EQ(reuse.size(), 2u);
+  EXPECT_EQ(reuse.begin()->epoch, 2u);
+
+  second.synchronize();
+  EXPECT_FALSE(reuse.isCompleted());
+  gate.release();
+  reuse.wait();
+  EXPECT_TRUE(reuse.isCompleted());
+}
+
+TEST(CpuCommandQueueTest, KeepAliveIsReleasedAfterCompletion) {
+  Queue queue;
+  Gate gate;
+  auto object = std::make_shared<int>(7);
+  std::weak_ptr<int> watch = object;
+
+  queue.submit([&gate] { gate.wait(); }, std::move(object));
+  EXPECT_EQ(queue.retainedCount(), 1u);
+  EXPECT_EQ(queue.releaseCompleted(), 0u);
+  EXPECT_FALSE(watch.expired());
+
+  gate.release();
+  queue.synchronize();
+  EXPECT_EQ(queue.retainedCount(), 0u);
+  EXPECT_TRUE(watch.expired());
+}
+
+TEST(CpuCommandQueueTest, SynchronizeRethrowsFirstTaskError) {
+  Queue queue;
+  std::atomic<int> ran{0};
+  queue.submit([] { throw std::runtime_error("first"); });
+  queue.submit([] { throw std::logic_error("second"); });
+  queue.submit([&ran] { ran.fetch_add(1); });
+
+  EXPECT_THROW(queue.synchronize(), std::runtime_error);
+  EXPECT_EQ(ran.load(), 1);
+  EXPECT_NO_THROW(queue.synchronize());
+}
+
+TEST(CpuCommandQueueTest, RejectsEmptyTask) {
+  Queue queue;
+  EXPECT_THROW(queue.submit(Queue::Task{}), std::system_error);
+}
+
+TEST(CpuCommandQueueTest, DestructorDrainsPendingTasks) {
+  std::atomic<int> ran{0};
+  {
+    Queue queue;
+    for (int i = 0; i < 8; ++i) {
+      queue.submit([&ran] {
+        std::this_thread::yield();
+        ran.fetch_add(1);
+      });
+    }
+  }
+  EXPECT_EQ(ran.load(), 8);
+}
+
+} // namespace
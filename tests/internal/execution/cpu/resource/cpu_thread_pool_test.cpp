@@ -0,0 +1,188 @@
+#include "orteaf/internal/execution/cpu/resource/cpu_thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace cpu_resource = ::orteaf::internal::execution::cpu::resource;
+
+namespace {
+
+using Pool = cpu_resource::CpuThreadPool;
+using Index = Pool::Index;
+
+TEST(CpuThreadPoolTest, ConcurrencyFollowsConfig) {
+  Pool inline_pool{Pool::Config{1}};
+  EXPECT_EQ(inline_pool.concurrency(), 1u);
+
+  Pool pool{Pool::Config{4}};
+  EXPECT_EQ(pool.concurrency(), 4u);
+
+  Pool default_pool{};
+  EXPECT_GE(default_pool.concurrency(), 1u);
+}
+
+TEST(CpuThreadPoolTest, ParallelForCoversRangeOnce) {
+  Pool pool{Pool::Config{4}};
+  std::vector<std::atomic<int>> hits(1000);
+  pool.parallelFor(0, 1000, 7, [&](Index begin, Index end) {
+    EXPECT_LT(begin, end);
+    for (Index i = begin; i < end; ++i) {
+      hits[static_cast<std::size_t>(i)].fetch_add(1);
+    }
+  });
+  for (const auto &hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+}
+
+TEST(CpuThreadPoolTest, EmptyAndSmallRangesRunInline) {
+  Pool pool{Pool::Config{4}};
+  int calls = 0;
+  pool.parallelFor(5, 5, 1, [&](Index, Index) { ++calls; });
+  EXPECT_EQ(calls, 0);
+
+  const auto caller = std::this_thread::get_id();
+  pool.parallelFor(0, 3, 8, [&](Index begin, Index end) {
+    ++calls;
+    EXPECT_EQ(begin, 0);
+    EXPECT_EQ(end, 3);
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+  });
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(CpuThreadPoolTest, WorkSpreadsOverWorkers) {
+  Pool pool{Pool::Config{4}};
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  pool.parallelFor(0, 64, 1, [&](Index, Index) {
+    // Long enough that idle workers pick up queued chunks.
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.insert(std::this_thread::get_id());
+  });
+  EXPECT_GT(threads.size(), 1u);
+}
+
+TEST(CpuThreadPoolTest, NestedParallelForCompletes) {
+  Pool pool{Pool::Config{3}};
+  std::atomic<Index> total{0};
+  pool.parallelFor(0, 8, 1, [&](Index outer_begin, Index outer_end) {
+    for (Index outer = outer_begin; outer < outer_end; ++outer) {
+      pool.parallelFor(0, 100, 1, [&](Index begin, Index end) {
+        total.fetch_add(end - begin);
+      });
+    }
+  });
+  EXPECT_EQ(total.load(), 800);
+  EXPECT_EQ(pool.currentWorkerIndex(), -1);
+}
+
+TEST(CpuThreadPoolTest, ParallelReduceIsDeterministic) {
+  Pool pool{Pool::Config{4}};
+  auto sum = [&] {
+    return pool.parallelReduce(
+        Index{1}, Index{10001}, Index{16}, std::int64_t{0},
+        [](Index begin, Index end) {
+          std::int64_t partial = 0;
+          for (Index i = begin; i < end; ++i) {
+            partial += i;
+          }
+          return partial;
+        },
+        [](std::int64_t lhs, std::int64_t rhs) { return lhs + rhs; });
+  };
+  EXPECT_EQ(sum(), 50005000);
+  EXPECT_EQ(sum(), sum());
+  EXPECT_EQ(pool.parallelReduce(
+                Index{3}, Index{3}, Index{1}, 42, [](Index, Index) { return 0; },
+                [](int lhs, int rhs) { return lhs + rhs; }),
+            42);
+}
+
+TEST(CpuThreadPoolTest, ExceptionPropagatesToCaller) {
+  Pool pool{Pool::Config{4}};
+  std::atomic<Index> visited{0};
+  EXPECT_THROW(pool.parallelFor(0, 100, 1,
+                                [&](Index begin, Index end) {
+                                  visited.fetch_add(end - begin);
+                                  if (begin <= 50 && 50 < end) {
+                                    throw std::runtime_error("chunk failed");
+                                  }
+                                }),
+               std::runtime_error);
+  // Every chunk still ran before the exception was rethrown.
+  EXPECT_EQ(visited.load(), 100);
+
+  // The pool stays usable afterwards.
+  std::atomic<Index> after{0};
+  pool.parallelFor(0, 10, 1,
+                   [&](Index begin, Index end) { after += end - begin; });
+  EXPECT_EQ(after.load(), 10);
+}
+
+TEST(CpuThreadPoolTest, WorkerMayDropTheLastReference) {
+  auto pool = std::make_shared<Pool>(Pool::Config{2});
+  Pool *raw = pool.get();
+  std::atomic<bool> released{false};
+  // Chunk 0 runs on the caller and waits, so the worker runs chunk 1 and
+  // destroys the pool from inside its own task.
+  raw->parallelFor(0, 2, 1, [&](Index begin, Index) {
+    if (begin == 1) {
+      pool.reset();
+      released.store(true);
+      return;
+    }
+    while (!released.load()) {
+      std::this_thread::yield();
+    }
+    // Let the worker retire its task, so the caller finds the job done
+    // without touching the destroyed pool.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  });
+  EXPECT_TRUE(released.load());
+  EXPECT_EQ(pool, nullptr);
+}
+
+TEST(CpuThreadPoolTest, PinnedPoolRuns) {
+  Pool pool{Pool::Config{2, /*pin_threads=*/true}};
+  std::atomic<Index> total{0};
+  pool.parallelFor(0, 32, 1,
+                   [&](Index begin, Index end) { total += end - begin; });
+  EXPECT_EQ(total.load(), 32);
+}
+
+#if defined(__linux__)
+TEST(CpuThreadPoolTest, WorkersPinToCoreList) {
+  Pool::Config config{3, /*pin_threads=*/true};
+  config.cores = {0};
+  Pool pool{config};
+  std::mutex mutex;
+  std::set<int> worker_cpus;
+  pool.parallelFor(0, 256, 1, [&](Index, Index) {
+    if (pool.currentWorkerIndex() >= 0) {
+      std::lock_guard<std::mutex> lock(mutex);
+      worker_cpus.insert(sched_getcpu());
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  });
+  for (int cpu : worker_cpus) {
+    EXPECT_EQ(cpu, 0);
+  }
+}
+#endif
+
+} // namespace
@@ -0,0 +1,264 @@
+#include "orteaf/internal/kernel/autotune/kernel_autotuner.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "orteaf/internal/kernel/core/kernel_key.h"
+#include "orteaf/internal/kernel/core/kernel_metadata.h"
+#include "orteaf/internal/kernel/core/variant.h"
+#include "orteaf/internal/kernel/registry/persistent_kernel_store.h"
+
+namespace kernel = orteaf::internal::kernel;
+namespace autotune = kernel::autotune;
+using Architecture = orteaf::internal::architecture::Architecture;
+using DType = orteaf::internal::DType;
+using Op = orteaf::internal::ops::Op;
+using Registry = autotune::KernelAutotuner::Registry;
+using Entry = autotune::KernelAutotuner::Entry;
+
+namespace {
+
+// Never run: the fake timer below tells candidates apart by pointer.
+void smallTileKernel(Entry::KernelBaseLease &, kernel::KernelArgs &) {}
+void largeTileKernel(Entry::KernelBaseLease &, kernel::KernelArgs &) {}
+
+// Small problems favour smallTileKernel, large ones largeTileKernel.
+bool g_large_problem = false;
+int g_measure_calls = 0;
+
+double fakeMeasure(Entry &entry, kernel::KernelArgs &) {
+  ++g_measure_calls;
+  const bool small_tile = entry.execute() == &smallTileKernel;
+  return small_tile == g_large_problem ? 100.0 : 10.0;
+}
+
+constexpr Op kOp = static_cast<Op>(1);
+
+kernel::KernelKey keyOf(Architecture architecture, std::uint64_t variant) {
+  return kernel::kernel_key::make(kOp, architecture,
+                                  static_cast<kernel::Layout>(0), DType::F32,
+                                  static_cast<kernel::Variant>(variant));
+}
+
+void registerCandidate(Registry &registry, kernel::KernelKey key,
+                       Entry::ExecuteFunc execute) {
+  kernel::core::KernelMetadataLease metadata;
+  metadata.setExecute(execute);
+  registry.registerKernel(key, std::move(metadata));
+}
+
+class KernelAutotunerTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    g_large_problem = false;
+    g_measure_calls = 0;
+    path_ = (std::filesystem::temp_directory_path() /
+             ("orteaf_autotune_" +
+              std::string(::testing::UnitTest::GetInstance()
+                              ->current_test_info()
+                              ->name()) +
+              ".txt"))
+                .string();
+    std::filesystem::remove(path_);
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  autotune::KernelAutotuner::Config config(bool persistent = false) const {
+    autotune::KernelAutotuner::Config config;
+    config.repetitions = 3;
+    config.measure = &fakeMeasure;
+    if (persistent) {
+      config.cache_path = path_;
+    }
+    return config;
+  }
+
+  std::string path_;
+  kernel::KeyRequest request_{kOp, DType::F32, Architecture::CpuGeneric};
+  kernel::KernelArgs args_;
+};
+
+TEST(ShapeBucketTest, RoundsExtentsToPowersOfTwo) {
+  const std::vector<std::int64_t> a{60, 64};
+  const std::vector<std::int64_t> b{64, 64};
+  const std::vector<std::int64_t> c{4096, 4096};
+  const std::vector<std::int64_t> flat{64 * 64};
+  EXPECT_EQ(autotune::shapeBucket(a), autotune::shapeBucket(b));
+  EXPECT_NE(autotune::shapeBucket(b), autotune::shapeBucket(c));
+  EXPECT_NE(autotune::shapeBucket(b), autotune::shapeBucket(flat));
+}
+
+TEST_F(KernelAutotunerTest, PicksFastestVariantPerBucket) {
+  Registry registry;
+  const auto small_key = keyOf(Architecture::CpuGeneric, 0);
+  const auto large_key = keyOf(Architecture::CpuGeneric, 1);
+  registerCandidate(registry, small_key, &smallTileKernel);
+  registerCandidate(registry, large_key, &largeTileKernel);
+  autotune::KernelAutotuner tuner(config());
+
+  const std::vector<std::int64_t> small_shape{64, 64};
+  const std::vector<std::int64_t> large_shape{4096, 4096};
+  const auto small_bucket = autotune::shapeBucket(small_shape);
+  const auto large_bucket = autotune::shapeBucket(large_shape);
+
+  auto chosen = tuner.select(registry, request_, args_, small_bucket);
+  ASSERT_TRUE(chosen.has_value());
+  EXPECT_EQ(*chosen, small_key);
+  // One warm-up and three timed runs per candidate.
+  EXPECT_EQ(g_measure_calls, 8);
+
+  g_large_problem = true;
+  chosen = tuner.select(registry, request_, args_, large_bucket);
+  ASSERT_TRUE(chosen.has_value());
+  EXPECT_EQ(*chosen, large_key);
+
+  // Decided buckets are not timed again.
+  const int calls = g_measure_calls;
+  EXPECT_EQ(tuner.select(registry, request_, args_, small_bucket), small_key);
+  EXPECT_EQ(g_measure_calls, calls);
+
+  const auto stats = tuner.stats();
+  EXPECT_EQ(stats.tuned, 2u);
+  EXPECT_EQ(stats.cached_hits, 1u);
+  EXPECT_EQ(stats.candidates_timed, 4u);
+}
+
+TEST_F(KernelAutotunerTest, WrittenOperandsWithoutScratchAreNotTimed) {
+  Registry registry;
+  registerCandidate(registry, keyOf(Architecture::CpuGeneric, 0),
+                    &smallTileKernel);
+  registerCandidate(registry, keyOf(Architecture::CpuGeneric, 1),
+                    &largeTileKernel);
+  autotune::KernelAutotuner tuner(config());
+
+  kernel::KernelArgs args;
+  args.addStorage(kernel::OperandId::Input0, {});
+  args.addStorage(kernel::OperandId::InOut, {});
+  EXPECT_EQ(tuner.select(registry, request_, args, 0),
+            keyOf(Architecture::CpuGeneric, 0));
+  EXPECT_EQ(g_measure_calls, 0);
+  EXPECT_FALSE(tuner.decision(request_, 0).has_value());
+  EXPECT_EQ(tuner.stats().untimed, 1u);
+}
+
+TEST_F(KernelAutotunerTest, UsesMostSpecificArchitectureAndSkipsFused) {
+  Registry registry;
+  const auto zen4_key = kernel::kernel_key::make(
+      kOp, Architecture::CpuZen4, static_cast<kernel::Layout>(0), DType::F32,
+      kernel::variant::kDefault);
+  registerCandidate(registry, keyOf(Architecture::CpuGeneric, 0),
+                    &smallTileKernel);
+  registerCandidate(registry, zen4_key, &largeTileKernel);
+  registerCandidate(registry,
+                    kernel::kernel_key::make(
+                        kOp, Architecture::CpuZen4,
+                        static_cast<kernel::Layout>(0), DType::F32,
+                        kernel::variant::fusedElementwise(0)),
+                    &smallTileKernel);
+  autotune::KernelAutotuner tuner(config());
+
+  const kernel::KeyRequest zen4{kOp, DType::F32, Architecture::CpuZen4};
+  EXPECT_EQ(tuner.select(registry, zen4, args_, 0), zen4_key);
+  // A single candidate needs no timing.
+  EXPECT_EQ(g_measure_calls, 0);
+
+  const kernel::KeyRequest other{kOp, DType::F16, Architecture::CpuZen4};
+  EXPECT_FALSE(tuner.select(registry, other, args_, 0).has_value());
+}
+
+TEST_F(KernelAutotunerTest, ReloadsDecisionsFromCacheFile) {
+  Registry registry;
+  const auto small_key = keyOf(Architecture::CpuGeneric, 0);
+  const auto large_key = keyOf(Architecture::CpuGeneric, 1);
+  registerCandidate(registry, small_key, &smallTileKernel);
+  registerCandidate(registry, large_key, &largeTileKernel);
+
+  g_large_problem = true;
+  {
+    autotune::KernelAutotuner tuner(config(true));
+    EXPECT_EQ(tuner.select(registry, request_, args_, 7), large_key);
+  }
+
+  g_measure_calls = 0;
+  g_large_problem = false; // would flip the decision if re-tuned
+  autotune::KernelAutotuner restarted(config(true));
+  EXPECT_EQ(restarted.stats().loaded, 1u);
+  EXPECT_EQ(restarted.decision(request_, 7), large_key);
+  EXPECT_EQ(restarted.select(registry, request_, args_, 7), large_key);
+  EXPECT_EQ(g_measure_calls, 0);
+}
+
+TEST_F(KernelAutotunerTest, RetunesWhenLoadedKeyIsGone) {
+  {
+    Registry registry;
+    registerCandidate(registry, keyOf(Architecture::CpuGeneric, 2),
+                      &largeTileKernel);
+    autotune::KernelAutotuner tuner(config(true));
+    ASSERT_TRUE(tuner.select(registry, request_, args_, 0).has_value());
+    ASSERT_TRUE(tuner.save());
+  }
+
+  Registry registry;
+  const auto small_key = keyOf(Architecture::CpuGeneric, 0);
+  registerCandidate(registry, small_key, &smallTileKernel);
+  autotune::KernelAutotuner restarted(config(true));
+  EXPECT_EQ(restarted.stats().loaded, 1u);
+  EXPECT_EQ(restarted.select(registry, request_, args_, 0), small_key);
+  EXPECT_EQ(restarted.stats().tuned, 1u);
+}
+
+TEST_F(KernelAutotunerTest, IgnoresForeignCacheFile) {
+  {
+    std::ofstream out(path_);
+    out << "something else\n1 2 3\n";
+  }
+  autotune::KernelAutotuner tuner(config(true));
+  EXPECT_EQ(tuner.stats().loaded, 0u);
+  EXPECT_FALSE(tuner.decision(request_, 2).has_value());
+
+  // The first decision replaces the foreign file.
+  Registry registry;
+  const auto key = keyOf(Architecture::CpuGeneric, 0);
+  registerCandidate(registry, key, &smallTileKernel);
+  ASSERT_EQ(tuner.select(registry, request_, args_, 2), key);
+  autotune::KernelAutotuner restarted(config(true));
+  EXPECT_EQ(restarted.stats().loaded, 1u);
+  EXPECT_EQ(restarted.decision(request_, 2), key);
+}
+
+TEST_F(KernelAutotunerTest, SharesDecisionsThroughPersistentStore) {
+  Registry registry;
+  const auto small_key = keyOf(Architecture::CpuGeneric, 0);
+  const auto large_key = keyOf(Architecture::CpuGeneric, 1);
+  registerCandidate(registry, small_key, &smallTileKernel);
+  registerCandidate(registry, large_key, &largeTileKernel);
+
+  const std::string store_path = path_ + ".store";
+  std::filesystem::remove(store_path);
+  {
+    kernel::registry::PersistentKernelStore store(store_path);
+    auto tuned = config();
+    tuned.store = &store;
+    g_large_problem = true;
+    autotune::KernelAutotuner tuner(tuned);
+    EXPECT_EQ(tuner.select(registry, request_, args_, 3), large_key);
+  }
+
+  g_measure_calls = 0;
+  kernel::registry::PersistentKernelStore store(store_path);
+  auto restarted_config = config();
+  restarted_config.store = &store;
+  autotune::KernelAutotuner restarted(restarted_config);
+  EXPECT_EQ(restarted.select(registry, request_, args_, 3), large_key);
+  EXPECT_EQ(g_measure_calls, 0);
+  EXPECT_EQ(restarted.stats().tuned, 0u);
+  std::filesystem::remove(store_path);
+}
+
+} // namespace
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#include "orteaf/internal/kernel/cpu/cpu_copy.h"
+
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+using ::orteaf::internal::DType;
+using ::orteaf::internal::execution::cpu::resource::CpuThreadPool;
+
+namespace {
+
+using Dim = cpu_kernel::CpuOperand::Dim;
+
+template <typename T>
+cpu_kernel::CpuOperand makeOperand(std::vector<T> &values, DType dtype,
+                                   cpu_kernel::CpuOperand::Dims shape,
+                                   cpu_kernel::CpuOperand::Dims strides,
+                                   Dim offset = 0) {
+  cpu_kernel::CpuOperand operand;
+  operand.data = reinterpret_cast<std::byte *>(values.data() + offset);
+  operand.dtype = dtype;
+  operand.shape = std::move(shape);
+  operand.strides = std::move(strides);
+  return operand;
+}
+
+template <typename T> std::vector<T> iota(std::size_t count) {
+  std::vector<T> values(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    values[i] = static_cast<T>(i);
+  }
+  return values;
+}
+
+TEST(CpuCopyTest, TransposesWithTiles) {
+  // Odd sizes so tiles at both edges are partial.
+  constexpr Dim kRows = 67;
+  constexpr Dim kCols = 45;
+  auto src = iota<float>(kRows * kCols);
+
+  for (CpuThreadPool *pool : {static_cast<CpuThreadPool *>(nullptr),
+                              new CpuThreadPool(CpuThreadPool::Config{4})}) {
+    std::vector<float> dst(kRows * kCols, -1.0f);
+    // dst[c][r] = src[r][c]
+    cpu_kernel::copyStrided(
+        makeOperand(src, DType::F32, {kCols, kRows}, {1, kCols}),
+        makeOperand(dst, DType::F32, {kCols, kRows}, {kRows, 1}), pool);
+    for (Dim c = 0; c < kCols; ++c) {
+      for (Dim r = 0; r < kRows; ++r) {
+        ASSERT_EQ(dst[c * kRows + r], src[r * kCols + c])
+            << "r=" << r << " c=" << c;
+      }
+    }
+    delete pool;
+  }
+}
+
+TEST(CpuCopyTest, CopiesBatchedPermutation) {
+  // src [B, R, C] viewed as [B, C, R].
+  constexpr Dim kBatch = 3;
+  constexpr Dim kRows = 40;
+  constexpr Dim kCols = 36;
+  auto src = iota<std::uint16_t>(kBatch * kRows * kCols);
+  std::vector<std::uint16_t> dst(src.size());
+
+  cpu_kernel::copyStrided(
+      makeOperand(src, DType::F16, {kBatch, kCols, kRows},
+                  {kRows * kCols, 1, kCols}),
+      makeOperand(dst, DType::F16, {kBatch, kCols, kRows},
+                  {kRows * kCols, kRows, 1}));
+  for (Dim b = 0; b < kBatch; ++b) {
+    for (Dim c = 0; c < kCols; ++c) {
+      for (Dim r = 0; r < kRows; ++r) {
+        ASSERT_EQ(dst[(b * kCols + c) * kRows + r],
+                  src[(b * kRows + r) * kCols + c]);
+      }
+    }
+  }
+}
+
+TEST(CpuCopyTest, CopiesSlicesWithOffsetAndStep) {
+  // src is 6 x 8; copy rows 1..4 and every other column starting at 1.
+  auto src = iota<double>(48);
+  std::vector<double> dst(16);
+  cpu_kernel::copyStrided(makeOperand(src, DType::F64, {4, 4}, {8, 2}, 9),
+                          makeOperand(dst, DType::F64, {4, 4}, {4, 1}));
+  for (Dim r = 0; r < 4; ++r) {
+    for (Dim c = 0; c < 4; ++c) {
+      EXPECT_EQ(dst[r * 4 + c], src[(r + 1) * 8 + 1 + 2 * c]);
+    }
+  }
+}
+
+TEST(CpuCopyTest, RejectsMismatchedOperands) {
+  std::vector<float> a(6), b(6);
+  EXPECT_THROW(
+      cpu_kernel::copyStrided(makeOperand(a, DType::F32, {2, 3}, {3, 1}),
+                              makeOperand(b, DType::F32, {3, 2}, {2, 1})),
+      std::system_error);
+  EXPECT_THROW(
+      cpu_kernel::copyStrided(makeOperand(a, DType::F32, {6}, {1}),
+                              makeOperand(b, DType::I32, {6}, {1})),
+      std::system_error);
+}
+
+} // namespace
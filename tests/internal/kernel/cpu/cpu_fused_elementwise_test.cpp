@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#include "orteaf/internal/kernel/cpu/cpu_fused_elementwise.h"
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+using ::orteaf::internal::DType;
+using ::orteaf::internal::ops::Op;
+using cpu_kernel::fusedAdd;
+using cpu_kernel::fusedInput;
+using cpu_kernel::fusedRelu;
+using cpu_kernel::fusedResult;
+
+namespace {
+
+constexpr auto kAddReluAdd = cpu_kernel::makeFusedExpression(
+    fusedAdd(fusedInput(0), fusedInput(1)), fusedRelu(fusedResult(0)),
+    fusedAdd(fusedResult(1), fusedInput(2), 0.5f));
+
+static_assert(kAddReluAdd.valid());
+static_assert(kAddReluAdd.inputCount() == 3);
+static_assert(kAddReluAdd.rootOp() == Op::Add);
+static_assert(cpu_kernel::isFusableOp(Op::Relu));
+static_assert(!cpu_kernel::isFusableOp(Op::MatMul));
+// A node may only read results of nodes before it.
+static_assert(!cpu_kernel::makeFusedExpression(fusedRelu(fusedResult(0)))
+                   .valid());
+static_assert(
+    !cpu_kernel::makeFusedExpression(fusedRelu(fusedInput(4))).valid());
+
+std::vector<cpu_kernel::CpuIsa> allIsas() {
+  std::vector<cpu_kernel::CpuIsa> isas{cpu_kernel::CpuIsa::Scalar};
+  for (auto isa : {cpu_kernel::CpuIsa::Neon, cpu_kernel::CpuIsa::Avx2,
+                   cpu_kernel::CpuIsa::Avx512}) {
+    if (cpu_kernel::isSupported(isa)) {
+      isas.push_back(isa);
+    }
+  }
+  return isas;
+}
+
+template <typename T>
+cpu_kernel::CpuOperand makeOperand(std::vector<T> &values, DType dtype,
+                                   cpu_kernel::CpuOperand::Dims shape,
+                                   cpu_kernel::CpuOperand::Dims strides) {
+  cpu_kernel::CpuOperand operand;
+  operand.data = reinterpret_cast<std::byte *>(values.data());
+  operand.dtype = dtype;
+  operand.shape = std::move(shape);
+  operand.strides = std::move(strides);
+  return operand;
+}
+
+TEST(CpuFusedElementwiseTest, AddReluAddMatchesUnfusedWithBroadcast) {
+  // out[i][j] = relu(a[i][j] + b[j]) + 0.5 * c[i], with a read transposed.
+  constexpr std::int64_t kRows = 5;
+  constexpr std::int64_t kCols = 700;
+  std::vector<float> a(kRows * kCols), b(kCols), c(kRows);
+  for (std::int64_t k = 0; k < kRows * kCols; ++k) {
+    a[k] = static_cast<float>((k * 13) % 29) - 14.0f;
+  }
+  for (std::int64_t j = 0; j < kCols; ++j) {
+    b[j] = static_cast<float>(j % 7) - 3.0f;
+  }
+  for (std::int64_t i = 0; i < kRows; ++i) {
+    c[i] = static_cast<float>(i) * 2.0f;
+  }
+
+  for (auto isa : allIsas()) {
+    std::vector<float> out(kRows * kCols, -1.0f);
+    const std::vector<cpu_kernel::CpuOperand> inputs{
+        makeOperand(a, DType::F32, {kRows, kCols}, {1, kRows}),
+        makeOperand(b, DType::F32, {kCols}, {1}),
+        makeOperand(c, DType::F32, {kRows, 1}, {1, 1})};
+    const auto output =
+        makeOperand(out, DType::F32, {kRows, kCols}, {kCols, 1});
+
+    cpu_kernel::runFusedElementwise(kAddReluAdd.view(), inputs, output,
+                                    cpu_kernel::vectorOps(isa));
+
+    for (std::int64_t i = 0; i < kRows; ++i) {
+      for (std::int64_t j = 0; j < kCols; ++j) {
+        const float sum = a[j * kRows + i] + b[j];
+        const float expected = (sum < 0 ? 0.0f : sum) + 0.5f * c[i];
+        ASSERT_FLOAT_EQ(out[i * kCols + j], expected)
+            << "i=" << i << " j=" << j;
+      }
+    }
+  }
+}
+
+TEST(CpuFusedElementwiseTest, SupportsI32) {
+  std::vector<std::int32_t> a{-3, -1, 0, 2}, b{1, 1, 1, 1}, c{10, 20, 30, 40};
+  std::vector<std::int32_t> out(4);
+  const std::vector<cpu_kernel::CpuOperand> inputs{
+      makeOperand(a, DType::I32, {4}, {1}), makeOperand(b, DType::I32, {4}, {1}),
+      makeOperand(c, DType::I32, {4}, {1})};
+  const auto output = makeOperand(out, DType::I32, {4}, {1});
+
+  constexpr auto kExpression = cpu_kernel::makeFusedExpression(
+      fusedAdd(fusedInput(0), fusedInput(1)), fusedRelu(fusedResult(0)),
+      fusedAdd(fusedResult(1), fusedInput(2)));
+  cpu_kernel::runFusedElementwise(kExpression.view(), inputs, output,
+                                  cpu_kernel::vectorOps(
+                                      cpu_kernel::CpuIsa::Scalar));
+
+  EXPECT_EQ(out, (std::vector<std::int32_t>{10, 20, 31, 43}));
+
+  // A fractional alpha has no I32 meaning; nothing is written.
+  std::vector<std::int32_t> untouched(4, 7);
+  EXPECT_THROW(cpu_kernel::runFusedElementwise(
+                   kAddReluAdd.view(), inputs,
+                   makeOperand(untouched, DType::I32, {4}, {1}),
+                   cpu_kernel::vectorOps(cpu_kernel::CpuIsa::Scalar)),
+               std::system_error);
+  EXPECT_EQ(untouched, (std::vector<std::int32_t>(4, 7)));
+}
+
+TEST(CpuFusedElementwiseTest, RejectsMissingInputsAndShapeMismatch) {
+  std::vector<float> a(6), b(6), out(6);
+  const auto &ops = cpu_kernel::vectorOps(cpu_kernel::CpuIsa::Scalar);
+  const auto output = makeOperand(out, DType::F32, {2, 3}, {3, 1});
+
+  const std::vector<cpu_kernel::CpuOperand> too_few{
+      makeOperand(a, DType::F32, {2, 3}, {3, 1}),
+      makeOperand(b, DType::F32, {2, 3}, {3, 1})};
+  EXPECT_THROW(cpu_kernel::runFusedElementwise(kAddReluAdd.view(), too_few,
+                                               output, ops),
+               std::system_error);
+
+  constexpr auto kAdd =
+      cpu_kernel::makeFusedExpression(fusedAdd(fusedInput(0), fusedInput(1)));
+  const std::vector<cpu_kernel::CpuOperand> mismatched{
+      makeOperand(a, DType::F32, {2, 3}, {3, 1}),
+      makeOperand(b, DType::F32, {2}, {1})};
+  EXPECT_THROW(
+      cpu_kernel::runFusedElementwise(kAdd.view(), mismatched, output, ops),
+      std::system_error);
+}
+
+} // namespace
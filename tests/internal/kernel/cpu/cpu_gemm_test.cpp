@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/dtype/float16.h"
+#include "orteaf/internal/kernel/cpu/cpu_gemm.h"
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+namespace dtype_detail = ::orteaf::internal::detail;
+using ::orteaf::internal::DType;
+using ::orteaf::internal::execution::cpu::resource::CpuThreadPool;
+
+namespace {
+
+using Index = cpu_kernel::CpuGemmMicroKernel::Index;
+
+std::vector<cpu_kernel::CpuIsa> allIsas() {
+  std::vector<cpu_kernel::CpuIsa> isas{cpu_kernel::CpuIsa::Scalar};
+  for (auto isa : {cpu_kernel::CpuIsa::Neon, cpu_kernel::CpuIsa::Avx2,
+                   cpu_kernel::CpuIsa::Avx512}) {
+    if (cpu_kernel::isSupported(isa)) {
+      isas.push_back(isa);
+    }
+  }
+  return isas;
+}
+
+std::vector<float> makeFloats(Index count, float scale) {
+  std::vector<float> values(static_cast<std::size_t>(count));
+  for (Index i = 0; i < count; ++i) {
+    values[i] = scale * static_cast<float>((i * 37) % 19 - 9) / 8.0f;
+  }
+  return values;
+}
+
+struct Strided {
+  Index row_stride;
+  Index col_stride;
+};
+
+/// Reference C = A * B (+ bias) in double precision.
+std::vector<double> reference(const std::vector<float> &a, Strided a_layout,
+                              const std::vector<float> &b, Strided b_layout,
+                              const std::vector<float> *bias, Index m,
+                              Index n, Index k) {
+  std::vector<double> c(static_cast<std::size_t>(m * n), 0.0);
+  for (Index i = 0; i < m; ++i) {
+    for (Index j = 0; j < n; ++j) {
+      double sum = bias != nullptr ? (*bias)[j] : 0.0;
+      for (Index p = 0; p < k; ++p) {
+        sum += static_cast<double>(
+                   a[i * a_layout.row_stride + p * a_layout.col_stride]) *
+               b[p * b_layout.row_stride + j * b_layout.col_stride];
+      }
+      c[i * n + j] = sum;
+    }
+  }
+  return c;
+}
+
+struct GemmCase {
+  Index m;
+  Index n;
+  Index k;
+  bool transpose_a;
+  bool transpose_b;
+  bool bias;
+};
+
+// Sizes straddle every micro-tile and cache block edge at least once.
+constexpr GemmCase kCases[] = {
+    {1, 1, 1, false, false, false},   {5, 7, 3, false, false, true},
+    {6, 16, 9, true, false, false},   {17, 33, 20, false, true, true},
+    {130, 40, 11, true, true, false}, {9, 530, 5, false, false, true},
+    {33, 20, 300, false, true, false}, {4, 3, 0, false, false, true},
+};
+
+TEST(CpuGemmTest, MicroKernelFallsBackToSupportedIsa) {
+  for (auto isa : {cpu_kernel::CpuIsa::Scalar, cpu_kernel::CpuIsa::Neon,
+                   cpu_kernel::CpuIsa::Avx2, cpu_kernel::CpuIsa::Avx512}) {
+    const auto &kernel = cpu_kernel::gemmMicroKernel(isa);
+    EXPECT_EQ(kernel.isa, cpu_kernel::effectiveIsa(isa));
+    EXPECT_NE(kernel.run, nullptr);
+    EXPECT_EQ(kernel.mc % kernel.mr, 0);
+    EXPECT_EQ(kernel.nc % kernel.nr, 0);
+  }
+}
+
+TEST(CpuGemmTest, F32MatchesReference) {
+  for (auto isa : allIsas()) {
+    for (const auto &gemm_case : kCases) {
+      const Index m = gemm_case.m, n = gemm_case.n, k = gemm_case.k;
+      const auto a = makeFloats(m * k, 1.0f);
+      const auto b = makeFloats(k * n, -0.75f);
+      const auto bias = makeFloats(n, 2.0f);
+      const Strided a_layout = gemm_case.transpose_a ? Strided{1, m}
+                                                     : Strided{k, 1};
+      const Strided b_layout = gemm_case.transpose_b ? Strided{1, k}
+                                                     : Strided{n, 1};
+      const auto expected =
+          reference(a, a_layout, b, b_layout,
+                    gemm_case.bias ? &bias : nullptr, m, n, k);
+
+      std::vector<float> c(static_cast<std::size_t>(m * n), -1.0f);
+      cpu_kernel::CpuGemmBatch batch{};
+      batch.a = {a.data(), a_layout.row_stride, a_layout.col_stride};
+      batch.b = {b.data(), b_layout.row_stride, b_layout.col_stride};
+      batch.bias = {bias.data(), 0, 1};
+      batch.c = {c.data(), n, 1};
+      cpu_kernel::gemm(isa, {m, n, k, DType::F32, gemm_case.bias},
+                       {&batch, 1});
+
+      for (Index i = 0; i < m * n; ++i) {
+        ASSERT_NEAR(c[i], expected[i], 1e-3 * (1.0 + std::abs(expected[i])))
+            << "isa=" << static_cast<int>(isa) << " m=" << m << " n=" << n
+            << " k=" << k << " index=" << i;
+      }
+    }
+  }
+}
+
+TEST(CpuGemmTest, F16WithStridedOutputMatchesReference) {
+  constexpr Index m = 13, n = 21, k = 19;
+  const auto a = makeFloats(m * k, 1.0f);
+  const auto b = makeFloats(k * n, 0.5f);
+  std::vector<std::uint16_t> a_half(a.size()), b_half(b.size());
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    a_half[i] = dtype_detail::float32ToHalfBits(a[i]);
+  }
+  for (std::size_t i = 0; i < b.size(); ++i) {
+    b_half[i] = dtype_detail::float32ToHalfBits(b[i]);
+  }
+  const auto expected = reference(a, {k, 1}, b, {n, 1}, nullptr, m, n, k);
+
+  for (auto isa : allIsas()) {
+    // Column-major output exercises the strided store path.
+    std::vector<std::uint16_t> c(static_cast<std::size_t>(m * n));
+    cpu_kernel::CpuGemmBatch batch{};
+    batch.a = {a_half.data(), k, 1};
+    batch.b = {b_half.data(), n, 1};
+    batch.c = {c.data(), 1, m};
+    cpu_kernel::gemm(isa, {m, n, k, DType::F16, false}, {&batch, 1});
+    for (Index i = 0; i < m; ++i) {
+      for (Index j = 0; j < n; ++j) {
+        const double want = expected[i * n + j];
+        EXPECT_NEAR(dtype_detail::halfBitsToFloat32(c[j * m + i]), want,
+                    1e-2 * (1.0 + std::abs(want)));
+      }
+    }
+  }
+}
+
+TEST(CpuGemmTest, LargeBatchRunsInParallel) {
+  // Large enough to cross the parallel threshold with several blocks/batch.
+  constexpr Index m = 160, n = 96, k = 64, batch_count = 3;
+  const auto a = makeFloats(batch_count * m * k, 1.0f);
+  const auto b = makeFloats(k * n, -1.0f);
+  std::vector<float> c(static_cast<std::size_t>(batch_count * m * n));
+  std::vector<cpu_kernel::CpuGemmBatch> batches(batch_count);
+  for (Index i = 0; i < batch_count; ++i) {
+    batches[i].a = {a.data() + i * m * k, k, 1};
+    // rhs broadcast across the batch.
+    batches[i].b = {b.data(), n, 1};
+    batches[i].c = {c.data() + i * m * n, n, 1};
+  }
+  CpuThreadPool pool{CpuThreadPool::Config{4}};
+  cpu_kernel::gemm(cpu_kernel::CpuIsa::Avx512,
+                   {m, n, k, DType::F32, false}, batches, &pool);
+
+  for (Index batch = 0; batch < batch_count; ++batch) {
+    const std::vector<float> a_slice(a.begin() + batch * m * k,
+                                     a.begin() + (batch + 1) * m * k);
+    const auto expected = reference(a_slice, {k, 1}, b, {n, 1}, nullptr, m,
+                                    n, k);
+    for (Index i = 0; i < m * n; ++i) {
+      ASSERT_NEAR(c[batch * m * n + i], expected[i],
+                  1e-3 * (1.0 + std::abs(expected[i])));
+    }
+  }
+}
+
+TEST(CpuGemmTest, PackedBPanelsStayPerBatch) {
+  // Several M blocks, N blocks and K steps per batch entry, each with its own
+  // B, so a shared packed panel must never leak into another entry.
+  constexpr Index m = 150, n = 300, k = 270, batch_count = 2;
+  const auto a = makeFloats(batch_count * m * k, 1.0f);
+  const auto b = makeFloats(batch_count * k * n, -0.5f);
+  for (const auto isa : allIsas()) {
+    std::vector<float> c(static_cast<std::size_t>(batch_count * m * n));
+    std::vector<cpu_kernel::CpuGemmBatch> batches(batch_count);
+    for (Index i = 0; i < batch_count; ++i) {
+      batches[i].a = {a.data() + i * m * k, k, 1};
+      // Transposed B exercises the strided packing path.
+      batches[i].b = {b.data() + i * k * n, 1, k};
+      batches[i].c = {c.data() + i * m * n, n, 1};
+    }
+    CpuThreadPool pool{CpuThreadPool::Config{4}};
+    cpu_kernel::gemm(isa, {m, n, k, DType::F32, false}, batches, &pool);
+
+    for (Index batch = 0; batch < batch_count; ++batch) {
+      const std::vector<float> a_slice(a.begin() + batch * m * k,
+                                       a.begin() + (batch + 1) * m * k);
+      const std::vector<float> b_slice(b.begin() + batch * k * n,
+                                       b.begin() + (batch + 1) * k * n);
+      const auto expected =
+          reference(a_slice, {k, 1}, b_slice, {1, k}, nullptr, m, n, k);
+      for (Index i = 0; i < m * n; ++i) {
+        ASSERT_NEAR(c[batch * m * n + i], expected[i],
+                    1e-3 * (1.0 + std::abs(expected[i])))
+            << "isa=" << static_cast<int>(isa) << " batch=" << batch
+            << " i=" << i;
+      }
+    }
+  }
+}
+
+TEST(CpuGemmTest, UnsupportedDtypeThrows) {
+  cpu_kernel::CpuGemmBatch batch{};
+  EXPECT_THROW(cpu_kernel::gemm(cpu_kernel::CpuIsa::Scalar,
+                                {1, 1, 1, DType::I32, false}, {&batch, 1}),
+               std::system_error);
+}
+
+} // namespace
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "orteaf/internal/kernel/cpu/cpu_iteration_plan.h"
+
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+using ::orteaf::internal::execution::cpu::resource::CpuThreadPool;
+
+namespace {
+
+using Dim = std::int64_t;
+using Plan2 = cpu_kernel::CpuIterationPlan<2>;
+
+std::span<const Dim> spanOf(const std::vector<Dim> &values) {
+  return {values.data(), values.size()};
+}
+
+/// Offsets of every element visited in [begin, end), per operand.
+std::array<std::vector<Dim>, 2> visit(const Plan2 &plan, Dim begin, Dim end) {
+  std::array<std::vector<Dim>, 2> visited;
+  plan.forEachRun(begin, end,
+                  [&](const std::array<Dim, 2> &offsets, Dim count,
+                      const std::array<Dim, 2> &inner) {
+                    for (Dim i = 0; i < count; ++i) {
+                      visited[0].push_back(offsets[0] + i * inner[0]);
+                      visited[1].push_back(offsets[1] + i * inner[1]);
+                    }
+                  });
+  return visited;
+}
+
+TEST(CpuIterationPlanTest, ContiguousLayoutCollapsesToOneRun) {
+  const std::vector<Dim> shape{2, 1, 3, 4};
+  const std::vector<Dim> strides{12, 12, 4, 1};
+  const Plan2 plan(spanOf(shape), {spanOf(strides), spanOf(strides)});
+
+  EXPECT_EQ(plan.rank(), 1u);
+  EXPECT_EQ(plan.innerCount(), 24);
+  EXPECT_EQ(plan.outerCount(), 1);
+  EXPECT_EQ(plan.innerStrides()[0], 1);
+}
+
+TEST(CpuIterationPlanTest, ReordersDimsWhenAllOperandsAgree) {
+  // Both operands are the same transposed view: walking in memory order
+  // turns it back into a single contiguous run.
+  const std::vector<Dim> shape{4, 3};
+  const std::vector<Dim> strides{1, 4};
+  const Plan2 plan(spanOf(shape), {spanOf(strides), spanOf(strides)});
+
+  EXPECT_EQ(plan.rank(), 1u);
+  EXPECT_EQ(plan.innerCount(), 12);
+}
+
+TEST(CpuIterationPlanTest, KeepsOrderWhenOperandsDisagree) {
+  const std::vector<Dim> shape{4, 3};
+  const std::vector<Dim> src{1, 4};
+  const std::vector<Dim> dst{3, 1};
+  const Plan2 plan(spanOf(shape), {spanOf(src), spanOf(dst)});
+
+  ASSERT_EQ(plan.rank(), 2u);
+  EXPECT_EQ(plan.innerCount(), 3);
+  EXPECT_EQ(plan.innerStrides()[0], 4);
+  EXPECT_EQ(plan.innerStrides()[1], 1);
+}
+
+TEST(CpuIterationPlanTest, BroadcastDimsKeepZeroStride) {
+  // [3] broadcast to [2, 3]: outer dim has stride 0 in the input.
+  const std::vector<Dim> shape{2, 3};
+  const std::vector<Dim> in{0, 1};
+  const std::vector<Dim> out{3, 1};
+  const Plan2 plan(spanOf(shape), {spanOf(in), spanOf(out)}, {5, 0});
+
+  const auto visited = visit(plan, 0, plan.numel());
+  EXPECT_EQ(visited[0], (std::vector<Dim>{5, 6, 7, 5, 6, 7}));
+  EXPECT_EQ(visited[1], (std::vector<Dim>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST(CpuIterationPlanTest, SubRangesMatchFullWalk) {
+  const std::vector<Dim> shape{3, 5, 7};
+  const std::vector<Dim> src{1, 3, 15};
+  const std::vector<Dim> dst{35, 7, 1};
+  const Plan2 plan(spanOf(shape), {spanOf(src), spanOf(dst)});
+  const auto full = visit(plan, 0, plan.numel());
+  ASSERT_EQ(full[1].size(), 105u);
+
+  for (const Dim chunk : {Dim{1}, Dim{4}, Dim{7}, Dim{50}}) {
+    std::array<std::vector<Dim>, 2> joined;
+    for (Dim begin = 0; begin < plan.numel(); begin += chunk) {
+      const auto part = visit(plan, begin, begin + chunk);
+      for (std::size_t k = 0; k < 2; ++k) {
+        joined[k].insert(joined[k].end(), part[k].begin(), part[k].end());
+      }
+    }
+    EXPECT_EQ(joined, full) << "chunk=" << chunk;
+  }
+}
+
+TEST(CpuIterationPlanTest, ParallelWalkVisitsEveryElementOnce) {
+  const std::vector<Dim> shape{64, 300};
+  const std::vector<Dim> src{1, 64};
+  const std::vector<Dim> dst{300, 1};
+  const Plan2 plan(spanOf(shape), {spanOf(src), spanOf(dst)});
+  CpuThreadPool pool{CpuThreadPool::Config{4}};
+
+  std::vector<std::atomic<int>> hits(static_cast<std::size_t>(plan.numel()));
+  plan.parallelForEachRun(&pool, 1000,
+                          [&](const std::array<Dim, 2> &offsets, Dim count,
+                              const std::array<Dim, 2> &inner) {
+                            for (Dim i = 0; i < count; ++i) {
+                              hits[static_cast<std::size_t>(
+                                       offsets[1] + i * inner[1])]
+                                  .fetch_add(1);
+                            }
+                          });
+  for (const auto &hit : hits) {
+    ASSERT_EQ(hit.load(), 1);
+  }
+}
+
+TEST(CpuIterationPlanTest, HandlesEmptyAndScalarShapes) {
+  const std::vector<Dim> empty_shape{3, 0};
+  const std::vector<Dim> empty_strides{0, 1};
+  const Plan2 empty(spanOf(empty_shape),
+                    {spanOf(empty_strides), spanOf(empty_strides)});
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(visit(empty, 0, 10)[0].empty());
+
+  const std::vector<Dim> none;
+  const Plan2 scalar(spanOf(none), {spanOf(none), spanOf(none)}, {2, 3});
+  const auto visited = visit(scalar, 0, scalar.numel());
+  EXPECT_EQ(visited[0], (std::vector<Dim>{2}));
+  EXPECT_EQ(visited[1], (std::vector<Dim>{3}));
+}
+
+} // namespace
@@ -0,0 +1,183 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <variant>
+
+#include "orteaf/internal/architecture/architecture.h"
+#include "orteaf/internal/execution/cpu/api/cpu_execution_api.h"
+#include "orteaf/internal/execution/cpu/platform/cpu_slow_ops.h"
+#include "orteaf/internal/execution_context/cpu/current_context.h"
+#include "orteaf/internal/kernel/core/context_any.h"
+#include "orteaf/internal/kernel/core/kernel_args.h"
+#include "orteaf/internal/kernel/core/kernel_entry.h"
+#include "orteaf/internal/kernel/core/kernel_metadata.h"
+
+namespace kernel = ::orteaf::internal::kernel;
+namespace kernel_entry = ::orteaf::internal::kernel::core;
+namespace architecture = ::orteaf::internal::architecture;
+namespace cpu = ::orteaf::internal::execution::cpu;
+namespace cpu_api = ::orteaf::internal::execution::cpu::api;
+namespace cpu_context = ::orteaf::internal::execution_context::cpu;
+namespace cpu_platform = ::orteaf::internal::execution::cpu::platform;
+namespace cpu_resource = ::orteaf::internal::execution::cpu::resource;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+
+class CpuSlowOpsMock : public cpu_platform::CpuSlowOps {
+public:
+  MOCK_METHOD(int, getDeviceCount, (), (override));
+  MOCK_METHOD(architecture::Architecture, detectArchitecture,
+              (cpu::CpuDeviceHandle device_id), (override));
+  MOCK_METHOD(void *, allocBuffer, (std::size_t size, std::size_t alignment),
+              (override));
+  MOCK_METHOD(void, deallocBuffer, (void *ptr, std::size_t size), (override));
+};
+
+int g_execute_count = 0;
+kernel::KernelArgs *g_execute_args = nullptr;
+
+void countingExecute(kernel_entry::KernelEntry::KernelBaseLease &lease,
+                     kernel::KernelArgs &args) {
+  EXPECT_TRUE(std::holds_alternative<
+              kernel_entry::KernelEntry::CpuKernelBaseLease>(lease));
+  ++g_execute_count;
+  g_execute_args = &args;
+}
+
+class CpuKernelEntryTest : public ::testing::Test {
+protected:
+  void configureWithArchitecture(architecture::Architecture arch) {
+    auto *ops = new NiceMock<CpuSlowOpsMock>();
+    ON_CALL(*ops, getDeviceCount()).WillByDefault(Return(1));
+    ON_CALL(*ops, detectArchitecture(cpu::CpuDeviceHandle{0}))
+        .WillByDefault(Return(arch));
+    cpu_api::CpuExecutionApi::ExecutionManager::Config config{};
+    config.slow_ops = ops;
+    cpu_api::CpuExecutionApi::configure(config);
+    cpu_context::reset();
+  }
+
+  void SetUp() override {
+    g_execute_count = 0;
+    g_execute_args = nullptr;
+    configureWithArchitecture(architecture::Architecture::CpuZen4);
+  }
+
+  void TearDown() override {
+    cpu_context::reset();
+    cpu_api::CpuExecutionApi::shutdown();
+  }
+
+  static kernel::KernelArgs makeCpuArgs() {
+    return kernel::KernelArgs(
+        kernel::ContextAny::erase(cpu_context::currentContext()));
+  }
+};
+
+TEST_F(CpuKernelEntryTest, RunDispatchesExecuteWithCpuContext) {
+  kernel_entry::KernelEntry entry(
+      cpu_api::CpuExecutionApi::acquireKernelBase(
+          architecture::Architecture::CpuZen4),
+      countingExecute);
+
+  auto args = makeCpuArgs();
+  entry.run(args);
+  entry.run(args);
+
+  EXPECT_EQ(g_execute_count, 2);
+  EXPECT_EQ(g_execute_args, &args);
+}
+
+TEST_F(CpuKernelEntryTest, RunAcceptsFallbackArchitectureKernel) {
+  kernel_entry::KernelEntry entry(
+      cpu_api::CpuExecutionApi::acquireKernelBase(
+          architecture::Architecture::CpuGeneric),
+      countingExecute);
+
+  auto args = makeCpuArgs();
+  entry.run(args);
+
+  EXPECT_EQ(g_execute_count, 1);
+}
+
+TEST_F(CpuKernelEntryTest, RunThrowsWhenDeviceCannotRunKernel) {
+  cpu_api::CpuExecutionApi::shutdown();
+  configureWithArchitecture(architecture::Architecture::CpuGeneric);
+
+  kernel_entry::KernelEntry entry(
+      cpu_api::CpuExecutionApi::acquireKernelBase(
+          architecture::Architecture::CpuZen4),
+      countingExecute);
+
+  auto args = makeCpuArgs();
+  EXPECT_THROW(entry.run(args), std::system_error);
+  EXPECT_EQ(g_execute_count, 0);
+}
+
+TEST_F(CpuKernelEntryTest, RunThrowsWithoutCpuContext) {
+  kernel_entry::KernelEntry entry(
+      cpu_api::CpuExecutionApi::acquireKernelBase(
+          architecture::Architecture::CpuGeneric),
+      countingExecute);
+
+  kernel::KernelArgs args;
+  EXPECT_THROW(entry.run(args), std::system_error);
+  EXPECT_EQ(g_execute_count, 0);
+}
+
+TEST_F(CpuKernelEntryTest, RunThrowsWithoutExecuteFunction) {
+  kernel_entry::KernelEntry entry;
+  entry.setBase(cpu_api::CpuExecutionApi::acquireKernelBase(
+      architecture::Architecture::CpuGeneric));
+
+  auto args = makeCpuArgs();
+  EXPECT_THROW(entry.run(args), std::system_error);
+}
+
+TEST_F(CpuKernelEntryTest, MetadataRoundTripRebuildsEntry) {
+  kernel_entry::KernelEntry entry(
+      cpu_api::CpuExecutionApi::acquireKernelBase(
+          architecture::Architecture::CpuZen4),
+      countingExecute);
+
+  auto metadata = kernel_entry::KernelMetadataLease::fromEntry(entry);
+  ASSERT_TRUE(std::holds_alternative<
+              kernel_entry::KernelMetadataLease::CpuKernelMetadataLease>(
+      metadata.lease()));
+  EXPECT_EQ(metadata.execute(), &countingExecute);
+
+  auto rebuilt = metadata.rebuild();
+  auto *lease = std::get_if<kernel_entry::KernelEntry::CpuKernelBaseLease>(
+      &rebuilt.base());
+  ASSERT_NE(lease, nullptr);
+  ASSERT_TRUE(*lease);
+  EXPECT_EQ((*lease)->architecture(), architecture::Architecture::CpuZen4);
+
+  auto args = makeCpuArgs();
+  rebuilt.run(args);
+  EXPECT_EQ(g_execute_count, 1);
+}
+
+TEST(CpuKernelBaseTest, SupportsFollowsFallbackChain) {
+  using Arch = architecture::Architecture;
+  EXPECT_TRUE(cpu_resource::CpuKernelBase::supports(Arch::CpuZen4,
+                                                    Arch::CpuZen4));
+  EXPECT_TRUE(cpu_resource::CpuKernelBase::supports(Arch::CpuZen4,
+                                                    Arch::CpuGeneric));
+  EXPECT_FALSE(cpu_resource::CpuKernelBase::supports(Arch::CpuGeneric,
+                                                     Arch::CpuZen4));
+  EXPECT_FALSE(cpu_resource::CpuKernelBase::supports(Arch::CpuSkylake,
+                                                     Arch::CpuZen4));
+}
+
+TEST(CpuKernelBaseTest, SetArchitectureRejectsNonCpu) {
+  cpu_resource::CpuKernelBase base;
+  EXPECT_TRUE(base.setArchitecture(architecture::Architecture::CpuSkylake));
+  EXPECT_EQ(base.architecture(), architecture::Architecture::CpuSkylake);
+  EXPECT_FALSE(base.setArchitecture(architecture::Architecture::CudaGeneric));
+  EXPECT_EQ(base.architecture(), architecture::Architecture::CpuGeneric);
+}
+
+} // namespace
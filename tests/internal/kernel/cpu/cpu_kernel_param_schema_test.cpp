@@ -7,6 +7,7 @@
 
 #include <array>
 #include <gtest/gtest.h>
+#include <stdexcept>
 
 namespace kernel = orteaf::internal::kernel;
 
@@ -83,3 +84,45 @@ TEST(KernelParamSchemaTest, ExtractArrayViewToInlineVector) {
   EXPECT_EQ(shape.get().data[1], 2);
   EXPECT_EQ(shape.get().data[2], 4);
 }
+
+TEST(KernelParamSchemaTest, ExtractPrefersPackedSchema) {
+  kernel::KernelArgs args;
+  SchemaWithOptional packed;
+  packed.alpha.set(2.0f);
+  packed.beta.set(3.0f);
+  args.setPackedParams(packed);
+
+  // No ParamList entries: the packed schema is read directly.
+  EXPECT_EQ(args.paramList().size(), 0u);
+  auto schema = SchemaWithOptional::extract(args);
+  EXPECT_FLOAT_EQ(schema.alpha, 2.0f);
+  ASSERT_TRUE(static_cast<bool>(schema.beta));
+  EXPECT_FLOAT_EQ(schema.beta, 3.0f);
+}
+
+TEST(KernelParamSchemaTest, PackedSchemaOfOtherTypeFallsBackToParamList) {
+  kernel::KernelArgs args;
+  SchemaWithOptional packed;
+  packed.alpha.set(2.0f);
+  args.setPackedParams(packed);
+  args.addParam(kernel::Param(kernel::ParamId::Alpha, 4.0f));
+  args.addParam(kernel::Param(kernel::ParamId::Beta, 5.0f));
+
+  EXPECT_EQ(args.packedParams<CpuTestSchema>(), nullptr);
+  auto schema = CpuTestSchema::extract(args);
+  EXPECT_FLOAT_EQ(schema.alpha, 4.0f);
+  EXPECT_FLOAT_EQ(schema.beta, 5.0f);
+}
+
+TEST(KernelParamSchemaTest, ClearParamsDropsPackedSchema) {
+  kernel::KernelArgs args;
+  CpuTestSchema packed;
+  packed.alpha.set(1.0f);
+  packed.beta.set(1.0f);
+  args.setPackedParams(packed);
+  ASSERT_NE(args.packedParams<CpuTestSchema>(), nullptr);
+
+  args.clearParams();
+  EXPECT_EQ(args.packedParams<CpuTestSchema>(), nullptr);
+  EXPECT_THROW(CpuTestSchema::extract(args), std::runtime_error);
+}
@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <vector>
+
+#include "orteaf/internal/architecture/architecture.h"
+#include "orteaf/internal/dtype/float16.h"
+#include "orteaf/internal/kernel/cpu/cpu_isa.h"
+#include "orteaf/internal/kernel/cpu/cpu_vector_ops.h"
+
+namespace architecture = ::orteaf::internal::architecture;
+namespace cpu_kernel = ::orteaf::internal::kernel::cpu;
+namespace dtype_detail = ::orteaf::internal::detail;
+
+namespace {
+
+using Index = cpu_kernel::CpuVectorOps::Index;
+
+// Sizes straddle the 8 / 16 lane widths so both main loops and tails run.
+constexpr Index kCounts[] = {0, 1, 7, 8, 15, 16, 17, 33, 100};
+
+std::vector<cpu_kernel::CpuIsa> supportedIsas() {
+  std::vector<cpu_kernel::CpuIsa> isas;
+  for (auto isa : {cpu_kernel::CpuIsa::Neon, cpu_kernel::CpuIsa::Avx2,
+                   cpu_kernel::CpuIsa::Avx512}) {
+    if (cpu_kernel::isSupported(isa)) {
+      isas.push_back(isa);
+    }
+  }
+  return isas;
+}
+
+std::vector<float> makeFloats(Index count, float scale) {
+  std::vector<float> values(static_cast<std::size_t>(count));
+  for (Index i = 0; i < count; ++i) {
+    values[i] = scale * static_cast<float>((i * 37) % 19 - 9) / 4.0f;
+  }
+  return values;
+}
+
+std::vector<std::uint16_t> toHalf(const std::vector<float> &values) {
+  std::vector<std::uint16_t> bits(values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    bits[i] = dtype_detail::float32ToHalfBits(values[i]);
+  }
+  return bits;
+}
+
+TEST(CpuIsaTest, ArchitectureMapsToIsa) {
+  using Arch = architecture::Architecture;
+  EXPECT_EQ(cpu_kernel::isaOf(Arch::CpuZen4), cpu_kernel::CpuIsa::Avx512);
+  EXPECT_EQ(cpu_kernel::isaOf(Arch::CpuSkylake), cpu_kernel::CpuIsa::Avx512);
+  EXPECT_EQ(cpu_kernel::isaOf(Arch::CpuIntelCometLake),
+            cpu_kernel::CpuIsa::Avx2);
+  EXPECT_EQ(cpu_kernel::isaOf(Arch::CudaGeneric), cpu_kernel::CpuIsa::Scalar);
+}
+
+TEST(CpuIsaTest, EffectiveIsaIsSupported) {
+  for (auto isa : {cpu_kernel::CpuIsa::Scalar, cpu_kernel::CpuIsa::Neon,
+                   cpu_kernel::CpuIsa::Avx2, cpu_kernel::CpuIsa::Avx512}) {
+    const auto effective = cpu_kernel::effectiveIsa(isa);
+    EXPECT_TRUE(cpu_kernel::isSupported(effective));
+    EXPECT_EQ(cpu_kernel::vectorOps(isa).isa, effective);
+  }
+  EXPECT_TRUE(cpu_kernel::isSupported(cpu_kernel::CpuIsa::Scalar));
+}
+
+TEST(CpuVectorOpsTest, AddF32MatchesScalar) {
+  const auto &scalar = cpu_kernel::vectorOps(cpu_kernel::CpuIsa::Scalar);
+  for (auto isa : supportedIsas()) {
+    const auto &ops = cpu_kernel::vectorOps(isa);
+    for (Index count : kCounts) {
+      const auto a = makeFloats(count + 1, 1.0f);
+      const auto b = makeFloats(2 * count + 1, -0.5f);
+      // Contiguous, broadcast rhs and strided rhs.
+      for (Index b_stride : {Index{1}, Index{0}, Index{2}}) {
+        std::vector<float> expected(count), actual(count);
+        scalar.add_f32(a.data(), 1, b.data(), b_stride, expected.data(), 1,
+                       count, 0.75f);
+        ops.add_f32(a.data(), 1, b.data(), b_stride, actual.data(), 1, count,
+                    0.75f);
+        for (Index i = 0; i < count; ++i) {
+          EXPECT_FLOAT_EQ(actual[i], expected[i]) << "i=" << i;
+        }
+      }
+    }
+  }
+}
+
+TEST(CpuVectorOpsTest, AddF16MatchesScalar) {
+  const auto &scalar = cpu_kernel::vectorOps(cpu_kernel::CpuIsa::Scalar);
+  for (auto isa : supportedIsas()) {
+    const auto &ops = cpu_kernel::vectorOps(isa);
+    for (Index count : kCounts) {
+      const auto a = toHalf(makeFloats(count + 1, 1.0f));
+      const auto b = toHalf(makeFloats(count + 1, 2.0f));
+      for (Index a_stride : {Index{1}, Index{0}}) {
+        std::vector<std::uint16_t> expected(count), actual(count);
+        scalar.add_f16(a.data(), a_stride, b.data(), 1, expected.data(), 1,
+                       count, 1.0f);
+        ops.add_f16(a.data(), a_stride, b.data(), 1, actual.data(), 1, count,
+                    1.0f);
+        EXPECT_EQ(actual, expected);
+      }
+    }
+  }
+}
+
+TEST(CpuVectorOpsTest, AddI32MatchesScalar) {
+  const auto &scalar = cpu_kernel::vectorOps(cpu_kernel::CpuIsa::Scalar);
+  for (auto isa : supportedIsas()) {
+    const auto &ops = cpu_kernel::vectorOps(isa);
+    for (Index count : kCounts) {
+      std::vector<std::int32_t> a(count + 1), b(count + 1);
+      for (Index i = 0; i <= count; ++i) {
+        a[i] = static_cast<std::int32_t>(i * 3 - 40);
+        b[i] = static_cast<std::int32_t>(17 - i);
+      }
+      std::vector<std::int32_t> expected(count), actual(count);
+      scalar.add_i32(a.data(), 1, b.data(), 1, expected.data(), 1, count, -3);
+      ops.add_i32(a.data(), 1, b.data(), 1, actual.data(), 1, count, -3);
+      EXPECT_EQ(actual, expected);
+    }
+  }
+}
+
+TEST(CpuVectorOpsTest, AddI32WrapsOnOverflowOnEveryIsa) {
+  constexpr std::int32_t kMax = std::numeric_limits<std::int32_t>::max();
+  constexpr std::int32_t kMin = std::numeric_limits<std::int32_t>::min();
+  auto isas = supportedIsas();
+  isas.push_back(cpu_kernel::CpuIsa::Scalar);
+  for (auto isa : isas) {
+    const auto &ops = cpu_kernel::vectorOps(isa);
+    // 17 elements: a full vector plus a tail on every ISA.
+    std::vector<std::int32_t> a(17, kMax), b(17, 1), out(17);
+    ops.add_i32(a.data(), 1, b.data(), 1, out.data(), 1, 17, 2);
+    EXPECT_EQ(out, (std::vector<std::int32_t>(17, kMin + 1)));
+
+    std::fill(a.begin(), a.end(), 0);
+    std::fill(b.begin(), b.end(), kMin);
+    ops.add_i32(a.data(), 1, b.data(), 1, out.data(), 1, 17, -1);
+    EXPECT_EQ(out, (std::vector<std::int32_t>(17, kMin)));
+  }
+}
+
+TEST(CpuVectorOpsTest, I32AddAlphaRequiresAnInteger) {
+  EXPECT_EQ(cpu_kernel::i32AddAlpha(-3.0f), -3);
+  EXPECT_EQ(cpu_kernel::i32AddAlpha(-2147483648.0f),
+            std::numeric_limits<std::int32_t>::min());
+  EXPECT_THROW(cpu_kernel::i32AddAlpha(0.5f), std::system_error);
+  EXPECT_THROW(cpu_kernel::i32AddAlpha(2147483648.0f), std::system_error);
+  EXPECT_THROW(
+      cpu_kernel::i32AddAlpha(std::numeric_limits<float>::quiet_NaN()),
+      std::system_error);
+}
+
+TEST(CpuVectorOpsTest, ReluMatchesScalar) {
+  const auto &scalar = cpu_kernel::vectorOps(cpu_kernel::CpuIsa::Scalar);
+  for (auto isa : supportedIsas()) {
+    const auto &ops = cpu_kernel::vectorOps(isa);
+    for (Index count : kCounts) {
+      const auto in = makeFloats(count, 1.0f);
+      std::vector<float> expected(count), actual(count);
+      scalar.relu_f32(in.data(), 1, expected.data(), 1, count);
+      ops.relu_f32(in.data(), 1, actual.data(), 1, count);
+      EXPECT_EQ(actual, expected);
+
+      const auto in_half = toHalf(in);
+      std::vector<std::uint16_t> expected_half(count), actual_half(count);
+      scalar.relu_f16(in_half.data(), 1, expected_half.data(), 1, count);
+      ops.relu_f16(in_half.data(), 1, actual_half.data(), 1, count);
+      EXPECT_EQ(actual_half, expected_half);
+
+      std::vector<std::int32_t> in_int(count);
+      for (Index i = 0; i < count; ++i) {
+        in_int[i] = static_cast<std::int32_t>(in[i] * 4.0f);
+      }
+      std::vector<std::int32_t> expected_int(count), actual_int(count);
+      scalar.relu_i32(in_int.data(), 1, expected_int.data(), 1, count);
+      ops.relu_i32(in_int.data(), 1, actual_int.data(), 1, count);
+      EXPECT_EQ(actual_int, expected_int);
+    }
+  }
+}
+
+TEST(CpuVectorOpsTest, ReluF16PreservesSpecialValues) {
+  const std::vector<std::uint16_t> in{
+      0x8000u, // -0
+      0x7e00u, // NaN
+      0xfe00u, // -NaN
+      0xfc00u, // -inf
+      0x7c00u, // +inf
+      0xbc00u, // -1
+  };
+  const std::vector<std::uint16_t> expected{0x8000u, 0x7e00u, 0xfe00u,
+                                            0x0000u, 0x7c00u, 0x0000u};
+  for (auto isa : {cpu_kernel::CpuIsa::Scalar, cpu_kernel::CpuIsa::Neon,
+                   cpu_kernel::CpuIsa::Avx2, cpu_kernel::CpuIsa::Avx512}) {
+    // Repeat so SIMD paths see the values in full vectors, not only tails.
+    std::vector<std::uint16_t> input, want;
+    for (int rep = 0; rep < 8; ++rep) {
+      input.insert(input.end(), in.begin(), in.end());
+      want.insert(want.end(), expected.begin(), expected.end());
+    }
+    std::vector<std::uint16_t> actual(input.size());
+    cpu_kernel::vectorOps(isa).relu_f16(input.data(), 1, actual.data(), 1,
+                                        static_cast<Index>(input.size()));
+    EXPECT_EQ(actual, want);
+  }
+}
+
+TEST(CpuVectorOpsTest, ReluF32PropagatesNan) {
+  std::vector<float> in(20, -1.0f);
+  in[3] = std::numeric_limits<float>::quiet_NaN();
+  in[17] = std::numeric_limits<float>::quiet_NaN();
+  for (auto isa : supportedIsas()) {
+    std::vector<float> out(in.size());
+    cpu_kernel::vectorOps(isa).relu_f32(in.data(), 1, out.data(), 1,
+                                        static_cast<Index>(in.size()));
+    EXPECT_TRUE(std::isnan(out[3]));
+    EXPECT_TRUE(std::isnan(out[17]));
+    EXPECT_EQ(out[0], 0.0f);
+  }
+}
+
+TEST(CpuVectorOpsTest, AxpyAndStoreMatchScalar) {
+  const auto &scalar = cpu_kernel::vectorOps(cpu_kernel::CpuIsa::Scalar);
+  for (auto isa : supportedIsas()) {
+    const auto &ops = cpu_kernel::vectorOps(isa);
+    for (Index count : kCounts) {
+      const auto x = makeFloats(2 * count + 1, 1.0f);
+      for (Index x_stride : {Index{1}, Index{2}}) {
+        std::vector<float> expected(count, 1.0f), actual(count, 1.0f);
+        scalar.axpy_f32(0.5f, x.data(), x_stride, expected.data(), count);
+        ops.axpy_f32(0.5f, x.data(), x_stride, actual.data(), count);
+        for (Index i = 0; i < count; ++i) {
+          EXPECT_FLOAT_EQ(actual[i], expected[i]);
+        }
+      }
+
+      const auto x_half = toHalf(x);
+      std::vector<float> expected(count, 0.0f), actual(count, 0.0f);
+      scalar.axpy_f16(-2.0f, x_half.data(), 1, expected.data(), count);
+      ops.axpy_f16(-2.0f, x_half.data(), 1, actual.data(), count);
+      for (Index i = 0; i < count; ++i) {
+        EXPECT_FLOAT_EQ(actual[i], expected[i]);
+      }
+
+      std::vector<std::uint16_t> expected_half(count), actual_half(count);
+      scalar.store_f16(actual.data(), expected_half.data(), 1, count);
+      ops.store_f16(actual.data(), actual_half.data(), 1, count);
+      EXPECT_EQ(actual_half, expected_half);
+    }
+  }
+}
+
+} // namespace
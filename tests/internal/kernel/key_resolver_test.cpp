@@ -2,9 +2,16 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
 #include <unordered_set>
 
 #include "orteaf/internal/kernel/core/key_components.h"
+#include "orteaf/internal/kernel/core/kernel_metadata.h"
+#include "orteaf/internal/kernel/registry/kernel_registry.h"
+#include "orteaf/internal/kernel/registry/persistent_kernel_store.h"
 
 namespace kernel = orteaf::internal::kernel;
 namespace resolver = kernel::key_resolver;
@@ -25,6 +32,28 @@ private:
   std::unordered_set<kernel::KernelKey> keys_;
 };
 
+// Mock registry that counts probes and exposes a generation
+class CountingRegistry {
+public:
+  void add(kernel::KernelKey key) {
+    keys_.insert(key);
+    ++generation_;
+  }
+
+  bool contains(kernel::KernelKey key) const {
+    ++probes;
+    return keys_.find(key) != keys_.end();
+  }
+
+  std::uint64_t generation() const { return generation_; }
+
+  mutable int probes = 0;
+
+private:
+  std::unordered_set<kernel::KernelKey> keys_;
+  std::uint64_t generation_ = 1;
+};
+
 // ============================================================
 // KeyRequest tests
 // ============================================================
@@ -286,3 +315,144 @@ TEST(KeyResolver, ResolveFollowsHierarchy) {
   ASSERT_TRUE(result.has_value());
   EXPECT_EQ(*result, sm80_key);
 }
+
+// ============================================================
+// ResolveCache tests
+// ============================================================
+
+TEST(KeyResolver, CachedResolveSkipsProbesOnRepeat) {
+  CountingRegistry registry;
+  kernel::KeyRequest request{static_cast<Op>(1), DType::F32,
+                             Architecture::CudaSm86};
+  auto generic_key = kernel::makeKey(
+      {request.op, request.dtype},
+      {Architecture::CudaGeneric, static_cast<kernel::Layout>(0),
+       static_cast<kernel::Variant>(0)});
+  registry.add(generic_key);
+
+  resolver::ResolveCache cache;
+  kernel::KernelArgs args;
+  auto first = resolver::resolve(registry, request, args, cache);
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(*first, generic_key);
+  const int probes = registry.probes;
+  EXPECT_EQ(probes, 3); // Sm86 -> Sm80 -> CudaGeneric
+
+  auto second = resolver::resolve(registry, request, args, cache);
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(*second, generic_key);
+  EXPECT_EQ(registry.probes, probes);
+}
+
+TEST(KeyResolver, CachedResolveRemembersMissesPerSignature) {
+  CountingRegistry registry;
+  kernel::KeyRequest request{static_cast<Op>(1), DType::F32,
+                             Architecture::CpuGeneric};
+  resolver::ResolveCache cache;
+  kernel::KernelArgs args;
+
+  EXPECT_FALSE(resolver::resolve(registry, request, args, cache).has_value());
+  const int probes = registry.probes;
+  EXPECT_FALSE(resolver::resolve(registry, request, args, cache).has_value());
+  EXPECT_EQ(registry.probes, probes);
+
+  // A different signature is a different cache entry.
+  EXPECT_FALSE(
+      resolver::resolve(registry, request, args, cache, 7).has_value());
+  EXPECT_GT(registry.probes, probes);
+}
+
+TEST(KeyResolver, CachedResolveInvalidatedByRegisterKernel) {
+  orteaf::internal::kernel::registry::KernelRegistry registry;
+  kernel::KeyRequest request{static_cast<Op>(1), DType::F32,
+                             Architecture::CpuZen4};
+  kernel::FixedKeyComponents fixed{request.op, request.dtype};
+  auto generic_key =
+      kernel::makeKey(fixed, {Architecture::CpuGeneric,
+                              static_cast<kernel::Layout>(0),
+                              static_cast<kernel::Variant>(0)});
+  auto zen4_key = kernel::makeKey(fixed, {Architecture::CpuZen4,
+                                          static_cast<kernel::Layout>(0),
+                                          static_cast<kernel::Variant>(0)});
+  resolver::ResolveCache cache;
+  kernel::KernelArgs args;
+
+  EXPECT_FALSE(resolver::resolve(registry, request, args, cache).has_value());
+
+  registry.registerKernel(generic_key, kernel::core::KernelMetadataLease{});
+  auto result = resolver::resolve(registry, request, args, cache);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(*result, generic_key);
+
+  // Looking kernels up moves them between tiers without invalidating.
+  const auto generation = registry.generation();
+  ASSERT_NE(registry.lookup(generic_key), nullptr);
+  EXPECT_EQ(registry.generation(), generation);
+
+  registry.registerKernel(zen4_key, kernel::core::KernelMetadataLease{});
+  result = resolver::resolve(registry, request, args, cache);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(*result, zen4_key);
+
+  // Re-registering an existing key changes nothing.
+  const auto after = registry.generation();
+  registry.registerKernel(zen4_key, kernel::core::KernelMetadataLease{});
+  EXPECT_EQ(registry.generation(), after);
+}
+
+TEST(KeyResolver, ThreadResolveCacheIsPerThread) {
+  auto *main_cache = &resolver::threadResolveCache();
+  EXPECT_EQ(&resolver::threadResolveCache(), main_cache);
+  resolver::ResolveCache *other = nullptr;
+  std::thread([&] { other = &resolver::threadResolveCache(); }).join();
+  EXPECT_NE(other, main_cache);
+}
+
+TEST(KeyResolver, CachedResolveReusesPersistedResolution) {
+  namespace registry = orteaf::internal::kernel::registry;
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "orteaf_resolve_store.bin")
+          .string();
+  std::filesystem::remove(path);
+
+  kernel::KeyRequest request{static_cast<Op>(1), DType::F32,
+                             Architecture::CpuZen4};
+  kernel::FixedKeyComponents fixed{request.op, request.dtype};
+  auto generic_key =
+      kernel::makeKey(fixed, {Architecture::CpuGeneric,
+                              static_cast<kernel::Layout>(0),
+                              static_cast<kernel::Variant>(0)});
+  auto zen4_key = kernel::makeKey(fixed, {Architecture::CpuZen4,
+                                          static_cast<kernel::Layout>(0),
+                                          static_cast<kernel::Variant>(0)});
+  kernel::KernelArgs args;
+
+  std::uint64_t fingerprint = 0;
+  {
+    registry::PersistentKernelStore store(path);
+    registry::KernelRegistry reg;
+    reg.attachPersistentStore(&store);
+    reg.registerKernel(generic_key, kernel::core::KernelMetadataLease{});
+    resolver::ResolveCache cache;
+    EXPECT_EQ(resolver::resolve(reg, request, args, cache), generic_key);
+    fingerprint = reg.keySetFingerprint();
+    EXPECT_EQ(store.findResolution(request, 0, fingerprint), generic_key);
+  }
+
+  {
+    // Same key set in a new process: the persisted result applies.
+    registry::PersistentKernelStore store(path);
+    registry::KernelRegistry reg;
+    reg.registerKernel(generic_key, kernel::core::KernelMetadataLease{});
+    reg.attachPersistentStore(&store);
+    EXPECT_EQ(reg.keySetFingerprint(), fingerprint);
+    resolver::ResolveCache cache;
+    EXPECT_EQ(resolver::resolve(reg, request, args, cache), generic_key);
+
+    // A more specific kernel changes the key set; resolution starts over.
+    reg.registerKernel(zen4_key, kernel::core::KernelMetadataLease{});
+    EXPECT_NE(reg.keySetFingerprint(), fingerprint);
+    EXPECT_EQ(resolver::resolve(reg, request, args, cache), zen4_key);
+  }
+  std::filesystem::remove(path);
+}
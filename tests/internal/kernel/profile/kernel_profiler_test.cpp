@@ -0,0 +1,136 @@
+#include "orteaf/internal/kernel/profile/kernel_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "orteaf/internal/base/array_view.h"
+#include "orteaf/internal/kernel/core/kernel_args.h"
+#include "orteaf/internal/kernel/core/kernel_key.h"
+#include "orteaf/internal/kernel/param/param.h"
+
+namespace kernel = ::orteaf::internal::kernel;
+namespace profile = ::orteaf::internal::kernel::profile;
+
+namespace {
+
+kernel::KernelKey makeKey(int id) {
+  return static_cast<kernel::KernelKey>(static_cast<std::uint64_t>(id) << 12);
+}
+
+} // namespace
+
+TEST(KernelProfilerTest, SizeBucketsSpanSixteenfoldRanges) {
+  EXPECT_EQ(profile::sizeBucketOf(std::int64_t{0}), 0u);
+  EXPECT_EQ(profile::sizeBucketOf(std::int64_t{15}), 0u);
+  EXPECT_EQ(profile::sizeBucketOf(std::int64_t{16}), 1u);
+  EXPECT_EQ(profile::sizeBucketOf(std::int64_t{255}), 1u);
+  EXPECT_EQ(profile::sizeBucketOf(std::int64_t{256}), 2u);
+  EXPECT_EQ(profile::sizeBucketOf(std::int64_t{1} << 40),
+            profile::kUnknownSizeBucket - 1);
+  EXPECT_EQ(profile::sizeBucketOf(std::int64_t{-1}),
+            profile::kUnknownSizeBucket);
+}
+
+TEST(KernelProfilerTest, SizeBucketUsesLargestShapeParam) {
+  std::array<std::int64_t, 2> small{2, 2};
+  std::array<std::int64_t, 2> large{32, 32};
+  using View = ::orteaf::internal::base::ArrayView<const std::int64_t>;
+
+  kernel::KernelArgs args;
+  EXPECT_EQ(profile::sizeBucketOf(args), profile::kUnknownSizeBucket);
+
+  args.addParam(kernel::Param(
+      kernel::ParamKey::scoped(kernel::ParamId::Shape,
+                               kernel::makeOperandKey(
+                                   kernel::OperandId::Input0)),
+      View(small.data(), small.size())));
+  args.addParam(kernel::Param(
+      kernel::ParamKey::scoped(kernel::ParamId::Shape,
+                               kernel::makeOperandKey(
+                                   kernel::OperandId::Output)),
+      View(large.data(), large.size())));
+  EXPECT_EQ(profile::sizeBucketOf(args), profile::sizeBucketOf(1024));
+}
+
+TEST(KernelProfilerTest, LatencyBucketsAreLog2) {
+  EXPECT_EQ(profile::latencyBucketOf(0), 0u);
+  EXPECT_EQ(profile::latencyBucketOf(1), 0u);
+  EXPECT_EQ(profile::latencyBucketOf(2), 1u);
+  EXPECT_EQ(profile::latencyBucketOf(1023), 9u);
+  EXPECT_EQ(profile::latencyBucketOf(1024), 10u);
+  EXPECT_EQ(profile::latencyBucketOf(~std::uint64_t{0}),
+            profile::kLatencyBucketCount - 1);
+}
+
+TEST(KernelProfilerTest, RecordsPerKeyAndSizeBucket) {
+  profile::KernelProfiler profiler;
+  profiler.record(makeKey(1), 0, 100);
+  profiler.record(makeKey(1), 2, 300);
+  profiler.record(makeKey(2), 0, 50);
+
+  auto first = profiler.find(makeKey(1));
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(first->total.calls, 2u);
+  EXPECT_EQ(first->total.total_ns, 400u);
+  EXPECT_EQ(first->total.min_ns, 100u);
+  EXPECT_EQ(first->total.max_ns, 300u);
+  EXPECT_DOUBLE_EQ(first->total.meanNs(), 200.0);
+  EXPECT_EQ(first->by_size[0].calls, 1u);
+  EXPECT_EQ(first->by_size[2].calls, 1u);
+  EXPECT_EQ(first->total.histogram[profile::latencyBucketOf(100)], 1u);
+
+  EXPECT_FALSE(profiler.find(makeKey(3)).has_value());
+
+  const auto all = profiler.snapshot();
+  ASSERT_EQ(all.size(), 2u);
+  EXPECT_EQ(all[0].key, makeKey(1));
+
+  profiler.reset();
+  EXPECT_TRUE(profiler.snapshot().empty());
+}
+
+TEST(KernelProfilerTest, SamplesOneLaunchInN) {
+  profile::KernelProfiler profiler({.sample_every = 4});
+  // Run on a fresh thread so the thread-local countdown starts at zero.
+  std::size_t sampled = 0;
+  std::thread([&] {
+    for (int i = 0; i < 16; ++i) {
+      sampled += profiler.shouldSample() ? 1 : 0;
+    }
+  }).join();
+  EXPECT_EQ(sampled, 4u);
+
+  profile::KernelProfiler every({.sample_every = 1});
+  EXPECT_TRUE(every.shouldSample());
+  EXPECT_TRUE(every.shouldSample());
+}
+
+TEST(KernelProfilerTest, JsonExportScalesSampledCalls) {
+  profile::KernelProfiler profiler({.sample_every = 8});
+  profiler.record(makeKey(1), 1, 1000);
+  profiler.record(makeKey(1), profile::kUnknownSizeBucket, 3000);
+
+  const std::string json = profiler.toJson();
+  EXPECT_NE(json.find("\"sample_every\":8"), std::string::npos);
+  EXPECT_NE(json.find("\"calls\":2,\"estimated_calls\":16"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"bucket\":\"<256\""), std::string::npos);
+  EXPECT_NE(json.find("\"bucket\":\"unknown\""), std::string::npos);
+  EXPECT_NE(json.find("\"total_ns\":4000"), std::string::npos);
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+}
+
+TEST(KernelProfilerTest, InstallSetsActiveProfiler) {
+  EXPECT_EQ(profile::KernelProfiler::active(), nullptr);
+  profile::KernelProfiler profiler;
+  profile::KernelProfiler::install(&profiler);
+  EXPECT_EQ(profile::KernelProfiler::active(), &profiler);
+  profile::KernelProfiler::install(nullptr);
+  EXPECT_EQ(profile::KernelProfiler::active(), nullptr);
+}
@@ -0,0 +1,79 @@
+#include "orteaf/internal/kernel/registry/concurrent_kernel_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace registry = orteaf::internal::kernel::registry;
+namespace kernel = orteaf::internal::kernel;
+
+namespace {
+
+using Entry = registry::ConcurrentKernelCache::Entry;
+
+kernel::KernelKey makeKey(int id) {
+  return static_cast<kernel::KernelKey>(static_cast<std::uint64_t>(id) << 12);
+}
+
+TEST(ConcurrentKernelCacheTest, InsertFindErase) {
+  registry::ConcurrentKernelCache cache(8);
+  Entry a, b;
+
+  EXPECT_EQ(cache.find(makeKey(1)), nullptr);
+  cache.insert(makeKey(1), &a);
+  cache.insert(makeKey(2), &b);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.find(makeKey(1)), &a);
+  EXPECT_EQ(cache.find(makeKey(2)), &b);
+
+  // Re-inserting a key replaces its entry in place.
+  cache.insert(makeKey(1), &b);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.find(makeKey(1)), &b);
+
+  cache.erase(makeKey(1));
+  EXPECT_EQ(cache.find(makeKey(1)), nullptr);
+  EXPECT_EQ(cache.size(), 1u);
+
+  cache.clear();
+  EXPECT_EQ(cache.find(makeKey(2)), nullptr);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(ConcurrentKernelCacheTest, ReferenceBitsFollowReads) {
+  registry::ConcurrentKernelCache cache(4);
+  Entry entry;
+  cache.insert(makeKey(1), &entry);
+
+  EXPECT_FALSE(cache.testAndClearReferenced(makeKey(1)));
+  ASSERT_EQ(cache.find(makeKey(1)), &entry);
+  EXPECT_TRUE(cache.testAndClearReferenced(makeKey(1)));
+  EXPECT_FALSE(cache.testAndClearReferenced(makeKey(1)));
+  EXPECT_FALSE(cache.testAndClearReferenced(makeKey(2)));
+}
+
+TEST(ConcurrentKernelCacheTest, FullBucketDisplacesUnreferencedSlot) {
+  // One bucket: every key conflicts.
+  registry::ConcurrentKernelCache cache(1);
+  ASSERT_EQ(cache.slotCount(), registry::ConcurrentKernelCache::kWays);
+
+  std::vector<Entry> entries(registry::ConcurrentKernelCache::kWays + 1);
+  for (int i = 0; i < static_cast<int>(cache.slotCount()); ++i) {
+    cache.insert(makeKey(i), &entries[i]);
+  }
+  // Read everything except key 2.
+  for (int i = 0; i < static_cast<int>(cache.slotCount()); ++i) {
+    if (i != 2) {
+      ASSERT_NE(cache.find(makeKey(i)), nullptr);
+    }
+  }
+
+  cache.insert(makeKey(100), &entries.back());
+  EXPECT_EQ(cache.find(makeKey(100)), &entries.back());
+  EXPECT_EQ(cache.find(makeKey(2)), nullptr);
+  EXPECT_EQ(cache.find(makeKey(0)), &entries[0]);
+  EXPECT_EQ(cache.size(), cache.slotCount());
+}
+
+} // namespace
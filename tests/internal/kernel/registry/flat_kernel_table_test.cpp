@@ -0,0 +1,123 @@
+#include "orteaf/internal/kernel/registry/flat_kernel_table.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace registry = orteaf::internal::kernel::registry;
+namespace kernel = orteaf::internal::kernel;
+
+namespace {
+
+kernel::KernelKey makeKey(int id) {
+  return static_cast<kernel::KernelKey>(static_cast<std::uint64_t>(id) << 12);
+}
+
+std::vector<int> recencyOrder(const registry::FlatKernelTable<int> &table) {
+  std::vector<int> values;
+  table.forEachByRecency(
+      [&](kernel::KernelKey, const int &value) { values.push_back(value); });
+  return values;
+}
+
+TEST(FlatKernelTableTest, InsertFindErase) {
+  registry::FlatKernelTable<int> table(4);
+  EXPECT_TRUE(table.empty());
+  EXPECT_GE(table.slotCount(), 8u);
+
+  table.insertFront(makeKey(1), 10);
+  table.insertFront(makeKey(2), 20);
+  ASSERT_NE(table.find(makeKey(1)), nullptr);
+  EXPECT_EQ(*table.find(makeKey(1)), 10);
+  EXPECT_EQ(table.find(makeKey(3)), nullptr);
+  EXPECT_TRUE(table.contains(makeKey(2)));
+
+  int out = 0;
+  EXPECT_TRUE(table.erase(makeKey(1), &out));
+  EXPECT_EQ(out, 10);
+  EXPECT_FALSE(table.erase(makeKey(1)));
+  EXPECT_EQ(table.size(), 1u);
+
+  table.clear();
+  EXPECT_TRUE(table.empty());
+  EXPECT_FALSE(table.backKey().has_value());
+}
+
+TEST(FlatKernelTableTest, TracksRecency) {
+  registry::FlatKernelTable<int> table(3);
+  for (int i = 1; i <= 3; ++i) {
+    table.insertFront(makeKey(i), i);
+  }
+  EXPECT_TRUE(table.full());
+  EXPECT_EQ(recencyOrder(table), (std::vector<int>{3, 2, 1}));
+
+  // find() leaves the order alone; findAndTouch() moves to the front.
+  table.find(makeKey(1));
+  EXPECT_EQ(*table.backKey(), makeKey(1));
+  table.findAndTouch(makeKey(1));
+  EXPECT_EQ(recencyOrder(table), (std::vector<int>{1, 3, 2}));
+
+  kernel::KernelKey evicted{};
+  int value = 0;
+  ASSERT_TRUE(table.popBack(&evicted, &value));
+  EXPECT_EQ(evicted, makeKey(2));
+  EXPECT_EQ(value, 2);
+  EXPECT_EQ(recencyOrder(table), (std::vector<int>{1, 3}));
+}
+
+TEST(FlatKernelTableTest, BackwardShiftKeepsKeysReachable) {
+  // Random churn against a reference map, with enough keys per slot count
+  // that probe runs overlap and erasure has to shift entries.
+  constexpr std::size_t kCapacity = 32;
+  registry::FlatKernelTable<int> table(kCapacity);
+  std::unordered_map<int, int> reference;
+  std::vector<int> order; // reference LRU order, most recent first
+  std::mt19937 rng(7);
+
+  for (int step = 0; step < 20000; ++step) {
+    const int id = static_cast<int>(rng() % 96);
+    if (auto *value = table.findAndTouch(makeKey(id))) {
+      ASSERT_EQ(reference.at(id), *value);
+      std::erase(order, id);
+      order.insert(order.begin(), id);
+      if (rng() % 4 == 0) {
+        ASSERT_TRUE(table.erase(makeKey(id)));
+        reference.erase(id);
+        order.erase(order.begin());
+      }
+      continue;
+    }
+    ASSERT_EQ(reference.count(id), 0u);
+    if (table.full()) {
+      kernel::KernelKey evicted{};
+      ASSERT_TRUE(table.popBack(&evicted));
+      ASSERT_EQ(evicted, makeKey(order.back()));
+      reference.erase(order.back());
+      order.pop_back();
+    }
+    table.insertFront(makeKey(id), step);
+    reference[id] = step;
+    order.insert(order.begin(), id);
+  }
+
+  EXPECT_EQ(table.size(), reference.size());
+  for (const auto &[id, value] : reference) {
+    ASSERT_NE(table.find(makeKey(id)), nullptr) << id;
+    EXPECT_EQ(*table.find(makeKey(id)), value);
+  }
+}
+
+TEST(FlatKernelTableTest, MovesOwnedValues) {
+  registry::FlatKernelTable<std::unique_ptr<int>> table(2);
+  int *raw = table.insertFront(makeKey(1), std::make_unique<int>(5)).get();
+  table.insertFront(makeKey(2), std::make_unique<int>(6));
+  table.erase(makeKey(2));
+  ASSERT_NE(table.find(makeKey(1)), nullptr);
+  EXPECT_EQ(table.find(makeKey(1))->get(), raw);
+}
+
+} // namespace
@@ -2,7 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "orteaf/internal/kernel/core/kernel_key.h"
 #include "orteaf/internal/kernel/core/kernel_metadata.h"
@@ -53,62 +56,26 @@ TEST(KernelRegistryTest, CustomConfiguration) {
   EXPECT_EQ(reg.config().main_memory_capacity, 16u);
 }
 
-#if ORTEAF_ENABLE_TESTING
-TEST(KernelRegistryTest, CacheNodePointerStableAcrossRehash) {
+TEST(KernelRegistryTest, EntryPointerStableAcrossTierChurn) {
   registry::KernelRegistryConfig config;
-  config.cache_capacity = 128;
-  config.main_memory_capacity = 128;
+  config.cache_capacity = 2;
+  config.main_memory_capacity = 16;
 
   registry::KernelRegistry reg(config);
-  auto key = makeKey(1);
-  reg.registerKernel(key, makeMetadata("lib1", "func1"));
-  ASSERT_NE(reg.lookup(key), nullptr);
-
-  auto &nodes = reg.cacheNodesForTest();
-  auto node_it = nodes.find(key);
-  ASSERT_NE(node_it, nodes.end());
-
-  auto *node_ptr = node_it->second.get();
-  ASSERT_NE(node_ptr, nullptr);
-
-  auto before_buckets = nodes.bucket_count();
-  nodes.rehash(before_buckets * 2 + 1);
-  EXPECT_GT(nodes.bucket_count(), before_buckets);
-
-  auto node_it_after = nodes.find(key);
-  ASSERT_NE(node_it_after, nodes.end());
-  EXPECT_EQ(node_it_after->second.get(), node_ptr);
-  EXPECT_NE(reg.lookup(key), nullptr);
+  for (int i = 0; i < 16; ++i) {
+    reg.registerKernel(makeKey(i), makeMetadata("lib", "func"));
+  }
+  auto *entry = reg.lookup(makeKey(0));
+  ASSERT_NE(entry, nullptr);
+
+  // Cache evictions shift slots around in the flat tables; the entry
+  // itself must not move.
+  for (int i = 1; i < 16; ++i) {
+    ASSERT_NE(reg.lookup(makeKey(i)), nullptr);
+  }
+  EXPECT_EQ(reg.lookup(makeKey(0)), entry);
 }
 
-TEST(KernelRegistryTest, MainMemoryNodePointerStableAcrossRehash) {
-  registry::KernelRegistryConfig config;
-  config.cache_capacity = 128;
-  config.main_memory_capacity = 128;
-
-  registry::KernelRegistry reg(config);
-  auto key = makeKey(1);
-  reg.registerKernel(key, makeMetadata("lib1", "func1"));
-  ASSERT_NE(reg.lookup(key), nullptr);
-
-  auto &nodes = reg.mainMemoryNodesForTest();
-  auto node_it = nodes.find(key);
-  ASSERT_NE(node_it, nodes.end());
-
-  auto *node_ptr = node_it->second.get();
-  ASSERT_NE(node_ptr, nullptr);
-
-  auto before_buckets = nodes.bucket_count();
-  nodes.rehash(before_buckets * 2 + 1);
-  EXPECT_GT(nodes.bucket_count(), before_buckets);
-
-  auto node_it_after = nodes.find(key);
-  ASSERT_NE(node_it_after, nodes.end());
-  EXPECT_EQ(node_it_after->second.get(), node_ptr);
-  EXPECT_NE(reg.lookup(key), nullptr);
-}
-#endif
-
 // ============================================================
 // Register and lookup tests (Demand Paging)
 // ============================================================
@@ -356,4 +323,121 @@ TEST(KernelRegistryTest, StatsTracking) {
   EXPECT_EQ(reg.stats().misses, 1u);
 }
 
+// ============================================================
+// Concurrent mode tests
+// ============================================================
+
+registry::KernelRegistryConfig concurrentConfig(std::size_t cache,
+                                                std::size_t main_memory) {
+  registry::KernelRegistryConfig config;
+  config.cache_capacity = cache;
+  config.main_memory_capacity = main_memory;
+  config.concurrent = true;
+  return config;
+}
+
+TEST(KernelRegistryTest, ConcurrentLookupServesCacheHits) {
+  registry::KernelRegistry reg(concurrentConfig(4, 8));
+  auto key = makeKey(1);
+  reg.registerKernel(key, makeMetadata("lib1", "func1"));
+
+  auto *first = reg.lookup(key);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(reg.lookup(key), first);
+  EXPECT_EQ(reg.lookup(key), first);
+
+  EXPECT_EQ(reg.stats().secondary_hits, 1u);
+  EXPECT_EQ(reg.stats().cache_hits, 2u);
+  EXPECT_EQ(reg.lookup(makeKey(2)), nullptr);
+  EXPECT_EQ(reg.stats().misses, 1u);
+}
+
+TEST(KernelRegistryTest, ConcurrentEvictionKeepsReadEntries) {
+  registry::KernelRegistry reg(concurrentConfig(2, 8));
+  for (int i = 1; i <= 3; ++i) {
+    reg.registerKernel(makeKey(i), makeMetadata("lib", "func"));
+  }
+  reg.lookup(makeKey(1));
+  reg.lookup(makeKey(2));
+  // Key 1 is LRU but was read since; CLOCK evicts key 2 instead.
+  reg.lookup(makeKey(1));
+  reg.lookup(makeKey(3));
+
+  EXPECT_EQ(reg.cacheSize(), 2u);
+  auto hits = reg.stats().cache_hits;
+  reg.lookup(makeKey(1));
+  EXPECT_EQ(reg.stats().cache_hits, hits + 1);
+  reg.lookup(makeKey(2));
+  EXPECT_EQ(reg.stats().main_memory_hits, 1u);
+}
+
+TEST(KernelRegistryTest, ConcurrentMainMemoryEvictionRetiresEntries) {
+  registry::KernelRegistry reg(concurrentConfig(2, 2));
+  for (int i = 1; i <= 3; ++i) {
+    reg.registerKernel(makeKey(i), makeMetadata("lib", "func"));
+    ASSERT_NE(reg.lookup(makeKey(i)), nullptr);
+  }
+
+  EXPECT_EQ(reg.mainMemorySize(), 2u);
+  EXPECT_EQ(reg.secondaryStorageSize(), 1u);
+  EXPECT_EQ(reg.retiredSize(), 1u);
+  EXPECT_EQ(reg.reclaimRetired(), 1u);
+  EXPECT_EQ(reg.retiredSize(), 0u);
+  EXPECT_NE(reg.lookup(makeKey(1)), nullptr);
+}
+
+TEST(KernelRegistryTest, ConcurrentRetiredEntriesAreRevived) {
+  registry::KernelRegistry reg(concurrentConfig(1, 1));
+  reg.registerKernel(makeKey(1), makeMetadata("lib", "func"));
+  reg.registerKernel(makeKey(2), makeMetadata("lib", "func"));
+  auto *first = reg.lookup(makeKey(1));
+  ASSERT_NE(first, nullptr);
+
+  // Thrash the two keys through a one-entry Main Memory: each key keeps
+  // one retired entry, and promoting it again hands the same entry back.
+  for (int round = 0; round < 100; ++round) {
+    ASSERT_NE(reg.lookup(makeKey(2)), nullptr);
+    EXPECT_EQ(reg.lookup(makeKey(1)), first);
+    EXPECT_LE(reg.retiredSize(), 2u);
+  }
+  reg.clear();
+  EXPECT_EQ(reg.retiredSize(), 0u);
+}
+
+TEST(KernelRegistryTest, ConcurrentLookupsFromManyThreads) {
+  constexpr int kKeys = 24;
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 2000;
+  // Small tiers force promotion and eviction while readers are running.
+  registry::KernelRegistry reg(concurrentConfig(4, 8));
+  for (int i = 0; i < kKeys; ++i) {
+    reg.registerKernel(makeKey(i), makeMetadata("lib", "func"));
+  }
+
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kIterations; ++i) {
+        // Mostly a hot set of two keys, with periodic cold keys.
+        const int id = (i % 8 == 0) ? (i / 8 + t) % kKeys : t % 2;
+        if (reg.lookup(makeKey(id)) == nullptr) {
+          failures.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(failures.load(), 0);
+  const auto &stats = reg.stats();
+  EXPECT_EQ(stats.cache_hits + stats.main_memory_hits + stats.secondary_hits,
+            static_cast<std::size_t>(kThreads * kIterations));
+  EXPECT_EQ(stats.misses, 0u);
+  EXPECT_LE(reg.cacheSize(), 4u);
+  EXPECT_LE(reg.mainMemorySize(), 8u);
+}
+
 } // namespace
@@ -0,0 +1,228 @@
+#include "orteaf/internal/kernel/registry/kernel_warmup.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "orteaf/internal/execution/cpu/api/cpu_execution_api.h"
+#include "orteaf/internal/kernel/core/kernel_metadata.h"
+
+namespace registry = orteaf::internal::kernel::registry;
+namespace kernel = orteaf::internal::kernel;
+using Architecture = orteaf::internal::architecture::Architecture;
+using DType = orteaf::internal::DType;
+using Op = orteaf::internal::ops::Op;
+
+namespace {
+
+registry::KernelManifestEntry manifestEntry(int op) {
+  return {static_cast<Op>(op), DType::F32, Architecture::CpuGeneric};
+}
+
+registry::KernelManifest manifestOf(int count) {
+  registry::KernelManifest manifest;
+  for (int op = 1; op <= count; ++op) {
+    manifest.push_back(manifestEntry(op));
+  }
+  return manifest;
+}
+
+void registerAll(registry::KernelRegistry &reg,
+                 const registry::KernelManifest &manifest) {
+  for (const auto &entry : manifest) {
+    reg.registerKernel(entry.key(), kernel::core::KernelMetadataLease{});
+  }
+}
+
+registry::KernelRegistryConfig concurrentConfig(std::size_t cache,
+                                                std::size_t main_memory) {
+  registry::KernelRegistryConfig config;
+  config.cache_capacity = cache;
+  config.main_memory_capacity = main_memory;
+  config.concurrent = true;
+  return config;
+}
+
+TEST(KernelWarmupTest, ManifestEntryRoundTripsThroughKey) {
+  registry::KernelManifestEntry entry{static_cast<Op>(7), DType::F16,
+                                      Architecture::CpuZen4,
+                                      static_cast<kernel::Variant>(3),
+                                      static_cast<kernel::Layout>(2)};
+  EXPECT_EQ(registry::KernelManifestEntry::fromKey(entry.key()), entry);
+}
+
+TEST(KernelWarmupTest, WarmsManifestOnBackgroundThreads) {
+  registry::KernelRegistry reg(concurrentConfig(16, 16));
+  const auto manifest = manifestOf(12);
+  registerAll(reg, manifest);
+
+  registry::KernelWarmup warmup(reg, manifest, 4);
+  warmup.wait();
+
+  EXPECT_TRUE(warmup.finished());
+  const auto progress = warmup.progress();
+  EXPECT_EQ(progress.total, 12u);
+  EXPECT_EQ(progress.completed, 12u);
+  EXPECT_EQ(progress.warmed, 12u);
+  EXPECT_EQ(progress.missing, 0u);
+  EXPECT_GT(progress.nanoseconds, 0u);
+  EXPECT_EQ(reg.mainMemorySize(), 12u);
+  EXPECT_EQ(reg.cacheSize(), 12u);
+
+  // The first real lookups are Cache hits.
+  for (const auto &entry : manifest) {
+    EXPECT_NE(reg.lookup(entry.key()), nullptr);
+  }
+  const auto &stats = reg.stats();
+  EXPECT_EQ(stats.cache_hits, 12u);
+  EXPECT_EQ(stats.secondary_hits, 0u);
+  EXPECT_EQ(stats.prefetch_requested, 12u);
+  EXPECT_EQ(stats.prefetched, 12u);
+  EXPECT_EQ(stats.prefetch_missing, 0u);
+}
+
+TEST(KernelWarmupTest, CountsUnregisteredEntriesAsMissing) {
+  registry::KernelRegistry reg(concurrentConfig(8, 8));
+  const auto manifest = manifestOf(4);
+  registerAll(reg, registry::KernelManifest(manifest.begin(),
+                                            manifest.begin() + 2));
+
+  registry::KernelWarmup warmup(reg, manifest, 2);
+  warmup.wait();
+
+  EXPECT_EQ(warmup.progress().warmed, 2u);
+  EXPECT_EQ(warmup.progress().missing, 2u);
+  EXPECT_EQ(reg.stats().prefetch_missing, 2u);
+  EXPECT_EQ(reg.stats().misses, 0u);
+  EXPECT_FALSE(reg.contains(manifest[3].key()));
+}
+
+TEST(KernelWarmupTest, NonConcurrentRegistryWarmsBeforeReturning) {
+  registry::KernelRegistry reg;
+  const auto manifest = manifestOf(6);
+  registerAll(reg, manifest);
+
+  registry::KernelWarmup warmup(reg, manifest, 3);
+
+  EXPECT_TRUE(warmup.finished());
+  EXPECT_EQ(reg.secondaryStorageSize(), 0u);
+  EXPECT_EQ(reg.stats().prefetched, 6u);
+}
+
+TEST(KernelWarmupTest, LookupsDuringWarmupSeeOneEntryPerKey) {
+  registry::KernelRegistry reg(concurrentConfig(64, 64));
+  const auto manifest = manifestOf(64);
+  registerAll(reg, manifest);
+
+  registry::KernelWarmup warmup(reg, manifest, 4);
+  std::thread reader([&] {
+    for (const auto &entry : manifest) {
+      EXPECT_NE(reg.lookup(entry.key()), nullptr);
+    }
+  });
+  reader.join();
+  warmup.wait();
+
+  EXPECT_EQ(reg.mainMemorySize(), 64u);
+  EXPECT_EQ(reg.secondaryStorageSize(), 0u);
+  EXPECT_EQ(warmup.progress().warmed, 64u);
+}
+
+TEST(KernelWarmupTest, DefaultAndZeroThreadsUseOneWorker) {
+  const auto manifest = manifestOf(6);
+  for (const std::size_t threads : {std::size_t{1}, std::size_t{0}}) {
+    registry::KernelRegistry reg(concurrentConfig(8, 8));
+    registerAll(reg, manifest);
+    registry::KernelWarmup warmup(reg, manifest, threads);
+    warmup.wait();
+    EXPECT_EQ(warmup.progress().warmed, 6u);
+    EXPECT_EQ(reg.cacheSize(), 6u);
+  }
+}
+
+TEST(KernelWarmupTest, EmptyManifestFinishesImmediately) {
+  registry::KernelRegistry reg(concurrentConfig(4, 4));
+  registry::KernelWarmup warmup(reg, {});
+  EXPECT_TRUE(warmup.finished());
+  warmup.wait();
+  EXPECT_EQ(warmup.progress().total, 0u);
+}
+
+TEST(KernelWarmupTest, RecordedManifestSurvivesSaveAndLoad) {
+  const auto path =
+      (std::filesystem::temp_directory_path() / "orteaf_manifest_test.txt")
+          .string();
+  registry::KernelRegistry reg;
+  const auto manifest = manifestOf(3);
+  registerAll(reg, manifest);
+  reg.registerKernel(manifestEntry(9).key(),
+                     kernel::core::KernelMetadataLease{});
+  for (const auto &entry : manifest) {
+    reg.lookup(entry.key());
+  }
+
+  // Only the working set is recorded, most recent first.
+  const auto recorded = registry::recordManifest(reg);
+  ASSERT_EQ(recorded.size(), 3u);
+  EXPECT_EQ(recorded.front(), manifest.back());
+
+  ASSERT_TRUE(registry::saveManifest(path, recorded));
+  EXPECT_EQ(registry::loadManifest(path), recorded);
+
+  {
+    std::ofstream out(path, std::ios::trunc);
+    out << "something else\n1 2 3 0 0\n";
+  }
+  EXPECT_TRUE(registry::loadManifest(path).empty());
+  std::filesystem::remove(path);
+}
+
+TEST(KernelWarmupTest, WarmsCpuMetadataFromSeveralThreads) {
+  using CpuExecutionApi =
+      ::orteaf::internal::execution::cpu::api::CpuExecutionApi;
+  CpuExecutionApi::configure(CpuExecutionApi::ExecutionManager::Config{});
+  {
+    // Main Memory smaller than the manifest, so warm-up also evicts and
+    // rebuilds metadata leases while lookups run.
+    registry::KernelRegistry reg(concurrentConfig(8, 24));
+    const auto manifest = manifestOf(32);
+    for (const auto &entry : manifest) {
+      kernel::core::KernelMetadataLease metadata(
+          kernel::core::KernelMetadataLease::Variant{
+              CpuExecutionApi::acquireKernelMetadata(entry.architecture)});
+      reg.registerKernel(entry.key(), std::move(metadata));
+    }
+
+    std::atomic<bool> done{false};
+    std::thread reader([&] {
+      while (!done.load()) {
+        for (const auto &entry : manifest) {
+          auto *found = reg.lookup(entry.key());
+          ASSERT_NE(found, nullptr);
+          EXPECT_TRUE(std::holds_alternative<
+                      kernel::core::KernelEntry::CpuKernelBaseLease>(
+              found->base()));
+        }
+      }
+    });
+    for (int round = 0; round < 4; ++round) {
+      registry::KernelWarmup warmup(reg, manifest, 4);
+      warmup.wait();
+      EXPECT_EQ(warmup.progress().warmed, manifest.size());
+    }
+    done.store(true);
+    reader.join();
+
+    EXPECT_EQ(reg.mainMemorySize(), 24u);
+    reg.clear();
+  }
+  CpuExecutionApi::shutdown();
+}
+
+} // namespace
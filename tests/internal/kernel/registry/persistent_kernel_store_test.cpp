@@ -0,0 +1,185 @@
+#include "orteaf/internal/kernel/registry/persistent_kernel_store.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#include "orteaf/internal/kernel/core/kernel_metadata.h"
+#include "orteaf/internal/kernel/registry/kernel_registry.h"
+
+namespace registry = orteaf::internal::kernel::registry;
+namespace kernel = orteaf::internal::kernel;
+using Architecture = orteaf::internal::architecture::Architecture;
+using DType = orteaf::internal::DType;
+using Op = orteaf::internal::ops::Op;
+
+namespace {
+
+kernel::KernelKey makeKey(int id) {
+  return static_cast<kernel::KernelKey>(static_cast<std::uint64_t>(id) << 12);
+}
+
+class PersistentKernelStoreTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    path_ = (std::filesystem::temp_directory_path() /
+             ("orteaf_store_" +
+              std::string(::testing::UnitTest::GetInstance()
+                              ->current_test_info()
+                              ->name()) +
+              ".bin"))
+                .string();
+    std::filesystem::remove(path_);
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  std::string path_;
+  kernel::KeyRequest request_{static_cast<Op>(1), DType::F32,
+                              Architecture::CpuZen4};
+};
+
+TEST_F(PersistentKernelStoreTest, RecordsSurviveReopen) {
+  {
+    registry::PersistentKernelStore store(path_);
+    EXPECT_TRUE(store.putMetadata(makeKey(1), {Architecture::CpuZen4, true}));
+    store.putResolution(request_, 0, 42, makeKey(1));
+    store.putTuning(request_, 9, makeKey(2));
+    // Updates happen in place.
+    store.putTuning(request_, 9, makeKey(3));
+    EXPECT_EQ(store.size(), 3u);
+  }
+
+  registry::PersistentKernelStore store(path_);
+  EXPECT_EQ(store.size(), 3u);
+  auto metadata = store.findMetadata(makeKey(1));
+  ASSERT_TRUE(metadata.has_value());
+  EXPECT_EQ(metadata->architecture, Architecture::CpuZen4);
+  EXPECT_TRUE(metadata->resident);
+  EXPECT_EQ(store.findResolution(request_, 0, 42), makeKey(1));
+  EXPECT_EQ(store.findTuning(request_, 9), makeKey(3));
+  EXPECT_FALSE(store.findTuning(request_, 10).has_value());
+}
+
+TEST_F(PersistentKernelStoreTest, GrowsPastInitialCapacity) {
+  {
+    registry::PersistentKernelStore store(path_, 16);
+    for (int i = 0; i < 100; ++i) {
+      store.putMetadata(makeKey(i), {Architecture::CpuGeneric, i % 2 == 0});
+    }
+  }
+  registry::PersistentKernelStore store(path_);
+  EXPECT_EQ(store.size(), 100u);
+  int resident = 0;
+  store.forEachMetadata(
+      [&](kernel::KernelKey,
+          const registry::PersistentKernelStore::MetadataRecord &record) {
+        resident += record.resident ? 1 : 0;
+      });
+  EXPECT_EQ(resident, 50);
+}
+
+TEST_F(PersistentKernelStoreTest, RefusesFilesFromOtherVersions) {
+  {
+    registry::PersistentKernelStore store(path_);
+    store.putMetadata(makeKey(1), {});
+  }
+  const auto size = std::filesystem::file_size(path_);
+  {
+    // Bump the format version field that follows the 8-byte magic.
+    std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+    const std::uint32_t other = registry::PersistentKernelStore::kFormatVersion + 1;
+    file.seekp(8);
+    file.write(reinterpret_cast<const char *>(&other), sizeof(other));
+  }
+  EXPECT_THROW(registry::PersistentKernelStore{path_}, std::system_error);
+  EXPECT_EQ(std::filesystem::file_size(path_), size);
+
+  {
+    std::ofstream garbage(path_, std::ios::trunc);
+    garbage << "not a kernel store";
+  }
+  EXPECT_THROW(registry::PersistentKernelStore{path_}, std::system_error);
+  std::ifstream kept(path_);
+  std::string contents;
+  std::getline(kept, contents);
+  EXPECT_EQ(contents, "not a kernel store");
+}
+
+TEST_F(PersistentKernelStoreTest, StoresSharingAFileSeeEachOthersWrites) {
+  registry::PersistentKernelStore first(path_, 16);
+  registry::PersistentKernelStore second(path_, 16);
+  // Grows the file several times under second's smaller mapping.
+  for (int i = 0; i < 100; ++i) {
+    first.putMetadata(makeKey(i), {Architecture::CpuGeneric, false});
+  }
+  second.putMetadata(makeKey(100), {Architecture::CpuZen4, true});
+  EXPECT_EQ(second.size(), 101u);
+  EXPECT_TRUE(second.findMetadata(makeKey(42)).has_value());
+
+  // Updates reuse the slot appended by the other store.
+  second.putMetadata(makeKey(7), {Architecture::CpuZen4, true});
+  first.putMetadata(makeKey(101), {});
+  EXPECT_EQ(first.size(), 102u);
+  EXPECT_TRUE(first.findMetadata(makeKey(7))->resident);
+
+  registry::PersistentKernelStore reopened(path_);
+  EXPECT_EQ(reopened.size(), 102u);
+}
+
+TEST_F(PersistentKernelStoreTest, RejectsKeysOfOtherVersions) {
+  registry::PersistentKernelStore store(path_);
+  const auto future_key = kernel::kernel_key::make(
+      static_cast<Op>(1), Architecture::CpuGeneric,
+      static_cast<kernel::Layout>(0), DType::F32, kernel::variant::kDefault,
+      kernel::kernel_key::kCurrentVersion + 1);
+  EXPECT_FALSE(store.putMetadata(future_key, {}));
+  store.putTuning(request_, 0, future_key);
+  EXPECT_EQ(store.size(), 0u);
+}
+
+TEST_F(PersistentKernelStoreTest, ResolutionsAreTiedToKeySetFingerprint) {
+  registry::PersistentKernelStore store(path_);
+  store.putResolution(request_, 0, 1234, makeKey(5));
+  EXPECT_EQ(store.findResolution(request_, 0, 1234), makeKey(5));
+  EXPECT_FALSE(store.findResolution(request_, 0, 4321).has_value());
+  EXPECT_FALSE(store.findResolution(request_, 1, 1234).has_value());
+}
+
+TEST_F(PersistentKernelStoreTest, RegistryWarmsSavedWorkingSet) {
+  {
+    registry::PersistentKernelStore store(path_);
+    registry::KernelRegistry reg;
+    reg.attachPersistentStore(&store);
+    for (int i = 1; i <= 4; ++i) {
+      reg.registerKernel(makeKey(i), kernel::core::KernelMetadataLease{});
+    }
+    EXPECT_EQ(store.size(), 4u);
+    ASSERT_NE(reg.lookup(makeKey(2)), nullptr);
+    ASSERT_NE(reg.lookup(makeKey(3)), nullptr);
+    EXPECT_EQ(reg.saveWorkingSet(), 2u);
+  }
+
+  // A restarted process: same registrations, cold tiers.
+  registry::PersistentKernelStore store(path_);
+  registry::KernelRegistry reg;
+  for (int i = 1; i <= 4; ++i) {
+    reg.registerKernel(makeKey(i), kernel::core::KernelMetadataLease{});
+  }
+  reg.attachPersistentStore(&store);
+  EXPECT_EQ(reg.mainMemorySize(), 0u);
+  EXPECT_EQ(reg.warmFromStore(), 2u);
+  EXPECT_EQ(reg.mainMemorySize(), 2u);
+  EXPECT_EQ(reg.cacheSize(), 2u);
+
+  const auto hits = reg.stats().cache_hits;
+  reg.lookup(makeKey(2));
+  reg.lookup(makeKey(3));
+  EXPECT_EQ(reg.stats().cache_hits, hits + 2);
+}
+
+} // namespace
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <system_error>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -178,3 +179,23 @@ TEST(Variant, OptimizationLevelExample) {
   EXPECT_TRUE(baseline < optimized);
   EXPECT_TRUE(optimized < highly_optimized);
 }
+
+// ============================================================
+// Fused elementwise variants
+// ============================================================
+
+TEST(Variant, FusedElementwiseIndicesMapIntoReservedRange) {
+  static_assert(kernel::variant::fusedElementwise(0) ==
+                static_cast<kernel::Variant>(0x80));
+  constexpr auto last = kernel::variant::fusedElementwise(
+      kernel::variant::kFusedElementwiseCount - 1);
+  static_assert(kernel::variant::isFusedElementwise(last));
+  EXPECT_EQ(static_cast<std::uint64_t>(last), 0xFFu);
+}
+
+TEST(Variant, FusedElementwiseRejectsOutOfRangeIndex) {
+  const auto index =
+      static_cast<std::uint8_t>(kernel::variant::kFusedElementwiseCount);
+  EXPECT_THROW(kernel::variant::fusedElementwise(index), std::system_error);
+  EXPECT_THROW(kernel::variant::fusedElementwise(0xFF), std::system_error);
+}
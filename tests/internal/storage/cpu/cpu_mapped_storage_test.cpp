@@ -0,0 +1,169 @@
+#include "orteaf/internal/storage/concepts/storage_concepts.h"
+#include "orteaf/internal/storage/cpu/cpu_mapped_file.h"
+#include "orteaf/internal/storage/cpu/cpu_mapped_storage.h"
+#include "orteaf/internal/storage/registry/storage_types.h"
+#include "orteaf/internal/storage/storage_lease.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace storage = orteaf::internal::storage;
+namespace cpu_storage = orteaf::internal::storage::cpu;
+using DType = orteaf::internal::DType;
+
+namespace {
+
+class CpuMappedStorageTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    path_ = (std::filesystem::temp_directory_path() /
+             ("orteaf_mapped_" +
+              std::string(::testing::UnitTest::GetInstance()
+                              ->current_test_info()
+                              ->name()) +
+              ".bin"))
+                .string();
+    for (int i = 0; i < 64; ++i) {
+      values_.push_back(static_cast<float>(i) * 0.5f);
+    }
+    std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(values_.data()),
+              static_cast<std::streamsize>(values_.size() * sizeof(float)));
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  std::string path_;
+  std::vector<float> values_;
+};
+
+} // namespace
+
+TEST(CpuMappedStorageConcepts, SatisfiesStorageConcept) {
+  static_assert(
+      storage::concepts::StorageConcept<cpu_storage::CpuMappedStorage>);
+  EXPECT_STREQ(
+      storage::registry::StorageTraits<cpu_storage::CpuMappedStorage>::name,
+      "cpu_mapped");
+}
+
+TEST_F(CpuMappedStorageTest, OpenMapsFileContents) {
+  auto file = cpu_storage::CpuMappedFile::open(path_);
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(file->size(), values_.size() * sizeof(float));
+  EXPECT_EQ(file->path(), path_);
+  EXPECT_EQ(std::memcmp(file->data(), values_.data(), file->size()), 0);
+}
+
+TEST_F(CpuMappedStorageTest, OpenWithoutHintsMapsFileContents) {
+  auto file = cpu_storage::CpuMappedFile::open(
+      path_, {.will_need = false, .sequential = false});
+  EXPECT_EQ(std::memcmp(file->data(), values_.data(), file->size()), 0);
+}
+
+TEST_F(CpuMappedStorageTest, OpenMissingFileThrows) {
+  EXPECT_THROW(cpu_storage::CpuMappedFile::open(path_ + ".missing"),
+               std::system_error);
+}
+
+TEST_F(CpuMappedStorageTest, EmptyFileMapsToNull) {
+  std::ofstream(path_, std::ios::binary | std::ios::trunc).close();
+  auto file = cpu_storage::CpuMappedFile::open(path_);
+  EXPECT_EQ(file->size(), 0u);
+  EXPECT_EQ(file->data(), nullptr);
+}
+
+TEST_F(CpuMappedStorageTest, StorageViewsRangeInPlace) {
+  auto file = cpu_storage::CpuMappedFile::open(path_);
+  auto mapped = cpu_storage::CpuMappedStorage::builder()
+                    .withMappedFile(file)
+                    .withByteOffset(8 * sizeof(float))
+                    .withDType(DType::F32)
+                    .withNumElements(16)
+                    .build();
+
+  EXPECT_EQ(mapped.numel(), 16u);
+  EXPECT_EQ(mapped.sizeInBytes(), 16 * sizeof(float));
+  EXPECT_EQ(mapped.byteOffset(), 8 * sizeof(float));
+  EXPECT_EQ(mapped.data(), file->data() + 8 * sizeof(float));
+  EXPECT_EQ(static_cast<const float *>(mapped.data())[0], values_[8]);
+}
+
+TEST_F(CpuMappedStorageTest, StorageKeepsMappingAlive) {
+  cpu_storage::CpuMappedStorage mapped;
+  {
+    auto file = cpu_storage::CpuMappedFile::open(path_);
+    mapped = cpu_storage::CpuMappedStorage::builder()
+                 .withMappedFile(file)
+                 .withDType(DType::F32)
+                 .withNumElements(values_.size())
+                 .build();
+  }
+  ASSERT_NE(mapped.data(), nullptr);
+  EXPECT_EQ(static_cast<const float *>(mapped.data())[63], values_[63]);
+}
+
+TEST_F(CpuMappedStorageTest, BuilderRejectsInvalidRanges) {
+  auto file = cpu_storage::CpuMappedFile::open(path_);
+  EXPECT_THROW(cpu_storage::CpuMappedStorage::builder()
+                   .withDType(DType::F32)
+                   .withNumElements(1)
+                   .build(),
+               std::system_error);
+  EXPECT_THROW(cpu_storage::CpuMappedStorage::builder()
+                   .withMappedFile(file)
+                   .withByteOffset(2)
+                   .withDType(DType::F32)
+                   .withNumElements(1)
+                   .build(),
+               std::system_error);
+  EXPECT_THROW(cpu_storage::CpuMappedStorage::builder()
+                   .withMappedFile(file)
+                   .withByteOffset(sizeof(float))
+                   .withDType(DType::F32)
+                   .withNumElements(values_.size())
+                   .build(),
+               std::system_error);
+}
+
+TEST_F(CpuMappedStorageTest, BuilderRejectsOverflowingSize) {
+  auto file = cpu_storage::CpuMappedFile::open(path_);
+  EXPECT_THROW(cpu_storage::CpuMappedStorage::builder()
+                   .withMappedFile(file)
+                   .withDType(DType::F32)
+                   .withNumElements(std::numeric_limits<std::size_t>::max() /
+                                        sizeof(float) +
+                                    1)
+                   .build(),
+               std::system_error);
+}
+
+TEST_F(CpuMappedStorageTest, ManagerAcquiresMappedLease) {
+  storage::CpuMappedStorageManager manager;
+  manager.configure({});
+
+  storage::CpuMappedStorageManager::Request request{};
+  request.mapped_file = cpu_storage::CpuMappedFile::open(path_);
+  request.byte_offset = 4 * sizeof(float);
+  request.dtype = DType::F32;
+  request.numel = 4;
+  {
+    auto lease = storage::StorageLease::erase(manager.acquire(request));
+    ASSERT_TRUE(lease.valid());
+    EXPECT_EQ(lease.execution(), orteaf::internal::execution::Execution::Cpu);
+    EXPECT_EQ(lease.numel(), 4u);
+    EXPECT_NE(lease.tryAs<storage::CpuMappedStorageLease>(), nullptr);
+    EXPECT_EQ(lease.tryAs<storage::CpuStorageLease>(), nullptr);
+  }
+
+  request.mapped_file.reset();
+  EXPECT_THROW(manager.acquire(request), std::system_error);
+  manager.shutdown();
+}
@@ -1,6 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
 #include <orteaf/internal/execution/cpu/api/cpu_execution_api.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
 #include <orteaf/internal/tensor/api/tensor_api.h>
 
 namespace {
@@ -236,4 +243,109 @@ TEST_F(TensorApiInternalTest, HasImplNameUnknown) {
   EXPECT_FALSE(tensor_api::TensorApi::hasImplName("coo"));
 }
 
+// =============================================================================
+// Existing Storage Tests
+// =============================================================================
+
+class TensorApiMappedTest : public TensorApiInternalTest {
+protected:
+  void SetUp() override {
+    TensorApiInternalTest::SetUp();
+    path_ = (std::filesystem::temp_directory_path() /
+             ("orteaf_tensor_mapped_" +
+              std::string(::testing::UnitTest::GetInstance()
+                              ->current_test_info()
+                              ->name()) +
+              ".bin"))
+                .string();
+    values_.resize(32);
+    std::iota(values_.begin(), values_.end(), 0.0f);
+    std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(values_.data()),
+              static_cast<std::streamsize>(values_.size() * sizeof(float)));
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(path_);
+    TensorApiInternalTest::TearDown();
+  }
+
+  std::string path_;
+  std::vector<float> values_;
+};
+
+TEST_F(TensorApiMappedTest, FromStorageSlicesMappedFileWithoutCopy) {
+  using TensorApi = tensor_api::TensorApi;
+  auto file = TensorApi::MappedFile::open(path_);
+  auto storage = TensorApi::mapStorage(file, 0, DType::F32, values_.size());
+
+  std::array<int64_t, 2> weight_shape{2, 3};
+  std::array<int64_t, 1> bias_shape{4};
+  auto weight = TensorApi::fromStorage(storage, weight_shape, 0);
+  auto bias = TensorApi::fromStorage(storage, bias_shape, 6);
+
+  const auto &weight_lease = std::get<1>(weight);
+  const auto &bias_lease = std::get<1>(bias);
+  EXPECT_EQ(weight_lease->numel(), 6);
+  EXPECT_EQ(bias_lease->offset(), 6);
+
+  const auto operand = orteaf::internal::kernel::cpu::makeCpuOperand(
+      bias_lease->storageLease(), bias_lease->layout().shapeView(),
+      bias_lease->layout().stridesView(), bias_lease->offset(),
+      orteaf::internal::kernel::Access::Read);
+  EXPECT_EQ(operand.data, file->data() + 6 * sizeof(float));
+  EXPECT_EQ(operand.as<const float>()[3], values_[9]);
+}
+
+TEST_F(TensorApiMappedTest, MappedStorageRejectsWrittenOperands) {
+  using TensorApi = tensor_api::TensorApi;
+  auto storage = TensorApi::mapStorage(TensorApi::MappedFile::open(path_), 0,
+                                       DType::F32, values_.size());
+  std::array<int64_t, 2> shape{2, 3};
+  auto tensor = TensorApi::fromStorage(storage, shape);
+  const auto &lease = std::get<1>(tensor);
+  for (const auto access : {orteaf::internal::kernel::Access::Write,
+                            orteaf::internal::kernel::Access::ReadWrite}) {
+    EXPECT_THROW(orteaf::internal::kernel::cpu::makeCpuOperand(
+                     lease->storageLease(), lease->layout().shapeView(),
+                     lease->layout().stridesView(), lease->offset(), access),
+                 std::system_error);
+  }
+}
+
+TEST_F(TensorApiMappedTest, ContiguousCopiesMappedViewToHeap) {
+  using TensorApi = tensor_api::TensorApi;
+  auto file = TensorApi::MappedFile::open(path_);
+  auto storage = TensorApi::mapStorage(file, 4 * sizeof(float), DType::F32, 6);
+
+  std::array<int64_t, 2> shape{2, 3};
+  std::array<std::size_t, 2> perm{1, 0};
+  auto transposed =
+      TensorApi::transpose(TensorApi::fromStorage(storage, shape), perm);
+  auto dense = TensorApi::contiguous(transposed);
+
+  const auto &lease = std::get<1>(dense);
+  ASSERT_NE(lease->storageLease()
+                .tryAs<orteaf::internal::storage::CpuStorageLease>(),
+            nullptr);
+  const auto operand = orteaf::internal::kernel::cpu::makeCpuOperand(
+      lease->storageLease(), lease->layout().shapeView(),
+      lease->layout().stridesView(), lease->offset(),
+      orteaf::internal::kernel::Access::Read);
+  const float expected[] = {4, 7, 5, 8, 6, 9};
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(operand.as<const float>()[i], expected[i]);
+  }
+}
+
+TEST_F(TensorApiMappedTest, FromStorageOutOfRangeThrows) {
+  using TensorApi = tensor_api::TensorApi;
+  auto storage = TensorApi::mapStorage(TensorApi::MappedFile::open(path_), 0,
+                                       DType::F32, 8);
+  std::array<int64_t, 2> shape{2, 4};
+  EXPECT_THROW(TensorApi::fromStorage(storage, shape, 1), std::system_error);
+  EXPECT_THROW(TensorApi::fromStorage(storage, shape, -1), std::system_error);
+  EXPECT_THROW(TensorApi::fromStorage({}, shape), std::system_error);
+}
+
 } // namespace
@@ -0,0 +1,135 @@
+#include "orteaf/internal/tensor/format/safetensors.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <orteaf/internal/execution/cpu/api/cpu_execution_api.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
+
+namespace format = orteaf::internal::tensor::format;
+namespace tensor_api = orteaf::internal::tensor::api;
+namespace cpu_api = orteaf::internal::execution::cpu::api;
+using DType = orteaf::internal::DType;
+
+namespace {
+
+class SafetensorsTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    cpu_api::CpuExecutionApi::ExecutionManager::Config cpu_config{};
+    cpu_api::CpuExecutionApi::configure(cpu_config);
+    tensor_api::TensorApi::configure({});
+
+    const std::string base =
+        (std::filesystem::temp_directory_path() /
+         ("orteaf_safetensors_" +
+          std::string(::testing::UnitTest::GetInstance()
+                          ->current_test_info()
+                          ->name())))
+            .string();
+    source_ = base + ".safetensors";
+    converted_ = base + ".owf";
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(source_);
+    std::filesystem::remove(converted_);
+    tensor_api::TensorApi::shutdown();
+    cpu_api::CpuExecutionApi::shutdown();
+  }
+
+  // Writes a file with "w" (F32 [2,2]) and "n" (I16 [3]) after a header
+  // padded to @p header_size bytes.
+  void writeSource(std::size_t header_size) {
+    std::string header =
+        R"({"__metadata__":{"format":"pt"},)"
+        R"("w":{"dtype":"F32","shape":[2,2],"data_offsets":[0,16]},)"
+        R"("n":{"dtype":"I16","shape":[3],"data_offsets":[16,22]}})";
+    header.resize(header_size, ' ');
+    const std::uint64_t size = header.size();
+    std::ofstream out(source_, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    out.write(reinterpret_cast<const char *>(w_), sizeof(w_));
+    out.write(reinterpret_cast<const char *>(n_), sizeof(n_));
+  }
+
+  static const std::byte *dataOf(const format::WeightFile::LeaseVariant &v) {
+    const auto &lease = std::get<1>(v);
+    return orteaf::internal::kernel::cpu::makeCpuOperand(
+               lease->storageLease(), lease->layout().shapeView(),
+               lease->layout().stridesView(), lease->offset(),
+               orteaf::internal::kernel::Access::Read)
+        .data;
+  }
+
+  std::string source_;
+  std::string converted_;
+  const float w_[4] = {1.5f, -2.0f, 3.25f, 4.0f};
+  const std::int16_t n_[3] = {-1, 2, 300};
+};
+
+} // namespace
+
+TEST_F(SafetensorsTest, OpensAlignedFileInPlace) {
+  writeSource(184);
+  auto file = format::openSafetensors(source_);
+
+  ASSERT_EQ(file.entries().size(), 2u);
+  EXPECT_EQ(file.entries()[0].name, "w");
+  const auto *n = file.find("n");
+  ASSERT_NE(n, nullptr);
+  EXPECT_EQ(n->dtype, DType::I16);
+  EXPECT_EQ(n->shape, (std::vector<std::int64_t>{3}));
+
+  auto w = file.load("w");
+  EXPECT_EQ(dataOf(w), file.mappedFile()->data() + 8 + 184);
+  EXPECT_EQ(std::memcmp(dataOf(w), w_, sizeof(w_)), 0);
+  EXPECT_EQ(std::memcmp(dataOf(file.load("n")), n_, sizeof(n_)), 0);
+}
+
+TEST_F(SafetensorsTest, MisalignedFileMustBeConverted) {
+  writeSource(185);
+  EXPECT_THROW(format::openSafetensors(source_), std::system_error);
+
+  format::convertSafetensors(source_, converted_);
+  auto file = format::WeightFile::open(converted_);
+  ASSERT_EQ(file.entries().size(), 2u);
+  for (const auto &entry : file.entries()) {
+    EXPECT_EQ(entry.byte_offset % 64, 0u);
+  }
+  EXPECT_EQ(std::memcmp(dataOf(file.load("w")), w_, sizeof(w_)), 0);
+  EXPECT_EQ(std::memcmp(dataOf(file.load("n")), n_, sizeof(n_)), 0);
+}
+
+TEST_F(SafetensorsTest, RejectsMalformedHeaders) {
+  const auto write = [&](const std::string &header) {
+    const std::uint64_t size = header.size();
+    std::ofstream out(source_, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+  };
+
+  write(R"({"w":{"dtype":"BF16","shape":[1],"data_offsets":[0,2]}})");
+  EXPECT_THROW(format::openSafetensors(source_), std::system_error);
+
+  write(R"({"w":{"dtype":"F32","shape":[1],"data_offsets":[0,4]}})");
+  EXPECT_THROW(format::openSafetensors(source_), std::system_error);
+
+  write(R"({"w":{"dtype":"F32","shape":[1])");
+  EXPECT_THROW(format::openSafetensors(source_), std::system_error);
+  write(R"({"w":{"dtype":"F32","shape":[18446744073709551616],)"
+        R"("data_offsets":[0,4]}})");
+  EXPECT_THROW(format::openSafetensors(source_), std::system_error);
+
+  // Deep nesting must fail cleanly rather than exhaust the stack.
+  write(R"({"__metadata__":)" + std::string(100000, '[') +
+        std::string(100000, ']') + "}");
+  EXPECT_THROW(format::openSafetensors(source_), std::system_error);
+}
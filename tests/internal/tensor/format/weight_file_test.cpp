@@ -0,0 +1,169 @@
+#include "orteaf/internal/tensor/format/weight_file.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <orteaf/internal/execution/cpu/api/cpu_execution_api.h>
+#include <orteaf/internal/kernel/cpu/cpu_operand.h>
+
+namespace format = orteaf::internal::tensor::format;
+namespace tensor_api = orteaf::internal::tensor::api;
+namespace cpu_api = orteaf::internal::execution::cpu::api;
+using DType = orteaf::internal::DType;
+
+namespace {
+
+class WeightFileTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    cpu_api::CpuExecutionApi::ExecutionManager::Config cpu_config{};
+    cpu_api::CpuExecutionApi::configure(cpu_config);
+    tensor_api::TensorApi::configure({});
+
+    path_ = (std::filesystem::temp_directory_path() /
+             ("orteaf_weights_" +
+              std::string(::testing::UnitTest::GetInstance()
+                              ->current_test_info()
+                              ->name()) +
+              ".owf"))
+                .string();
+    weight_.resize(12);
+    std::iota(weight_.begin(), weight_.end(), 1.0f);
+    bias_ = {7, -8, 9};
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(path_);
+    tensor_api::TensorApi::shutdown();
+    cpu_api::CpuExecutionApi::shutdown();
+  }
+
+  void writeModel() {
+    format::WeightFileWriter writer(path_);
+    writer.declare("layer.weight", DType::F32, weight_shape_);
+    writer.declare("layer.bias", DType::I32, bias_shape_, 4096);
+    // Chunks need not line up with tensor boundaries.
+    writer.append(weight_.data(), 5 * sizeof(float));
+    std::vector<std::byte> rest(7 * sizeof(float) + sizeof(bias_));
+    std::memcpy(rest.data(), weight_.data() + 5, 7 * sizeof(float));
+    std::memcpy(rest.data() + 7 * sizeof(float), bias_.data(), sizeof(bias_));
+    writer.append(rest.data(), rest.size());
+    writer.finish();
+  }
+
+  static const std::byte *dataOf(const format::WeightFile::LeaseVariant &v) {
+    const auto &lease = std::get<1>(v);
+    return orteaf::internal::kernel::cpu::makeCpuOperand(
+               lease->storageLease(), lease->layout().shapeView(),
+               lease->layout().stridesView(), lease->offset(),
+               orteaf::internal::kernel::Access::Read)
+        .data;
+  }
+
+  std::string path_;
+  std::array<std::int64_t, 2> weight_shape_{3, 4};
+  std::array<std::int64_t, 1> bias_shape_{3};
+  std::vector<float> weight_;
+  std::array<std::int32_t, 3> bias_{};
+};
+
+} // namespace
+
+TEST_F(WeightFileTest, RoundTripsIndex) {
+  writeModel();
+  auto file = format::WeightFile::open(path_);
+
+  ASSERT_EQ(file.entries().size(), 2u);
+  const auto *weight = file.find("layer.weight");
+  ASSERT_NE(weight, nullptr);
+  EXPECT_EQ(weight->dtype, DType::F32);
+  EXPECT_EQ(weight->shape, (std::vector<std::int64_t>{3, 4}));
+  EXPECT_EQ(weight->byte_size, 12 * sizeof(float));
+  EXPECT_EQ(weight->byte_offset % 64, 0u);
+
+  const auto *bias = file.find("layer.bias");
+  ASSERT_NE(bias, nullptr);
+  EXPECT_EQ(bias->dtype, DType::I32);
+  EXPECT_EQ(bias->alignment, 4096u);
+  EXPECT_EQ(bias->byte_offset % 4096, 0u);
+  EXPECT_EQ(file.find("missing"), nullptr);
+  EXPECT_EQ(std::filesystem::file_size(path_) % 64, 0u);
+}
+
+TEST_F(WeightFileTest, LoadViewsPayloadInPlace) {
+  writeModel();
+  auto file = format::WeightFile::open(path_);
+
+  auto weight = file.load("layer.weight");
+  const auto &lease = std::get<1>(weight);
+  EXPECT_EQ(lease->numel(), 12);
+  EXPECT_EQ(lease->dtype(), DType::F32);
+
+  const std::byte *data = dataOf(weight);
+  EXPECT_EQ(data, file.mappedFile()->data() +
+                      file.find("layer.weight")->byte_offset);
+  EXPECT_EQ(std::memcmp(data, weight_.data(), 12 * sizeof(float)), 0);
+
+  auto bias = file.load("layer.bias");
+  EXPECT_EQ(std::memcmp(dataOf(bias), bias_.data(), sizeof(bias_)), 0);
+}
+
+TEST_F(WeightFileTest, LoadedTensorOutlivesFile) {
+  writeModel();
+  format::WeightFile::LeaseVariant bias;
+  { bias = format::WeightFile::open(path_).load("layer.bias"); }
+  EXPECT_EQ(std::memcmp(dataOf(bias), bias_.data(), sizeof(bias_)), 0);
+}
+
+TEST_F(WeightFileTest, LoadUnknownNameThrows) {
+  writeModel();
+  auto file = format::WeightFile::open(path_);
+  EXPECT_THROW(file.load("missing"), std::system_error);
+}
+
+TEST_F(WeightFileTest, WriterRejectsMisuse) {
+  format::WeightFileWriter writer(path_);
+  writer.declare("a", DType::F32, bias_shape_);
+  EXPECT_THROW(writer.declare("a", DType::F32, bias_shape_),
+               std::system_error);
+  EXPECT_THROW(writer.declare("b", DType::F32, bias_shape_, 32),
+               std::system_error);
+  const std::array<std::int64_t, 2> huge{std::int64_t{1} << 62, 8};
+  EXPECT_THROW(writer.declare("huge", DType::F32, huge), std::system_error);
+
+  const float values[4] = {};
+  writer.append(values, sizeof(float));
+  EXPECT_THROW(writer.declare("c", DType::F32, bias_shape_),
+               std::system_error);
+  EXPECT_THROW(writer.finish(), std::system_error);
+  EXPECT_THROW(writer.append(values, sizeof(values)), std::system_error);
+}
+
+TEST_F(WeightFileTest, OpenRejectsTruncatedFile) {
+  writeModel();
+  std::filesystem::resize_file(path_, std::filesystem::file_size(path_) - 64);
+  EXPECT_THROW(format::WeightFile::open(path_), std::system_error);
+
+  std::ofstream(path_, std::ios::binary | std::ios::trunc) << "not weights";
+  EXPECT_THROW(format::WeightFile::open(path_), std::system_error);
+}
+
+TEST_F(WeightFileTest, OpenRejectsCountLargerThanIndex) {
+  writeModel();
+  {
+    // The tensor count follows the 8-byte magic and the u32 version.
+    std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+    const std::uint32_t count = 0xFFFFFFFFu;
+    file.seekp(12);
+    file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+  }
+  EXPECT_THROW(format::WeightFile::open(path_), std::system_error);
+}
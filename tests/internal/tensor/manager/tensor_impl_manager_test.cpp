@@ -2,13 +2,18 @@
 
 #include <orteaf/extension/tensor/dense_tensor_impl.h>
 #include <orteaf/internal/execution/cpu/api/cpu_execution_api.h>
+#include <orteaf/internal/execution/cpu/platform/cpu_slow_ops.h>
+#include <orteaf/internal/execution_context/cpu/current_context.h>
 #include <orteaf/internal/storage/registry/storage_types.h>
 #include <orteaf/internal/tensor/manager/tensor_impl_manager.h>
 #include <orteaf/internal/tensor/manager/tensor_impl_manager.inl>
 
 namespace {
 
+namespace cpu = orteaf::internal::execution::cpu;
 namespace cpu_api = orteaf::internal::execution::cpu::api;
+namespace cpu_context = orteaf::internal::execution_context::cpu;
+namespace cpu_platform = orteaf::internal::execution::cpu::platform;
 namespace storage_reg = orteaf::internal::storage::registry;
 using DenseTensorImpl = orteaf::extension::tensor::DenseTensorImpl;
 using DenseTensorImplManager =
@@ -225,6 +230,70 @@ TEST_F(TensorImplManagerTest, ViewsShareStorage) {
   EXPECT_EQ(original->storageSizeInBytes(), transposed->storageSizeInBytes());
 }
 
+// =============================================================================
+// Materialization Tests
+// =============================================================================
+
+float *dataOf(const DenseTensorImplManager::TensorImplLease &lease) {
+  using CpuStorageLease = orteaf::internal::storage::CpuStorageLease;
+  const auto *storage = lease->storageLease().tryAs<CpuStorageLease>();
+  return static_cast<float *>((*storage)->data()) + lease->offset();
+}
+
+TEST_F(TensorImplManagerTest, ContiguousReturnsSameLeaseWhenDense) {
+  std::array<int64_t, 2> shape{3, 4};
+  auto original = manager_.create(shape, DType::F32, Execution::Cpu);
+
+  auto dense = manager_.contiguous(original);
+  EXPECT_EQ(dense.operator->(), original.operator->());
+}
+
+TEST_F(TensorImplManagerTest, ContiguousCopiesTransposedView) {
+  std::array<int64_t, 2> shape{3, 4};
+  auto original = manager_.create(shape, DType::F32, Execution::Cpu);
+  for (int i = 0; i < 12; ++i) {
+    dataOf(original)[i] = static_cast<float>(i);
+  }
+
+  std::array<std::size_t, 2> perm{1, 0};
+  auto transposed = manager_.transpose(original, perm);
+  auto dense = manager_.contiguous(transposed);
+
+  ASSERT_TRUE(dense->isContiguous());
+  EXPECT_EQ(dense->shape()[0], 4);
+  EXPECT_EQ(dense->shape()[1], 3);
+  for (int r = 0; r < 4; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      EXPECT_EQ(dataOf(dense)[r * 3 + c], static_cast<float>(c * 4 + r));
+    }
+  }
+}
+
+TEST_F(TensorImplManagerTest, ReshapeCopiesOnlyWhenViewImpossible) {
+  std::array<int64_t, 2> shape{3, 4};
+  auto original = manager_.create(shape, DType::F32, Execution::Cpu);
+  for (int i = 0; i < 12; ++i) {
+    dataOf(original)[i] = static_cast<float>(i);
+  }
+  std::array<std::size_t, 2> perm{1, 0};
+  auto transposed = manager_.transpose(original, perm);
+
+  // [4, 3] -> [2, 2, 3] splits the outer dim: still a view.
+  std::array<int64_t, 3> split{2, 2, 3};
+  auto view = manager_.reshape(transposed, split);
+  EXPECT_EQ(dataOf(view), dataOf(original));
+
+  // Flattening a transpose needs a copy.
+  std::array<int64_t, 1> flat{12};
+  auto copied = manager_.reshape(transposed, flat);
+  EXPECT_NE(dataOf(copied), dataOf(original));
+  for (int r = 0; r < 4; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      EXPECT_EQ(dataOf(copied)[r * 3 + c], static_cast<float>(c * 4 + r));
+    }
+  }
+}
+
 // =============================================================================
 // Lifecycle Tests
 // =============================================================================
@@ -248,3 +317,87 @@ TEST_F(TensorImplManagerTest, IsConfigured) {
 }
 
 } // namespace
+
+// =============================================================================
+// NUMA Device Tests
+// =============================================================================
+
+namespace {
+
+// Reports two NUMA nodes and remembers where buffers were placed.
+struct TwoNodeSlowOps final : cpu_platform::CpuSlowOps {
+  int getDeviceCount() override { return 2; }
+  int numaNodeOf(cpu::CpuDeviceHandle device) override {
+    return static_cast<int>(device.index);
+  }
+  orteaf::internal::architecture::Architecture
+  detectArchitecture(cpu::CpuDeviceHandle device) override {
+    return impl.detectArchitecture(device);
+  }
+  void *allocBuffer(std::size_t size, std::size_t alignment) override {
+    return impl.allocBuffer(size, alignment);
+  }
+  void *allocBufferOnNode(std::size_t size, std::size_t alignment,
+                          int numa_node) override {
+    nodes.push_back(numa_node);
+    return impl.allocBuffer(size, alignment);
+  }
+  void deallocBuffer(void *ptr, std::size_t size) override {
+    impl.deallocBuffer(ptr, size);
+  }
+
+  cpu_platform::CpuSlowOpsImpl impl;
+  std::vector<int> nodes;
+};
+
+cpu::CpuDeviceHandle
+deviceOf(const DenseTensorImplManager::TensorImplLease &lease) {
+  const auto *storage =
+      lease->storageLease()
+          .tryAs<orteaf::internal::storage::CpuStorageLease>();
+  return storage != nullptr && *storage ? (*storage)->device()
+                                        : cpu::CpuDeviceHandle{};
+}
+
+} // namespace
+
+class TensorImplManagerNumaTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    ops_ = new TwoNodeSlowOps();
+    cpu_api::CpuExecutionApi::ExecutionManager::Config cpu_config{};
+    cpu_config.slow_ops = ops_;
+    cpu_api::CpuExecutionApi::configure(cpu_config);
+    storage_registry_.configure(StorageRegistry::Config{});
+    manager_.configure(DenseTensorImplManager::Config{}, storage_registry_);
+  }
+
+  void TearDown() override {
+    cpu_context::reset();
+    manager_.shutdown();
+    storage_registry_.shutdown();
+    cpu_api::CpuExecutionApi::shutdown();
+  }
+
+  TwoNodeSlowOps *ops_{nullptr};
+  StorageRegistry storage_registry_;
+  DenseTensorImplManager manager_;
+};
+
+TEST_F(TensorImplManagerNumaTest, StorageFollowsCurrentContextDevice) {
+  std::array<int64_t, 2> shape{3, 4};
+  auto on_default = manager_.create(shape, DType::F32, Execution::Cpu);
+  EXPECT_EQ(deviceOf(on_default), cpu::CpuDeviceHandle{0});
+
+  cpu_context::setCurrentContext(cpu_context::Context{cpu::CpuDeviceHandle{1}});
+  ops_->nodes.clear();
+  auto on_node1 = manager_.create(shape, DType::F32, Execution::Cpu);
+  EXPECT_EQ(deviceOf(on_node1), cpu::CpuDeviceHandle{1});
+  EXPECT_EQ(ops_->nodes, (std::vector<int>{1}));
+
+  // The dense copy of a view is placed on the current device as well.
+  std::array<std::size_t, 2> perm{1, 0};
+  auto dense = manager_.contiguous(manager_.transpose(on_node1, perm));
+  EXPECT_EQ(deviceOf(dense), cpu::CpuDeviceHandle{1});
+  EXPECT_EQ(ops_->nodes, (std::vector<int>{1, 1}));
+}
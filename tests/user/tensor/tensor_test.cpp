@@ -92,6 +92,32 @@ TEST_F(TensorApiTest, TensorReshape) {
   EXPECT_EQ(b.numel(), 12);
 }
 
+TEST_F(TensorApiTest, TensorReshapeAfterTranspose) {
+  std::array<int64_t, 2> shape{3, 4};
+  auto a = tensor::Tensor::dense(shape, DType::F32, Execution::Cpu);
+
+  std::array<std::size_t, 2> perm{1, 0};
+  auto t = a.transpose(perm);
+  EXPECT_FALSE(t.isContiguous());
+
+  std::array<int64_t, 1> flat{-1};
+  auto b = t.reshape(flat);
+  EXPECT_TRUE(b.isContiguous());
+  EXPECT_EQ(b.numel(), 12);
+}
+
+TEST_F(TensorApiTest, TensorContiguous) {
+  std::array<int64_t, 2> shape{3, 4};
+  auto a = tensor::Tensor::dense(shape, DType::F32, Execution::Cpu);
+  EXPECT_TRUE(a.contiguous().isContiguous());
+
+  std::array<std::size_t, 2> perm{1, 0};
+  auto b = a.transpose(perm).contiguous();
+  EXPECT_TRUE(b.isContiguous());
+  EXPECT_EQ(b.shape()[0], 4);
+  EXPECT_EQ(b.shape()[1], 3);
+}
+
 TEST_F(TensorApiTest, TensorSlice) {
   std::array<int64_t, 2> shape{6, 6};
   auto a = tensor::Tensor::dense(shape, DType::F32, Execution::Cpu);